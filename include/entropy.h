@@ -23,24 +23,42 @@
 #ifndef ENTROPY_H
 #define ENTROPY_H
 
+/* Marks the functions exported from the shared library - the library is
+ * built with all other symbols hidden. */
+#ifndef RANDOM_API
+#if defined(CC_GCC) || defined(CC_CLANG) || defined(__GNUC__)
+#define RANDOM_API	__attribute__((visibility("default")))
+#else
+#define RANDOM_API
+#endif
+#endif
+
 #define ENTROPY_FLAG_ONCE       0x01
 #define ENTROPY_FLAG_NO_PREV    0x02
 
 typedef int(ENTROPY_FUNC)(void *data, uint32_t *len, uint16_t *bits);
+typedef uint32_t(ENTROPY_BULK_FUNC)(void *data, uint32_t num, uint32_t *len,
+    uint16_t *bits);
 typedef struct entropy_meth_st
 {
     char *name;
     uint16_t flags;
     ENTROPY_FUNC *func;
+    /* Optional - gathers many samples per call. */
+    ENTROPY_BULK_FUNC *bulk;
 } ENTROPY_METH;
 
-extern ENTROPY_METH ENTROPY_METH_defaults[];
+extern RANDOM_API ENTROPY_METH ENTROPY_METH_defaults[];
 
-int ENTROPY_METH_rdrand(void *rd, uint32_t *len, uint16_t *bits);
-int ENTROPY_METH_rdtsc(void *rd, uint32_t *len, uint16_t *bits);
-int ENTROPY_METH_dev_random(void *rd, uint32_t *len, uint16_t *bits);
-int ENTROPY_METH_time(void *rd, uint32_t *len, uint16_t *bits);
-int ENTROPY_generate(ENTROPY_METH *meth, uint16_t bits, void *data,
+RANDOM_API int ENTROPY_METH_rdrand(void *rd, uint32_t *len, uint16_t *bits);
+RANDOM_API int ENTROPY_METH_rdtsc(void *rd, uint32_t *len, uint16_t *bits);
+RANDOM_API int ENTROPY_METH_dev_random(void *rd, uint32_t *len, uint16_t *bits);
+RANDOM_API int ENTROPY_METH_time(void *rd, uint32_t *len, uint16_t *bits);
+RANDOM_API uint32_t ENTROPY_METH_rdrand_bulk(void *rd, uint32_t num,
+    uint32_t *len, uint16_t *bits);
+RANDOM_API uint32_t ENTROPY_METH_dev_random_bulk(void *rd, uint32_t num,
+    uint32_t *len, uint16_t *bits);
+RANDOM_API int ENTROPY_generate(ENTROPY_METH *meth, uint16_t bits, void *data,
     uint16_t *olen);
 
 #endif
@@ -20,17 +20,44 @@
  * SOFTWARE.
  */
 
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <stddef.h>
 #include <stdint.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+/* Marks the functions exported from the shared library - the library is
+ * built with all other symbols hidden. */
+#ifndef RANDOM_API
+#if defined(CC_GCC) || defined(CC_CLANG) || defined(__GNUC__)
+#define RANDOM_API	__attribute__((visibility("default")))
+#else
+#define RANDOM_API
+#endif
+#endif
+
 #include "entropy.h"
 
 #define RANDOM_ERR_NOT_FOUND		1
 #define RANDOM_ERR_PARAM_NULL		12
+#define RANDOM_ERR_PARAM_RANGE		13
 #define RANDOM_ERR_ALLOC		20
 #define RANDOM_ERR_TIME			21
 #define RANDOM_ERR_ENTROPY		30
 #define RANDOM_ERR_RESEED		31
+#define RANDOM_ERR_SVC			40
+#define RANDOM_ERR_WRITE		41
 
 #define RANDOM_METH_FLAG_SMALL		0x01
+/** Choose the fastest implementation by measured throughput. */
+#define RANDOM_METH_FLAG_TUNED		0x8000
+
+#define RANDOM_FLOAT_DENSE		0x01
+
+/** The default name of the shared memory of the random byte service. */
+#define RANDOM_SVC_NAME			"/random_svc"
 
 #define RANDOM_ID_HASH_DRBG_SHA1	1
 #define RANDOM_ID_HASH_DRBG_SHA224	2
@@ -41,18 +68,97 @@
 #define RANDOM_ID_HASH_DRBG_SHA512_256	7
 
 typedef struct random_st RANDOM;
+typedef struct random_shared_st RANDOM_SHARED;
+typedef struct random_svc_st RANDOM_SVC;
+
+/**
+ * Statistics of a random number generator object.
+ * The phase cycle counts are only accumulated when built with
+ * RANDOM_STATS_CYCLES defined and are 0 otherwise.
+ */
+typedef struct random_stats_st
+{
+    /** The number of successful initializations. */
+    uint64_t inits;
+    /** The number of successful reseeds - requested and automatic. */
+    uint64_t reseeds;
+    /** The number of reseeds forced by the generator's reseed counter. */
+    uint64_t auto_reseeds;
+    /** The number of generate calls. */
+    uint64_t generates;
+    /** The number of bytes generated. */
+    uint64_t bytes;
+    /** The number of refills of the buffer used for small draws. */
+    uint64_t buf_fills;
+    /** The number of bytes of entropy gathered. */
+    uint64_t entropy_bytes;
+    /** The number of times gathering entropy failed. */
+    uint64_t entropy_fails;
+    /** Cycles spent gathering entropy. */
+    uint64_t entropy_cycles;
+    /** Cycles spent deriving state from seed material (Hash_df). */
+    uint64_t df_cycles;
+    /** Cycles spent generating output (hashgen). */
+    uint64_t gen_cycles;
+    /** Cycles spent updating the state after generating. */
+    uint64_t update_cycles;
+} RANDOM_STATS;
 
-int RANDOM_new(ENTROPY_METH *src, uint16_t bits, uint16_t flags,
+RANDOM_API int RANDOM_new(ENTROPY_METH *src, uint16_t bits, uint16_t flags,
     RANDOM **random);
-int RANDOM_new_by_id(ENTROPY_METH *src, int id, uint16_t flags,
+RANDOM_API int RANDOM_new_by_id(ENTROPY_METH *src, int id, uint16_t flags,
     RANDOM **random);
-void RANDOM_free(RANDOM *random);
+RANDOM_API void RANDOM_free(RANDOM *random);
+RANDOM_API int RANDOM_tune(const char *file);
+
+RANDOM_API int RANDOM_get_impl_name(RANDOM *random, char **name);
+RANDOM_API int RANDOM_get_stats(RANDOM *random, RANDOM_STATS *stats);
+
+RANDOM_API int RANDOM_init(RANDOM *random, void *data, uint32_t len);
+RANDOM_API int RANDOM_seed(RANDOM *random, void *data, uint32_t len);
+RANDOM_API int RANDOM_init_with_entropy(RANDOM *random, void *entropy,
+    uint32_t elen, void *data, uint32_t len);
+RANDOM_API int RANDOM_seed_with_entropy(RANDOM *random, void *entropy,
+    uint32_t elen, void *data, uint32_t len);
+RANDOM_API int RANDOM_generate(RANDOM *random, void *data, uint32_t len);
+RANDOM_API int RANDOM_generate_with_input(RANDOM *random, void *ainput,
+    uint32_t alen, void *data, uint32_t len);
+RANDOM_API int RANDOM_generatev(RANDOM *random, const struct iovec *iov,
+    int cnt);
+RANDOM_API int RANDOM_fill_fd(RANDOM *random, int fd, off_t offset,
+    uint64_t length);
+
+
+RANDOM_API int RANDOM_uniform_u32(RANDOM *random, uint32_t bound, uint32_t *r);
+RANDOM_API int RANDOM_uniform_u64(RANDOM *random, uint64_t bound, uint64_t *r);
+RANDOM_API int RANDOM_uniform_u32_array(RANDOM *random, uint32_t bound,
+    uint32_t *r, uint32_t num);
+RANDOM_API int RANDOM_uniform_u64_array(RANDOM *random, uint64_t bound,
+    uint64_t *r, uint32_t num);
+
+RANDOM_API int RANDOM_fill_double(RANDOM *random, double *r, uint32_t num,
+    uint16_t flags);
+RANDOM_API int RANDOM_fill_float(RANDOM *random, float *r, uint32_t num,
+    uint16_t flags);
+
+RANDOM_API int RANDOM_shuffle(RANDOM *random, void *base, size_t n,
+    size_t size);
+RANDOM_API int RANDOM_sample_indices(RANDOM *random, uint32_t n, uint32_t k,
+    uint32_t *idx);
+
+RANDOM_API int RANDOM_fill_normal(RANDOM *random, double *r, uint32_t num);
+RANDOM_API int RANDOM_fill_exponential(RANDOM *random, double *r, uint32_t num);
 
-int RANDOM_get_impl_name(RANDOM *random, char **name);
+RANDOM_API int RANDOM_SHARED_new(RANDOM *random, RANDOM_SHARED **shared);
+RANDOM_API void RANDOM_SHARED_free(RANDOM_SHARED *shared);
+RANDOM_API int RANDOM_SHARED_generate(RANDOM_SHARED *shared, void *data,
+    uint32_t len);
 
-int RANDOM_init(RANDOM *random, void *data, uint32_t len);
-int RANDOM_seed(RANDOM *random, void *data, uint32_t len);
-int RANDOM_generate(RANDOM *random, void *data, uint32_t len);
-int RANDOM_generate_with_input(RANDOM *random, void *ainput, uint32_t alen,
-    void *data, uint32_t len);
+RANDOM_API int RANDOM_SVC_new(const char *name, RANDOM_SVC **svc);
+RANDOM_API void RANDOM_SVC_free(RANDOM_SVC *svc);
+RANDOM_API int RANDOM_SVC_is_shared(RANDOM_SVC *svc);
+RANDOM_API int RANDOM_SVC_get_bytes(RANDOM_SVC *svc, uint64_t *shared,
+    uint64_t *local);
+RANDOM_API int RANDOM_SVC_generate(RANDOM_SVC *svc, void *data, uint32_t len);
 
+#endif
@@ -1,31 +1,102 @@
+EXE=t_entropy t_random t_hash_drbg
+TOOLS=randd randgen
+LIB=librandom.a
+SHLIB=librandom.so
+all: $(LIB) $(SHLIB) $(EXE) $(TOOLS)
 
-EXE=t_entropy t_random
-# t_hash_drbg
-all: $(EXE)
+RANDOM_OBJ=random.o entropy.o random_hash.o random_uniform.o \
+	random_float.o random_shuffle.o random_ziggurat.o random_shared.o \
+	random_svc.o random_fill.o random_sha.o random_tune.o $(HASH_OBJ)
 
-RANDOM_OBJ=random.o entropy.o random_hash.o $(HASH_OBJ)
+# Library objects are position independent and only export RANDOM_API.
+LIB_CFLAGS=-fPIC -fvisibility=hidden
+
+# Link-time optimization: make LTO=1
+ifeq ($(LTO),1)
+CFLAGS+=-flto
+LDFLAGS+=-flto
+AR=gcc-ar
+endif
+
+# Profile-guided optimization - see the pgo target.
+ifeq ($(PGO),gen)
+CFLAGS+=-fprofile-generate -fprofile-update=atomic
+LDFLAGS+=-fprofile-generate
+endif
+ifeq ($(PGO),use)
+CFLAGS+=-fprofile-use -fprofile-correction -Wno-missing-profile
+LDFLAGS+=-fprofile-use
+endif
 
 %.o: src/%.c src/*.h include/*.h
-	$(CC) -c $(CFLAGS) -o $@ $<
+	$(CC) -c $(CFLAGS) $(LIB_CFLAGS) -o $@ $<
+
+$(LIB): $(RANDOM_OBJ)
+	rm -f $@
+	$(AR) rcs $@ $^
+# The HASH library is linked by the application.
+$(SHLIB): $(RANDOM_OBJ)
+	$(CC) -shared $(LDFLAGS) -o $@ $^ $(MATH_LIB) $(THREAD_LIB) $(RT_LIB)
 
-t_entropy.o: test/t_entropy.c
+t_entropy.o: test/t_entropy.c test/t_perf.h
 	$(CC) -c $(CFLAGS) -Isrc -o $@ $<
-t_entropy: t_entropy.o $(RANDOM_OBJ)
-	$(CC) -o $@ $^ $(LIBS) $(MATH_LIB)
+t_entropy: t_entropy.o $(LIB)
+	$(CC) $(LDFLAGS) -o $@ $^ $(LIBS) $(MATH_LIB) $(THREAD_LIB) \
+	    $(BZ2_LIB) $(RT_LIB)
 
-t_random.o: test/t_random.c
+t_random.o: test/t_random.c test/t_perf.h
 	$(CC) -c $(CFLAGS) -Isrc -o $@ $<
-t_random: t_random.o $(RANDOM_OBJ)
-	$(CC) -o $@ $^ $(LIBS)
+t_random: t_random.o $(LIB)
+	$(CC) $(LDFLAGS) -o $@ $^ $(LIBS) $(MATH_LIB) $(THREAD_LIB) $(RT_LIB)
 
-#test/t_hash_drbg.c: test/vectors/gen_test.rb
-#	ruby test/vectors/gen_test.rb test/vectors/pr_false/Hash_DRBG.txt > test/t_hash_drbg.c
-#t_hash_drbg.o: test/t_hash_drbg.c
-#	$(CC) -c $(CFLAGS) -Isrc -o $@ $<
-#t_hash_drbg: t_hash_drbg.o $(RANDOM_OBJ)
-#	$(CC) -o $@ $^ $(LIBS)
+t_hash_drbg.o: test/t_hash_drbg.c test/hash_drbg_kat.h
+	$(CC) -c $(CFLAGS) -Isrc -o $@ $<
+t_hash_drbg: t_hash_drbg.o $(LIB)
+	$(CC) $(LDFLAGS) -o $@ $^ $(LIBS) $(MATH_LIB) $(THREAD_LIB) $(RT_LIB)
+
+randd.o: tools/randd.c src/random_svc.h include/random.h
+	$(CC) -c $(CFLAGS) -Isrc -o $@ $<
+randd: randd.o $(LIB)
+	$(CC) $(LDFLAGS) -o $@ $^ $(LIBS) $(MATH_LIB) $(THREAD_LIB) $(RT_LIB)
 
-clean:
+randgen.o: tools/randgen.c include/random.h
+	$(CC) -c $(CFLAGS) -o $@ $<
+randgen: randgen.o $(LIB)
+	$(CC) $(LDFLAGS) -o $@ $^ $(LIBS) $(MATH_LIB) $(THREAD_LIB) $(RT_LIB)
+
+# The Hash_DRBG is checked with and without the in-tree SHA implementations.
+test: $(EXE)
+	./t_hash_drbg
+	./t_hash_drbg -diff
+	RANDOM_NO_SHA_ACCEL=1 ./t_hash_drbg
+	RANDOM_NO_SHA_ACCEL=1 ./t_hash_drbg -diff
+	./t_random -dist
+	./t_entropy -check
+
+# Regenerate the committed known answer tests - needs ruby.
+kat:
+	ruby test/vectors/gen_test.rb test/vectors/pr_false/Hash_DRBG.txt \
+	    > test/hash_drbg_kat.h
+
+# Build instrumented, train on the benchmarks and rebuild with the profile.
+pgo:
+	$(MAKE) clean
+	$(MAKE) PGO=gen $(EXE) $(TOOLS)
+	./t_random -speed
+	./t_random -uniform
+	./t_random -svc -sha256
+	./randgen -bytes 256M -threads 2 > /dev/null
+	./t_hash_drbg -diff
+	./t_random -dist
+	./t_entropy -check
+	$(MAKE) clean-obj
+	$(MAKE) PGO=use
+
+clean-obj:
 	rm -f *.o
-	rm $(EXE)
+	rm -f $(LIB) $(SHLIB) $(EXE) $(TOOLS)
+
+clean: clean-obj
+	rm -f *.gcda
 
+.PHONY: all test kat pgo clean-obj clean
@@ -27,6 +27,7 @@
 #include <fcntl.h>
 #include <sys/time.h>
 #include "entropy.h"
+#include "random_usdt.h"
 
 #ifdef CPU_X86_64
 /** The number of times to retry the RDRAND instruction.  */
@@ -58,6 +59,42 @@ int ENTROPY_METH_rdrand(void *rd, uint32_t *len, uint16_t *bits)
     return set;
 }
 
+/**
+ * Get many samples of entropy from the RDRAND instruction on x86_64 Intel
+ * processors. Each sample is a 16-bit RDRAND as in ENTROPY_METH_rdrand().
+ * Stops at the first sample that fails after retries.
+ *
+ * @param [in]      rd    The buffer to put the entropy data into.
+ * @param [in]      num   The maximum number of samples to gather.
+ * @param [out]     len   The length of the entropy data.
+ * @param [in, out] bits  The number of entropy bits in data.
+ * @return  The number of samples gathered.
+ */
+uint32_t ENTROPY_METH_rdrand_bulk(void *rd, uint32_t num, uint32_t *len,
+    uint16_t *bits)
+{
+    uint16_t *r = rd;
+    uint32_t n;
+    uint8_t i;
+    uint8_t set = 1;
+
+    for (n=0; (n<num) && set; n++)
+    {
+        set = 0;
+        for (i=RDRAND_RETRY; (i>0) && !set; i--)
+        {
+            asm volatile ("rdrand %0\n\t"
+                          "setc %1"
+                          : "=r" (r[n]), "=r" (set));
+        }
+    }
+    if (!set)
+        n--;
+    *len = n * sizeof(uint16_t);
+    *bits += n * 9;
+    return n;
+}
+
 /**
  * Get the number of clock cycles on x86_64 Intel processors.
  *
@@ -120,6 +157,48 @@ int ENTROPY_METH_dev_random(void *data, uint32_t *len, uint16_t *bits)
 end:
     return (l == 0);
 }
+
+/**
+ * Get many samples of entropy from /dev/random on Unix OSes.
+ * The device is opened once for all samples. Reading is non-blocking as data
+ * may not be available - fewer samples than asked for may be returned.
+ *
+ * @param [in]      data  The buffer to put the entropy data into.
+ * @param [in]      num   The maximum number of samples to gather.
+ * @param [out]     len   The length of the entropy data.
+ * @param [in, out] bits  The number of entropy bits in data.
+ * @return  The number of samples gathered.
+ */
+uint32_t ENTROPY_METH_dev_random_bulk(void *data, uint32_t num, uint32_t *len,
+    uint16_t *bits)
+{
+    uint8_t *r = data;
+    uint32_t l = 0;
+    uint32_t n = 0;
+    int fd;
+    ssize_t rl;
+    int flags;
+
+    fd = open("/dev/random", O_RDONLY);
+    if (fd == -1) goto end;
+    flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+    do
+    {
+        rl = read(fd, r + l, num * sizeof(uint16_t) - l);
+        if (rl > 0)
+            l += rl;
+    }
+    while ((rl > 0) && (l < num * sizeof(uint16_t)));
+    close(fd);
+
+    /* Only whole samples. */
+    n = l / sizeof(uint16_t);
+    *bits += n * 12;
+end:
+    *len = n * sizeof(uint16_t);
+    return n;
+}
 #endif
 
 /**
@@ -152,20 +231,29 @@ end:
 ENTROPY_METH ENTROPY_METH_defaults[] =
 {
 #if defined(OS_LINUX) || defined(OS_MACOSX)
-    { "/dev/random", 0, &ENTROPY_METH_dev_random },
+    { "/dev/random", 0, &ENTROPY_METH_dev_random,
+      &ENTROPY_METH_dev_random_bulk },
 #endif
 #ifdef CPU_X86_64
-    { "Intel RDRAND", ENTROPY_FLAG_NO_PREV, &ENTROPY_METH_rdrand },
-    { "Intel RDTSC", 0, &ENTROPY_METH_rdtsc },
+    { "Intel RDRAND", ENTROPY_FLAG_NO_PREV, &ENTROPY_METH_rdrand,
+      &ENTROPY_METH_rdrand_bulk },
+    /* No bulk function - back-to-back reads of the cycle counter differ by
+     * little. One read per round keeps them spaced out by the other sources.
+     */
+    { "Intel RDTSC", 0, &ENTROPY_METH_rdtsc, NULL },
 #endif
-    { "usec Time", ENTROPY_FLAG_ONCE, &ENTROPY_METH_time },
-    { NULL, 0, NULL }
+    { "usec Time", ENTROPY_FLAG_ONCE, &ENTROPY_METH_time, NULL },
+    { NULL, 0, NULL, NULL }
 };
 
 /**
  * Generate entropy data.
  * The number of bytes generated will be no more than bits number of bytes.
  * That is, each source generates at least 1 bit per byte of entropy data.
+ * The first round takes one sample from each source. Later rounds take, from
+ * each source with a bulk function, as many samples as the rounds left would
+ * have - with less overhead per sample. Sources without a bulk function, such
+ * as timers whose samples must be spaced out, take one sample per round.
  *
  * @param [in]  meth  The methods that gather entropy.<br>
  *                    Use ENTROPY_METH_defaults() for good sources.
@@ -181,10 +269,15 @@ int ENTROPY_generate(ENTROPY_METH *meth, uint16_t bits, void *data,
     uint8_t i;
     uint8_t gathered = 1;
     uint16_t b = 0;
-    uint8_t l = 0;
+    uint16_t l = 0;
     uint8_t *p = data;
     uint32_t len;
     uint32_t once = 0;
+    uint32_t n = 1;
+    uint16_t rb;
+    int ok;
+
+    RANDOM_USDT1(entropy_entry, bits);
 
     /* Keep gathering entropy while more bits are required and a source
      * succeeded.
@@ -192,6 +285,7 @@ int ENTROPY_generate(ENTROPY_METH *meth, uint16_t bits, void *data,
     while ((b < bits) && gathered)
     {
         gathered = 0;
+        rb = b;
         /* Try each entrppy source. */
         for (i=0; meth[i].func != NULL; i++)
         {
@@ -210,7 +304,13 @@ int ENTROPY_generate(ENTROPY_METH *meth, uint16_t bits, void *data,
             /* Try source - may not be able to return entropy data at this
              * time.
              */
-            if ((*meth[i].func)(p, &len, &b))
+            RANDOM_USDT3(entropy_src_entry, i, meth[i].name, b);
+            if ((n > 1) && (meth[i].bulk != NULL))
+                ok = (*meth[i].bulk)(p, n, &len, &b) > 0;
+            else
+                ok = (*meth[i].func)(p, &len, &b);
+            RANDOM_USDT4(entropy_src_return, i, ok ? len : 0, b, ok);
+            if (ok)
             {
                 if (meth[i].flags & ENTROPY_FLAG_ONCE)
                     once |= 1 << i;
@@ -219,9 +319,17 @@ int ENTROPY_generate(ENTROPY_METH *meth, uint16_t bits, void *data,
                 l += len;
             }
         }
+
+        /* Bits from one sample of each source - take the samples of the
+         * remaining rounds at once.
+         */
+        rb = (b - rb) / n;
+        if ((b < bits) && (rb > 0))
+            n = (bits - b + rb - 1) / rb;
     }
 
     *olen = l;
+    RANDOM_USDT3(entropy_return, b, l, b >= bits);
     return (b >= bits);
 }
 
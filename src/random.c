@@ -24,6 +24,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "random_lcl.h"
+#include "random_usdt.h"
 #include "entropy.h"
 
 /** The implementations of random number generators. */
@@ -32,35 +33,44 @@ RANDOM_METH random_meth[] =
     { RANDOM_ID_HASH_DRBG_SHA1, "Hash_DRBG SHA1",
       128, 0, sizeof(RANDOM_HASH),
       &RANDOM_HASH_SHA1_init, &RANDOM_HASH_SHA1_final,
-      &RANDOM_HASH_SHA1_reseed, &RANDOM_HASH_SHA1_gen },
+      &RANDOM_HASH_SHA1_reseed, &RANDOM_HASH_SHA1_gen,
+      &RANDOM_HASH_SHA1_genv, &RANDOM_HASH_SHA1_stats },
     { RANDOM_ID_HASH_DRBG_SHA224, "Hash_DRBG SHA224",
       192, 0, sizeof(RANDOM_HASH),
       &RANDOM_HASH_SHA224_init, &RANDOM_HASH_SHA224_final,
-      &RANDOM_HASH_SHA224_reseed, &RANDOM_HASH_SHA224_gen },
+      &RANDOM_HASH_SHA224_reseed, &RANDOM_HASH_SHA224_gen,
+      &RANDOM_HASH_SHA224_genv, &RANDOM_HASH_SHA224_stats },
     { RANDOM_ID_HASH_DRBG_SHA512, "Hash_DRBG SHA512",
       256, 0, sizeof(RANDOM_HASH),
       &RANDOM_HASH_SHA512_init, &RANDOM_HASH_SHA512_final,
-      &RANDOM_HASH_SHA512_reseed, &RANDOM_HASH_SHA512_gen },
+      &RANDOM_HASH_SHA512_reseed, &RANDOM_HASH_SHA512_gen,
+      &RANDOM_HASH_SHA512_genv, &RANDOM_HASH_SHA512_stats },
     { RANDOM_ID_HASH_DRBG_SHA384, "Hash_DRBG SHA384",
       256, 0, sizeof(RANDOM_HASH),
       &RANDOM_HASH_SHA384_init, &RANDOM_HASH_SHA384_final,
-      &RANDOM_HASH_SHA384_reseed, &RANDOM_HASH_SHA384_gen },
+      &RANDOM_HASH_SHA384_reseed, &RANDOM_HASH_SHA384_gen,
+      &RANDOM_HASH_SHA384_genv, &RANDOM_HASH_SHA384_stats },
     { RANDOM_ID_HASH_DRBG_SHA256, "Hash_DRBG SHA256",
       256, 0, sizeof(RANDOM_HASH),
       &RANDOM_HASH_SHA256_init, &RANDOM_HASH_SHA256_final,
-      &RANDOM_HASH_SHA256_reseed, &RANDOM_HASH_SHA256_gen },
+      &RANDOM_HASH_SHA256_reseed, &RANDOM_HASH_SHA256_gen,
+      &RANDOM_HASH_SHA256_genv, &RANDOM_HASH_SHA256_stats },
     { RANDOM_ID_HASH_DRBG_SHA512_256, "Hash_DRBG SHA512_256",
       256, 0, sizeof(RANDOM_HASH),
       &RANDOM_HASH_SHA512_256_init, &RANDOM_HASH_SHA512_256_final,
-      &RANDOM_HASH_SHA512_256_reseed, &RANDOM_HASH_SHA512_256_gen },
+      &RANDOM_HASH_SHA512_256_reseed, &RANDOM_HASH_SHA512_256_gen,
+      &RANDOM_HASH_SHA512_256_genv, &RANDOM_HASH_SHA512_256_stats },
     { RANDOM_ID_HASH_DRBG_SHA512_224, "Hash_DRBG SHA512_224",
       192, 0, sizeof(RANDOM_HASH),
       &RANDOM_HASH_SHA512_224_init, &RANDOM_HASH_SHA512_224_final,
-      &RANDOM_HASH_SHA512_224_reseed, &RANDOM_HASH_SHA512_224_gen },
+      &RANDOM_HASH_SHA512_224_reseed, &RANDOM_HASH_SHA512_224_gen,
+      &RANDOM_HASH_SHA512_224_genv, &RANDOM_HASH_SHA512_224_stats },
 };
 
 /** The number of random number generator implementations.  */
 #define RANDOM_METH_NUM	((uint8_t)(sizeof(random_meth)/sizeof(*random_meth)))
+/** The number of random number generator implementations.  */
+const uint8_t random_meth_num = RANDOM_METH_NUM;
 
 /**
  * Retrieves a random number generator implementation that meets requirements.
@@ -151,7 +161,8 @@ static int random_new(ENTROPY_METH *src, RANDOM_METH *meth, RANDOM **random)
 
     rand->ctx = malloc(meth->ctx_size);
     rand->entropy = malloc(meth->bits * 32/8);
-    if ((rand->ctx == NULL) || (rand->entropy == NULL))
+    rand->buf = malloc(RANDOM_BUF_SIZE);
+    if ((rand->ctx == NULL) || (rand->entropy == NULL) || (rand->buf == NULL))
     {
         ret = RANDOM_ERR_ALLOC;
         goto end;
@@ -168,6 +179,9 @@ end:
 
 /**
  * Creates a random object with the entropy sources based on the requirements.
+ * With RANDOM_METH_FLAG_TUNED the fastest implementation on this machine that
+ * meets the requirements is used - see RANDOM_tune() - otherwise the first in
+ * a fixed order.
  *
  * @param [in]  src     The entropy source methods.
  * @param [in]  bits    The number of bits of security required.
@@ -191,7 +205,13 @@ int RANDOM_new(ENTROPY_METH *src, uint16_t bits, uint16_t flags,
         goto end;
     }
 
-    ret = random_meth_get(bits, flags, &meth);
+    if (flags & RANDOM_METH_FLAG_TUNED)
+    {
+        ret = random_tune_meth_get(bits, flags & ~RANDOM_METH_FLAG_TUNED,
+            &meth);
+    }
+    else
+        ret = random_meth_get(bits, flags, &meth);
     if (ret != 0) goto end;
 
     ret = random_new(src, meth, random);
@@ -224,7 +244,7 @@ int RANDOM_new_by_id(ENTROPY_METH *src, int id, uint16_t flags,
         goto end;
     }
 
-    ret = random_meth_get_by_id(id, flags, &meth);
+    ret = random_meth_get_by_id(id, flags & ~RANDOM_METH_FLAG_TUNED, &meth);
     if (ret != 0) goto end;
 
     ret = random_new(src, meth, random);
@@ -243,6 +263,11 @@ void RANDOM_free(RANDOM *random)
     if (random != NULL)
     {
         random->meth->fin(random->ctx);
+        if (random->buf != NULL)
+        {
+            memset(random->buf, 0, RANDOM_BUF_SIZE);
+            free(random->buf);
+        }
         if (random->entropy != NULL) free(random->entropy);
         if (random->ctx != NULL) free(random->ctx);
         free(random);
@@ -272,6 +297,46 @@ end:
     return ret;
 }
 
+/**
+ * Retrieves the statistics of the random number generator object.
+ * The counters are cumulative from the creation of the object. The phase
+ * cycle counts are only accumulated when built with RANDOM_STATS_CYCLES
+ * defined.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [out] stats   The statistics of the object.
+ * @return  RANDOM_ERR_PARAM_NULL when a parameter is NULL.<br>
+ *          0 otherwise.
+ */
+int RANDOM_get_stats(RANDOM *random, RANDOM_STATS *stats)
+{
+    int ret = 0;
+
+    if ((random == NULL) || (stats == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+
+    *stats = random->stats;
+    if (random->meth->stats != NULL)
+        random->meth->stats(random->ctx, stats);
+end:
+    return ret;
+}
+
+/**
+ * Discards the generated data held in the buffer for small draws.
+ * Data generated before a reseed must not be returned after it.
+ *
+ * @param [in] random  A random number generator object.
+ */
+static void random_buf_clear(RANDOM *random)
+{
+    memset(random->buf, 0, RANDOM_BUF_SIZE);
+    random->buf_len = 0;
+}
+
 /**
  * Initialize the random number generator object for generating data.
  *
@@ -285,25 +350,37 @@ end:
 int RANDOM_init(RANDOM *random, void *data, uint32_t len)
 {
     int ret = 0;
-    uint16_t elen;
+    uint16_t elen = 0;
 
     if (random == NULL)
     {
         ret = RANDOM_ERR_PARAM_NULL;
         goto end;
     }
+    RANDOM_USDT2(init_entry, random->meth->id, len);
 
     /* Include the nonce in the entropy data. */
+    RANDOM_CYCLES_START(start);
     if (!ENTROPY_generate(random->entropy_src, random->meth->bits * 1.5,
         random->entropy, &elen))
     {
+        random->stats.entropy_fails++;
         ret = RANDOM_ERR_ENTROPY;
         goto end;
     }
+    RANDOM_CYCLES_ADD(random->stats.entropy_cycles, start);
+    random->stats.entropy_bytes += elen;
 
     ret = random->meth->init(random->ctx, random->entropy, elen, data, len);
     memset(random->entropy, 0, elen);
+    random_buf_clear(random);
+    if (ret == 0)
+    {
+        random->stats.inits++;
+    }
 end:
+    RANDOM_USDT3(init_return, (random != NULL) ? random->meth->id : 0, elen,
+        ret);
     return ret;
 }
 
@@ -320,23 +397,105 @@ end:
 int RANDOM_seed(RANDOM *random, void *data, uint32_t len)
 {
     int ret = 0;
-    uint16_t elen;
+    uint16_t elen = 0;
 
     if (random == NULL)
     {
         ret = RANDOM_ERR_PARAM_NULL;
         goto end;
     }
+    RANDOM_USDT2(seed_entry, random->meth->id, len);
 
+    RANDOM_CYCLES_START(start);
     if (!ENTROPY_generate(random->entropy_src, random->meth->bits,
         random->entropy, &elen))
     {
+        random->stats.entropy_fails++;
         ret = RANDOM_ERR_ENTROPY;
         goto end;
     }
+    RANDOM_CYCLES_ADD(random->stats.entropy_cycles, start);
+    random->stats.entropy_bytes += elen;
 
     ret = random->meth->reseed(random->ctx, random->entropy, elen, data, len);
     memset(random->entropy, 0, elen);
+    random_buf_clear(random);
+    if (ret == 0)
+    {
+        random->stats.reseeds++;
+    }
+end:
+    RANDOM_USDT3(seed_return, (random != NULL) ? random->meth->id : 0, elen,
+        ret);
+    return ret;
+}
+
+/**
+ * Initialize the random number generator object with entropy data supplied by
+ * the caller rather than gathered from the entropy sources.
+ * Used for known-answer testing and reproducible streams. The generated data
+ * is only as unpredictable as the entropy data supplied.
+ *
+ * @param [in] random   A random number generator object.
+ * @param [in] entropy  The entropy data including the nonce.
+ * @param [in] elen     The length of the entropy data.
+ * @param [in] data     User data to initialize with.
+ * @param [in] len      The length of the user data.
+ * @return  RANDOM_ERR_PARAM_NULL when random or entropy is NULL.<br>
+ *          0 otherwise.
+ */
+int RANDOM_init_with_entropy(RANDOM *random, void *entropy, uint32_t elen,
+    void *data, uint32_t len)
+{
+    int ret = 0;
+
+    if ((random == NULL) || (entropy == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+
+    ret = random->meth->init(random->ctx, entropy, elen, data, len);
+    random_buf_clear(random);
+    if (ret == 0)
+    {
+        random->stats.inits++;
+    }
+end:
+    return ret;
+}
+
+/**
+ * Seed the random number generator object with entropy data supplied by the
+ * caller rather than gathered from the entropy sources.
+ * Used for known-answer testing and reproducible streams. The generated data
+ * is only as unpredictable as the entropy data supplied.
+ *
+ * @param [in] random   A random number generator object.
+ * @param [in] entropy  The entropy data.
+ * @param [in] elen     The length of the entropy data.
+ * @param [in] data     User data to seed with.
+ * @param [in] len      The length of the user data.
+ * @return  RANDOM_ERR_PARAM_NULL when random or entropy is NULL.<br>
+ *          0 otherwise.
+ */
+int RANDOM_seed_with_entropy(RANDOM *random, void *entropy, uint32_t elen,
+    void *data, uint32_t len)
+{
+    int ret = 0;
+
+    if ((random == NULL) || (entropy == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+
+    ret = random->meth->reseed(random->ctx, entropy, elen, data, len);
+    random_buf_clear(random);
+    if (ret == 0)
+    {
+        random->stats.reseeds++;
+    }
 end:
     return ret;
 }
@@ -364,19 +523,27 @@ int RANDOM_generate_with_input(RANDOM *random, void *ainput, uint32_t alen,
         ret = RANDOM_ERR_PARAM_NULL;
         goto end;
     }
+    RANDOM_USDT3(generate_entry, random->meth->id, len, alen);
 
+    random->stats.generates++;
     while (len > 0)
     {
         ret = random->meth->gen(random->ctx, ainput, alen, data, len, &olen);
         if (ret == RANDOM_ERR_RESEED)
+        {
+            random->stats.auto_reseeds++;
             ret = RANDOM_seed(random, NULL, 0);
+        }
         if (ret != 0)
             goto end;
 
-        data += len;
+        data += olen;
         len -= olen;
+        random->stats.bytes += olen;
     }
 end:
+    RANDOM_USDT2(generate_return, (random != NULL) ? random->meth->id : 0,
+        ret);
     return ret;
 }
 
@@ -395,3 +562,122 @@ int RANDOM_generate(RANDOM *random, void *data, uint32_t len)
     return RANDOM_generate_with_input(random, NULL, 0, data, len);
 }
 
+/**
+ * Generate random data into a number of segments.
+ * The segments are filled from one stream, the same data as one generate of
+ * their total length, and the state is updated once per request rather than
+ * once per segment.
+ *
+ * @param [in] random  A random number generator object.
+ * @param [in] iov     The segments for the generated data.
+ * @param [in] cnt     The number of segments.
+ * @return  RANDOM_ERR_PARAM_NULL when random, iov or a segment is NULL.<br>
+ *          RANDOM_ERR_PARAM_RANGE when cnt is negative.<br>
+ *          RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int RANDOM_generatev(RANDOM *random, const struct iovec *iov, int cnt)
+{
+    int ret = 0;
+    int i;
+    size_t len = 0, off = 0;
+    uint32_t olen;
+
+    if ((random == NULL) || ((iov == NULL) && (cnt > 0)))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+    if (cnt < 0)
+    {
+        ret = RANDOM_ERR_PARAM_RANGE;
+        goto end;
+    }
+    for (i=0; i<cnt; i++)
+    {
+        if ((iov[i].iov_base == NULL) && (iov[i].iov_len > 0))
+        {
+            ret = RANDOM_ERR_PARAM_NULL;
+            goto end;
+        }
+        len += iov[i].iov_len;
+    }
+    RANDOM_USDT3(generate_entry, random->meth->id, len, 0);
+
+    random->stats.generates++;
+    while (off < len)
+    {
+        olen = (len - off > 0xffffffff) ? 0xffffffff : len - off;
+        ret = random->meth->genv(random->ctx, NULL, 0, iov, cnt, off, olen,
+            &olen);
+        if (ret == RANDOM_ERR_RESEED)
+        {
+            random->stats.auto_reseeds++;
+            ret = RANDOM_seed(random, NULL, 0);
+        }
+        if (ret != 0)
+            goto end;
+
+        off += olen;
+        random->stats.bytes += olen;
+    }
+end:
+    RANDOM_USDT2(generate_return, (random != NULL) ? random->meth->id : 0,
+        ret);
+    return ret;
+}
+
+
+/**
+ * Refill the buffer of generated data used for small draws.
+ * Any unused data in the buffer is discarded.
+ *
+ * @param [in] random  A random number generator object.
+ * @return  RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int random_buf_fill(RANDOM *random)
+{
+    int ret;
+
+    ret = RANDOM_generate(random, random->buf, RANDOM_BUF_SIZE);
+    if (ret != 0) goto end;
+
+    random->buf_len = RANDOM_BUF_SIZE;
+    random->stats.buf_fills++;
+end:
+    return ret;
+}
+
+/**
+ * Retrieves generated data for a draw.
+ * Small amounts are taken from the buffer of generated data and large amounts
+ * are generated directly into the data.
+ *
+ * @param [in] random  A random number generator object.
+ * @param [in] data    The buffer to hold the generated data.
+ * @param [in] len     The length of the data to retrieve.
+ * @return  RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int random_buf_get(RANDOM *random, void *data, uint32_t len)
+{
+    int ret = 0;
+
+    if (len >= RANDOM_BUF_SIZE)
+    {
+        ret = RANDOM_generate(random, data, len);
+        goto end;
+    }
+
+    if (random->buf_len < len)
+    {
+        ret = random_buf_fill(random);
+        if (ret != 0) goto end;
+    }
+
+    memcpy(data, random->buf + RANDOM_BUF_SIZE - random->buf_len, len);
+    random->buf_len -= len;
+end:
+    return ret;
+}
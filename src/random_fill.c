@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2016 Sean Parkinson (sparkinson@iprimus.com.au)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* This code implements filling a file with random data.
+ * The calling thread generates into one of a few I/O buffers while a writer
+ * thread writes the others, so generating and writing overlap. Data is
+ * generated a chunk at a time into a small buffer that stays in the cache and
+ * copied to the I/O buffer with non-temporal stores - large fills don't evict
+ * the rest of the cache.
+ */
+
+#ifdef OS_LINUX
+#define _GNU_SOURCE
+#endif
+#include <stdint.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "random_lcl.h"
+#if defined(CPU_X86_64) && (defined(CC_GCC) || defined(CC_CLANG))
+#include <emmintrin.h>
+#define RANDOM_FILL_STREAM
+#endif
+
+#ifndef O_DIRECT
+#define O_DIRECT	0
+#endif
+
+/** The size of an I/O buffer. */
+#define RANDOM_FILL_BUF_SIZE		(1 << 20)
+/** The number of I/O buffers - one generating and two writing. */
+#define RANDOM_FILL_BUFS		3
+/** The alignment of buffers, offsets and lengths for O_DIRECT. */
+#define RANDOM_FILL_ALIGN		4096
+
+/** The state shared by the generating thread and the writer thread. */
+typedef struct random_fill_st
+{
+    /** The file descriptor to write to. */
+    int fd;
+    /** The file status flags when O_DIRECT is set and 0 otherwise. */
+    int direct;
+    /** The I/O buffers. */
+    uint8_t *buf[RANDOM_FILL_BUFS];
+    /** The length of data in each I/O buffer. */
+    size_t len[RANDOM_FILL_BUFS];
+    /** The offset into the file to write each I/O buffer to. */
+    off_t off[RANDOM_FILL_BUFS];
+    /** The number of I/O buffers waiting to be written. */
+    int full;
+    /** The index of the next I/O buffer to write. */
+    int next;
+    /** Set when no more buffers will be filled. */
+    int done;
+    /** The result of writing. */
+    int ret;
+    /** Protects the counts of buffers. */
+    pthread_mutex_t lock;
+    /** Signaled when a buffer is filled or written. */
+    pthread_cond_t cond;
+} RANDOM_FILL;
+
+/**
+ * Copy data with non-temporal stores where available - the destination is not
+ * brought into the cache.
+ *
+ * @param [in] dst  The destination - aligned to 16 bytes.
+ * @param [in] src  The source.
+ * @param [in] len  The length of the data.
+ */
+static void fill_copy(uint8_t *dst, const uint8_t *src, size_t len)
+{
+#ifdef RANDOM_FILL_STREAM
+    size_t i;
+
+    for (i=0; i+16<=len; i+=16)
+    {
+        _mm_stream_si128((__m128i *)(dst + i),
+            _mm_loadu_si128((const __m128i *)(src + i)));
+    }
+    memcpy(dst + i, src + i, len - i);
+    _mm_sfence();
+#else
+    memcpy(dst, src, len);
+#endif
+}
+
+/**
+ * Write all of a buffer at an offset.
+ * With O_DIRECT, an unaligned tail is written with O_DIRECT turned off.
+ *
+ * @param [in] fill  The fill state.
+ * @param [in] data  The buffer.
+ * @param [in] len   The length of the buffer.
+ * @param [in] off   The offset into the file.
+ * @return  RANDOM_ERR_WRITE when writing fails.<br>
+ *          0 otherwise.
+ */
+static int fill_write(RANDOM_FILL *fill, uint8_t *data, size_t len, off_t off)
+{
+    ssize_t n;
+    size_t l;
+    int tail = 0;
+
+    while (len > 0)
+    {
+        l = len;
+        if (fill->direct && (l % RANDOM_FILL_ALIGN != 0))
+        {
+            l -= l % RANDOM_FILL_ALIGN;
+            if (l == 0)
+            {
+                if (fcntl(fill->fd, F_SETFL, fill->direct & ~O_DIRECT) != 0)
+                    return RANDOM_ERR_WRITE;
+                tail = 1;
+                l = len;
+            }
+        }
+
+        n = pwrite(fill->fd, data, l, off);
+        if ((n == -1) && (errno == EINTR))
+            continue;
+        if (n <= 0)
+            break;
+        data += n;
+        len -= n;
+        off += n;
+    }
+
+    if (tail)
+        fcntl(fill->fd, F_SETFL, fill->direct);
+    return (len == 0) ? 0 : RANDOM_ERR_WRITE;
+}
+
+/**
+ * Write the I/O buffers as they are filled until all are written or writing
+ * fails.
+ *
+ * @param [in] arg  The fill state.
+ * @return  NULL.
+ */
+static void *fill_writer(void *arg)
+{
+    RANDOM_FILL *fill = arg;
+    int i, ret;
+
+    pthread_mutex_lock(&fill->lock);
+    while (1)
+    {
+        while ((fill->full == 0) && !fill->done)
+            pthread_cond_wait(&fill->cond, &fill->lock);
+        if (fill->full == 0)
+            break;
+        i = fill->next;
+        pthread_mutex_unlock(&fill->lock);
+
+        ret = fill_write(fill, fill->buf[i], fill->len[i], fill->off[i]);
+
+        pthread_mutex_lock(&fill->lock);
+        fill->next = (i + 1) % RANDOM_FILL_BUFS;
+        fill->full--;
+        pthread_cond_signal(&fill->cond);
+        if (ret != 0)
+        {
+            fill->ret = ret;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&fill->lock);
+    return NULL;
+}
+
+/**
+ * Generate random data into an I/O buffer a chunk at a time.
+ *
+ * @param [in] random  A random number generator object.
+ * @param [in] stage   The buffer to generate a chunk into.
+ * @param [in] data    The I/O buffer.
+ * @param [in] len     The length of data to generate.
+ * @return  RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+static int fill_gen(RANDOM *random, uint8_t *stage, uint8_t *data, size_t len)
+{
+    int ret = 0;
+    size_t n;
+
+    for (; len > 0; data += n, len -= n)
+    {
+        n = (len < RANDOM_CHUNK_SIZE) ? len : RANDOM_CHUNK_SIZE;
+        ret = RANDOM_generate_with_input(random, NULL, 0, stage, n);
+        if (ret != 0) break;
+        fill_copy(data, stage, n);
+    }
+    return ret;
+}
+
+/**
+ * Fill a file with random data.
+ * The data written is the same as one generate of length bytes. Generating
+ * overlaps with writing when more than one I/O buffer of data is written.
+ * When the file was opened with O_DIRECT, the offset must be aligned to 4096
+ * bytes. An unaligned end is written without O_DIRECT.
+ *
+ * @param [in] random  A random number generator object.
+ * @param [in] fd      The file descriptor to write to.
+ * @param [in] offset  The offset into the file to write at.
+ * @param [in] length  The number of bytes to write.
+ * @return  RANDOM_ERR_PARAM_NULL when random is NULL.<br>
+ *          RANDOM_ERR_PARAM_RANGE when fd or offset is negative, or the
+ *          offset is not aligned for O_DIRECT.<br>
+ *          RANDOM_ERR_ALLOC on dynamic memory allocation failure.<br>
+ *          RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          RANDOM_ERR_WRITE when writing to the file fails.<br>
+ *          0 otherwise.
+ */
+int RANDOM_fill_fd(RANDOM *random, int fd, off_t offset, uint64_t length)
+{
+    int ret = 0;
+    RANDOM_FILL fill;
+    uint8_t *mem = NULL;
+    uint8_t *stage;
+    pthread_t thread;
+    int threaded = 0;
+    int flags, i;
+    size_t len;
+
+    if (random == NULL)
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+    flags = (fd < 0) ? -1 : fcntl(fd, F_GETFL);
+    if ((flags == -1) || (offset < 0))
+    {
+        ret = RANDOM_ERR_PARAM_RANGE;
+        goto end;
+    }
+    if (length == 0)
+        goto end;
+
+    memset(&fill, 0, sizeof(fill));
+    fill.fd = fd;
+    if ((O_DIRECT != 0) && ((flags & O_DIRECT) != 0))
+    {
+        if (offset % RANDOM_FILL_ALIGN != 0)
+        {
+            ret = RANDOM_ERR_PARAM_RANGE;
+            goto end;
+        }
+        fill.direct = flags;
+    }
+
+    if (posix_memalign((void **)&mem, RANDOM_FILL_ALIGN,
+        RANDOM_FILL_BUFS * RANDOM_FILL_BUF_SIZE + RANDOM_CHUNK_SIZE) != 0)
+    {
+        mem = NULL;
+        ret = RANDOM_ERR_ALLOC;
+        goto end;
+    }
+    for (i=0; i<RANDOM_FILL_BUFS; i++)
+        fill.buf[i] = mem + i * RANDOM_FILL_BUF_SIZE;
+    stage = mem + RANDOM_FILL_BUFS * RANDOM_FILL_BUF_SIZE;
+
+    /* Without a writer thread, the buffers are written in turn. */
+    pthread_mutex_init(&fill.lock, NULL);
+    pthread_cond_init(&fill.cond, NULL);
+    if (length > RANDOM_FILL_BUF_SIZE)
+        threaded = (pthread_create(&thread, NULL, fill_writer, &fill) == 0);
+
+    for (i=0; length > 0; i=(i+1)%RANDOM_FILL_BUFS)
+    {
+        len = (length < RANDOM_FILL_BUF_SIZE) ? length : RANDOM_FILL_BUF_SIZE;
+
+        if (threaded)
+        {
+            pthread_mutex_lock(&fill.lock);
+            while ((fill.full == RANDOM_FILL_BUFS) && (fill.ret == 0))
+                pthread_cond_wait(&fill.cond, &fill.lock);
+            ret = fill.ret;
+            pthread_mutex_unlock(&fill.lock);
+            if (ret != 0) break;
+        }
+
+        ret = fill_gen(random, stage, fill.buf[i], len);
+        if (ret != 0) break;
+
+        if (threaded)
+        {
+            pthread_mutex_lock(&fill.lock);
+            fill.len[i] = len;
+            fill.off[i] = offset;
+            fill.full++;
+            pthread_cond_signal(&fill.cond);
+            pthread_mutex_unlock(&fill.lock);
+        }
+        else
+        {
+            ret = fill_write(&fill, fill.buf[i], len, offset);
+            if (ret != 0) break;
+        }
+        offset += len;
+        length -= len;
+    }
+
+    if (threaded)
+    {
+        pthread_mutex_lock(&fill.lock);
+        fill.done = 1;
+        pthread_cond_signal(&fill.cond);
+        pthread_mutex_unlock(&fill.lock);
+        pthread_join(thread, NULL);
+        if (ret == 0)
+            ret = fill.ret;
+    }
+    pthread_cond_destroy(&fill.cond);
+    pthread_mutex_destroy(&fill.lock);
+end:
+    free(mem);
+    return ret;
+}
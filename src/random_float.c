@@ -0,0 +1,463 @@
+/*
+ * Copyright (c) 2016 Sean Parkinson (sparkinson@iprimus.com.au)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* This code implements uniform floating-point random numbers in [0, 1).
+ * Standard values are multiples of 2^-53 (double) or 2^-24 (float).
+ * Dense values use all representable numbers in [0, 1) down to 2^-1022
+ * (double) or 2^-126 (float) with the probability of the interval they
+ * represent.
+ */
+
+#include <stdint.h>
+#include "random_lcl.h"
+
+#if defined(CPU_X86_64) && (defined(CC_GCC) || defined(CC_CLANG))
+#include <immintrin.h>
+/** Use SSE2 and AVX2 conversion kernels. */
+#define RANDOM_FLOAT_X86_64
+#endif
+
+/** The bits of 1.0 as a double. */
+#define DOUBLE_ONE		0x3ff0000000000000ULL
+/** The bits of 2^-53 as a double - half the precision of numbers in [1,2). */
+#define DOUBLE_HALF_ULP		0x3ca0000000000000ULL
+/** Mask of the mantissa bits of a double. */
+#define DOUBLE_MANT_MASK	0x000fffffffffffffULL
+/** The bits of 1.0 as a float. */
+#define FLOAT_ONE		0x3f800000
+/** The bits of 2^-24 as a float - half the precision of numbers in [1,2). */
+#define FLOAT_HALF_ULP		0x33800000
+/** Mask of the mantissa bits of a float. */
+#define FLOAT_MANT_MASK		0x007fffff
+
+/**
+ * Count the leading zero bits of a non-zero 64-bit number.
+ *
+ * @param [in] w  The non-zero number.
+ * @return  The number of leading zero bits.
+ */
+static inline int clz64(uint64_t w)
+{
+#if defined(CC_GCC) || defined(CC_CLANG)
+    return __builtin_clzll(w);
+#else
+    int n = 0;
+
+    for (; (w & (1ULL << 63)) == 0; w <<= 1)
+        n++;
+    return n;
+#endif
+}
+
+/**
+ * Convert random 64-bit words into doubles in [0, 1) in place.
+ * The top 52 bits of a word form the mantissa of a number in [1, 2) and the
+ * bottom bit adds half the precision after subtracting 1.
+ *
+ * @param [in, out] r    On in, random words. On out, doubles.
+ * @param [in]      num  The number of words to convert.
+ */
+static void words_to_double(double *r, uint32_t num)
+{
+    uint32_t i;
+    uint64_t w, m, h;
+    double d, e;
+
+    for (i=0; i<num; i++)
+    {
+        memcpy(&w, &r[i], sizeof(w));
+        m = (w >> 12) | DOUBLE_ONE;
+        h = (0 - (w & 1)) & DOUBLE_HALF_ULP;
+        memcpy(&d, &m, sizeof(d));
+        memcpy(&e, &h, sizeof(e));
+        r[i] = (d - 1.0) + e;
+    }
+}
+
+/**
+ * Convert random 32-bit words into floats in [0, 1) in place.
+ * The top 23 bits of a word form the mantissa of a number in [1, 2) and the
+ * bottom bit adds half the precision after subtracting 1.
+ *
+ * @param [in, out] r    On in, random words. On out, floats.
+ * @param [in]      num  The number of words to convert.
+ */
+static void words_to_float(float *r, uint32_t num)
+{
+    uint32_t i;
+    uint32_t w, m, h;
+    float d, e;
+
+    for (i=0; i<num; i++)
+    {
+        memcpy(&w, &r[i], sizeof(w));
+        m = (w >> 9) | FLOAT_ONE;
+        h = (0 - (w & 1)) & FLOAT_HALF_ULP;
+        memcpy(&d, &m, sizeof(d));
+        memcpy(&e, &h, sizeof(e));
+        r[i] = (d - 1.0f) + e;
+    }
+}
+
+#ifdef RANDOM_FLOAT_X86_64
+/**
+ * Convert random 64-bit words into doubles in [0, 1) in place using SSE2.
+ *
+ * @param [in, out] r    On in, random words. On out, doubles.
+ * @param [in]      num  The number of words to convert.
+ */
+static void words_to_double_sse2(double *r, uint32_t num)
+{
+    uint32_t i;
+    __m128i w, m, h;
+    const __m128i one = _mm_set1_epi64x(DOUBLE_ONE);
+    const __m128i half = _mm_set1_epi64x(DOUBLE_HALF_ULP);
+    const __m128i bit = _mm_set1_epi64x(1);
+    const __m128d oned = _mm_set1_pd(1.0);
+
+    for (i=0; i+2<=num; i+=2)
+    {
+        w = _mm_loadu_si128((__m128i *)&r[i]);
+        m = _mm_or_si128(_mm_srli_epi64(w, 12), one);
+        h = _mm_sub_epi64(_mm_setzero_si128(), _mm_and_si128(w, bit));
+        h = _mm_and_si128(h, half);
+        _mm_storeu_pd(&r[i], _mm_add_pd(
+            _mm_sub_pd(_mm_castsi128_pd(m), oned), _mm_castsi128_pd(h)));
+    }
+    words_to_double(r + i, num - i);
+}
+
+/**
+ * Convert random 32-bit words into floats in [0, 1) in place using SSE2.
+ *
+ * @param [in, out] r    On in, random words. On out, floats.
+ * @param [in]      num  The number of words to convert.
+ */
+static void words_to_float_sse2(float *r, uint32_t num)
+{
+    uint32_t i;
+    __m128i w, m, h;
+    const __m128i one = _mm_set1_epi32(FLOAT_ONE);
+    const __m128i half = _mm_set1_epi32(FLOAT_HALF_ULP);
+    const __m128i bit = _mm_set1_epi32(1);
+    const __m128 onef = _mm_set1_ps(1.0f);
+
+    for (i=0; i+4<=num; i+=4)
+    {
+        w = _mm_loadu_si128((__m128i *)&r[i]);
+        m = _mm_or_si128(_mm_srli_epi32(w, 9), one);
+        h = _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(w, bit));
+        h = _mm_and_si128(h, half);
+        _mm_storeu_ps(&r[i], _mm_add_ps(
+            _mm_sub_ps(_mm_castsi128_ps(m), onef), _mm_castsi128_ps(h)));
+    }
+    words_to_float(r + i, num - i);
+}
+
+/**
+ * Convert random 64-bit words into doubles in [0, 1) in place using AVX2.
+ *
+ * @param [in, out] r    On in, random words. On out, doubles.
+ * @param [in]      num  The number of words to convert.
+ */
+__attribute__((target("avx2")))
+static void words_to_double_avx2(double *r, uint32_t num)
+{
+    uint32_t i;
+    __m256i w, m, h;
+    const __m256i one = _mm256_set1_epi64x(DOUBLE_ONE);
+    const __m256i half = _mm256_set1_epi64x(DOUBLE_HALF_ULP);
+    const __m256i bit = _mm256_set1_epi64x(1);
+    const __m256d oned = _mm256_set1_pd(1.0);
+
+    for (i=0; i+4<=num; i+=4)
+    {
+        w = _mm256_loadu_si256((__m256i *)&r[i]);
+        m = _mm256_or_si256(_mm256_srli_epi64(w, 12), one);
+        h = _mm256_sub_epi64(_mm256_setzero_si256(), _mm256_and_si256(w, bit));
+        h = _mm256_and_si256(h, half);
+        _mm256_storeu_pd(&r[i], _mm256_add_pd(
+            _mm256_sub_pd(_mm256_castsi256_pd(m), oned),
+            _mm256_castsi256_pd(h)));
+    }
+    words_to_double(r + i, num - i);
+}
+
+/**
+ * Convert random 32-bit words into floats in [0, 1) in place using AVX2.
+ *
+ * @param [in, out] r    On in, random words. On out, floats.
+ * @param [in]      num  The number of words to convert.
+ */
+__attribute__((target("avx2")))
+static void words_to_float_avx2(float *r, uint32_t num)
+{
+    uint32_t i;
+    __m256i w, m, h;
+    const __m256i one = _mm256_set1_epi32(FLOAT_ONE);
+    const __m256i half = _mm256_set1_epi32(FLOAT_HALF_ULP);
+    const __m256i bit = _mm256_set1_epi32(1);
+    const __m256 onef = _mm256_set1_ps(1.0f);
+
+    for (i=0; i+8<=num; i+=8)
+    {
+        w = _mm256_loadu_si256((__m256i *)&r[i]);
+        m = _mm256_or_si256(_mm256_srli_epi32(w, 9), one);
+        h = _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_and_si256(w, bit));
+        h = _mm256_and_si256(h, half);
+        _mm256_storeu_ps(&r[i], _mm256_add_ps(
+            _mm256_sub_ps(_mm256_castsi256_ps(m), onef),
+            _mm256_castsi256_ps(h)));
+    }
+    words_to_float(r + i, num - i);
+}
+#endif
+
+/**
+ * Convert random 64-bit words into doubles in [0, 1) in place using the best
+ * kernel available on the CPU.
+ *
+ * @param [in, out] r    On in, random words. On out, doubles.
+ * @param [in]      num  The number of words to convert.
+ */
+static void fill_double(double *r, uint32_t num)
+{
+#ifdef RANDOM_FLOAT_X86_64
+    if (__builtin_cpu_supports("avx2"))
+        words_to_double_avx2(r, num);
+    else
+        words_to_double_sse2(r, num);
+#else
+    words_to_double(r, num);
+#endif
+}
+
+/**
+ * Convert random 32-bit words into floats in [0, 1) in place using the best
+ * kernel available on the CPU.
+ *
+ * @param [in, out] r    On in, random words. On out, floats.
+ * @param [in]      num  The number of words to convert.
+ */
+static void fill_float(float *r, uint32_t num)
+{
+#ifdef RANDOM_FLOAT_X86_64
+    if (__builtin_cpu_supports("avx2"))
+        words_to_float_avx2(r, num);
+    else
+        words_to_float_sse2(r, num);
+#else
+    words_to_float(r, num);
+#endif
+}
+
+/**
+ * Convert random 64-bit words into dense doubles in [0, 1) in place.
+ * The bottom 52 bits of a word are the mantissa and the leading zeros of the
+ * top 12 bits choose the exponent. More words are drawn from the buffer when
+ * the top bits are all zero.
+ *
+ * @param [in]      random  A random number generator object.
+ * @param [in, out] r       On in, random words. On out, doubles.
+ * @param [in]      num     The number of words to convert.
+ * @return  RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+static int fill_double_dense(RANDOM *random, double *r, uint32_t num)
+{
+    int ret = 0;
+    uint32_t i;
+    uint64_t w, g, e, z;
+
+    for (i=0; i<num; i++)
+    {
+        memcpy(&w, &r[i], sizeof(w));
+        e = 1022;
+        for (g = w >> 52; g == 0; g >>= 52)
+        {
+            /* Smaller than the smallest normal number - use zero. */
+            if (e <= 12)
+            {
+                e = 0;
+                w = 0;
+                break;
+            }
+            e -= 12;
+            ret = random_buf_u64(random, &g);
+            if (ret != 0) goto end;
+        }
+        /* Clamp at the subnormal boundary - e can be as small as 2 here and
+         * the last group may have up to 11 leading zeros. */
+        if (e > 0)
+        {
+            z = clz64(g) - 52;
+            e = (e > z) ? e - z : 0;
+        }
+
+        w = (e << 52) | (w & DOUBLE_MANT_MASK);
+        memcpy(&r[i], &w, sizeof(w));
+    }
+end:
+    return ret;
+}
+
+/**
+ * Convert random 32-bit words into dense floats in [0, 1) in place.
+ * The bottom 23 bits of a word are the mantissa and the leading zeros of the
+ * top 9 bits choose the exponent. More words are drawn from the buffer when
+ * the top bits are all zero.
+ *
+ * @param [in]      random  A random number generator object.
+ * @param [in, out] r       On in, random words. On out, floats.
+ * @param [in]      num     The number of words to convert.
+ * @return  RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+static int fill_float_dense(RANDOM *random, float *r, uint32_t num)
+{
+    int ret = 0;
+    uint32_t i;
+    uint32_t w, g, e, z;
+
+    for (i=0; i<num; i++)
+    {
+        memcpy(&w, &r[i], sizeof(w));
+        e = 126;
+        for (g = w >> 23; g == 0; g >>= 23)
+        {
+            /* Smaller than the smallest normal number - use zero. */
+            if (e <= 9)
+            {
+                e = 0;
+                w = 0;
+                break;
+            }
+            e -= 9;
+            ret = random_buf_u32(random, &g);
+            if (ret != 0) goto end;
+        }
+        /* Clamp at the subnormal boundary as for doubles. */
+        if (e > 0)
+        {
+            z = clz64(g) - 55;
+            e = (e > z) ? e - z : 0;
+        }
+
+        w = (e << 23) | (w & FLOAT_MANT_MASK);
+        memcpy(&r[i], &w, sizeof(w));
+    }
+end:
+    return ret;
+}
+
+/**
+ * Generate an array of uniform random doubles in the range [0, 1).
+ * Random words are generated in bulk directly into the array and converted in
+ * place.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [out] r       The array of random doubles.
+ * @param [in]  num     The number of random doubles to generate.
+ * @param [in]  flags   RANDOM_FLOAT_DENSE to generate all representable
+ *                      numbers rather than multiples of 2^-53.
+ * @return  RANDOM_ERR_PARAM_NULL when random or r is NULL.<br>
+ *          RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int RANDOM_fill_double(RANDOM *random, double *r, uint32_t num,
+    uint16_t flags)
+{
+    int ret = 0;
+    uint32_t n;
+
+    if ((random == NULL) || (r == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+
+    for (; num > 0; num -= n, r += n)
+    {
+        n = RANDOM_CHUNK_SIZE / sizeof(*r);
+        if (n > num)
+            n = num;
+
+        ret = random_buf_get(random, r, n * sizeof(*r));
+        if (ret != 0) goto end;
+
+        if (flags & RANDOM_FLOAT_DENSE)
+        {
+            ret = fill_double_dense(random, r, n);
+            if (ret != 0) goto end;
+        }
+        else
+            fill_double(r, n);
+    }
+end:
+    return ret;
+}
+
+/**
+ * Generate an array of uniform random floats in the range [0, 1).
+ * Random words are generated in bulk directly into the array and converted in
+ * place.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [out] r       The array of random floats.
+ * @param [in]  num     The number of random floats to generate.
+ * @param [in]  flags   RANDOM_FLOAT_DENSE to generate all representable
+ *                      numbers rather than multiples of 2^-24.
+ * @return  RANDOM_ERR_PARAM_NULL when random or r is NULL.<br>
+ *          RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int RANDOM_fill_float(RANDOM *random, float *r, uint32_t num, uint16_t flags)
+{
+    int ret = 0;
+    uint32_t n;
+
+    if ((random == NULL) || (r == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+
+    for (; num > 0; num -= n, r += n)
+    {
+        n = RANDOM_CHUNK_SIZE / sizeof(*r);
+        if (n > num)
+            n = num;
+
+        ret = random_buf_get(random, r, n * sizeof(*r));
+        if (ret != 0) goto end;
+
+        if (flags & RANDOM_FLOAT_DENSE)
+        {
+            ret = fill_float_dense(random, r, n);
+            if (ret != 0) goto end;
+        }
+        else
+            fill_float(r, n);
+    }
+end:
+    return ret;
+}
@@ -28,14 +28,63 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
-#include "random.h"
-#include "random_hash.h"
+#include "random_lcl.h"
 #include "hash.h"
 
+/**
+ * Start hashing a message.
+ * Uses the in-tree implementation when there is one for the CPU and the hash
+ * object otherwise.
+ *
+ * @param [in] h  The Hash_DRBG context.
+ * @return  A hash algorithm error.<br>
+ *          0 otherwise.
+ */
+static int hash_init(RANDOM_HASH *h)
+{
+    if (!h->accel)
+        return HASH_init(h->hash);
+    random_sha_init(&h->sha);
+    return 0;
+}
+
+/**
+ * Hash more data of the message.
+ *
+ * @param [in] h     The Hash_DRBG context.
+ * @param [in] data  The data to hash.
+ * @param [in] len   The length of the data.
+ * @return  A hash algorithm error.<br>
+ *          0 otherwise.
+ */
+static int hash_update(RANDOM_HASH *h, const void *data, uint32_t len)
+{
+    if (!h->accel)
+        return HASH_update(h->hash, data, len);
+    random_sha_update(&h->sha, data, len);
+    return 0;
+}
+
+/**
+ * Finish hashing the message and output the digest.
+ *
+ * @param [in] h    The Hash_DRBG context.
+ * @param [in] out  The buffer to put the digest output into.
+ * @return  A hash algorithm error.<br>
+ *          0 otherwise.
+ */
+static int hash_final(RANDOM_HASH *h, void *out)
+{
+    if (!h->accel)
+        return HASH_final(h->hash, out);
+    random_sha_final(&h->sha, out);
+    return 0;
+}
+
 /**
  * Generates a hash of optional prefix data and up to three buffers of data.
  *
- * @param [in] hash  The hash object.
+ * @param [in] h     The Hash_DRBG context.
  * @param [in] pre   The prefix data.
  * @param [in] plen  The length of the prefix data.
  * @param [in] data  An array of three pointers.
@@ -44,21 +93,21 @@
  * @return  A hash algorithm error.<br>
  *          0 otherwise.
  */
-static int hash_data(HASH *hash, uint8_t *pre, uint16_t plen, void **data,
+static int hash_data(RANDOM_HASH *h, uint8_t *pre, uint16_t plen, void **data,
     uint32_t *len, void *out)
 {
     int ret;
 
-    ret = HASH_init(hash);
+    ret = hash_init(h);
     if (ret != 0) goto end;
-    if (pre != NULL) ret = HASH_update(hash, pre, plen);
+    if (pre != NULL) ret = hash_update(h, pre, plen);
     if (ret != 0) goto end;
-    ret = HASH_update(hash, data[0], len[0]);
-    if (data[1] != NULL) ret = HASH_update(hash, data[1], len[1]);
+    ret = hash_update(h, data[0], len[0]);
+    if (data[1] != NULL) ret = hash_update(h, data[1], len[1]);
     if (ret != 0) goto end;
-    if (data[2] != NULL) ret = HASH_update(hash, data[2], len[2]);
+    if (data[2] != NULL) ret = hash_update(h, data[2], len[2]);
     if (ret != 0) goto end;
-    ret = HASH_final(hash, out);
+    ret = hash_final(h, out);
     if (ret != 0) goto end;
 
 end:
@@ -70,7 +119,7 @@ end:
  * Derives arbitrary length data using a hash function.
  * There are up to three buffers of data that passed in to derive from.
  *
- * @param [in] hash  The hash object.
+ * @param [in] h     The Hash_DRBG context.
  * @param [in] hlen  The length of the digest output.
  * @param [in] data  An array of three pointers.
  * @param [in] len   The length of data in the three pointers.
@@ -79,7 +128,7 @@ end:
  * @return  A hash algorithm error.<br>
  *          0 otherwise.
  */
-static int hash_df(HASH *hash, uint16_t hlen, void **data, uint32_t *len,
+static int hash_df(RANDOM_HASH *h, uint16_t hlen, void **data, uint32_t *len,
     void *out, uint32_t olen)
 {
     int ret = 0;
@@ -93,7 +142,7 @@ static int hash_df(HASH *hash, uint16_t hlen, void **data, uint32_t *len,
         pre[1+i] = (olen * 8) >> (24 - (i*8));
     for (i=olen; i>0; i-=hlen,pre[0]++)
     {
-        ret = hash_data(hash, pre, sizeof(pre), data, len, t);
+        ret = hash_data(h, pre, sizeof(pre), data, len, t);
         if (ret != 0) goto end;
         ol = (hlen < i) ? hlen : i;
         memcpy(out, t, ol);
@@ -127,23 +176,33 @@ static int random_hash_init(void *ctx, int hash_id, uint16_t seed_len,
     void *data[3] = { entropy, pstring, NULL };
     uint32_t len[3] = { elen, pslen, 0 };
 
-    if (h->hash == NULL)
+    /* Use the in-tree implementation when the CPU has the extensions. */
+    if ((h->hash == NULL) && !h->accel)
+        h->accel = random_sha_setup(&h->sha, hash_id);
+    if (h->accel)
+        h->hash_len = h->sha.hash_len;
+    else
     {
-        ret = HASH_new(hash_id, 0, &h->hash);
+        if (h->hash == NULL)
+        {
+            ret = HASH_new(hash_id, 0, &h->hash);
+            if (ret != 0) goto end;
+        }
+
+        ret = HASH_get_len(h->hash, &h->hash_len); 
         if (ret != 0) goto end;
     }
 
-    ret = HASH_get_len(h->hash, &h->hash_len); 
-    if (ret != 0) goto end;
-
-    ret = hash_df(h->hash, h->hash_len, data, len, &h->v[1], seed_len);
+    RANDOM_CYCLES_START(start);
+    ret = hash_df(h, h->hash_len, data, len, &h->v[1], seed_len);
     if (ret != 0) goto end;
 
     h->v[0] = 0;
     data[0] = h->v; len[0] = seed_len + 1;
     data[1] = NULL; data[2] = NULL;
-    ret = hash_df(h->hash, h->hash_len, data, len, h->c, seed_len);
+    ret = hash_df(h, h->hash_len, data, len, h->c, seed_len);
     if (ret != 0) goto end;
+    RANDOM_CYCLES_ADD(h->df_cycles, start);
 
     h->reseed_cnt = 1;
     h->seed_len = seed_len;
@@ -301,7 +360,8 @@ void RANDOM_HASH_final(void *ctx)
 {
     RANDOM_HASH *h = ctx;
 
-    HASH_free(h->hash);
+    if (h->hash != NULL)
+        HASH_free(h->hash);
 
     memset(h, 0, sizeof(*h));
 }
@@ -324,16 +384,18 @@ int RANDOM_HASH_reseed(void *ctx, void *entropy, uint32_t elen, void *ainput,
     void *data[3] = { h->v, entropy, ainput };
     uint32_t len[3] = { h->seed_len + 1, elen, alen };
 
+    RANDOM_CYCLES_START(start);
     h->v[0] = 1;
-    ret = hash_df(h->hash, h->hash_len, data, len, &h->t, h->seed_len);
+    ret = hash_df(h, h->hash_len, data, len, &h->t, h->seed_len);
     if (ret != 0) goto end;
     memcpy(&h->v[1], h->t, h->seed_len);
     
     h->v[0] = 0;
     data[0] = h->v; len[0] = h->seed_len + 1;
     data[1] = NULL; data[2] = NULL;
-    ret = hash_df(h->hash, h->hash_len, data, len, &h->c, h->seed_len);
+    ret = hash_df(h, h->hash_len, data, len, &h->c, h->seed_len);
     if (ret != 0) goto end;
+    RANDOM_CYCLES_ADD(h->df_cycles, start);
 
     h->reseed_cnt = 1;
 end:
@@ -342,37 +404,64 @@ end:
 
 /**
  * Generates data using a hash function.
+ * The data is one stream scattered over the segments, starting at an offset
+ * into them. The in-tree implementation may hash many values of v at once.
  *
- * @param [in] hash  The hash object.
+ * @param [in] h     The Hash_DRBG context.
  * @param [in] hlen  The length of the digest output.
  * @param [in] v     The v state to hash.
  * @param [in] vlen  The length of v data.
- * @param [in] data  The buffer to hold the generated data.
+ * @param [in] iov   The segments to hold the generated data.
+ * @param [in] cnt   The number of segments.
+ * @param [in] off   The offset into the segments to start at.
  * @param [in] len   The length of the generated data.
  * @return  A hash algorithm error.<br>
  *          0 otherwise.
  */
-static int hashgen(HASH *hash, uint16_t hlen, uint8_t *v, uint32_t vlen,
-    void *data, uint32_t len)
+static int hashgen(RANDOM_HASH *h, uint16_t hlen, uint8_t *v, uint32_t vlen,
+    const struct iovec *iov, int cnt, size_t off, uint32_t len)
 {
     int ret = 0;
-    int32_t i, j, ol;
-    uint8_t t[HASH_MAX_DIGEST_LEN];
+    int32_t j;
+    int s;
+    uint32_t i, ol, n, l, k;
+    uint32_t lanes = (h->accel && (h->sha.lanes > 0)) ? h->sha.lanes : 1;
+    uint8_t t[RANDOM_SHA_LANES * HASH_MAX_DIGEST_LEN];
 
-    for (i=len; i>0; i-=hlen)
-    {
-        ret = HASH_init(hash);
-        if (ret != 0) goto end;
-        ret = HASH_update(hash, v, vlen);
-        if (ret != 0) goto end;
-        ret = HASH_final(hash, t);
-        if (ret != 0) goto end;
+    /* Find the segment to start in. */
+    for (s=0; (s<cnt) && (off>=iov[s].iov_len); s++)
+        off -= iov[s].iov_len;
 
-        ol = (hlen < i) ? hlen : i;
-        memcpy(data, t, ol);
-        data += hlen;
+    for (i=len; i>0; i-=ol)
+    {
+        k = (i + hlen - 1) / hlen;
+        if (k > lanes)
+            k = lanes;
+        if (h->accel)
+            random_sha_ctr(&h->sha, v, vlen, k, t);
+        else
+        {
+            ret = HASH_init(h->hash);
+            if (ret != 0) goto end;
+            ret = HASH_update(h->hash, v, vlen);
+            if (ret != 0) goto end;
+            ret = HASH_final(h->hash, t);
+            if (ret != 0) goto end;
+            for (j=vlen-1; j>=0 && (++v[j] == 0); j--) ;
+        }
 
-        for (j=vlen-1; j>=0 && (++v[j] == 0); j--) ;
+        ol = (k * hlen < i) ? k * hlen : i;
+        for (n=0; (n<ol) && (s<cnt); n+=l)
+        {
+            l = ol - n;
+            if (l > iov[s].iov_len - off)
+                l = iov[s].iov_len - off;
+            memcpy((uint8_t *)iov[s].iov_base + off, t + n, l);
+            off += l;
+            /* Move on to the next segment with space. */
+            for (; (s<cnt) && (off==iov[s].iov_len); s++)
+                off = 0;
+        }
     }
 
 end:
@@ -380,19 +469,44 @@ end:
 }
 
 /**
- * Generate random data with optional user data.
+ * Add the cycles spent in each phase of the Hash_DRBG to the statistics.
+ * Only counted when built with RANDOM_STATS_CYCLES defined.
+ *
+ * @param [in]      ctx    The Hash_DRBG context.
+ * @param [in, out] stats  The statistics to add to.
+ */
+void RANDOM_HASH_stats(void *ctx, RANDOM_STATS *stats)
+{
+#ifdef RANDOM_STATS_CYCLES
+    RANDOM_HASH *h = ctx;
+
+    stats->df_cycles += h->df_cycles;
+    stats->gen_cycles += h->gen_cycles;
+    stats->update_cycles += h->update_cycles;
+#else
+    (void)ctx;
+    (void)stats;
+#endif
+}
+
+/**
+ * Generate random data with optional user data into segments.
+ * The segments are filled from one stream and the state is updated once.
  *
  * @param [in]  ctx      The Hash_DRBG context.
  * @param [in]  ainput   The user data or additional input.
  * @param [in]  alen     The length of the additional input.
- * @param [in]  out      The output buffer for the generated data.
+ * @param [in]  iov      The segments for the generated data.
+ * @param [in]  cnt      The number of segments.
+ * @param [in]  off      The offset into the segments to start at.
  * @param [in]  olen     The length of the data to generate.
  * @param [out] glen     The length of the generated data.
  * @return  RANDOM_ERR_RESEED if a reseed is required.<br>
  *          0 otherwise.
  */
-int RANDOM_HASH_gen(void *ctx, void *ainput, uint32_t alen, void *out,
-    uint32_t olen, uint32_t *glen)
+int RANDOM_HASH_genv(void *ctx, void *ainput, uint32_t alen,
+    const struct iovec *iov, int cnt, size_t off, uint32_t olen,
+    uint32_t *glen)
 {
     int ret;
     RANDOM_HASH *h = ctx;
@@ -409,11 +523,12 @@ int RANDOM_HASH_gen(void *ctx, void *ainput, uint32_t alen, void *out,
         goto end;
     }
 
-    if (ainput != NULL)
+    RANDOM_CYCLES_START(start);
+    if ((ainput != NULL) && (alen > 0))
     {
         h->v[0] = 2;
         memset(h->t, 0, h->seed_len-l);
-        ret = hash_data(h->hash, NULL, 0, data, len, h->t+h->seed_len-l);
+        ret = hash_data(h, NULL, 0, data, len, h->t+h->seed_len-l);
         if (ret != 0) goto end;
         t = 0;
         for (i=h->seed_len-1; i>=0; i--)
@@ -428,15 +543,22 @@ int RANDOM_HASH_gen(void *ctx, void *ainput, uint32_t alen, void *out,
     if (olen > (1 << 16))
         olen = 1 << 16;
 
+    RANDOM_CYCLES_ADD(h->update_cycles, start);
+
+    RANDOM_CYCLES_START(gen_start);
     memcpy(h->t, h->v+1, h->seed_len);
-    ret = hashgen(h->hash, h->hash_len, h->t, h->seed_len, out, olen);
+    ret = hashgen(h, h->hash_len, h->t, h->seed_len, iov, cnt, off,
+        olen);
     if (ret != 0) goto end;
+    RANDOM_CYCLES_ADD(h->gen_cycles, gen_start);
+
+    RANDOM_CYCLES_START(update_start);
 
     h->v[0] = 3;
     data[0] = h->v; len[0] = h->seed_len + 1;
     data[1] = NULL; data[2] = NULL;
     memset(h->t, 0, h->seed_len-l);
-    ret = hash_data(h->hash, NULL, 0, data, len, h->t+h->seed_len-l);
+    ret = hash_data(h, NULL, 0, data, len, h->t+h->seed_len-l);
     if (ret != 0) goto end;
     t = 0;
     for (i=h->seed_len-1; i>=h->seed_len-4; i--)
@@ -457,9 +579,33 @@ int RANDOM_HASH_gen(void *ctx, void *ainput, uint32_t alen, void *out,
         t >>= 8;
     }
 
+    RANDOM_CYCLES_ADD(h->update_cycles, update_start);
+
     h->reseed_cnt++;
     *glen = olen;
 end:
     return ret;
 }
 
+/**
+ * Generate random data with optional user data.
+ *
+ * @param [in]  ctx      The Hash_DRBG context.
+ * @param [in]  ainput   The user data or additional input.
+ * @param [in]  alen     The length of the additional input.
+ * @param [in]  out      The output buffer for the generated data.
+ * @param [in]  olen     The length of the data to generate.
+ * @param [out] glen     The length of the generated data.
+ * @return  RANDOM_ERR_RESEED if a reseed is required.<br>
+ *          0 otherwise.
+ */
+int RANDOM_HASH_gen(void *ctx, void *ainput, uint32_t alen, void *out,
+    uint32_t olen, uint32_t *glen)
+{
+    struct iovec iov;
+
+    iov.iov_base = out;
+    iov.iov_len = olen;
+    return RANDOM_HASH_genv(ctx, ainput, alen, &iov, 1, 0, olen, glen);
+}
+
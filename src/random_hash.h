@@ -25,7 +25,12 @@
  *                           Deterministic RBGs.
  */
 
+#ifndef RANDOM_HASH_H
+#define RANDOM_HASH_H
+
 #include "hash.h"
+#include "random.h"
+#include "random_sha.h"
 
 /** The maximum digest output length. */
 #define HASH_MAX_DIGEST_LEN		64
@@ -48,12 +53,24 @@ typedef struct random_hash_st
     uint8_t t[RANDOM_HASH_MAX_SEED_LEN];
     /** Count of generation operations.  */
     uint64_t reseed_cnt;
-    /** Hash object.  */
+    /** Hash object. NULL when the in-tree implementation is used.  */
     HASH *hash;
+    /** In-tree hash implementation for the CPU - used when accel is set. */
+    RANDOM_SHA sha;
+    /** Set when the in-tree hash implementation is used. */
+    int accel;
     /** Length of the digest output. */
     int hash_len;
     /** Length of seed for this implementation. */
     uint16_t seed_len;
+#ifdef RANDOM_STATS_CYCLES
+    /** Cycles spent in Hash_df. */
+    uint64_t df_cycles;
+    /** Cycles spent in hashgen. */
+    uint64_t gen_cycles;
+    /** Cycles spent updating v after generating. */
+    uint64_t update_cycles;
+#endif
 } RANDOM_HASH;
 
 int RANDOM_HASH_SHA1_init(void *ctx, void *entropy, uint32_t elen,
@@ -61,47 +78,65 @@ int RANDOM_HASH_SHA1_init(void *ctx, void *entropy, uint32_t elen,
 #define RANDOM_HASH_SHA1_final		RANDOM_HASH_final
 #define RANDOM_HASH_SHA1_reseed		RANDOM_HASH_reseed
 #define RANDOM_HASH_SHA1_gen		RANDOM_HASH_gen
+#define RANDOM_HASH_SHA1_genv		RANDOM_HASH_genv
+#define RANDOM_HASH_SHA1_stats		RANDOM_HASH_stats
 
 int RANDOM_HASH_SHA224_init(void *ctx, void *entropy, uint32_t elen,
     void *pstring, uint32_t pslen);
 #define RANDOM_HASH_SHA224_final	RANDOM_HASH_final
 #define RANDOM_HASH_SHA224_reseed	RANDOM_HASH_reseed
 #define RANDOM_HASH_SHA224_gen		RANDOM_HASH_gen
+#define RANDOM_HASH_SHA224_genv		RANDOM_HASH_genv
+#define RANDOM_HASH_SHA224_stats		RANDOM_HASH_stats
 
 int RANDOM_HASH_SHA256_init(void *ctx, void *entropy, uint32_t elen,
     void *pstring, uint32_t pslen);
 #define RANDOM_HASH_SHA256_final	RANDOM_HASH_final
 #define RANDOM_HASH_SHA256_reseed	RANDOM_HASH_reseed
 #define RANDOM_HASH_SHA256_gen		RANDOM_HASH_gen
+#define RANDOM_HASH_SHA256_genv		RANDOM_HASH_genv
+#define RANDOM_HASH_SHA256_stats		RANDOM_HASH_stats
 
 int RANDOM_HASH_SHA384_init(void *ctx, void *entropy, uint32_t elen,
     void *pstring, uint32_t pslen);
 #define RANDOM_HASH_SHA384_final	RANDOM_HASH_final
 #define RANDOM_HASH_SHA384_reseed	RANDOM_HASH_reseed
 #define RANDOM_HASH_SHA384_gen		RANDOM_HASH_gen
+#define RANDOM_HASH_SHA384_genv		RANDOM_HASH_genv
+#define RANDOM_HASH_SHA384_stats		RANDOM_HASH_stats
 
 int RANDOM_HASH_SHA512_init(void *ctx, void *entropy, uint32_t elen,
     void *pstring, uint32_t pslen);
 #define RANDOM_HASH_SHA512_final	RANDOM_HASH_final
 #define RANDOM_HASH_SHA512_reseed	RANDOM_HASH_reseed
 #define RANDOM_HASH_SHA512_gen		RANDOM_HASH_gen
+#define RANDOM_HASH_SHA512_genv		RANDOM_HASH_genv
+#define RANDOM_HASH_SHA512_stats		RANDOM_HASH_stats
 
 int RANDOM_HASH_SHA512_224_init(void *ctx, void *entropy, uint32_t elen,
     void *pstring, uint32_t pslen);
 #define RANDOM_HASH_SHA512_224_final	RANDOM_HASH_final
 #define RANDOM_HASH_SHA512_224_reseed	RANDOM_HASH_reseed
 #define RANDOM_HASH_SHA512_224_gen	RANDOM_HASH_gen
+#define RANDOM_HASH_SHA512_224_genv	RANDOM_HASH_genv
+#define RANDOM_HASH_SHA512_224_stats	RANDOM_HASH_stats
 
 int RANDOM_HASH_SHA512_256_init(void *ctx, void *entropy, uint32_t elen,
     void *pstring, uint32_t pslen);
 #define RANDOM_HASH_SHA512_256_final	RANDOM_HASH_final
 #define RANDOM_HASH_SHA512_256_reseed	RANDOM_HASH_reseed
 #define RANDOM_HASH_SHA512_256_gen	RANDOM_HASH_gen
+#define RANDOM_HASH_SHA512_256_genv	RANDOM_HASH_genv
+#define RANDOM_HASH_SHA512_256_stats	RANDOM_HASH_stats
 
 void RANDOM_HASH_final(void *ctx);
 int RANDOM_HASH_reseed(void *ctx, void *entropy, uint32_t elen,
     void *ainput, uint32_t alen);
+void RANDOM_HASH_stats(void *ctx, RANDOM_STATS *stats);
 int RANDOM_HASH_gen(void *ctx, void *ainput, uint32_t alen, void *out,
     uint32_t olen, uint32_t *glen);
+int RANDOM_HASH_genv(void *ctx, void *ainput, uint32_t alen,
+    const struct iovec *iov, int cnt, size_t off, uint32_t olen,
+    uint32_t *glen);
 
-
+#endif
@@ -20,8 +20,20 @@
  * SOFTWARE.
  */
 
+#ifndef RANDOM_LCL_H
+#define RANDOM_LCL_H
+
+#include <string.h>
 #include "random.h"
 #include "random_hash.h"
+#ifdef RANDOM_STATS_CYCLES
+#include <time.h>
+#endif
+
+/** The size of the buffer of generated data used for small draws. */
+#define RANDOM_BUF_SIZE		4096
+/** The number of bytes to generate at a time when filling large arrays. */
+#define RANDOM_CHUNK_SIZE	(1 << 16)
 
 /**
  * Initialize the random number generator context with entropy and user data.
@@ -69,6 +81,32 @@ typedef int (RANDOM_RESEED)(void *ctx, void *entropy, uint32_t elen,
  */
 typedef int (RANDOM_GEN)(void *ctx, void *ainput, uint32_t alen, void *out,
     uint32_t olen, uint32_t *glen);
+/**
+ * Generate random data with optional user data into segments.
+ * The data is one stream, as from one generate, scattered over the segments.
+ *
+ * @param [in]  ctx      The random number generator context.
+ * @param [in]  ainput   The user data or additional input.
+ * @param [in]  alen     The length of the additional input.
+ * @param [in]  iov      The segments for the generated data.
+ * @param [in]  cnt      The number of segments.
+ * @param [in]  off      The offset into the segments to start at.
+ * @param [in]  olen     The length of the data to generate.
+ * @param [out] glen     The length of the generated data.
+ * @return  0 when there is no error.
+ */
+typedef int (RANDOM_GENV)(void *ctx, void *ainput, uint32_t alen,
+    const struct iovec *iov, int cnt, size_t off, uint32_t olen,
+    uint32_t *glen);
+
+/**
+ * Add the implementation's statistics, like phase cycle counts, to the
+ * statistics of the random number generator object.
+ *
+ * @param [in]      ctx    The random number generator context.
+ * @param [in, out] stats  The statistics to add to.
+ */
+typedef void (RANDOM_STATS_FUNC)(void *ctx, RANDOM_STATS *stats);
 
 /** The structure for the random number generator implementation. */
 typedef struct random_meth_st
@@ -91,6 +129,10 @@ typedef struct random_meth_st
     RANDOM_RESEED *reseed;
     /** The generation function. */
     RANDOM_GEN *gen;
+    /** The scatter generation function. */
+    RANDOM_GENV *genv;
+    /** The statistics function. May be NULL. */
+    RANDOM_STATS_FUNC *stats;
 } RANDOM_METH;
 
 /** The random number generator object.  */
@@ -106,5 +148,129 @@ struct random_st
     uint8_t *entropy;
     /** The number of bytes of entropy to generate. */
     uint16_t elen;
+    /** The buffer of generated data used for small draws. */
+    uint8_t *buf;
+    /** The number of unused bytes at the end of the buffer. */
+    uint32_t buf_len;
+    /** The statistics of the object. */
+    RANDOM_STATS stats;
 };
 
+#ifdef RANDOM_STATS_CYCLES
+/**
+ * Get the current cycle count for phase accounting.
+ * Uses the CPU's time stamp counter when available, otherwise nanoseconds.
+ *
+ * @return  Cycle count.
+ */
+static inline uint64_t random_cycles()
+{
+#if defined(CPU_X86_64) && (defined(CC_GCC) || defined(CC_CLANG))
+    unsigned int hi, lo;
+
+    asm volatile ("rdtsc\n\t" : "=a" (lo), "=d"(hi));
+    return ((uint64_t)lo) | (((uint64_t)hi) << 32);
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+/** Start timing a phase. */
+#define RANDOM_CYCLES_START(s)		uint64_t s = random_cycles()
+/** Add the cycles since the start of the phase to a count. */
+#define RANDOM_CYCLES_ADD(cnt, s)	(cnt) += random_cycles() - (s)
+#else
+#define RANDOM_CYCLES_START(s)
+#define RANDOM_CYCLES_ADD(cnt, s)
+#endif
+
+/**
+ * Multiply two 64-bit numbers to produce a 128-bit result.
+ *
+ * @param [in]  a   The first operand.
+ * @param [in]  b   The second operand.
+ * @param [out] lo  The low 64 bits of the product.
+ * @return  The high 64 bits of the product.
+ */
+static inline uint64_t random_mul64(uint64_t a, uint64_t b, uint64_t *lo)
+{
+#if defined(CC_GCC) || defined(CC_CLANG)
+    unsigned __int128 m = (unsigned __int128)a * b;
+
+    *lo = (uint64_t)m;
+    return (uint64_t)(m >> 64);
+#else
+    uint64_t al = (uint32_t)a, ah = a >> 32;
+    uint64_t bl = (uint32_t)b, bh = b >> 32;
+    uint64_t ll = al * bl, lh = al * bh, hl = ah * bl, hh = ah * bh;
+    uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+
+    *lo = (mid << 32) | (uint32_t)ll;
+    return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+/** The implementations of random number generators. */
+extern RANDOM_METH random_meth[];
+/** The number of random number generator implementations. */
+extern const uint8_t random_meth_num;
+
+int random_tune_meth_get(uint16_t bits, uint16_t flags, RANDOM_METH **meth);
+
+int random_buf_fill(RANDOM *random);
+int random_buf_get(RANDOM *random, void *data, uint32_t len);
+
+/**
+ * Retrieves a 32-bit word of generated data from the buffer of the random
+ * number generator object. The buffer is refilled when empty.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [out] w       The 32-bit word of generated data.
+ * @return  RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+static inline int random_buf_u32(RANDOM *random, uint32_t *w)
+{
+    int ret = 0;
+
+    if (random->buf_len < sizeof(*w))
+    {
+        ret = random_buf_fill(random);
+        if (ret != 0) goto end;
+    }
+
+    memcpy(w, random->buf + RANDOM_BUF_SIZE - random->buf_len, sizeof(*w));
+    random->buf_len -= sizeof(*w);
+end:
+    return ret;
+}
+
+/**
+ * Retrieves a 64-bit word of generated data from the buffer of the random
+ * number generator object. The buffer is refilled when empty.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [out] w       The 64-bit word of generated data.
+ * @return  RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+static inline int random_buf_u64(RANDOM *random, uint64_t *w)
+{
+    int ret = 0;
+
+    if (random->buf_len < sizeof(*w))
+    {
+        ret = random_buf_fill(random);
+        if (ret != 0) goto end;
+    }
+
+    memcpy(w, random->buf + RANDOM_BUF_SIZE - random->buf_len, sizeof(*w));
+    random->buf_len -= sizeof(*w);
+end:
+    return ret;
+}
+
+#endif
@@ -0,0 +1,708 @@
+/*
+ * Copyright (c) 2016 Sean Parkinson (sparkinson@iprimus.com.au)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* This code implements SHA-1, SHA-2 as specified in -
+ *   FIPS 180-4: Secure Hash Standard (SHS).
+ * The implementations are only used when the CPU has the extensions they
+ * need - the Hash_DRBG uses the HASH library otherwise:
+ *   SHA-1, SHA-224, SHA-256: Intel SHA extensions.
+ *   SHA-384, SHA-512, SHA-512/t: AVX2 - four messages hashed at once when
+ *   generating. A single message, as when seeding, uses scalar C code - it is
+ *   not vectorized.
+ * Define RANDOM_NO_SHA_ACCEL to always use the HASH library, or set the
+ * environment variable RANDOM_NO_SHA_ACCEL to do so at run time - the tests
+ * use this to check both paths on every machine.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "random_lcl.h"
+#include "random_sha.h"
+#include "hash.h"
+
+#if defined(CPU_X86_64) && (defined(CC_GCC) || defined(CC_CLANG)) && \
+    !defined(RANDOM_NO_SHA_ACCEL)
+#define RANDOM_SHA_ACCEL
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+#ifdef RANDOM_SHA_ACCEL
+
+/** The CPU has the Intel SHA extensions. */
+#define SHA_CAP_SHANI		0x01
+/** The CPU has AVX2 and the operating system saves the registers. */
+#define SHA_CAP_AVX2		0x02
+/** The capabilities of the CPU have been determined. */
+#define SHA_CAP_DONE		0x80
+/** The environment variable that, when set, disables the implementations. */
+#define SHA_NO_ACCEL_ENV	"RANDOM_NO_SHA_ACCEL"
+
+static const uint32_t sha256_k[] =
+{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+static const uint64_t sha512_k[] =
+{
+    0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL,
+    0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+    0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL,
+    0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+    0xd807aa98a3030242ULL, 0x12835b0145706fbeULL,
+    0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+    0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL,
+    0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+    0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL,
+    0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+    0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL,
+    0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+    0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL,
+    0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+    0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL,
+    0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+    0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL,
+    0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+    0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL,
+    0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+    0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL,
+    0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+    0xd192e819d6ef5218ULL, 0xd69906245565a910ULL,
+    0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+    0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL,
+    0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+    0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL,
+    0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+    0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL,
+    0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+    0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL,
+    0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+    0xca273eceea26619cULL, 0xd186b8c721c0c207ULL,
+    0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+    0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL,
+    0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+    0x28db77f523047d84ULL, 0x32caab7b40c72493ULL,
+    0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+    0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
+    0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+static const uint32_t sha1_iv[] =
+{
+    0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476,
+    0xc3d2e1f0
+};
+static const uint32_t sha224_iv[] =
+{
+    0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939,
+    0xffc00b31, 0x68581511, 0x64f98fa7, 0xbefa4fa4
+};
+static const uint32_t sha256_iv[] =
+{
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+static const uint64_t sha384_iv[] =
+{
+    0xcbbb9d5dc1059ed8ULL, 0x629a292a367cd507ULL,
+    0x9159015a3070dd17ULL, 0x152fecd8f70e5939ULL,
+    0x67332667ffc00b31ULL, 0x8eb44a8768581511ULL,
+    0xdb0c2e0d64f98fa7ULL, 0x47b5481dbefa4fa4ULL
+};
+static const uint64_t sha512_iv[] =
+{
+    0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL,
+    0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+    0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+    0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+static const uint64_t sha512_224_iv[] =
+{
+    0x8c3d37c819544da2ULL, 0x73e1996689dcd4d6ULL,
+    0x1dfab7ae32ff9c82ULL, 0x679dd514582f9fcfULL,
+    0x0f6d2b697bd44da8ULL, 0x77e36f7304c48942ULL,
+    0x3f9d85a86a1d36c8ULL, 0x1112e6ad91d692a1ULL
+};
+static const uint64_t sha512_256_iv[] =
+{
+    0x22312194fc2bf72cULL, 0x9f555fa3c84c64c2ULL,
+    0x2393b86b6f53b151ULL, 0x963877195940eabdULL,
+    0x96283ee2a88effe3ULL, 0xbe5e1e2553863992ULL,
+    0x2b0199fc2c85b8aaULL, 0x0eb72ddc81c52ca2ULL
+};
+
+/**
+ * Load a big-endian 64-bit word.
+ *
+ * @param [in] p  The bytes of the word.
+ * @return  The word.
+ */
+static uint64_t sha_load64(const uint8_t *p)
+{
+    uint64_t w;
+
+    memcpy(&w, p, sizeof(w));
+    return __builtin_bswap64(w);
+}
+
+/** Rotate a 64-bit word right. */
+#define ROTR64(x, n)	(((x) >> (n)) | ((x) << (64 - (n))))
+
+/**
+ * Process blocks of data with SHA-512.
+ * Used for a single message of the SHA-512 family. This is scalar code - only
+ * hashing four messages at once with sha512_block_x4_avx2() uses AVX2.
+ *
+ * @param [in] state   The hash state.
+ * @param [in] data    The blocks of data.
+ * @param [in] blocks  The number of blocks.
+ */
+static void sha512_block(void *state, const uint8_t *data, size_t blocks)
+{
+    uint64_t *s = state;
+    uint64_t w[16];
+    uint64_t a, b, c, d, e, f, g, h, t1, t2;
+    int t;
+
+    for (; blocks > 0; blocks--, data += 128)
+    {
+        a = s[0]; b = s[1]; c = s[2]; d = s[3];
+        e = s[4]; f = s[5]; g = s[6]; h = s[7];
+        for (t=0; t<80; t++)
+        {
+            if (t < 16)
+                w[t] = sha_load64(data + t * 8);
+            else
+            {
+                w[t&15] += (ROTR64(w[(t-2)&15], 19) ^
+                            ROTR64(w[(t-2)&15], 61) ^ (w[(t-2)&15] >> 6)) +
+                           w[(t-7)&15] +
+                           (ROTR64(w[(t-15)&15], 1) ^
+                            ROTR64(w[(t-15)&15], 8) ^ (w[(t-15)&15] >> 7));
+            }
+            t1 = h + (ROTR64(e, 14) ^ ROTR64(e, 18) ^ ROTR64(e, 41)) +
+                 ((e & f) ^ (~e & g)) + sha512_k[t] + w[t&15];
+            t2 = (ROTR64(a, 28) ^ ROTR64(a, 34) ^ ROTR64(a, 39)) +
+                 ((a & b) | (c & (a | b)));
+            h = g; g = f; f = e; e = d + t1;
+            d = c; c = b; b = a; a = t1 + t2;
+        }
+        s[0] += a; s[1] += b; s[2] += c; s[3] += d;
+        s[4] += e; s[5] += f; s[6] += g; s[7] += h;
+    }
+}
+
+/** Rotate the 64-bit words of a vector right. */
+#define ROTR64_X4(x, n)							\
+    _mm256_or_si256(_mm256_srli_epi64(x, n), _mm256_slli_epi64(x, 64 - (n)))
+
+/**
+ * Process one block of data for each of four SHA-512 states at once.
+ * The words of the four states are kept in the four lanes of AVX2 vectors.
+ *
+ * @param [in] state   The four hash states - one after the other.
+ * @param [in] data    The four blocks of data.
+ * @param [in] stride  The distance between the blocks of data.
+ */
+__attribute__((target("avx2")))
+static void sha512_block_x4_avx2(void *state, const uint8_t *data,
+    size_t stride)
+{
+    uint64_t *s = state;
+    __m256i v[8], w[16], a, b, c, d, e, f, g, h, t1, t2, x, y;
+    int i, t;
+
+    for (i=0; i<8; i++)
+        v[i] = _mm256_set_epi64x(s[24+i], s[16+i], s[8+i], s[i]);
+    a = v[0]; b = v[1]; c = v[2]; d = v[3];
+    e = v[4]; f = v[5]; g = v[6]; h = v[7];
+
+    for (t=0; t<80; t++)
+    {
+        if (t < 16)
+        {
+            w[t] = _mm256_set_epi64x(sha_load64(data + 3 * stride + t * 8),
+                sha_load64(data + 2 * stride + t * 8),
+                sha_load64(data + stride + t * 8), sha_load64(data + t * 8));
+        }
+        else
+        {
+            x = w[(t-2)&15];
+            y = w[(t-15)&15];
+            x = _mm256_xor_si256(_mm256_xor_si256(ROTR64_X4(x, 19),
+                ROTR64_X4(x, 61)), _mm256_srli_epi64(x, 6));
+            y = _mm256_xor_si256(_mm256_xor_si256(ROTR64_X4(y, 1),
+                ROTR64_X4(y, 8)), _mm256_srli_epi64(y, 7));
+            w[t&15] = _mm256_add_epi64(_mm256_add_epi64(w[t&15], x),
+                _mm256_add_epi64(w[(t-7)&15], y));
+        }
+
+        t1 = _mm256_xor_si256(_mm256_xor_si256(ROTR64_X4(e, 14),
+            ROTR64_X4(e, 18)), ROTR64_X4(e, 41));
+        t1 = _mm256_add_epi64(_mm256_add_epi64(h, t1),
+            _mm256_xor_si256(_mm256_and_si256(e, f),
+            _mm256_andnot_si256(e, g)));
+        t1 = _mm256_add_epi64(t1, _mm256_add_epi64(w[t&15],
+            _mm256_set1_epi64x(sha512_k[t])));
+        t2 = _mm256_xor_si256(_mm256_xor_si256(ROTR64_X4(a, 28),
+            ROTR64_X4(a, 34)), ROTR64_X4(a, 39));
+        t2 = _mm256_add_epi64(t2, _mm256_or_si256(_mm256_and_si256(a, b),
+            _mm256_and_si256(c, _mm256_or_si256(a, b))));
+        h = g; g = f; f = e; e = _mm256_add_epi64(d, t1);
+        d = c; c = b; b = a; a = _mm256_add_epi64(t1, t2);
+    }
+
+    v[0] = _mm256_add_epi64(v[0], a); v[1] = _mm256_add_epi64(v[1], b);
+    v[2] = _mm256_add_epi64(v[2], c); v[3] = _mm256_add_epi64(v[3], d);
+    v[4] = _mm256_add_epi64(v[4], e); v[5] = _mm256_add_epi64(v[5], f);
+    v[6] = _mm256_add_epi64(v[6], g); v[7] = _mm256_add_epi64(v[7], h);
+    for (i=0; i<8; i++)
+    {
+        s[i] = _mm256_extract_epi64(v[i], 0);
+        s[8+i] = _mm256_extract_epi64(v[i], 1);
+        s[16+i] = _mm256_extract_epi64(v[i], 2);
+        s[24+i] = _mm256_extract_epi64(v[i], 3);
+    }
+}
+
+/** Four rounds of SHA-1 with the Intel SHA extensions for group g of the 20.
+ * The message words for group g are calculated from the previous four.
+ */
+#define SHA1_GROUP(g, func)						\
+    do {								\
+        if ((g) >= 4)							\
+        {								\
+            m[(g)&3] = _mm_sha1msg2_epu32(_mm_xor_si128(		\
+                _mm_sha1msg1_epu32(m[(g)&3], m[((g)+1)&3]),		\
+                m[((g)+2)&3]), m[((g)+3)&3]);				\
+        }								\
+        e = _mm_sha1nexte_epu32(e, m[(g)&3]);				\
+        t = abcd;							\
+        abcd = _mm_sha1rnds4_epu32(abcd, e, func);			\
+        e = t;								\
+    } while (0)
+
+/**
+ * Process blocks of data with SHA-1 using the Intel SHA extensions.
+ *
+ * @param [in] state   The hash state.
+ * @param [in] data    The blocks of data.
+ * @param [in] blocks  The number of blocks.
+ */
+__attribute__((target("sha,sse4.1,ssse3")))
+static void sha1_block_shani(void *state, const uint8_t *data, size_t blocks)
+{
+    uint32_t *s = state;
+    __m128i abcd, abcd_save, e, e_save, t, m[4];
+    const __m128i mask = _mm_set_epi64x(0x0001020304050607ULL,
+        0x08090a0b0c0d0e0fULL);
+    int g;
+
+    abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)s), 0x1b);
+    e = _mm_set_epi32(s[4], 0, 0, 0);
+
+    for (; blocks > 0; blocks--, data += 64)
+    {
+        abcd_save = abcd;
+        e_save = e;
+        for (g=0; g<4; g++)
+        {
+            m[g] = _mm_shuffle_epi8(
+                _mm_loadu_si128((const __m128i *)(data + g * 16)), mask);
+        }
+
+        /* The first group adds e rather than calculating it from a. */
+        e = _mm_add_epi32(e, m[0]);
+        t = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e, 0);
+        e = t;
+        for (g=1; g<5; g++)
+            SHA1_GROUP(g, 0);
+        for (; g<10; g++)
+            SHA1_GROUP(g, 1);
+        for (; g<15; g++)
+            SHA1_GROUP(g, 2);
+        for (; g<20; g++)
+            SHA1_GROUP(g, 3);
+
+        e = _mm_sha1nexte_epu32(e, e_save);
+        abcd = _mm_add_epi32(abcd, abcd_save);
+    }
+
+    _mm_storeu_si128((__m128i *)s, _mm_shuffle_epi32(abcd, 0x1b));
+    s[4] = _mm_extract_epi32(e, 3);
+}
+
+/**
+ * Process blocks of data with SHA-256 using the Intel SHA extensions.
+ * The state is kept as ABEF and CDGH for the round instructions.
+ *
+ * @param [in] state   The hash state.
+ * @param [in] data    The blocks of data.
+ * @param [in] blocks  The number of blocks.
+ */
+__attribute__((target("sha,sse4.1,ssse3")))
+static void sha256_block_shani(void *state, const uint8_t *data,
+    size_t blocks)
+{
+    uint32_t *s = state;
+    __m128i s0, s1, s0_save, s1_save, msg, t, m[4];
+    const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+        0x0405060700010203ULL);
+    int g;
+
+    t = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)s), 0xb1);
+    s1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(s + 4)), 0x1b);
+    s0 = _mm_alignr_epi8(t, s1, 8);
+    s1 = _mm_blend_epi16(s1, t, 0xf0);
+
+    for (; blocks > 0; blocks--, data += 64)
+    {
+        s0_save = s0;
+        s1_save = s1;
+        for (g=0; g<4; g++)
+        {
+            m[g] = _mm_shuffle_epi8(
+                _mm_loadu_si128((const __m128i *)(data + g * 16)), mask);
+        }
+
+        for (g=0; g<16; g++)
+        {
+            msg = _mm_add_epi32(m[g&3],
+                _mm_loadu_si128((const __m128i *)(sha256_k + g * 4)));
+            s1 = _mm_sha256rnds2_epu32(s1, s0, msg);
+            s0 = _mm_sha256rnds2_epu32(s0, s1, _mm_shuffle_epi32(msg, 0x0e));
+            /* The message words for four groups on. */
+            if (g < 12)
+            {
+                m[g&3] = _mm_sha256msg2_epu32(_mm_add_epi32(
+                    _mm_sha256msg1_epu32(m[g&3], m[(g+1)&3]),
+                    _mm_alignr_epi8(m[(g+3)&3], m[(g+2)&3], 4)), m[(g+3)&3]);
+            }
+        }
+
+        s0 = _mm_add_epi32(s0, s0_save);
+        s1 = _mm_add_epi32(s1, s1_save);
+    }
+
+    t = _mm_shuffle_epi32(s0, 0x1b);
+    s1 = _mm_shuffle_epi32(s1, 0xb1);
+    _mm_storeu_si128((__m128i *)s, _mm_blend_epi16(t, s1, 0xf0));
+    _mm_storeu_si128((__m128i *)(s + 4), _mm_alignr_epi8(s1, t, 8));
+}
+
+/**
+ * Determine the extensions of the CPU that the implementations use.
+ * The result is determined once and kept. No extensions are reported when the
+ * environment variable RANDOM_NO_SHA_ACCEL is set.
+ *
+ * @return  The SHA_CAP_* flags.
+ */
+static int sha_cpu_caps(void)
+{
+    static int caps = 0;
+    int c = __atomic_load_n(&caps, __ATOMIC_RELAXED);
+    unsigned int eax, ebx, ecx, edx, xcr0_lo, xcr0_hi;
+    unsigned int ecx1 = 0;
+
+    if (c != 0)
+        return c;
+
+    c = SHA_CAP_DONE;
+    if ((getenv(SHA_NO_ACCEL_ENV) == NULL) &&
+        __get_cpuid(1, &eax, &ebx, &ecx1, &edx) &&
+        __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+    {
+        /* SSSE3 (ecx 9), SSE4.1 (ecx 19) and SHA (ebx 29). */
+        if ((ecx1 & (1 << 9)) && (ecx1 & (1 << 19)) && (ebx & (1 << 29)))
+            c |= SHA_CAP_SHANI;
+        /* AVX2 (ebx 5) needs AVX (ecx 28) and the OS saving the YMM
+         * registers (OSXSAVE ecx 27, XCR0 bits 1 and 2). */
+        if ((ebx & (1 << 5)) && (ecx1 & (1 << 28)) && (ecx1 & (1 << 27)))
+        {
+            __asm__ __volatile__ ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi)
+                : "c" (0));
+            if ((xcr0_lo & 0x6) == 0x6)
+                c |= SHA_CAP_AVX2;
+        }
+    }
+
+    __atomic_store_n(&caps, c, __ATOMIC_RELAXED);
+    return c;
+}
+
+#endif /* RANDOM_SHA_ACCEL */
+
+/**
+ * Set up an in-tree hash object for the hash algorithm when the CPU supports
+ * an implementation.
+ *
+ * @param [in] sha      The in-tree hash object.
+ * @param [in] hash_id  The hash algorithm identifier.
+ * @return  1 when there is an in-tree implementation for the CPU.<br>
+ *          0 otherwise.
+ */
+int random_sha_setup(RANDOM_SHA *sha, int hash_id)
+{
+#ifdef RANDOM_SHA_ACCEL
+    int caps = sha_cpu_caps();
+#endif
+
+    memset(sha, 0, sizeof(*sha));
+#ifdef RANDOM_SHA_ACCEL
+
+    switch (hash_id)
+    {
+        case HASH_ID_SHA1:
+            sha->iv = sha1_iv;
+            sha->hash_len = 20;
+            break;
+        case HASH_ID_SHA224:
+            sha->iv = sha224_iv;
+            sha->hash_len = 28;
+            break;
+        case HASH_ID_SHA256:
+            sha->iv = sha256_iv;
+            sha->hash_len = 32;
+            break;
+        case HASH_ID_SHA384:
+            sha->iv = sha384_iv;
+            sha->hash_len = 48;
+            break;
+        case HASH_ID_SHA512:
+            sha->iv = sha512_iv;
+            sha->hash_len = 64;
+            break;
+        case HASH_ID_SHA512_224:
+            sha->iv = sha512_224_iv;
+            sha->hash_len = 28;
+            break;
+        case HASH_ID_SHA512_256:
+            sha->iv = sha512_256_iv;
+            sha->hash_len = 32;
+            break;
+        default:
+            return 0;
+    }
+
+    if ((hash_id == HASH_ID_SHA1) || (hash_id == HASH_ID_SHA224) ||
+        (hash_id == HASH_ID_SHA256))
+    {
+        if ((caps & SHA_CAP_SHANI) == 0)
+            return 0;
+        sha->block = (hash_id == HASH_ID_SHA1) ? sha1_block_shani :
+            sha256_block_shani;
+        sha->block_len = 64;
+        sha->word_len = 4;
+    }
+    else
+    {
+        if ((caps & SHA_CAP_AVX2) == 0)
+            return 0;
+        sha->block = sha512_block;
+        sha->block_x = sha512_block_x4_avx2;
+        sha->lanes = 4;
+        sha->block_len = 128;
+        sha->word_len = 8;
+    }
+    return 1;
+#else
+    (void)hash_id;
+    return 0;
+#endif
+}
+
+/**
+ * Initialize the in-tree hash object for hashing a new message.
+ *
+ * @param [in] sha  The in-tree hash object.
+ */
+void random_sha_init(RANDOM_SHA *sha)
+{
+    memcpy(&sha->s, sha->iv, 8 * sha->word_len);
+    sha->used = 0;
+    sha->total = 0;
+}
+
+/**
+ * Hash more data of the message.
+ *
+ * @param [in] sha   The in-tree hash object.
+ * @param [in] data  The data to hash.
+ * @param [in] len   The length of the data.
+ */
+void random_sha_update(RANDOM_SHA *sha, const void *data, uint32_t len)
+{
+    const uint8_t *d = data;
+    uint32_t n;
+
+    sha->total += len;
+    if (sha->used > 0)
+    {
+        n = sha->block_len - sha->used;
+        if (n > len)
+            n = len;
+        memcpy(sha->buf + sha->used, d, n);
+        sha->used += n;
+        d += n;
+        len -= n;
+        if (sha->used < sha->block_len)
+            return;
+        sha->block(&sha->s, sha->buf, 1);
+        sha->used = 0;
+    }
+    if (len >= sha->block_len)
+    {
+        n = len / sha->block_len;
+        sha->block(&sha->s, d, n);
+        d += n * sha->block_len;
+        len -= n * sha->block_len;
+    }
+    memcpy(sha->buf, d, len);
+    sha->used = len;
+}
+
+/**
+ * Pad a message of a length into blocks: 0x80, zeros and the length in bits
+ * at the end of the last block.
+ *
+ * @param [in] sha   The in-tree hash object.
+ * @param [in] buf   The buffer holding the end of the message.
+ * @param [in] used  The length of the end of the message in the buffer.
+ * @param [in] total  The total length of the message.
+ * @return  The length of the padded end of the message - one or two blocks.
+ */
+static uint32_t sha_pad(RANDOM_SHA *sha, uint8_t *buf, uint32_t used,
+    uint64_t total)
+{
+    uint32_t len = sha->block_len;
+    int i;
+
+    buf[used++] = 0x80;
+    /* The length field is 2 words. */
+    if (used > len - 2 * sha->word_len)
+        len += sha->block_len;
+    memset(buf + used, 0, len - used);
+    for (i=0; i<8; i++)
+        buf[len - 1 - i] = (uint8_t)((total * 8) >> (i * 8));
+    return len;
+}
+
+/**
+ * Write the digest of a hash state.
+ *
+ * @param [in] sha  The in-tree hash object.
+ * @param [in] s    The hash state.
+ * @param [in] out  The buffer to hold the digest.
+ */
+static void sha_digest(RANDOM_SHA *sha, const void *s, uint8_t *out)
+{
+    const uint32_t *s32 = s;
+    const uint64_t *s64 = s;
+    int i;
+
+    for (i=0; i<sha->hash_len; i++)
+    {
+        if (sha->word_len == 4)
+            out[i] = (uint8_t)(s32[i / 4] >> (24 - (i % 4) * 8));
+        else
+            out[i] = (uint8_t)(s64[i / 8] >> (56 - (i % 8) * 8));
+    }
+}
+
+/**
+ * Finish hashing the message and output the digest.
+ *
+ * @param [in] sha  The in-tree hash object.
+ * @param [in] out  The buffer to hold the digest.
+ */
+void random_sha_final(RANDOM_SHA *sha, void *out)
+{
+    uint8_t buf[2 * RANDOM_SHA_MAX_BLOCK_LEN];
+    uint32_t len;
+
+    memcpy(buf, sha->buf, sha->used);
+    len = sha_pad(sha, buf, sha->used, sha->total);
+    sha->block(&sha->s, buf, len / sha->block_len);
+    sha_digest(sha, &sha->s, out);
+}
+
+/**
+ * Hash a number of messages: v, v+1, v+2, ... and increment v past them.
+ * v is a big-endian number. Messages are hashed many at once when the
+ * implementation can.
+ *
+ * @param [in] sha   The in-tree hash object.
+ * @param [in] v     The first message.
+ * @param [in] vlen  The length of the messages.
+ * @param [in] n     The number of messages - at most RANDOM_SHA_LANES.
+ * @param [in] out   The buffer to hold the digests - one after the other.
+ */
+void random_sha_ctr(RANDOM_SHA *sha, uint8_t *v, uint32_t vlen, uint32_t n,
+    uint8_t *out)
+{
+    uint8_t m[RANDOM_SHA_LANES][2 * RANDOM_SHA_MAX_BLOCK_LEN];
+    uint64_t s[RANDOM_SHA_LANES][8];
+    uint32_t i, b, len = 0;
+    int32_t j;
+
+    if ((sha->block_x == NULL) || (n < 2) ||
+        (vlen + 1 + 2 * sha->word_len > 2 * (uint32_t)sha->block_len))
+    {
+        for (i=0; i<n; i++, out+=sha->hash_len)
+        {
+            random_sha_init(sha);
+            random_sha_update(sha, v, vlen);
+            random_sha_final(sha, out);
+            for (j=vlen-1; j>=0 && (++v[j] == 0); j--) ;
+        }
+        return;
+    }
+
+    /* Each lane hashes the next number - unused lanes are ignored. */
+    for (i=0; i<sha->lanes; i++)
+    {
+        memcpy(m[i], v, vlen);
+        len = sha_pad(sha, m[i], vlen, vlen);
+        memcpy(s[i], sha->iv, sizeof(s[i]));
+        if (i < n)
+            for (j=vlen-1; j>=0 && (++v[j] == 0); j--) ;
+    }
+    for (b=0; b<len; b+=sha->block_len)
+        sha->block_x(s, m[0] + b, sizeof(m[0]));
+    for (i=0; i<n; i++, out+=sha->hash_len)
+        sha_digest(sha, s[i], out);
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2016 Sean Parkinson (sparkinson@iprimus.com.au)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* In-tree SHA implementations using CPU extensions for the Hash_DRBG.
+ * SHA-1 and SHA-256 use the Intel SHA extensions. The SHA-512 family hashes
+ * four messages at once with AVX2 when generating, otherwise one at a time
+ * with scalar code.
+ */
+
+#ifndef RANDOM_SHA_H
+#define RANDOM_SHA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** The maximum number of messages hashed at once. */
+#define RANDOM_SHA_LANES		4
+/** The maximum block length of the hash algorithms. */
+#define RANDOM_SHA_MAX_BLOCK_LEN	128
+
+/**
+ * Process blocks of data with a hash algorithm.
+ *
+ * @param [in] state   The hash state.
+ * @param [in] data    The blocks of data.
+ * @param [in] blocks  The number of blocks.
+ */
+typedef void (RANDOM_SHA_BLOCK)(void *state, const uint8_t *data,
+    size_t blocks);
+
+/**
+ * Process one block of data for each of a number of hash states at once.
+ *
+ * @param [in] state   The hash states - one after the other.
+ * @param [in] data    The blocks of data - one per state.
+ * @param [in] stride  The distance between the blocks of data.
+ */
+typedef void (RANDOM_SHA_BLOCK_X)(void *state, const uint8_t *data,
+    size_t stride);
+
+/** The in-tree hash object. */
+typedef struct random_sha_st
+{
+    /** The hash state. */
+    union
+    {
+        uint32_t s32[8];
+        uint64_t s64[8];
+    } s;
+    /** Data waiting for a full block. */
+    uint8_t buf[RANDOM_SHA_MAX_BLOCK_LEN];
+    /** The length of data waiting. */
+    uint32_t used;
+    /** The total length of data hashed. */
+    uint64_t total;
+    /** The initial hash state. */
+    const void *iv;
+    /** The block function. NULL when there is no in-tree implementation. */
+    RANDOM_SHA_BLOCK *block;
+    /** The function hashing a block of many messages at once. May be NULL. */
+    RANDOM_SHA_BLOCK_X *block_x;
+    /** The number of messages block_x hashes at once. */
+    uint16_t lanes;
+    /** The length of the digest output. */
+    uint16_t hash_len;
+    /** The length of a block. */
+    uint16_t block_len;
+    /** The size of a word of the state: 4 or 8 bytes. */
+    uint16_t word_len;
+} RANDOM_SHA;
+
+int random_sha_setup(RANDOM_SHA *sha, int hash_id);
+void random_sha_init(RANDOM_SHA *sha);
+void random_sha_update(RANDOM_SHA *sha, const void *data, uint32_t len);
+void random_sha_final(RANDOM_SHA *sha, void *out);
+void random_sha_ctr(RANDOM_SHA *sha, uint8_t *v, uint32_t vlen, uint32_t n,
+    uint8_t *out);
+
+#endif
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2016 Sean Parkinson (sparkinson@iprimus.com.au)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* This code implements a combining front-end for a random number generator
+ * object shared by many threads. Requests are published on a lock-free stack.
+ * The thread that takes the combiner flag serves all published requests,
+ * generating the data for a batch of requests with one scatter generate
+ * straight into their buffers. Based on flat combining -
+ *   Danny Hendler, Itai Incze, Nir Shavit, Moran Tzafrir: Flat Combining and
+ *   the Synchronization-Parallelism Tradeoff. SPAA 2010.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <sched.h>
+#include "random_lcl.h"
+
+/** The maximum number of requests served by one generate. */
+#define RANDOM_SHARED_IOV_MAX		64
+/** The maximum length of data generated for a batch - the most the generator
+ * produces with one state update. */
+#define RANDOM_SHARED_BATCH_MAX		(1 << 16)
+/** The maximum number of times the combiner takes the published requests
+ * before giving up the combiner flag. */
+#define RANDOM_SHARED_PASSES		8
+/** The number of times to spin waiting before yielding the CPU. */
+#define RANDOM_SHARED_SPINS		64
+/** The size of a cache line - keeps the contended fields apart. */
+#define RANDOM_SHARED_LINE		64
+
+#if defined(CPU_X86_64) && (defined(CC_GCC) || defined(CC_CLANG))
+/** Hint to the CPU that this is a spin loop. */
+#define SPIN_PAUSE()		__builtin_ia32_pause()
+#else
+#define SPIN_PAUSE()
+#endif
+
+/** A request for generated data published by a thread. */
+typedef struct random_shared_req_st
+{
+    /** The next published request. */
+    struct random_shared_req_st *next;
+    /** The buffer to put the generated data into. */
+    uint8_t *data;
+    /** The length of the data to generate. */
+    uint32_t len;
+    /** The result of generating. */
+    int ret;
+    /** Set when the request has been served. */
+    int done;
+} RANDOM_SHARED_REQ;
+
+/** The combining front-end of a shared random number generator object. */
+struct random_shared_st
+{
+    /** The stack of published requests. */
+    RANDOM_SHARED_REQ *head;
+    uint8_t pad1[RANDOM_SHARED_LINE - sizeof(RANDOM_SHARED_REQ *)];
+    /** Set while a thread is combining. */
+    int combining;
+    uint8_t pad2[RANDOM_SHARED_LINE - sizeof(int)];
+    /** The random number generator object - only used by the combiner. */
+    RANDOM *random;
+};
+
+/**
+ * Creates a combining front-end for a random number generator object that is
+ * shared by many threads.
+ * The random object is not owned - it must be initialized, must outlive the
+ * front-end and must only be used for generating through the front-end while
+ * it is shared.
+ *
+ * @param [in]  random  The initialized random number generator object.
+ * @param [out] shared  The combining front-end.
+ * @return  RANDOM_ERR_PARAM_NULL when a parameter is NULL.<br>
+ *          RANDOM_ERR_ALLOC on dynamic memory allocation failure.<br>
+ *          0 otherwise.
+ */
+int RANDOM_SHARED_new(RANDOM *random, RANDOM_SHARED **shared)
+{
+    int ret = 0;
+    RANDOM_SHARED *s;
+
+    if ((random == NULL) || (shared == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+
+    s = malloc(sizeof(*s));
+    if (s == NULL)
+    {
+        ret = RANDOM_ERR_ALLOC;
+        goto end;
+    }
+    s->head = NULL;
+    s->combining = 0;
+    s->random = random;
+
+    *shared = s;
+end:
+    return ret;
+}
+
+/**
+ * Dispose of the combining front-end.
+ * The random number generator object is not freed. No thread may be
+ * generating through the front-end.
+ *
+ * @param [in] shared  The combining front-end.
+ */
+void RANDOM_SHARED_free(RANDOM_SHARED *shared)
+{
+    free(shared);
+}
+
+/**
+ * Mark a request as served.
+ * The request belongs to a waiting thread and must not be touched after.
+ *
+ * @param [in] req  The request.
+ * @param [in] ret  The result of generating.
+ */
+static void shared_req_done(RANDOM_SHARED_REQ *req, int ret)
+{
+    req->ret = ret;
+    __atomic_store_n(&req->done, 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * Serve a list of requests.
+ * Requests are gathered into batches and the data for a batch is generated
+ * straight into the waiters' buffers with one scatter generate.
+ *
+ * @param [in] shared  The combining front-end.
+ * @param [in] req     The list of requests.
+ */
+static void shared_serve(RANDOM_SHARED *shared, RANDOM_SHARED_REQ *req)
+{
+    int ret;
+    int i, cnt;
+    RANDOM_SHARED_REQ *batch, *next;
+    size_t len;
+    struct iovec iov[RANDOM_SHARED_IOV_MAX];
+
+    while (req != NULL)
+    {
+        /* Gather requests up to the per-request limit of the generator. A
+         * large request is a batch on its own. */
+        batch = req;
+        len = 0;
+        for (cnt=0; (req != NULL) && (cnt < RANDOM_SHARED_IOV_MAX) &&
+             ((cnt == 0) || (len + req->len <= RANDOM_SHARED_BATCH_MAX));
+             cnt++)
+        {
+            iov[cnt].iov_base = req->data;
+            iov[cnt].iov_len = req->len;
+            len += req->len;
+            req = req->next;
+        }
+
+        ret = RANDOM_generatev(shared->random, iov, cnt);
+        for (i=0; i<cnt; i++, batch=next)
+        {
+            next = batch->next;
+            shared_req_done(batch, ret);
+        }
+    }
+}
+
+/**
+ * Generate random data using a random number generator object shared by many
+ * threads.
+ * The request is published and either served by the thread currently
+ * combining or, when none is, this thread becomes the combiner and serves all
+ * published requests.
+ *
+ * @param [in] shared  The combining front-end.
+ * @param [in] data    The generated data.
+ * @param [in] len     The length the data to generate.
+ * @return  RANDOM_ERR_PARAM_NULL when shared or data is NULL.<br>
+ *          RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int RANDOM_SHARED_generate(RANDOM_SHARED *shared, void *data, uint32_t len)
+{
+    RANDOM_SHARED_REQ req;
+    RANDOM_SHARED_REQ *list;
+    int i, spins = 0;
+
+    if ((shared == NULL) || (data == NULL))
+        return RANDOM_ERR_PARAM_NULL;
+    if (len == 0)
+        return 0;
+
+    req.data = data;
+    req.len = len;
+    req.ret = 0;
+    req.done = 0;
+
+    /* Publish the request. */
+    req.next = __atomic_load_n(&shared->head, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&shared->head, &req.next, &req, 1,
+        __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+    {
+    }
+
+    while (!__atomic_load_n(&req.done, __ATOMIC_ACQUIRE))
+    {
+        if ((__atomic_load_n(&shared->combining, __ATOMIC_RELAXED) == 0) &&
+            (__atomic_exchange_n(&shared->combining, 1, __ATOMIC_ACQUIRE) ==
+             0))
+        {
+            /* Combiner - serve requests until there are none or enough
+             * passes have been made. This thread's request was published
+             * before so is served in the first pass or by the previous
+             * combiner.
+             */
+            for (i=0; i<RANDOM_SHARED_PASSES; i++)
+            {
+                list = __atomic_exchange_n(&shared->head, NULL,
+                    __ATOMIC_ACQUIRE);
+                if (list == NULL)
+                    break;
+                shared_serve(shared, list);
+            }
+            __atomic_store_n(&shared->combining, 0, __ATOMIC_RELEASE);
+            spins = 0;
+        }
+        else if (++spins < RANDOM_SHARED_SPINS)
+            SPIN_PAUSE();
+        else
+        {
+            sched_yield();
+            spins = 0;
+        }
+    }
+
+    return req.ret;
+}
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2016 Sean Parkinson (sparkinson@iprimus.com.au)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* This code implements shuffling and sampling without replacement using the
+ * Fisher-Yates algorithm. Bounded indices are generated in batches, with a
+ * number of indices taken from each 64-bit word as described in -
+ *   Nevin Brackett-Rozinsky, Daniel Lemire: Batched Ranged Random Integer
+ *   Generation. Software: Practice and Experience 55 (1), 2025.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "random_lcl.h"
+
+/** The number of indices to generate before swapping elements. */
+#define SHUFFLE_BLOCK		64
+
+#if defined(CC_GCC) || defined(CC_CLANG)
+/** Prefetch the memory to be written. */
+#define PREFETCH(p)		__builtin_prefetch(p, 1)
+#else
+#define PREFETCH(p)
+#endif
+
+/**
+ * Determines the number of indices that can be taken from one 64-bit word.
+ * The product of the bounds must fit in 64 bits.
+ *
+ * @param [in] bound  The largest bound of the indices.
+ * @return  The number of indices to take from a word.
+ */
+static int batch_size(uint64_t bound)
+{
+    if (bound <= (1ULL << 10)) return 6;
+    if (bound <= (1ULL << 12)) return 5;
+    if (bound <= (1ULL << 16)) return 4;
+    if (bound <= (1ULL << 21)) return 3;
+    if (bound <= (1ULL << 32)) return 2;
+    return 1;
+}
+
+/**
+ * Generate unbiased indices for decreasing bounds.
+ * Index t is in the range [0, bound - t).
+ * Each 64-bit word is multiplied by a number of bounds in turn. The word is
+ * rejected when the remaining fraction is below 2^64 mod the product of the
+ * bounds.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [in]  bound   The bound of the first index.
+ * @param [in]  num     The number of indices to generate. Less than bound.
+ * @param [out] j       The generated indices.
+ * @return  RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+static int random_indices(RANDOM *random, uint64_t bound, uint32_t num,
+    uint64_t *j)
+{
+    int ret = 0;
+    uint32_t i, k, n;
+    uint64_t r, l, prod, t;
+
+    for (i=0; i<num; i+=k, bound-=k)
+    {
+        k = batch_size(bound);
+        if (k > num - i)
+            k = num - i;
+
+        ret = random_buf_u64(random, &r);
+        if (ret != 0) goto end;
+        for (n=0, l=r; n<k; n++)
+            j[i+n] = random_mul64(l, bound - n, &l);
+
+        /* Only calculate the threshold when may be rejected - the threshold
+         * is less than the product of the bounds.
+         */
+        for (n=1, prod=bound; n<k; n++)
+            prod *= bound - n;
+        if (l < prod)
+        {
+            t = -prod % prod;
+            while (l < t)
+            {
+                ret = random_buf_u64(random, &r);
+                if (ret != 0) goto end;
+                for (n=0, l=r; n<k; n++)
+                    j[i+n] = random_mul64(l, bound - n, &l);
+            }
+        }
+    }
+end:
+    return ret;
+}
+
+/**
+ * Swap two elements of an array.
+ *
+ * @param [in] a     The first element.
+ * @param [in] b     The second element.
+ * @param [in] size  The size of an element in bytes.
+ */
+static inline void swap_elem(uint8_t *a, uint8_t *b, size_t size)
+{
+    uint64_t t1, t2;
+    uint32_t u1, u2;
+    uint8_t c;
+
+    if (size == sizeof(t1))
+    {
+        memcpy(&t1, a, sizeof(t1));
+        memcpy(&t2, b, sizeof(t2));
+        memcpy(a, &t2, sizeof(t2));
+        memcpy(b, &t1, sizeof(t1));
+    }
+    else if (size == sizeof(u1))
+    {
+        memcpy(&u1, a, sizeof(u1));
+        memcpy(&u2, b, sizeof(u2));
+        memcpy(a, &u2, sizeof(u2));
+        memcpy(b, &u1, sizeof(u1));
+    }
+    else
+    {
+        for (; size >= sizeof(t1); size -= sizeof(t1))
+        {
+            memcpy(&t1, a, sizeof(t1));
+            memcpy(&t2, b, sizeof(t2));
+            memcpy(a, &t2, sizeof(t2));
+            memcpy(b, &t1, sizeof(t1));
+            a += sizeof(t1);
+            b += sizeof(t2);
+        }
+        for (; size > 0; size--)
+        {
+            c = *a;
+            *a++ = *b;
+            *b++ = c;
+        }
+    }
+}
+
+/**
+ * Shuffle the elements of an array into a uniformly random order.
+ * Indices for a block of swaps are generated first and the elements to be
+ * swapped are prefetched to hide cache misses on large arrays.
+ *
+ * @param [in]      random  A random number generator object.
+ * @param [in, out] base    The array of elements.
+ * @param [in]      n       The number of elements in the array.
+ * @param [in]      size    The size of an element in bytes.
+ * @return  RANDOM_ERR_PARAM_NULL when random or base is NULL.<br>
+ *          RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int RANDOM_shuffle(RANDOM *random, void *base, size_t n, size_t size)
+{
+    int ret = 0;
+    uint8_t *b = base;
+    uint64_t j[SHUFFLE_BLOCK];
+    uint32_t i, num;
+
+    if ((random == NULL) || (base == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+
+    /* Element n-1 is swapped with one of the first n elements, down to
+     * element 1.
+     */
+    while (n > 1)
+    {
+        num = (n - 1 < SHUFFLE_BLOCK) ? n - 1 : SHUFFLE_BLOCK;
+        ret = random_indices(random, n, num, j);
+        if (ret != 0) goto end;
+
+        for (i=0; i<num; i++)
+            PREFETCH(b + j[i] * size);
+        for (i=0; i<num; i++, n--)
+            swap_elem(b + (n - 1) * size, b + j[i] * size, size);
+    }
+end:
+    return ret;
+}
+
+/**
+ * Gets the value at a position of the virtual permutation.
+ * Positions not in the table hold their own index. Empty slots in the table
+ * have a key of all ones which is never a valid position.
+ *
+ * @param [in] key   The table of positions.
+ * @param [in] val   The table of values.
+ * @param [in] mask  The mask for the table size.
+ * @param [in] pos   The position.
+ * @param [out] slot The slot of the position in the table.
+ * @return  The value at the position.
+ */
+static uint32_t perm_get(uint32_t *key, uint32_t *val, uint32_t mask,
+    uint32_t pos, uint32_t *slot)
+{
+    uint32_t s = (uint32_t)((pos * 0x9e3779b97f4a7c15ULL) >> 32) & mask;
+
+    while ((key[s] != pos) && (key[s] != (uint32_t)-1))
+        s = (s + 1) & mask;
+    *slot = s;
+    return (key[s] == pos) ? val[s] : pos;
+}
+
+/**
+ * Sample k distinct indices from the range [0, n) in a uniformly random order.
+ * A partial Fisher-Yates shuffle is performed on a virtual permutation of the
+ * indices where only the positions swapped are kept in a hash table.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [in]  n       The number of indices to sample from.
+ * @param [in]  k       The number of indices to sample.
+ * @param [out] idx     The array of k sampled indices.
+ * @return  RANDOM_ERR_PARAM_NULL when random or idx is NULL.<br>
+ *          RANDOM_ERR_PARAM_RANGE when k is greater than n.<br>
+ *          RANDOM_ERR_ALLOC on dynamic memory allocation failure.<br>
+ *          RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int RANDOM_sample_indices(RANDOM *random, uint32_t n, uint32_t k,
+    uint32_t *idx)
+{
+    int ret = 0;
+    uint32_t *key = NULL;
+    uint32_t *val = NULL;
+    uint32_t mask, i, t, num, s, vi;
+    uint64_t size;
+    uint64_t j[SHUFFLE_BLOCK];
+
+    if ((random == NULL) || (idx == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+    if (k > n)
+    {
+        ret = RANDOM_ERR_PARAM_RANGE;
+        goto end;
+    }
+
+    /* Table at most half full. Calculated in 64 bits as 2 * k may not fit. */
+    for (size=1; size < 2 * (uint64_t)k; size <<= 1)
+        ;
+    if (size > SIZE_MAX / sizeof(*key))
+    {
+        ret = RANDOM_ERR_ALLOC;
+        goto end;
+    }
+    key = malloc(size * sizeof(*key));
+    val = malloc(size * sizeof(*val));
+    if ((key == NULL) || (val == NULL))
+    {
+        ret = RANDOM_ERR_ALLOC;
+        goto end;
+    }
+    memset(key, -1, size * sizeof(*key));
+    mask = (uint32_t)(size - 1);
+
+    /* Position i is swapped with one of the positions i to n-1. */
+    for (i=0; i<k; )
+    {
+        num = (k - i < SHUFFLE_BLOCK) ? k - i : SHUFFLE_BLOCK;
+        ret = random_indices(random, n - i, num, j);
+        if (ret != 0) goto end;
+
+        for (t=0; t<num; t++, i++)
+        {
+            /* Position i is not looked up again - only update the other. */
+            vi = perm_get(key, val, mask, i, &s);
+            idx[i] = perm_get(key, val, mask, i + j[t], &s);
+            key[s] = i + j[t];
+            val[s] = vi;
+        }
+    }
+end:
+    free(val);
+    free(key);
+    return ret;
+}
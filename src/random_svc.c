@@ -0,0 +1,723 @@
+/*
+ * Copyright (c) 2016 Sean Parkinson (sparkinson@iprimus.com.au)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* This code implements a random byte service for the processes of a host.
+ * The server fills a ring of random bytes in shared memory for each client.
+ * Clients take bytes from their ring with atomic loads and stores only - no
+ * system calls - and use a local random object when the ring is empty or the
+ * server is not running.
+ * All processes that can open the shared memory can read every ring - the
+ * memory is created readable and writable by the server's user only. The
+ * server does not trust what clients write to the shared memory. Clients only
+ * use shared memory owned by their user or root that no other user can
+ * access, so another user can't choose the bytes they take.
+ * Processes are tracked by process id so clients only connect to a server in
+ * the same PID namespace. A client is dropped and reconnected in the child
+ * after a fork so that the child does not return the parent's bytes.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "random_lcl.h"
+#include "random_svc.h"
+
+/** The least amount of space in a ring worth filling - a quarter. */
+#define RANDOM_SVC_FILL_SHIFT		2
+/** The time the server sleeps when no ring needed filling. */
+#define RANDOM_SVC_IDLE_NS		100000
+/** The number of idle sleeps between checks that clients are alive. */
+#define RANDOM_SVC_CHECK_IDLE		10000
+/** The alignment of the first ring in the shared memory. */
+#define RANDOM_SVC_RING_ALIGN		4096
+
+/** The client of the random byte service. */
+struct random_svc_st
+{
+    /** The name of the shared memory. */
+    char *name;
+    /** The fork generation the client was connected in. */
+    uint32_t fork_gen;
+    /** The mapped shared memory - NULL when not connected. */
+    void *map;
+    /** The length of the mapped shared memory. */
+    size_t map_len;
+    /** The slot owned by this client. */
+    RANDOM_SVC_SLOT *slot;
+    /** The ring of random bytes of the slot. */
+    uint8_t *ring;
+    /** The mask for the size of the ring. */
+    uint64_t mask;
+    /** The count of bytes taken from the ring. */
+    uint64_t tail;
+    /** The local random object - created when first needed. */
+    RANDOM *local;
+    /** The number of bytes taken from the ring. */
+    uint64_t shared_bytes;
+    /** The number of bytes generated with the local random object. */
+    uint64_t local_bytes;
+};
+
+/** The server of the random byte service. */
+struct random_svc_server_st
+{
+    /** The name of the shared memory. */
+    char *name;
+    /** The mapped shared memory. */
+    void *map;
+    /** The length of the mapped shared memory. */
+    size_t map_len;
+    /** The header of the shared memory. */
+    RANDOM_SVC_HDR *hdr;
+    /** The number of client slots - clients can write to the header. */
+    uint32_t slots;
+    /** The size of each ring. */
+    uint32_t ring_size;
+    /** The random object filling the rings. */
+    RANDOM *random;
+};
+
+/** The number of forks in this process's history - changed in the child. */
+static uint32_t svc_fork_gen;
+/** Registers the fork handler once. */
+static pthread_once_t svc_fork_once = PTHREAD_ONCE_INIT;
+
+/**
+ * Count a fork - called in the child.
+ */
+static void svc_fork_child()
+{
+    svc_fork_gen++;
+}
+
+/**
+ * Register the handler that counts forks.
+ */
+static void svc_fork_init()
+{
+    pthread_atfork(NULL, NULL, svc_fork_child);
+}
+
+/**
+ * Calculate the offset of the first ring in the shared memory.
+ *
+ * @param [in] slots  The number of client slots.
+ * @return  The offset of the first ring.
+ */
+static size_t svc_ring_off(uint32_t slots)
+{
+    size_t off = sizeof(RANDOM_SVC_HDR) + slots * sizeof(RANDOM_SVC_SLOT);
+
+    return (off + RANDOM_SVC_RING_ALIGN - 1) & ~(RANDOM_SVC_RING_ALIGN - 1);
+}
+
+/**
+ * Get a client slot in the shared memory.
+ *
+ * @param [in] hdr  The header of the shared memory.
+ * @param [in] i    The index of the slot.
+ * @return  The slot.
+ */
+static RANDOM_SVC_SLOT *svc_slot(RANDOM_SVC_HDR *hdr, uint32_t i)
+{
+    return (RANDOM_SVC_SLOT *)(hdr + 1) + i;
+}
+
+/**
+ * Get the ring of a client slot in the shared memory.
+ *
+ * @param [in] hdr        The header of the shared memory.
+ * @param [in] slots      The number of client slots.
+ * @param [in] ring_size  The size of each ring.
+ * @param [in] i          The index of the slot.
+ * @return  The ring.
+ */
+static uint8_t *svc_ring(RANDOM_SVC_HDR *hdr, uint32_t slots,
+    uint32_t ring_size, uint32_t i)
+{
+    return (uint8_t *)hdr + svc_ring_off(slots) + (size_t)i * ring_size;
+}
+
+/**
+ * Get the PID namespace of this process.
+ *
+ * @return  The inode of the PID namespace or 0 when unknown.
+ */
+static uint64_t svc_pid_ns()
+{
+#ifdef OS_LINUX
+    struct stat st;
+
+    if (stat("/proc/self/ns/pid", &st) == 0)
+        return st.st_ino;
+#endif
+    return 0;
+}
+
+/**
+ * Determine whether a process is running.
+ * The process id must be from this process's PID namespace.
+ *
+ * @param [in] pid  The process id.
+ * @return  1 when the process is running and 0 otherwise.
+ */
+static int svc_alive(int32_t pid)
+{
+    return (pid > 0) && ((kill(pid, 0) == 0) || (errno == EPERM));
+}
+
+/**
+ * Connect to the random byte service and take a client slot.
+ * Failing to connect is not an error - the client generates with a local
+ * random object instead. This includes shared memory that is owned by another
+ * user, other than root, or is accessible by other users.
+ *
+ * @param [in] svc   The client.
+ * @param [in] name  The name of the shared memory.
+ */
+static void svc_connect(RANDOM_SVC *svc, const char *name)
+{
+    int fd;
+    uint32_t i, slots, ring_size;
+    int32_t owner;
+    struct stat st;
+    RANDOM_SVC_HDR *hdr;
+
+    svc->fork_gen = svc_fork_gen;
+
+    fd = shm_open(name, O_RDWR, 0);
+    if (fd == -1)
+        return;
+    /* Shared memory created by another user could hold any bytes. */
+    if ((fstat(fd, &st) == 0) &&
+        ((st.st_uid == geteuid()) || (st.st_uid == 0)) &&
+        ((st.st_mode & 077) == 0) && (st.st_size >= (off_t)sizeof(*hdr)))
+    {
+        svc->map_len = st.st_size;
+        svc->map = mmap(NULL, svc->map_len, PROT_READ | PROT_WRITE,
+            MAP_SHARED, fd, 0);
+        if (svc->map == MAP_FAILED)
+            svc->map = NULL;
+    }
+    close(fd);
+    if (svc->map == NULL)
+        return;
+
+    hdr = svc->map;
+    if (__atomic_load_n(&hdr->magic, __ATOMIC_ACQUIRE) != RANDOM_SVC_MAGIC)
+        goto fail;
+    slots = hdr->slots;
+    ring_size = hdr->ring_size;
+    if ((ring_size == 0) || ((ring_size & (ring_size - 1)) != 0) ||
+        (svc_ring_off(slots) + (size_t)slots * ring_size > svc->map_len) ||
+        (hdr->pid_ns != svc_pid_ns()) || !svc_alive(hdr->pid))
+    {
+        goto fail;
+    }
+
+    for (i=0; i<slots; i++)
+    {
+        owner = 0;
+        if (__atomic_compare_exchange_n(&svc_slot(hdr, i)->owner, &owner,
+            (int32_t)getpid(), 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            break;
+        }
+    }
+    if (i == slots)
+        goto fail;
+
+    svc->slot = svc_slot(hdr, i);
+    svc->ring = svc_ring(hdr, slots, ring_size, i);
+    svc->mask = ring_size - 1;
+    /* Bytes put in the ring for an earlier owner are not used. */
+    svc->tail = __atomic_load_n(&svc->slot->head, __ATOMIC_ACQUIRE);
+    __atomic_store_n(&svc->slot->tail, svc->tail, __ATOMIC_RELEASE);
+    return;
+
+fail:
+    munmap(svc->map, svc->map_len);
+    svc->map = NULL;
+}
+
+/**
+ * Creates a client of the random byte service.
+ * When the service is not running, or has no free slots, the client generates
+ * with a local random object.
+ * A client must only be used by one thread at a time. In the child of a fork,
+ * the client takes a new slot and a new local random object when next used.
+ *
+ * @param [in]  name  The name of the shared memory. NULL for the default:
+ *                    RANDOM_SVC_NAME.
+ * @param [out] svc   The client.
+ * @return  RANDOM_ERR_PARAM_NULL when svc is NULL.<br>
+ *          RANDOM_ERR_ALLOC on dynamic memory allocation failure.<br>
+ *          0 otherwise.
+ */
+int RANDOM_SVC_new(const char *name, RANDOM_SVC **svc)
+{
+    int ret = 0;
+    RANDOM_SVC *s;
+
+    if (svc == NULL)
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+
+    s = calloc(1, sizeof(*s));
+    if (s != NULL)
+        s->name = strdup((name != NULL) ? name : RANDOM_SVC_NAME);
+    if ((s == NULL) || (s->name == NULL))
+    {
+        free(s);
+        ret = RANDOM_ERR_ALLOC;
+        goto end;
+    }
+    pthread_once(&svc_fork_once, svc_fork_init);
+    svc_connect(s, s->name);
+
+    *svc = s;
+end:
+    return ret;
+}
+
+/**
+ * Drop the connection to the random byte service.
+ * The slot is only given back when owned by this process - not when the
+ * connection was inherited over a fork.
+ *
+ * @param [in] svc  The client.
+ */
+static void svc_disconnect(RANDOM_SVC *svc)
+{
+    if (svc->map != NULL)
+    {
+        if (svc->fork_gen == svc_fork_gen)
+            __atomic_store_n(&svc->slot->owner, 0, __ATOMIC_RELEASE);
+        munmap(svc->map, svc->map_len);
+        svc->map = NULL;
+    }
+}
+
+/**
+ * Dispose of the client - the slot is given back to the service.
+ *
+ * @param [in] svc  The client.
+ */
+void RANDOM_SVC_free(RANDOM_SVC *svc)
+{
+    if (svc != NULL)
+    {
+        svc_disconnect(svc);
+        RANDOM_free(svc->local);
+        free(svc->name);
+        free(svc);
+    }
+}
+
+/**
+ * Determine whether the client is connected to the random byte service.
+ *
+ * @param [in] svc  The client.
+ * @return  1 when connected and 0 otherwise.
+ */
+int RANDOM_SVC_is_shared(RANDOM_SVC *svc)
+{
+    return (svc != NULL) && (svc->map != NULL);
+}
+
+/**
+ * Get the number of bytes the client took from the service and generated
+ * locally.
+ *
+ * @param [in]  svc     The client.
+ * @param [out] shared  The number of bytes taken from the service.
+ * @param [out] local   The number of bytes generated locally.
+ * @return  RANDOM_ERR_PARAM_NULL when a parameter is NULL.<br>
+ *          0 otherwise.
+ */
+int RANDOM_SVC_get_bytes(RANDOM_SVC *svc, uint64_t *shared, uint64_t *local)
+{
+    if ((svc == NULL) || (shared == NULL) || (local == NULL))
+        return RANDOM_ERR_PARAM_NULL;
+
+    *shared = svc->shared_bytes;
+    *local = svc->local_bytes;
+    return 0;
+}
+
+/**
+ * Generate random data.
+ * Bytes are taken from the client's ring. What the ring can't supply is
+ * generated with a local random object.
+ *
+ * @param [in] svc   The client.
+ * @param [in] data  The generated data.
+ * @param [in] len   The length the data to generate.
+ * @return  RANDOM_ERR_PARAM_NULL when svc or data is NULL.<br>
+ *          RANDOM_ERR_ALLOC on dynamic memory allocation failure.<br>
+ *          RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int RANDOM_SVC_generate(RANDOM_SVC *svc, void *data, uint32_t len)
+{
+    int ret = 0;
+    uint8_t *d = data;
+    uint64_t avail, pos;
+    uint32_t n, l;
+
+    if ((svc == NULL) || (data == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+
+    /* The slot and the local random object's state are shared with the
+     * parent - reconnect and reseed so the bytes differ. */
+    if (svc->fork_gen != svc_fork_gen)
+    {
+        svc_disconnect(svc);
+        RANDOM_free(svc->local);
+        svc->local = NULL;
+        svc_connect(svc, svc->name);
+    }
+
+    if (svc->map != NULL)
+    {
+        avail = __atomic_load_n(&svc->slot->head, __ATOMIC_ACQUIRE) -
+            svc->tail;
+        /* More than a ring of bytes is a corrupt slot - take none. */
+        if (avail > svc->mask + 1)
+            avail = 0;
+        n = (avail < len) ? avail : len;
+        if (n > 0)
+        {
+            pos = svc->tail & svc->mask;
+            l = (n < svc->mask + 1 - pos) ? n : svc->mask + 1 - pos;
+            memcpy(d, svc->ring + pos, l);
+            memcpy(d + l, svc->ring, n - l);
+            svc->tail += n;
+            __atomic_store_n(&svc->slot->tail, svc->tail, __ATOMIC_RELEASE);
+            svc->shared_bytes += n;
+            d += n;
+            len -= n;
+        }
+    }
+
+    if (len > 0)
+    {
+        if (svc->local == NULL)
+        {
+            ret = RANDOM_new(ENTROPY_METH_defaults, 256, 0, &svc->local);
+            if (ret == 0)
+                ret = RANDOM_init(svc->local, NULL, 0);
+            if (ret != 0)
+            {
+                RANDOM_free(svc->local);
+                svc->local = NULL;
+                goto end;
+            }
+        }
+        ret = RANDOM_generate(svc->local, d, len);
+        if (ret != 0) goto end;
+        svc->local_bytes += len;
+    }
+end:
+    return ret;
+}
+
+/**
+ * Creates the server of the random byte service.
+ * The shared memory is created, readable and writable by this user only. A
+ * shared memory of the same name left by a server that is no longer running is
+ * replaced.
+ * The random object is not owned - it must be initialized and must outlive the
+ * server.
+ *
+ * @param [in]  random     The random object to fill the rings with.
+ * @param [in]  name       The name of the shared memory. NULL for the
+ *                         default: RANDOM_SVC_NAME.
+ * @param [in]  slots      The number of client slots. 0 for the default.
+ * @param [in]  ring_size  The size of each ring - rounded up to a power of 2.
+ *                         0 for the default.
+ * @param [out] srv        The server.
+ * @return  RANDOM_ERR_PARAM_NULL when random or srv is NULL.<br>
+ *          RANDOM_ERR_ALLOC on dynamic memory allocation failure.<br>
+ *          RANDOM_ERR_SVC when the shared memory can't be created.<br>
+ *          0 otherwise.
+ */
+int RANDOM_SVC_server_new(RANDOM *random, const char *name, uint32_t slots,
+    uint32_t ring_size, RANDOM_SVC_SERVER **srv)
+{
+    int ret = 0;
+    int fd = -1;
+    uint32_t size;
+    RANDOM_SVC_SERVER *s = NULL;
+    RANDOM_SVC_HDR *hdr;
+
+    if ((random == NULL) || (srv == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+    if (name == NULL)
+        name = RANDOM_SVC_NAME;
+    if (slots == 0)
+        slots = RANDOM_SVC_SLOTS;
+    if (ring_size == 0)
+        ring_size = RANDOM_SVC_RING_SIZE;
+    for (size=RANDOM_SVC_LINE; size<ring_size; size<<=1)
+        ;
+
+    s = calloc(1, sizeof(*s));
+    if (s != NULL)
+        s->name = strdup(name);
+    if ((s == NULL) || (s->name == NULL))
+    {
+        ret = RANDOM_ERR_ALLOC;
+        goto end;
+    }
+    s->random = random;
+    s->slots = slots;
+    s->ring_size = size;
+    s->map_len = svc_ring_off(slots) + (size_t)slots * size;
+
+    fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if ((fd == -1) && (errno == EEXIST))
+    {
+        /* Replace shared memory left by a server that is not running. */
+        fd = shm_open(name, O_RDONLY, 0);
+        if (fd != -1)
+        {
+            hdr = mmap(NULL, sizeof(*hdr), PROT_READ, MAP_SHARED, fd, 0);
+            close(fd);
+            fd = -1;
+            /* A server in another PID namespace can't be checked. */
+            if ((hdr != MAP_FAILED) && (hdr->pid_ns == svc_pid_ns()) &&
+                !svc_alive(hdr->pid))
+            {
+                shm_unlink(name);
+            }
+            if (hdr != MAP_FAILED)
+                munmap(hdr, sizeof(*hdr));
+        }
+        fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    }
+    if (fd == -1)
+    {
+        ret = RANDOM_ERR_SVC;
+        goto end;
+    }
+    if (ftruncate(fd, s->map_len) != 0)
+    {
+        shm_unlink(name);
+        ret = RANDOM_ERR_SVC;
+        goto end;
+    }
+    s->map = mmap(NULL, s->map_len, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+        0);
+    if (s->map == MAP_FAILED)
+    {
+        s->map = NULL;
+        shm_unlink(name);
+        ret = RANDOM_ERR_SVC;
+        goto end;
+    }
+
+    s->hdr = s->map;
+    s->hdr->pid_ns = svc_pid_ns();
+    s->hdr->pid = getpid();
+    s->hdr->slots = slots;
+    s->hdr->ring_size = size;
+    /* Clients may connect once the magic is set. */
+    __atomic_store_n(&s->hdr->magic, RANDOM_SVC_MAGIC, __ATOMIC_RELEASE);
+
+    *srv = s;
+    s = NULL;
+end:
+    if (fd != -1)
+        close(fd);
+    if (s != NULL)
+    {
+        free(s->name);
+        free(s);
+    }
+    return ret;
+}
+
+/**
+ * Dispose of the server - the shared memory is removed.
+ * Connected clients keep their mapping and fall back to local generation.
+ *
+ * @param [in] srv  The server.
+ */
+void RANDOM_SVC_server_free(RANDOM_SVC_SERVER *srv)
+{
+    if (srv != NULL)
+    {
+        if (srv->map != NULL)
+        {
+            __atomic_store_n(&srv->hdr->magic, 0, __ATOMIC_RELEASE);
+            shm_unlink(srv->name);
+            munmap(srv->map, srv->map_len);
+        }
+        free(srv->name);
+        free(srv);
+    }
+}
+
+/**
+ * Fill the rings of the clients that have used enough of their bytes.
+ * The space in a ring is filled with one scatter generate. A slot with more
+ * bytes taken than put in, or with bytes missing, is corrupt and skipped.
+ *
+ * @param [in]  srv     The server.
+ * @param [out] filled  The number of bytes put into rings.
+ * @return  RANDOM_ERR_PARAM_NULL when a parameter is NULL.<br>
+ *          RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int RANDOM_SVC_server_fill(RANDOM_SVC_SERVER *srv, uint64_t *filled)
+{
+    int ret = 0;
+    uint32_t i;
+    uint64_t head, tail, space, pos;
+    uint32_t size;
+    RANDOM_SVC_SLOT *slot;
+    uint8_t *ring;
+    struct iovec iov[2];
+
+    if ((srv == NULL) || (filled == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+
+    *filled = 0;
+    size = srv->ring_size;
+    for (i=0; i<srv->slots; i++)
+    {
+        slot = svc_slot(srv->hdr, i);
+        if (__atomic_load_n(&slot->owner, __ATOMIC_RELAXED) == 0)
+            continue;
+
+        head = slot->head;
+        tail = __atomic_load_n(&slot->tail, __ATOMIC_ACQUIRE);
+        if (head - tail > size)
+            continue;
+        space = size - (head - tail);
+        if (space < (size >> RANDOM_SVC_FILL_SHIFT))
+            continue;
+
+        ring = svc_ring(srv->hdr, srv->slots, size, i);
+        pos = head & (size - 1);
+        iov[0].iov_base = ring + pos;
+        iov[0].iov_len = (space < size - pos) ? space : size - pos;
+        iov[1].iov_base = ring;
+        iov[1].iov_len = space - iov[0].iov_len;
+        ret = RANDOM_generatev(srv->random, iov, 2);
+        if (ret != 0) goto end;
+
+        /* The bytes are written before the client can see them. */
+        __atomic_store_n(&slot->head, head + space, __ATOMIC_RELEASE);
+        *filled += space;
+    }
+end:
+    return ret;
+}
+
+/**
+ * Give back the slots of clients that are no longer running.
+ * Clients only connect in the server's PID namespace so their process ids are
+ * meaningful here.
+ *
+ * @param [in] srv  The server.
+ */
+static void svc_server_reap(RANDOM_SVC_SERVER *srv)
+{
+    uint32_t i;
+    int32_t owner;
+    RANDOM_SVC_SLOT *slot;
+
+    for (i=0; i<srv->slots; i++)
+    {
+        slot = svc_slot(srv->hdr, i);
+        owner = __atomic_load_n(&slot->owner, __ATOMIC_RELAXED);
+        if ((owner != 0) && !svc_alive(owner))
+        {
+            __atomic_compare_exchange_n(&slot->owner, &owner, 0, 0,
+                __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+/**
+ * Run the server until told to stop.
+ * Rings are filled as clients use their bytes. The server sleeps briefly when
+ * no ring needed filling and occasionally frees the slots of clients that are
+ * no longer running.
+ *
+ * @param [in] srv   The server.
+ * @param [in] stop  Set to non-zero to stop the server.
+ * @return  RANDOM_ERR_PARAM_NULL when a parameter is NULL.<br>
+ *          RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int RANDOM_SVC_server_run(RANDOM_SVC_SERVER *srv, volatile int *stop)
+{
+    int ret = 0;
+    uint64_t filled;
+    uint32_t idle = 0;
+    struct timespec ts = { 0, RANDOM_SVC_IDLE_NS };
+
+    if ((srv == NULL) || (stop == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+
+    while (!*stop)
+    {
+        ret = RANDOM_SVC_server_fill(srv, &filled);
+        if (ret != 0) goto end;
+        if (filled > 0)
+            continue;
+
+        nanosleep(&ts, NULL);
+        if (++idle == RANDOM_SVC_CHECK_IDLE)
+        {
+            svc_server_reap(srv);
+            idle = 0;
+        }
+    }
+end:
+    return ret;
+}
+
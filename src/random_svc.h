@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2016 Sean Parkinson (sparkinson@iprimus.com.au)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* The shared memory layout of the random byte service and the server side
+ * used by the daemon, randd.
+ */
+
+#ifndef RANDOM_SVC_H
+#define RANDOM_SVC_H
+
+#include <stdint.h>
+#include <sys/types.h>
+#include "random.h"
+
+/** The magic number at the start of the shared memory - "RANDSVC1". */
+#define RANDOM_SVC_MAGIC		0x31435653444e4152ULL
+/** The default number of client slots. */
+#define RANDOM_SVC_SLOTS		16
+/** The default size of each client's ring of random bytes. */
+#define RANDOM_SVC_RING_SIZE		(1 << 20)
+/** The size of a cache line - keeps fields written by different processes
+ * apart. */
+#define RANDOM_SVC_LINE			64
+
+/** The header at the start of the shared memory. */
+typedef struct random_svc_hdr_st
+{
+    /** RANDOM_SVC_MAGIC when the server has finished setting up. */
+    uint64_t magic;
+    /** The PID namespace of the server - process ids are only compared when
+     * the same. 0 when unknown. */
+    uint64_t pid_ns;
+    /** The process id of the server. */
+    int32_t pid;
+    /** The number of client slots. */
+    uint32_t slots;
+    /** The size of each ring - a power of 2. */
+    uint32_t ring_size;
+    uint8_t pad[RANDOM_SVC_LINE - 2 * sizeof(uint64_t) - 3 * sizeof(uint32_t)];
+} RANDOM_SVC_HDR;
+
+/** A client slot. The ring of the slot follows the slots. */
+typedef struct random_svc_slot_st
+{
+    /** The process id of the client that owns the slot - 0 when free. */
+    int32_t owner;
+    uint8_t pad1[RANDOM_SVC_LINE - sizeof(int32_t)];
+    /** The count of bytes put into the ring - written by the server. */
+    uint64_t head;
+    uint8_t pad2[RANDOM_SVC_LINE - sizeof(uint64_t)];
+    /** The count of bytes taken from the ring - written by the client. */
+    uint64_t tail;
+    uint8_t pad3[RANDOM_SVC_LINE - sizeof(uint64_t)];
+} RANDOM_SVC_SLOT;
+
+/** The server of the random byte service. */
+typedef struct random_svc_server_st RANDOM_SVC_SERVER;
+
+int RANDOM_SVC_server_new(RANDOM *random, const char *name, uint32_t slots,
+    uint32_t ring_size, RANDOM_SVC_SERVER **srv);
+void RANDOM_SVC_server_free(RANDOM_SVC_SERVER *srv);
+int RANDOM_SVC_server_fill(RANDOM_SVC_SERVER *srv, uint64_t *filled);
+int RANDOM_SVC_server_run(RANDOM_SVC_SERVER *srv, volatile int *stop);
+
+#endif
+
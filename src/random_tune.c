@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2016 Sean Parkinson (sparkinson@iprimus.com.au)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* This code implements choosing the random number generator implementation
+ * by measured throughput. Each implementation is timed generating small and
+ * bulk requests, once per process or loaded from a profile file, and the
+ * fastest that meets the required security strength is chosen.
+ */
+
+#ifdef OS_LINUX
+#define _GNU_SOURCE
+#endif
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "random_lcl.h"
+
+/** The maximum number of implementations that are measured. */
+#define RANDOM_TUNE_METH_MAX		16
+/** The length of a small request. */
+#define RANDOM_TUNE_SMALL		32
+/** The length of a bulk request. */
+#define RANDOM_TUNE_BULK		16384
+/** The number of times each measurement is made - the best is kept. */
+#define RANDOM_TUNE_REPS		3
+/** The minimum time of one measurement in seconds. */
+#define RANDOM_TUNE_SECS		0.002
+/** The first line of a profile file. */
+#define RANDOM_TUNE_MAGIC		"random tune 1"
+/** The environment variable naming the profile file used on first use. */
+#define RANDOM_TUNE_ENV			"RANDOM_TUNE_FILE"
+
+/** Serializes measuring and choosing. */
+static pthread_mutex_t random_tune_lock = PTHREAD_MUTEX_INITIALIZER;
+/** Set when the implementations have been measured or loaded. */
+static int random_tuned;
+/** The small requests per second of each implementation. */
+static double random_tune_small[RANDOM_TUNE_METH_MAX];
+/** The bulk bytes per second of each implementation. */
+static double random_tune_bulk[RANDOM_TUNE_METH_MAX];
+
+/**
+ * Get the current time in seconds from a monotonic clock.
+ *
+ * @return  Time in seconds.
+ */
+static double random_tune_secs()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+}
+
+/**
+ * Get the name of the profile file from the environment.
+ * Ignored in setuid and setgid programs so that the caller can't make the
+ * library create and rename files at any path with their privileges.
+ *
+ * @return  The name of the profile file or NULL when not set or ignored.
+ */
+static const char *random_tune_env()
+{
+#if defined(OS_LINUX)
+    return secure_getenv(RANDOM_TUNE_ENV);
+#elif defined(OS_MACOSX)
+    return issetugid() ? NULL : getenv(RANDOM_TUNE_ENV);
+#else
+    return NULL;
+#endif
+}
+
+/**
+ * Measure the rate of generating requests of a length.
+ * The object is initialized with fixed entropy - no entropy is gathered and
+ * the generated data is discarded.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [in]  data    The buffer to generate into.
+ * @param [in]  len     The length of each request.
+ * @param [out] rate    The best rate of requests per second.
+ * @return  RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+static int random_tune_rate(RANDOM *random, uint8_t *data, uint32_t len,
+    double *rate)
+{
+    int ret = 0;
+    int i;
+    uint32_t ops, n;
+    double start, secs, best = 0;
+
+    for (i=0; i<RANDOM_TUNE_REPS; i++)
+    {
+        ops = 0;
+        start = random_tune_secs();
+        do
+        {
+            for (n=0; n<16; n++)
+            {
+                ret = RANDOM_generate(random, data, len);
+                if (ret != 0) goto end;
+            }
+            ops += n;
+            secs = random_tune_secs() - start;
+        }
+        while (secs < RANDOM_TUNE_SECS);
+
+        if (ops / secs > best)
+            best = ops / secs;
+    }
+
+    *rate = best;
+end:
+    return ret;
+}
+
+/**
+ * Measure the small and bulk rates of each implementation.
+ * An implementation that can't be measured has rates of 0.
+ *
+ * @return  RANDOM_ERR_ALLOC on dynamic memory allocation failure.<br>
+ *          0 otherwise.
+ */
+static int random_tune_measure()
+{
+    int ret = 0;
+    uint8_t i;
+    uint8_t entropy[RANDOM_TUNE_SMALL * 3] = { 0 };
+    uint8_t *data = NULL;
+    RANDOM *random;
+
+    data = malloc(RANDOM_TUNE_BULK);
+    if (data == NULL)
+    {
+        ret = RANDOM_ERR_ALLOC;
+        goto end;
+    }
+
+    for (i=0; (i<random_meth_num) && (i<RANDOM_TUNE_METH_MAX); i++)
+    {
+        random_tune_small[i] = 0;
+        random_tune_bulk[i] = 0;
+
+        random = NULL;
+        if ((RANDOM_new_by_id(ENTROPY_METH_defaults, random_meth[i].id, 0,
+            &random) != 0) ||
+            (RANDOM_init_with_entropy(random, entropy,
+                random_meth[i].bits * 3 / 16, NULL, 0) != 0) ||
+            (random_tune_rate(random, data, RANDOM_TUNE_SMALL,
+                &random_tune_small[i]) != 0) ||
+            (random_tune_rate(random, data, RANDOM_TUNE_BULK,
+                &random_tune_bulk[i]) != 0))
+        {
+            random_tune_small[i] = 0;
+        }
+        random_tune_bulk[i] *= RANDOM_TUNE_BULK;
+        RANDOM_free(random);
+    }
+end:
+    free(data);
+    return ret;
+}
+
+/**
+ * Load the rates of the implementations from a profile file.
+ * Each line after the first has the identifier of an implementation, its
+ * small requests per second and its bulk bytes per second.
+ *
+ * @param [in] file  The name of the profile file.
+ * @return  RANDOM_ERR_NOT_FOUND when the file can't be read or doesn't have a
+ *          valid rate for every implementation.<br>
+ *          0 otherwise.
+ */
+static int random_tune_load(const char *file)
+{
+    int ret = 0;
+    FILE *f;
+    char line[64];
+    unsigned int id;
+    double small, bulk;
+    uint8_t i;
+    uint32_t found = 0;
+
+    f = fopen(file, "r");
+    if (f == NULL)
+    {
+        ret = RANDOM_ERR_NOT_FOUND;
+        goto end;
+    }
+
+    if ((fgets(line, sizeof(line), f) == NULL) ||
+        (strncmp(line, RANDOM_TUNE_MAGIC, strlen(RANDOM_TUNE_MAGIC)) != 0))
+    {
+        ret = RANDOM_ERR_NOT_FOUND;
+        goto end;
+    }
+    while (fscanf(f, "%u %lf %lf", &id, &small, &bulk) == 3)
+    {
+        for (i=0; (i<random_meth_num) && (i<RANDOM_TUNE_METH_MAX); i++)
+        {
+            if ((random_meth[i].id == id) && (small > 0) && (bulk > 0))
+            {
+                random_tune_small[i] = small;
+                random_tune_bulk[i] = bulk;
+                found |= 1 << i;
+            }
+        }
+    }
+    for (i=0; (i<random_meth_num) && (i<RANDOM_TUNE_METH_MAX); i++)
+    {
+        if ((found & (1 << i)) == 0)
+        {
+            ret = RANDOM_ERR_NOT_FOUND;
+            goto end;
+        }
+    }
+end:
+    if (f != NULL) fclose(f);
+    return ret;
+}
+
+/**
+ * Save the rates of the implementations to a profile file.
+ * The profile is written to a temporary file that is renamed so that other
+ * processes never read a partial profile. Failure is ignored - the rates are
+ * measured again next time.
+ *
+ * @param [in] file  The name of the profile file.
+ */
+static void random_tune_save(const char *file)
+{
+    FILE *f;
+    char *tmp;
+    uint8_t i;
+    int ok;
+
+    tmp = malloc(strlen(file) + 5);
+    if (tmp == NULL)
+        return;
+    strcpy(tmp, file);
+    strcat(tmp, ".tmp");
+
+    f = fopen(tmp, "w");
+    if (f != NULL)
+    {
+        ok = (fprintf(f, "%s\n", RANDOM_TUNE_MAGIC) > 0);
+        for (i=0; (i<random_meth_num) && (i<RANDOM_TUNE_METH_MAX); i++)
+        {
+            ok &= (fprintf(f, "%u %.0f %.0f\n", random_meth[i].id,
+                random_tune_small[i], random_tune_bulk[i]) > 0);
+        }
+        ok &= (fclose(f) == 0);
+        if (!ok || (rename(tmp, file) != 0))
+            remove(tmp);
+    }
+    free(tmp);
+}
+
+/**
+ * Measure the implementations, or load the profile, with the lock held.
+ *
+ * @param [in] file  The name of the profile file. May be NULL.
+ * @return  RANDOM_ERR_ALLOC on dynamic memory allocation failure.<br>
+ *          0 otherwise.
+ */
+static int random_tune_locked(const char *file)
+{
+    int ret = 0;
+
+    if ((file == NULL) || (random_tune_load(file) != 0))
+    {
+        ret = random_tune_measure();
+        if (ret != 0) goto end;
+        if (file != NULL)
+            random_tune_save(file);
+    }
+    random_tuned = 1;
+end:
+    return ret;
+}
+
+/**
+ * Measure the throughput of the random number generator implementations.
+ * Used by RANDOM_new() when RANDOM_METH_FLAG_TUNED is passed. When a profile
+ * file is given and valid, the rates are loaded from it rather than measured,
+ * otherwise they are measured - taking about 100 milliseconds - and saved to
+ * it.
+ * When not called, the implementations are measured on the first use of
+ * RANDOM_METH_FLAG_TUNED with the profile file named by the environment
+ * variable RANDOM_TUNE_FILE, if set. The environment variable is ignored in
+ * setuid and setgid programs.
+ * The profile is only valid for the machine and build it was measured on.
+ *
+ * @param [in] file  The name of the profile file. May be NULL.
+ * @return  RANDOM_ERR_ALLOC on dynamic memory allocation failure.<br>
+ *          0 otherwise.
+ */
+int RANDOM_tune(const char *file)
+{
+    int ret;
+
+    pthread_mutex_lock(&random_tune_lock);
+    ret = random_tune_locked(file);
+    pthread_mutex_unlock(&random_tune_lock);
+
+    return ret;
+}
+
+/**
+ * Retrieves the fastest random number generator implementation that meets the
+ * requirements.
+ * The score of an implementation is the product of its small and bulk rates so
+ * that neither size dominates. Ties, and implementations that couldn't be
+ * measured, go to the first in the fixed order.
+ *
+ * @param [in]  bits   The number of bits of security required.
+ * @param [in]  flags  The flags required of the implementation.
+ * @param [out] meth   The random number generator implementation.
+ * @return  RANDOM_ERR_ALLOC on dynamic memory allocation failure when
+ *          measuring.<br>
+ *          RANDOM_ERR_NOT_FOUND when there is no matching implementation
+ *          available.<br>
+ *          0 otherwise.
+ */
+int random_tune_meth_get(uint16_t bits, uint16_t flags, RANDOM_METH **meth)
+{
+    int ret = 0;
+    uint8_t i;
+    RANDOM_METH *m = NULL;
+    double score, best = -1;
+
+    pthread_mutex_lock(&random_tune_lock);
+    /* On failure nothing is chosen - measuring is tried again next time. */
+    if (!random_tuned)
+        ret = random_tune_locked(random_tune_env());
+
+    for (i=0; (i<random_meth_num) && (i<RANDOM_TUNE_METH_MAX) && (ret == 0);
+        i++)
+    {
+        if ((random_meth[i].bits >= bits) &&
+            ((random_meth[i].flags & flags) == flags))
+        {
+            score = random_tune_small[i] * random_tune_bulk[i];
+            if (score > best)
+            {
+                m = &random_meth[i];
+                best = score;
+            }
+        }
+    }
+    pthread_mutex_unlock(&random_tune_lock);
+
+    if ((ret == 0) && (m == NULL))
+        ret = RANDOM_ERR_NOT_FOUND;
+    *meth = m;
+    return ret;
+}
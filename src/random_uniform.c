@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2016 Sean Parkinson (sparkinson@iprimus.com.au)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* This code implements unbiased bounded random integers using the
+ * multiply-shift rejection method described in -
+ *   Daniel Lemire: Fast Random Integer Generation in an Interval.
+ *   ACM Transactions on Modeling and Computer Simulation 29 (1), 2019.
+ */
+
+#include <stdint.h>
+#include "random_lcl.h"
+
+/**
+ * Reduce a random 32-bit word into the range [0, bound).
+ * Draws more words from the buffer when the word is rejected.
+ *
+ * @param [in]      random  A random number generator object.
+ * @param [in]      bound   The exclusive upper bound. Must not be 0.
+ * @param [in]      t       The rejection threshold: 2^32 mod bound.
+ * @param [in, out] r       On in, a random word. On out, the bounded value.
+ * @return  RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+static inline int uniform_u32(RANDOM *random, uint32_t bound, uint32_t t,
+    uint32_t *r)
+{
+    int ret = 0;
+    uint64_t m;
+
+    m = (uint64_t)*r * bound;
+    while ((uint32_t)m < t)
+    {
+        ret = random_buf_u32(random, r);
+        if (ret != 0) goto end;
+        m = (uint64_t)*r * bound;
+    }
+    *r = m >> 32;
+end:
+    return ret;
+}
+
+/**
+ * Reduce a random 64-bit word into the range [0, bound).
+ * Draws more words from the buffer when the word is rejected.
+ *
+ * @param [in]      random  A random number generator object.
+ * @param [in]      bound   The exclusive upper bound. Must not be 0.
+ * @param [in]      t       The rejection threshold: 2^64 mod bound.
+ * @param [in, out] r       On in, a random word. On out, the bounded value.
+ * @return  RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+static inline int uniform_u64(RANDOM *random, uint64_t bound, uint64_t t,
+    uint64_t *r)
+{
+    int ret = 0;
+    uint64_t h, l;
+
+    h = random_mul64(*r, bound, &l);
+    while (l < t)
+    {
+        ret = random_buf_u64(random, r);
+        if (ret != 0) goto end;
+        h = random_mul64(*r, bound, &l);
+    }
+    *r = h;
+end:
+    return ret;
+}
+
+/**
+ * Generate an unbiased random number in the range [0, bound).
+ * Data is drawn from the random object's buffer of generated data.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [in]  bound   The exclusive upper bound of the random number.
+ * @param [out] r       The random number.
+ * @return  RANDOM_ERR_PARAM_NULL when random or r is NULL.<br>
+ *          RANDOM_ERR_PARAM_RANGE when bound is 0.<br>
+ *          RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int RANDOM_uniform_u32(RANDOM *random, uint32_t bound, uint32_t *r)
+{
+    int ret;
+    uint32_t w;
+    uint64_t m;
+
+    if ((random == NULL) || (r == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+    if (bound == 0)
+    {
+        ret = RANDOM_ERR_PARAM_RANGE;
+        goto end;
+    }
+
+    ret = random_buf_u32(random, &w);
+    if (ret != 0) goto end;
+
+    /* Only calculate the threshold when the word may be rejected. */
+    m = (uint64_t)w * bound;
+    if ((uint32_t)m < bound)
+    {
+        ret = uniform_u32(random, bound, -bound % bound, &w);
+        if (ret != 0) goto end;
+    }
+    else
+        w = m >> 32;
+
+    *r = w;
+end:
+    return ret;
+}
+
+/**
+ * Generate an unbiased random number in the range [0, bound).
+ * Data is drawn from the random object's buffer of generated data.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [in]  bound   The exclusive upper bound of the random number.
+ * @param [out] r       The random number.
+ * @return  RANDOM_ERR_PARAM_NULL when random or r is NULL.<br>
+ *          RANDOM_ERR_PARAM_RANGE when bound is 0.<br>
+ *          RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int RANDOM_uniform_u64(RANDOM *random, uint64_t bound, uint64_t *r)
+{
+    int ret;
+    uint64_t w, h, l;
+
+    if ((random == NULL) || (r == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+    if (bound == 0)
+    {
+        ret = RANDOM_ERR_PARAM_RANGE;
+        goto end;
+    }
+
+    ret = random_buf_u64(random, &w);
+    if (ret != 0) goto end;
+
+    /* Only calculate the threshold when the word may be rejected. */
+    h = random_mul64(w, bound, &l);
+    if (l < bound)
+    {
+        ret = uniform_u64(random, bound, -bound % bound, &w);
+        if (ret != 0) goto end;
+    }
+    else
+        w = h;
+
+    *r = w;
+end:
+    return ret;
+}
+
+/**
+ * Generate an array of unbiased random numbers in the range [0, bound).
+ * Words are generated in bulk directly into the array and reduced in place.
+ * Rejected words are replaced from the random object's buffer.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [in]  bound   The exclusive upper bound of the random numbers.
+ * @param [out] r       The array of random numbers.
+ * @param [in]  num     The number of random numbers to generate.
+ * @return  RANDOM_ERR_PARAM_NULL when random or r is NULL.<br>
+ *          RANDOM_ERR_PARAM_RANGE when bound is 0.<br>
+ *          RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int RANDOM_uniform_u32_array(RANDOM *random, uint32_t bound, uint32_t *r,
+    uint32_t num)
+{
+    int ret = 0;
+    uint32_t i, n;
+    uint32_t t;
+
+    if ((random == NULL) || (r == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+    if (bound == 0)
+    {
+        ret = RANDOM_ERR_PARAM_RANGE;
+        goto end;
+    }
+
+    t = -bound % bound;
+    for (; num > 0; num -= n, r += n)
+    {
+        n = RANDOM_CHUNK_SIZE / sizeof(*r);
+        if (n > num)
+            n = num;
+
+        ret = random_buf_get(random, r, n * sizeof(*r));
+        if (ret != 0) goto end;
+
+        for (i=0; i<n; i++)
+        {
+            ret = uniform_u32(random, bound, t, &r[i]);
+            if (ret != 0) goto end;
+        }
+    }
+end:
+    return ret;
+}
+
+/**
+ * Generate an array of unbiased random numbers in the range [0, bound).
+ * Words are generated in bulk directly into the array and reduced in place.
+ * Rejected words are replaced from the random object's buffer.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [in]  bound   The exclusive upper bound of the random numbers.
+ * @param [out] r       The array of random numbers.
+ * @param [in]  num     The number of random numbers to generate.
+ * @return  RANDOM_ERR_PARAM_NULL when random or r is NULL.<br>
+ *          RANDOM_ERR_PARAM_RANGE when bound is 0.<br>
+ *          RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int RANDOM_uniform_u64_array(RANDOM *random, uint64_t bound, uint64_t *r,
+    uint32_t num)
+{
+    int ret = 0;
+    uint32_t i, n;
+    uint64_t t;
+
+    if ((random == NULL) || (r == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+    if (bound == 0)
+    {
+        ret = RANDOM_ERR_PARAM_RANGE;
+        goto end;
+    }
+
+    t = -bound % bound;
+    for (; num > 0; num -= n, r += n)
+    {
+        n = RANDOM_CHUNK_SIZE / sizeof(*r);
+        if (n > num)
+            n = num;
+
+        ret = random_buf_get(random, r, n * sizeof(*r));
+        if (ret != 0) goto end;
+
+        for (i=0; i<n; i++)
+        {
+            ret = uniform_u64(random, bound, t, &r[i]);
+            if (ret != 0) goto end;
+        }
+    }
+end:
+    return ret;
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2016 Sean Parkinson (sparkinson@iprimus.com.au)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Static tracepoints compatible with SystemTap SDT (USDT).
+ * Build with RANDOM_USDT defined to emit the probes. Each probe is a nop
+ * instruction and an ELF note in .note.stapsdt describing the location and
+ * arguments - no code runs unless a tracer (bpftrace, perf, SystemTap)
+ * attaches. Without RANDOM_USDT, or on unsupported platforms, the probes
+ * compile to nothing.
+ *
+ * All arguments are passed as unsigned 64-bit values. The provider is
+ * 'random'.
+ */
+
+#ifndef RANDOM_USDT_H
+#define RANDOM_USDT_H
+
+#include <stdint.h>
+
+#if defined(RANDOM_USDT) && defined(CPU_X86_64) && defined(OS_LINUX) && \
+    (defined(CC_GCC) || defined(CC_CLANG))
+
+/**
+ * Emit a probe point and its note.
+ * The semaphore address is 0 - the probe is always armed as a nop.
+ */
+#define RANDOM_USDT_PROBE(name, args, ...)                                    \
+    __asm__ __volatile__ (                                                    \
+        "990: nop\n"                                                          \
+        ".pushsection .note.stapsdt,\"?\",\"note\"\n"                         \
+        ".balign 4\n"                                                         \
+        ".4byte 992f-991f, 994f-993f, 3\n"                                    \
+        "991: .asciz \"stapsdt\"\n"                                           \
+        "992: .balign 4\n"                                                    \
+        "993: .8byte 990b\n"                                                  \
+        ".8byte _.stapsdt.base\n"                                             \
+        ".8byte 0\n"                                                          \
+        ".asciz \"random\"\n"                                                 \
+        ".asciz \"" #name "\"\n"                                              \
+        ".asciz \"" args "\"\n"                                               \
+        "994: .balign 4\n"                                                    \
+        ".popsection\n"                                                       \
+        ".ifndef _.stapsdt.base\n"                                            \
+        ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n"\
+        ".weak _.stapsdt.base\n"                                              \
+        ".hidden _.stapsdt.base\n"                                            \
+        "_.stapsdt.base: .space 1\n"                                          \
+        ".size _.stapsdt.base, 1\n"                                           \
+        ".popsection\n"                                                       \
+        ".endif\n"                                                            \
+        :: __VA_ARGS__)
+
+/** Probe with one argument. */
+#define RANDOM_USDT1(name, a)                                                 \
+    RANDOM_USDT_PROBE(name, "8@%0", "nor"((uint64_t)(a)))
+/** Probe with two arguments. */
+#define RANDOM_USDT2(name, a, b)                                              \
+    RANDOM_USDT_PROBE(name, "8@%0 8@%1", "nor"((uint64_t)(a)),                \
+        "nor"((uint64_t)(b)))
+/** Probe with three arguments. */
+#define RANDOM_USDT3(name, a, b, c)                                           \
+    RANDOM_USDT_PROBE(name, "8@%0 8@%1 8@%2", "nor"((uint64_t)(a)),           \
+        "nor"((uint64_t)(b)), "nor"((uint64_t)(c)))
+/** Probe with four arguments. */
+#define RANDOM_USDT4(name, a, b, c, d)                                        \
+    RANDOM_USDT_PROBE(name, "8@%0 8@%1 8@%2 8@%3", "nor"((uint64_t)(a)),      \
+        "nor"((uint64_t)(b)), "nor"((uint64_t)(c)), "nor"((uint64_t)(d)))
+
+#else
+
+#define RANDOM_USDT1(name, a)
+#define RANDOM_USDT2(name, a, b)
+#define RANDOM_USDT3(name, a, b, c)
+#define RANDOM_USDT4(name, a, b, c, d)
+
+#endif
+
+#endif
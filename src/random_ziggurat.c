@@ -0,0 +1,965 @@
+/*
+ * Copyright (c) 2016 Sean Parkinson (sparkinson@iprimus.com.au)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* This code implements normal and exponential random numbers using the
+ * ziggurat method described in -
+ *   George Marsaglia, Wai Wan Tsang: The Ziggurat Method for Generating
+ *   Random Variables. Journal of Statistical Software 5 (8), 2000.
+ * There are 256 layers in each ziggurat. A 64-bit word gives the layer in the
+ * bottom 8 bits, the sign of a normal in bit 8 and a 52-bit position in the
+ * top bits.
+ */
+
+#include <stdint.h>
+#include <math.h>
+#include "random_lcl.h"
+
+#if defined(CPU_X86_64) && (defined(CC_GCC) || defined(CC_CLANG))
+#include <immintrin.h>
+/** Use AVX2 kernel for the fast path. */
+#define RANDOM_ZIG_X86_64
+#endif
+
+/** The number of numbers to put through the fast path at a time. */
+#define ZIG_BLOCK		256
+
+/** The start of the tail of the normal ziggurat. */
+#define ZIG_NORM_R		3.6541528853610088
+/** The start of the tail of the exponential ziggurat. */
+#define ZIG_EXP_R		7.69711747013104972
+
+/* Tables generated with the recurrences of Marsaglia and Tsang using areas
+ * calculated from the starts of the tails above.
+ */
+/** Normal: thresholds of the layers scaled by 2^52. */
+static const uint64_t zig_norm_k[256] =
+{
+    0x000ef33d8025ef65ULL, 0x0000000000000000ULL, 0x000c08be98fbc6c9ULL,
+    0x000da354fabd814cULL, 0x000e51f67ec1eeefULL, 0x000eb255e9d3f780ULL,
+    0x000eef4b817ecabaULL, 0x000f19470afa44acULL, 0x000f37ed61ffcb18ULL,
+    0x000f4f469561255bULL, 0x000f61a5e41ba396ULL, 0x000f707a755396a4ULL,
+    0x000f7cb2ec28449bULL, 0x000f86f10c6357d3ULL, 0x000f8fa6578325ddULL,
+    0x000f9724c74dd0daULL, 0x000f9da907dbf508ULL, 0x000fa360f581fa72ULL,
+    0x000fa86fde5b4bf8ULL, 0x000facf160d354dcULL, 0x000fb0fb6718b90eULL,
+    0x000fb49f8d5374c5ULL, 0x000fb7ec2366fe77ULL, 0x000fbaece9a1e50cULL,
+    0x000fbdab9d040bedULL, 0x000fc03060ff6c57ULL, 0x000fc2821037a248ULL,
+    0x000fc4a67ae25bd1ULL, 0x000fc6a2977aee30ULL, 0x000fc87aa92896a4ULL,
+    0x000fca325e4bde85ULL, 0x000fcbcce902231aULL, 0x000fcd4d12f839c4ULL,
+    0x000fceb54d8fec99ULL, 0x000fd007bf1dc930ULL, 0x000fd1464dd6c4e5ULL,
+    0x000fd272a8e2f450ULL, 0x000fd38e4ff0c91eULL, 0x000fd49a9990b479ULL,
+    0x000fd598b8920f52ULL, 0x000fd689c08e99ecULL, 0x000fd76ea9c8e832ULL,
+    0x000fd848547b08e8ULL, 0x000fd9178bad2c8bULL, 0x000fd9dd07a7add2ULL,
+    0x000fda9970105e8bULL, 0x000fdb4d5dc02e1fULL, 0x000fdbf95c5bfcd0ULL,
+    0x000fdc9debb99a7dULL, 0x000fdd3b8118729dULL, 0x000fddd288342f8fULL,
+    0x000fde6364369f63ULL, 0x000fdeee708d514eULL, 0x000fdf7401a6b42eULL,
+    0x000fdff46599ed3eULL, 0x000fe06fe4bc24f1ULL, 0x000fe0e6c225a258ULL,
+    0x000fe1593c28b84bULL, 0x000fe1c78cbc3f98ULL, 0x000fe231e9db1ca9ULL,
+    0x000fe29885da1b91ULL, 0x000fe2fb8fb54186ULL, 0x000fe35b33558d4aULL,
+    0x000fe3b799d0002aULL, 0x000fe410e99ead7eULL, 0x000fe46746d47734ULL,
+    0x000fe4bad34c095bULL, 0x000fe50baed29524ULL, 0x000fe559f74ebc77ULL,
+    0x000fe5a5c8e41212ULL, 0x000fe5ef3e138689ULL, 0x000fe6366fd91077ULL,
+    0x000fe67b75c6d578ULL, 0x000fe6be661e11aaULL, 0x000fe6ff55e5f4f2ULL,
+    0x000fe73e5900a701ULL, 0x000fe77b823e9e39ULL, 0x000fe7b6e37070a1ULL,
+    0x000fe7f08d774242ULL, 0x000fe8289053f08cULL, 0x000fe85efb35173bULL,
+    0x000fe893dc840864ULL, 0x000fe8c741f0cebcULL, 0x000fe8f9387d4ef6ULL,
+    0x000fe929cc879b1cULL, 0x000fe95909d388eaULL, 0x000fe986fb939aa1ULL,
+    0x000fe9b3ac714865ULL, 0x000fe9df2694b6d5ULL, 0x000fea0973abe67bULL,
+    0x000fea329cf166a4ULL, 0x000fea5aab32952cULL, 0x000fea81a6d57419ULL,
+    0x000feaa797de1cefULL, 0x000feacc85f3d91fULL, 0x000feaf07865e63cULL,
+    0x000feb13762fec12ULL, 0x000feb3585fe2a4aULL, 0x000feb56ae3162b4ULL,
+    0x000feb76f4e284f9ULL, 0x000feb965fe62013ULL, 0x000febb4f4cf9d7cULL,
+    0x000febd2b8f449cfULL, 0x000febefb16e2e3dULL, 0x000fec0be31ebde8ULL,
+    0x000fec2752b15a14ULL, 0x000fec42049dafd3ULL, 0x000fec5bfd29f196ULL,
+    0x000fec75406ceef4ULL, 0x000fec8dd2500cb4ULL, 0x000feca5b6911f10ULL,
+    0x000fecbcf0c427feULL, 0x000fecd38454fb15ULL, 0x000fece97488c8b3ULL,
+    0x000fecfec47f91b7ULL, 0x000fed1377358528ULL, 0x000fed278f844903ULL,
+    0x000fed3b10242f4cULL, 0x000fed4dfbad586dULL, 0x000fed605498c3dcULL,
+    0x000fed721d414fe8ULL, 0x000fed8357e4a981ULL, 0x000fed9406a42cc8ULL,
+    0x000feda42b85b704ULL, 0x000fedb3c8746ab3ULL, 0x000fedc2df416652ULL,
+    0x000fedd171a46e52ULL, 0x000feddf813c8ad2ULL, 0x000feded0f90997fULL,
+    0x000fedfa1e0fd413ULL, 0x000fee06ae124bc4ULL, 0x000fee12c0d95a06ULL,
+    0x000fee1e579006dfULL, 0x000fee29734b6524ULL, 0x000fee34150ae4bbULL,
+    0x000fee3e3db89b3cULL, 0x000fee47ee2982f3ULL, 0x000fee51271db086ULL,
+    0x000fee59e9407f41ULL, 0x000fee623528b42dULL, 0x000fee6a0b5897f0ULL,
+    0x000fee716c3e077aULL, 0x000fee7858327b81ULL, 0x000fee7ecf7b06b9ULL,
+    0x000fee84d2484ab2ULL, 0x000fee8a60b66342ULL, 0x000fee8f7accc851ULL,
+    0x000fee94207e25daULL, 0x000fee9851a829ebULL, 0x000fee9c0e13485bULL,
+    0x000fee9f557273f3ULL, 0x000feea22762ccaeULL, 0x000feea4836b42abULL,
+    0x000feea668fc2d71ULL, 0x000feea7d76ed6f9ULL, 0x000feea8ce04fa0aULL,
+    0x000feea94be8333bULL, 0x000feea95029640fULL, 0x000feea8d9c0075dULL,
+    0x000feea7e7897653ULL, 0x000feea678481d24ULL, 0x000feea48aa29e82ULL,
+    0x000feea21d22e4d9ULL, 0x000fee9f2e352024ULL, 0x000fee9bbc26af2eULL,
+    0x000fee97c524f2e3ULL, 0x000fee93473c0a39ULL, 0x000fee8e40557515ULL,
+    0x000fee88ae369c79ULL, 0x000fee828e7f3dfcULL, 0x000fee7bdea7b887ULL,
+    0x000fee749bff37ffULL, 0x000fee6cc3a9bd5eULL, 0x000fee64529e007fULL,
+    0x000fee5b45a32888ULL, 0x000fee51994e57b5ULL, 0x000fee474a0006ceULL,
+    0x000fee3c53e12c4fULL, 0x000fee30b2e02ad7ULL, 0x000fee2462ad8204ULL,
+    0x000fee175eb83c59ULL, 0x000fee09a22a1447ULL, 0x000fedfb27e349cbULL,
+    0x000fedebea76216cULL, 0x000feddbe422047dULL, 0x000fedcb0ece39d3ULL,
+    0x000fedb964042cf3ULL, 0x000feda6dce938c9ULL, 0x000fed937237e98cULL,
+    0x000fed7f1c38a836ULL, 0x000fed69d2b9c02aULL, 0x000fed538d06adffULL,
+    0x000fed3c41dea422ULL, 0x000fed23e76a2fd7ULL, 0x000fed0a732fe643ULL,
+    0x000fecefda07fe33ULL, 0x000fecd4100eb7b8ULL, 0x000fecb708956eb4ULL,
+    0x000fec98b61230c0ULL, 0x000fec790a0da978ULL, 0x000fec57f50f31fdULL,
+    0x000fec356686c961ULL, 0x000fec114cb4b334ULL, 0x000febeb948e6fd0ULL,
+    0x000febc429a0b691ULL, 0x000feb9af5ee0cdcULL, 0x000feb6fe1c98542ULL,
+    0x000feb42d3ad1f9eULL, 0x000feb13b00b2d4bULL, 0x000feae2591a02e8ULL,
+    0x000feaaeae992256ULL, 0x000fea788d8ee326ULL, 0x000fea3fcffd73e5ULL,
+    0x000fea044c8dd9f6ULL, 0x000fe9c5d62f563aULL, 0x000fe9843ba947a3ULL,
+    0x000fe93f471d4728ULL, 0x000fe8f6bd76c5d6ULL, 0x000fe8aa5dc4e8e6ULL,
+    0x000fe859e07ab1eaULL, 0x000fe804f690a93fULL, 0x000fe7ab488233bfULL,
+    0x000fe74c751f6aa5ULL, 0x000fe6e8102aa201ULL, 0x000fe67da0b6abd8ULL,
+    0x000fe60c9f38307dULL, 0x000fe5947338f742ULL, 0x000fe51470977280ULL,
+    0x000fe48bd436f457ULL, 0x000fe3f9bffd1e37ULL, 0x000fe35d35eeb19bULL,
+    0x000fe2b5122fe4fdULL, 0x000fe20003995557ULL, 0x000fe13c82788314ULL,
+    0x000fe068c4ee67afULL, 0x000fdf82b02b71aaULL, 0x000fde87c57efeaaULL,
+    0x000fdd7509c63bfdULL, 0x000fdc46e529bf12ULL, 0x000fdaf8f82e0282ULL,
+    0x000fd985e1b2ba75ULL, 0x000fd7e6ef48cf04ULL, 0x000fd613adbd650bULL,
+    0x000fd40149e2f011ULL, 0x000fd1a1a7b4c7acULL, 0x000fcee204761f9eULL,
+    0x000fcba8d85e11b1ULL, 0x000fc7d26ecd2d22ULL, 0x000fc32b2f1e22ecULL,
+    0x000fbd6581c0b839ULL, 0x000fb606c4005433ULL, 0x000fac40582a2873ULL,
+    0x000f9e971e014597ULL, 0x000f89fa48a41dfbULL, 0x000f66c5f7f0302cULL,
+    0x000f1a5a4b331c49ULL,
+};
+
+/** Normal: widths of the layers divided by 2^52. */
+static const double zig_norm_w[256] =
+{
+    8.68362706080131504e-16, 4.77933017572782434e-17, 6.35435241740531654e-17,
+    7.45487048124773942e-17, 8.32936681579313671e-17, 9.06806040505951680e-17,
+    9.71486007656779635e-17, 1.02947503142410488e-16, 1.08234302884477123e-16,
+    1.13114701961090604e-16, 1.17663594570229483e-16, 1.21936172787143880e-16,
+    1.25974399146371125e-16, 1.29810998862640513e-16, 1.33472037368241425e-16,
+    1.36978648425712230e-16, 1.40348230012424018e-16, 1.43595294520569652e-16,
+    1.46732087423644416e-16, 1.49769046683910589e-16, 1.52715150035962226e-16,
+    1.55578181694607886e-16, 1.58364940092909076e-16, 1.61081401752749526e-16,
+    1.63732852039698754e-16, 1.66323990584208550e-16, 1.68859017086766161e-16,
+    1.71341701765596780e-16, 1.73775443658648791e-16, 1.76163319230010182e-16,
+    1.78508123169767495e-16, 1.80812402857991695e-16, 1.83078487648267699e-16,
+    1.85308513886180387e-16, 1.87504446393739014e-16, 1.89668097007747793e-16,
+    1.91801140648386395e-16, 1.93905129306251234e-16, 1.95981504266288417e-16,
+    1.98031606831281912e-16, 2.00056687762733448e-16, 2.02057915620716662e-16,
+    2.04036384154802242e-16, 2.05993118874037211e-16, 2.07929082904140321e-16,
+    2.09845182223703665e-16, 2.11742270357603567e-16, 2.13621152594498829e-16,
+    2.15482589785814729e-16, 2.17327301775643798e-16, 2.19155970504272856e-16,
+    2.20969242822353324e-16, 2.22767733047895683e-16, 2.24552025294143750e-16,
+    2.26322675592856984e-16, 2.28080213834501904e-16, 2.29825145544247036e-16,
+    2.31557953510408234e-16, 2.33279099280043758e-16, 2.34989024534709748e-16,
+    2.36688152357916235e-16, 2.38376888404542632e-16, 2.40055621981350775e-16,
+    2.41724727046750400e-16, 2.43384563137110434e-16, 2.45035476226149688e-16,
+    2.46677799523270695e-16, 2.48311854216108916e-16, 2.49937950162045440e-16,
+    2.51556386532965934e-16, 2.53167452417135975e-16, 2.54771427381694615e-16,
+    2.56368581998939832e-16, 2.57959178339286871e-16, 2.59543470433517169e-16,
+    2.61121704706702087e-16, 2.62694120385972713e-16, 2.64260949884119099e-16,
+    2.65822419160830878e-16, 2.67378748063236477e-16, 2.68930150647261740e-16,
+    2.70476835481199667e-16, 2.72019005932773355e-16, 2.73556860440868057e-16,
+    2.75090592773016862e-16, 2.76620392269639180e-16, 2.78146444075954558e-16,
+    2.79668929362423104e-16, 2.81188025534502173e-16, 2.82703906432448022e-16,
+    2.84216742521840705e-16, 2.85726701075460199e-16, 2.87233946347098044e-16,
+    2.88738639737848241e-16, 2.90240939955384283e-16, 2.91741003166694603e-16,
+    2.93238983144718263e-16, 2.94735031409293588e-16, 2.96229297362806697e-16,
+    2.97721928420902990e-16, 2.99213070138601406e-16, 3.00702866332133202e-16,
+    3.02191459196806251e-16, 3.03678989421180283e-16, 3.05165596297822021e-16,
+    3.06651417830895550e-16, 3.08136590840829816e-16, 3.09621251066292352e-16,
+    3.11105533263689395e-16, 3.12589571304399991e-16, 3.14073498269944765e-16,
+    3.15557446545280212e-16, 3.17041547910403000e-16, 3.18525933630440747e-16,
+    3.20010734544401236e-16, 3.21496081152744804e-16, 3.22982103703941607e-16,
+    3.24468932280169877e-16, 3.25956696882307937e-16, 3.27445527514370770e-16,
+    3.28935554267537066e-16, 3.30426907403912937e-16, 3.31919717440175283e-16,
+    3.33414115231237295e-16, 3.34910232054077895e-16, 3.36408199691876557e-16,
+    3.37908150518595029e-16, 3.39410217584149013e-16, 3.40914534700312702e-16,
+    3.42421236527501915e-16, 3.43930458662583183e-16, 3.45442337727858451e-16,
+    3.46957011461378452e-16, 3.48474618808741469e-16, 3.49995300016538198e-16,
+    3.51519196727607540e-16, 3.53046452078274108e-16, 3.54577210797743671e-16,
+    3.56111619309838942e-16, 3.57649825837265150e-16, 3.59191980508603143e-16,
+    3.60738235468235335e-16, 3.62288744989419349e-16, 3.63843665590734636e-16,
+    3.65403156156137144e-16, 3.66967378058870238e-16, 3.68536495289491549e-16,
+    3.70110674588289983e-16, 3.71690085582382396e-16, 3.73274900927794451e-16,
+    3.74865296456848967e-16, 3.76461451331202918e-16, 3.78063548200896087e-16,
+    3.79671773369794475e-16, 3.81286316967837788e-16, 3.82907373130524367e-16,
+    3.84535140186095956e-16, 3.86169820850914927e-16, 3.87811622433558721e-16,
+    3.89460757048192621e-16, 3.91117441837820591e-16, 3.92781899208054203e-16,
+    3.94454357072087761e-16, 3.96135049107613543e-16, 3.97824215026468309e-16,
+    3.99522100857856502e-16, 4.01228959246062957e-16, 4.02945049763632842e-16,
+    4.04670639241075044e-16, 4.06406002114225039e-16, 4.08151420790493873e-16,
+    4.09907186035326643e-16, 4.11673597380302521e-16, 4.13450963554423501e-16,
+    4.15239602940268686e-16, 4.17039844056831440e-16, 4.18852026071011082e-16,
+    4.20676499339901412e-16, 4.22513625986204839e-16, 4.24363780509307747e-16,
+    4.26227350434779810e-16, 4.28104737005311666e-16, 4.29996355916383230e-16,
+    4.31902638100262945e-16, 4.33824030562279080e-16, 4.35760997273684901e-16,
+    4.37714020125858796e-16, 4.39683599951052137e-16, 4.41670257615420398e-16,
+    4.43674535190656727e-16, 4.45696997211204307e-16, 4.47738232024753387e-16,
+    4.49798853244554968e-16, 4.51879501313005876e-16, 4.53980845187003401e-16,
+    4.56103584156742305e-16, 4.58248449810956766e-16, 4.60416208163115380e-16,
+    4.62607661954784666e-16, 4.64823653154320836e-16, 4.67065065671263256e-16,
+    4.69332828309332989e-16, 4.71627917983835327e-16, 4.73951363232586912e-16,
+    4.76304248053313935e-16, 4.78687716104872481e-16, 4.81102975314741918e-16,
+    4.83551302941152712e-16, 4.86034051145081294e-16, 4.88552653135360442e-16,
+    4.91108629959527054e-16, 4.93703598024033553e-16, 4.96339277440398824e-16,
+    4.99017501309182246e-16, 5.01740226071809045e-16, 5.04509543081872847e-16,
+    5.07327691573354306e-16, 5.10197073234156184e-16, 5.13120268630678373e-16,
+    5.16100055774322825e-16, 5.19139431175769958e-16, 5.22241633800023527e-16,
+    5.25410172417759733e-16, 5.28648856950494511e-16, 5.31961834533840038e-16,
+    5.35353631181649688e-16, 5.38829200133405320e-16, 5.42393978220171234e-16,
+    5.46053951907478140e-16, 5.49815735089281411e-16, 5.53686661246787600e-16,
+    5.57674893292657746e-16, 5.61789555355541666e-16, 5.66040892008242315e-16,
+    5.70440462129139007e-16, 5.75001376891989622e-16, 5.79738594572459464e-16,
+    5.84669289345547999e-16, 5.89813317647790041e-16, 5.95193814964144514e-16,
+    6.00837969627190931e-16, 6.06778040933344851e-16, 6.13052720872528061e-16,
+    6.19708989458162555e-16, 6.26804696330128341e-16, 6.34412240712750500e-16,
+    6.42623965954805442e-16, 6.51560331734499258e-16, 6.61382788509766317e-16,
+    6.72315046250558663e-16, 6.84680341756425876e-16, 6.98971833638761995e-16,
+    7.15999493483066422e-16, 7.37242430179879792e-16, 7.65893637080557177e-16,
+    8.11384933765648419e-16,
+};
+
+/** Normal: values of the density at the layer edges. */
+static const double zig_norm_f[256] =
+{
+    1.00000000000000000e+00, 9.77101701267670819e-01, 9.59879091800105999e-01,
+    9.45198953442298984e-01, 9.32060075959229906e-01, 9.19991505039346458e-01,
+    9.08726440052130324e-01, 8.98095921898342864e-01, 8.87984660755832822e-01,
+    8.78309655808916845e-01, 8.69008688036856491e-01, 8.60033621196330977e-01,
+    8.51346258458677507e-01, 8.42915653112203733e-01, 8.34716292986882991e-01,
+    8.26726833946220929e-01, 8.18929191603701812e-01, 8.11307874312655719e-01,
+    8.03849483170963830e-01, 7.96542330422958411e-01, 7.89376143566024036e-01,
+    7.82341832654801950e-01, 7.75431304981186620e-01, 7.68637315798485710e-01,
+    7.61953346836794720e-01, 7.55373506507095560e-01, 7.48892447219156376e-01,
+    7.42505296340150611e-01, 7.36207598126862095e-01, 7.29995264561475676e-01,
+    7.23864533468629667e-01, 7.17811932630721405e-01, 7.11834248878247866e-01,
+    7.05928501332753755e-01, 7.00091918136511060e-01, 6.94321916126116268e-01,
+    6.88616083004671253e-01, 6.82972161644994302e-01, 6.77388036218772971e-01,
+    6.71861719897081655e-01, 6.66391343908749656e-01, 6.60975147776662775e-01,
+    6.55611470579696931e-01, 6.50298743110816369e-01, 6.45035480820821960e-01,
+    6.39820277453056141e-01, 6.34651799287623164e-01, 6.29528779924836246e-01,
+    6.24450015547026061e-01, 6.19414360605833991e-01, 6.14420723888913445e-01,
+    6.09468064925773101e-01, 6.04555390697467332e-01, 5.99681752619124819e-01,
+    5.94846243767986893e-01, 5.90047996332825453e-01, 5.85286179263370787e-01,
+    5.80559996100790343e-01, 5.75868682972353163e-01, 5.71211506735252672e-01,
+    5.66587763256163890e-01, 5.61996775814523897e-01, 5.57437893618765501e-01,
+    5.52910490425831846e-01, 5.48413963255265369e-01, 5.43947731190025818e-01,
+    5.39511234256951577e-01, 5.35103932380457170e-01, 5.30725304403661502e-01,
+    5.26374847171683924e-01, 5.22052074672321398e-01, 5.17756517229755908e-01,
+    5.13487720747326515e-01, 5.09245245995747609e-01, 5.05028667943467791e-01,
+    5.00837575126148349e-01, 4.96671569052489326e-01, 4.92530263643868149e-01,
+    4.88413284705457584e-01, 4.84320269426682881e-01, 4.80250865909046365e-01,
+    4.76204732719505475e-01, 4.72181538467729756e-01, 4.68180961405693208e-01,
+    4.64202689048173911e-01, 4.60246417812842479e-01, 4.56311852678716101e-01,
+    4.52398706861848243e-01, 4.48506701507202732e-01, 4.44635565395739119e-01,
+    4.40785034665803765e-01, 4.36954852547985328e-01, 4.33144769112652095e-01,
+    4.29354541029441261e-01, 4.25583931338021748e-01, 4.21832709229495728e-01,
+    4.18100649837847949e-01, 4.14387534040890904e-01, 4.10693148270187991e-01,
+    4.07017284329473150e-01, 4.03359739221114288e-01, 3.99720314980197000e-01,
+    3.96098818515832174e-01, 3.92495061459315342e-01, 3.88908860018788549e-01,
+    3.85340034840077061e-01, 3.81788410873393436e-01, 3.78253817245618906e-01,
+    3.74736087137890861e-01, 3.71235057668239221e-01, 3.67750569779032255e-01,
+    3.64282468129003723e-01, 3.60830600989647754e-01, 3.57394820145780223e-01,
+    3.53974980800076555e-01, 3.50570941481405884e-01, 3.47182563956793477e-01,
+    3.43809713146850549e-01, 3.40452257044521645e-01, 3.37110066637005878e-01,
+    3.33783015830718233e-01, 3.30470981379163420e-01, 3.27173842813601290e-01,
+    3.23891482376391038e-01, 3.20623784956905300e-01, 3.17370638029913443e-01,
+    3.14131931596337066e-01, 3.10907558126286343e-01, 3.07697412504291890e-01,
+    3.04501391976649827e-01, 3.01319396100802883e-01, 2.98151326696685315e-01,
+    2.94997087799961644e-01, 2.91856585617094988e-01, 2.88729728482182701e-01,
+    2.85616426815501590e-01, 2.82516593083707412e-01, 2.79430141761637718e-01,
+    2.76356989295668098e-01, 2.73297054068576906e-01, 2.70250256365875186e-01,
+    2.67216518343561138e-01, 2.64195763997260802e-01, 2.61187919132720825e-01,
+    2.58192911337618902e-01, 2.55210669954661684e-01, 2.52241126055941900e-01,
+    2.49284212418528245e-01, 2.46339863501263634e-01, 2.43408015422750118e-01,
+    2.40488605940500394e-01, 2.37581574431237952e-01, 2.34686861872329872e-01,
+    2.31804410824338586e-01, 2.28934165414680230e-01, 2.26076071322380195e-01,
+    2.23230075763917429e-01, 2.20396127480151943e-01, 2.17574176724331131e-01,
+    2.14764175251173584e-01, 2.11966076307030155e-01, 2.09179834621124994e-01,
+    2.06405406397880714e-01, 2.03642749310334853e-01, 2.00891822494656563e-01,
+    1.98152586545775111e-01, 1.95425003514134277e-01, 1.92709036903589120e-01,
+    1.90004651670464958e-01, 1.87311814223800249e-01, 1.84630492426799270e-01,
+    1.81960655599522542e-01, 1.79302274522847638e-01, 1.76655321443734997e-01,
+    1.74019770081838748e-01, 1.71395595637505949e-01, 1.68782774801211510e-01,
+    1.66181285764482045e-01, 1.63591108232365695e-01, 1.61012223437511065e-01,
+    1.58444614155924313e-01, 1.55888264724479197e-01, 1.53343161060262828e-01,
+    1.50809290681845676e-01, 1.48286642732574525e-01, 1.45775208005994028e-01,
+    1.43274978973513406e-01, 1.40785949814444672e-01, 1.38308116448550705e-01,
+    1.35841476571253728e-01, 1.33386029691669128e-01, 1.30941777173644303e-01,
+    1.28508722279999515e-01, 1.26086870220185859e-01, 1.23676228201596544e-01,
+    1.21276805484790209e-01, 1.18888613442909977e-01, 1.16511665625610800e-01,
+    1.14145977827838349e-01, 1.11791568163837993e-01, 1.09448457146811631e-01,
+    1.07116667774683635e-01, 1.04796225622486888e-01, 1.02487158941935080e-01,
+    1.00189498768809809e-01, 9.79032790388622842e-02, 9.56285367130088187e-02,
+    9.33653119126908598e-02, 9.11136480663736342e-02, 8.88735920682757891e-02,
+    8.66451944505579608e-02, 8.44285095703533606e-02, 8.22235958132028627e-02,
+    8.00305158146630558e-02, 7.78493367020960392e-02, 7.56801303589270669e-02,
+    7.35229737139812684e-02, 7.13779490588903748e-02, 6.92451443970067693e-02,
+    6.71246538277884830e-02, 6.50165779712428421e-02, 6.29210244377581135e-02,
+    6.08381083495398642e-02, 5.87679529209337581e-02, 5.67106901062028948e-02,
+    5.46664613248889139e-02, 5.26354182767921758e-02, 5.06177238609477609e-02,
+    4.86135532158685213e-02, 4.66230949019303675e-02, 4.46465522512944427e-02,
+    4.26841449164744313e-02, 4.07361106559409256e-02, 3.88027074045261128e-02,
+    3.68842156885672845e-02, 3.49809414617160835e-02, 3.30932194585785155e-02,
+    3.12214171919202449e-02, 2.93659397581333137e-02, 2.75272356696030819e-02,
+    2.57058040085488965e-02, 2.39022033057958785e-02, 2.21170627073088641e-02,
+    2.03510962300445172e-02, 1.86051212757246433e-02, 1.68800831525431662e-02,
+    1.51770883079353248e-02, 1.34974506017398795e-02, 1.18427578579078877e-02,
+    1.02149714397014712e-02, 8.61658276939873159e-03, 7.05087547137322589e-03,
+    5.52240329925099676e-03, 4.03797259336303050e-03, 2.60907274610216273e-03,
+    1.26028593049859754e-03,
+};
+
+/** Exponential: thresholds of the layers scaled by 2^52. */
+static const uint64_t zig_exp_k[256] =
+{
+    0x000e290a13924be3ULL, 0x0000000000000000ULL, 0x0009beadebce18c1ULL,
+    0x000c377ac71f9e08ULL, 0x000d4ddb99075857ULL, 0x000de893fb8ca23eULL,
+    0x000e4a8e87c4328dULL, 0x000e8dff16ae1cbaULL, 0x000ebf2deab58c59ULL,
+    0x000ee49a6e8b9638ULL, 0x000f0204efd64ee5ULL, 0x000f19bdb8ea3c1bULL,
+    0x000f2d458bbe5bd1ULL, 0x000f3da104b78236ULL, 0x000f4b86d784571fULL,
+    0x000f577ad8a7784fULL, 0x000f61de83da32abULL, 0x000f6afb7843cce7ULL,
+    0x000f730a57372b44ULL, 0x000f7a37651b0e68ULL, 0x000f80a5bb6eea52ULL,
+    0x000f867189d3cb5bULL, 0x000f8bb1b4f8fbbdULL, 0x000f9079062292b8ULL,
+    0x000f94d70ca8d43aULL, 0x000f98d8c7dcaa99ULL, 0x000f9c8928abe083ULL,
+    0x000f9ff175b734a6ULL, 0x000fa319996bc47dULL, 0x000fa6085f8e9d07ULL,
+    0x000fa8c3a62e1991ULL, 0x000fab5084e1f660ULL, 0x000fadb36c84cccbULL,
+    0x000faff041086846ULL, 0x000fb20a6ea22bb9ULL, 0x000fb404fb42cb3cULL,
+    0x000fb5e295158173ULL, 0x000fb7a59e99727aULL, 0x000fb95038c8789dULL,
+    0x000fbae44ba684ebULL, 0x000fbc638d822e60ULL, 0x000fbdcf89209ffaULL,
+    0x000fbf29a303cfc5ULL, 0x000fc0731df1089cULL, 0x000fc1ad1ed6c8b1ULL,
+    0x000fc2d8b02b5c89ULL, 0x000fc3f6c4d92131ULL, 0x000fc5083ac9ba7dULL,
+    0x000fc60ddd1e9cd6ULL, 0x000fc7086622e825ULL, 0x000fc7f881009f0bULL,
+    0x000fc8decb41ac70ULL, 0x000fc9bbd623d7ecULL, 0x000fca9027c5b26dULL,
+    0x000fcb5c3c319c49ULL, 0x000fcc20864b4449ULL, 0x000fccdd70a35d40ULL,
+    0x000fcd935e34bf80ULL, 0x000fce42ab0db8bdULL, 0x000fceebace7ec01ULL,
+    0x000fcf8eb3b0d0e7ULL, 0x000fd02c0a049b60ULL, 0x000fd0c3f59d199cULL,
+    0x000fd156b7b5e27eULL, 0x000fd1e48d670341ULL, 0x000fd26daff73551ULL,
+    0x000fd2f2552684beULL, 0x000fd372af7233c1ULL, 0x000fd3eeee528f62ULL,
+    0x000fd4673e73543aULL, 0x000fd4dbc9e72ff7ULL, 0x000fd54cb856dc2cULL,
+    0x000fd5ba2f2c4119ULL, 0x000fd62451ba02c2ULL, 0x000fd68b415fcff4ULL,
+    0x000fd6ef1dabc160ULL, 0x000fd75004790eb6ULL, 0x000fd7ae120c583fULL,
+    0x000fd809612dbd09ULL, 0x000fd8620b40effaULL, 0x000fd8b8285b78fdULL,
+    0x000fd90bcf594b1dULL, 0x000fd95d15efd425ULL, 0x000fd9ac10bfa70cULL,
+    0x000fd9f8d364df06ULL, 0x000fda437086566bULL, 0x000fda8bf9e3c9feULL,
+    0x000fdad28062fed5ULL, 0x000fdb17141bff2cULL, 0x000fdb59c4648085ULL,
+    0x000fdb9a9fda83ccULL, 0x000fdbd9b46e3ed4ULL, 0x000fdc170f6b5d04ULL,
+    0x000fdc52bd81a3fbULL, 0x000fdc8ccacd07baULL, 0x000fdcc542dd3902ULL,
+    0x000fdcfc30bcb793ULL, 0x000fdd319ef77143ULL, 0x000fdd6597a0f60bULL,
+    0x000fdd98245a48a2ULL, 0x000fddc94e575271ULL, 0x000fddf91e64014fULL,
+    0x000fde279ce914caULL, 0x000fde54d1f0a06aULL, 0x000fde80c52a47cfULL,
+    0x000fdeab7def394eULL, 0x000fded50345eb35ULL, 0x000fdefd5be59fa0ULL,
+    0x000fdf248e39b26fULL, 0x000fdf4aa064b4afULL, 0x000fdf6f98435894ULL,
+    0x000fdf937b6f30baULL, 0x000fdfb64f414571ULL, 0x000fdfd818d48262ULL,
+    0x000fdff8dd07fed8ULL, 0x000fe018a08122c4ULL, 0x000fe03767adaa59ULL,
+    0x000fe05536c58a13ULL, 0x000fe07211ccb4c5ULL, 0x000fe08dfc94c532ULL,
+    0x000fe0a8fabe8ca1ULL, 0x000fe0c30fbb87a5ULL, 0x000fe0dc3ecf3a5aULL,
+    0x000fe0f48b107521ULL, 0x000fe10bf76a82efULL, 0x000fe122869e41ffULL,
+    0x000fe1383b4327e1ULL, 0x000fe14d17c83187ULL, 0x000fe1611e74c023ULL,
+    0x000fe1745169635aULL, 0x000fe186b2a09176ULL, 0x000fe19843ef4e07ULL,
+    0x000fe1a90705bf63ULL, 0x000fe1b8fd6fb37cULL, 0x000fe1c828951443ULL,
+    0x000fe1d689ba4bfdULL, 0x000fe1e4220099a4ULL, 0x000fe1f0f26655a0ULL,
+    0x000fe1fcfbc726d4ULL, 0x000fe2083edc2830ULL, 0x000fe212bc3bfeb4ULL,
+    0x000fe21c745adfe3ULL, 0x000fe225678a8895ULL, 0x000fe22d95fa23f4ULL,
+    0x000fe234ffb62282ULL, 0x000fe23ba4a800d9ULL, 0x000fe2418495fddcULL,
+    0x000fe2469f22bffbULL, 0x000fe24af3cce90dULL, 0x000fe24e81ee9858ULL,
+    0x000fe25148bcda19ULL, 0x000fe253474703feULL, 0x000fe2547c75fdc6ULL,
+    0x000fe254e70b754fULL, 0x000fe25485a0fd1aULL, 0x000fe25356a71450ULL,
+    0x000fe2515864173aULL, 0x000fe24e88f316f1ULL, 0x000fe24ae64296faULL,
+    0x000fe2466e132f60ULL, 0x000fe2411df611bdULL, 0x000fe23af34b6f73ULL,
+    0x000fe233eb40bf41ULL, 0x000fe22c02cee01bULL, 0x000fe22336b81710ULL,
+    0x000fe2198385e5ccULL, 0x000fe20ee586b707ULL, 0x000fe20358cb5dfbULL,
+    0x000fe1f6d92465b1ULL, 0x000fe1e9621f2c9eULL, 0x000fe1daef02c8daULL,
+    0x000fe1cb7accb0a6ULL, 0x000fe1bb002d22c9ULL, 0x000fe1a9798349b8ULL,
+    0x000fe196e0d9140cULL, 0x000fe1832fdebc44ULL, 0x000fe16e5fe5f931ULL,
+    0x000fe15869dccfcfULL, 0x000fe1414647fe78ULL, 0x000fe128ed3cf8b2ULL,
+    0x000fe10f565b69cfULL, 0x000fe0f478c633abULL, 0x000fe0d84b1bdd9eULL,
+    0x000fe0bac36e6688ULL, 0x000fe09bd73a6b5bULL, 0x000fe07b7b5d920aULL,
+    0x000fe059a40c26d2ULL, 0x000fe03644c5d7f8ULL, 0x000fe011504979b2ULL,
+    0x000fdfeab887b95cULL, 0x000fdfc26e94a447ULL, 0x000fdf986297e305ULL,
+    0x000fdf6c83bb8663ULL, 0x000fdf3ec0193eedULL, 0x000fdf0f04a5d30aULL,
+    0x000fdedd3d1aa204ULL, 0x000fdea953dcfc13ULL, 0x000fde7331e3100dULL,
+    0x000fde3abe9626f2ULL, 0x000fddffdfb1dbd5ULL, 0x000fddc2791ff351ULL,
+    0x000fdd826cd068c6ULL, 0x000fdd3f9a8d3856ULL, 0x000fdcf9dfc95b0cULL,
+    0x000fdcb1176a55feULL, 0x000fdc65198ba50bULL, 0x000fdc15bb3b2daaULL,
+    0x000fdbc2ce2dc4aeULL, 0x000fdb6c206aaacaULL, 0x000fdb117becb4a1ULL,
+    0x000fdab2a6379bf0ULL, 0x000fda4f5fdfb4e9ULL, 0x000fd9e76401f3a3ULL,
+    0x000fd97a67a9ce1fULL, 0x000fd90819221429ULL, 0x000fd8901f2d4b02ULL,
+    0x000fd812182170e1ULL, 0x000fd78d98e23cd3ULL, 0x000fd7022bb3f082ULL,
+    0x000fd66f4edf96b9ULL, 0x000fd5d473200305ULL, 0x000fd530f9ccff94ULL,
+    0x000fd48432b7b351ULL, 0x000fd3cd59a8469eULL, 0x000fd30b9368f90aULL,
+    0x000fd23dea45f500ULL, 0x000fd16349e2e04aULL, 0x000fd07a7a3ef98aULL,
+    0x000fcf8219b5df05ULL, 0x000fce7895bcfcdeULL, 0x000fcd5c220ad5e2ULL,
+    0x000fcc2aadbc17dcULL, 0x000fcae1d5e81fbcULL, 0x000fc97ed4e778f9ULL,
+    0x000fc7fe6d4d720eULL, 0x000fc65ccf39c2fcULL, 0x000fc4957623cb03ULL,
+    0x000fc2a2fc826dc7ULL, 0x000fc07ee19b01cdULL, 0x000fbe213c1cf493ULL,
+    0x000fbb8051ac1566ULL, 0x000fb890078d120eULL, 0x000fb5411a5b9a95ULL,
+    0x000fb18000547133ULL, 0x000fad334827f1e2ULL, 0x000fa839276708b9ULL,
+    0x000fa263b32e37edULL, 0x000f9b72d1c52cd1ULL, 0x000f930a1a281a05ULL,
+    0x000f889f023d820aULL, 0x000f7b577d2be5f3ULL, 0x000f69c650c40a8fULL,
+    0x000f51530f0916d8ULL, 0x000f2cb0e3c5933eULL, 0x000eeefb15d605d8ULL,
+    0x000e6da6ecf27460ULL,
+};
+
+/** Exponential: widths of the layers divided by 2^52. */
+static const double zig_exp_w[256] =
+{
+    1.93114801264183660e-15, 1.41780284879108441e-17, 2.32788249933824599e-17,
+    3.04878302470643326e-17, 3.66656977144748907e-17, 4.21793021892897388e-17,
+    4.72225615568627701e-17, 5.19119154462178852e-17, 5.63234710839550468e-17,
+    6.05100826064276466e-17, 6.45101650967275056e-17, 6.83526468037005407e-17,
+    7.20599395746890621e-17, 7.56498155373929933e-17, 7.91366439619510769e-17,
+    8.25322355635189409e-17, 8.58464361688505126e-17, 8.90875548656474283e-17,
+    9.22626796296637310e-17, 9.53779145052927188e-17, 9.84385608745592569e-17,
+    1.01449258090062940e-16, 1.04414094055853435e-16, 1.07336693234363844e-16,
+    1.10220287456701894e-16, 1.13067773464793343e-16, 1.15881760097055332e-16,
+    1.18664607304178862e-16, 1.21418458656943591e-16, 1.24145268623263870e-16,
+    1.26846825606061555e-16, 1.29524771519122842e-16, 1.32180618515388129e-16,
+    1.34815763357454470e-16, 1.37431499823676273e-16, 1.40029029468078617e-16,
+    1.42609470993212868e-16, 1.45173868448292992e-16, 1.47723198427635840e-16,
+    1.50258376414474562e-16, 1.52780262391016516e-16, 1.55289665815956962e-16,
+    1.57787350054595811e-16, 1.60274036333509089e-16, 1.62750407280835244e-16,
+    1.65217110104200763e-16, 1.67674759450782788e-16, 1.70123939987706463e-16,
+    1.72565208735682260e-16, 1.74999097184323675e-16, 1.77426113213805070e-16,
+    1.79846742844307141e-16, 1.82261451831958208e-16, 1.84670687127635762e-16,
+    1.87074878212982579e-16, 1.89474438326259016e-16, 1.91869765589159971e-16,
+    1.94261244044430424e-16, 1.96649244612990227e-16, 1.99034125978301438e-16,
+    2.01416235404858986e-16, 2.03795909496938816e-16, 2.06173474903084391e-16,
+    2.08549248971237711e-16, 2.10923540358915281e-16, 2.13296649602382940e-16,
+    2.15668869648389724e-16, 2.18040486351670095e-16, 2.20411778941115622e-16,
+    2.22783020457239500e-16, 2.25154478163313498e-16, 2.27526413932336941e-16,
+    2.29899084611801860e-16, 2.32272742368043662e-16, 2.34647635011809158e-16,
+    2.37024006306533887e-16, 2.39402096260693032e-16, 2.41782141405477104e-16,
+    2.44164375058941230e-16, 2.46549027577683039e-16, 2.48936326597022505e-16,
+    2.51326497260579703e-16, 2.53719762440079508e-16, 2.56116342946149876e-16,
+    2.58516457730823910e-16, 2.60920324082405769e-16, 2.63328157813314516e-16,
+    2.65740173441476178e-16, 2.68156584365799887e-16, 2.70577603036235092e-16,
+    2.73003441118879554e-16, 2.75434309656576242e-16, 2.77870419225412784e-16,
+    2.80311980087514308e-16, 2.82759202340497038e-16, 2.85212296063933089e-16,
+    2.87671471463158036e-16, 2.90136939010737537e-16, 2.92608909585895144e-16,
+    2.95087594612190327e-16, 2.97573206193725213e-16, 3.00065957250147390e-16,
+    3.02566061650707885e-16, 3.05073734347625110e-16, 3.07589191508999387e-16,
+    3.10112650651515430e-16, 3.12644330773167501e-16, 3.15184452486235228e-16,
+    3.17733238150736830e-16, 3.20290912008583347e-16, 3.22857700318655732e-16,
+    3.25433831493026100e-16, 3.28019536234543590e-16, 3.30615047676007382e-16,
+    3.33220601521148413e-16, 3.35836436187645773e-16, 3.38462792952404453e-16,
+    3.41099916099325966e-16, 3.43748053069806331e-16, 3.46407454616201674e-16,
+    3.49078374958506795e-16, 3.51761071944498276e-16, 3.54455807213601298e-16,
+    3.57162846364746524e-16, 3.59882459128492744e-16, 3.62614919543700312e-16,
+    3.65360506139050453e-16, 3.68119502119717566e-16, 3.70892195559513892e-16,
+    3.73678879598838537e-16, 3.76479852648778410e-16, 3.79295418601723344e-16,
+    3.82125887048875307e-16, 3.84971573505048764e-16, 3.87832799641179884e-16,
+    3.90709893524981826e-16, 3.93603189870207476e-16, 3.96513030295003809e-16,
+    3.99439763589868416e-16, 4.02383745995746934e-16, 4.05345341492839658e-16,
+    4.08324922100717804e-16, 4.11322868190383575e-16, 4.14339568808947407e-16,
+    4.17375422017631994e-16, 4.20430835243858558e-16, 4.23506225648215183e-16,
+    4.26602020507155817e-16, 4.29718657612332663e-16, 4.32856585687520945e-16,
+    4.36016264824156805e-16, 4.39198166936574146e-16, 4.42402776238099188e-16,
+    4.45630589739236109e-16, 4.48882117769261718e-16, 4.52157884522634748e-16,
+    4.55458428631724207e-16, 4.58784303767462271e-16, 4.62136079269642664e-16,
+    4.65514340808706923e-16, 4.68919691080991572e-16, 4.72352750539554799e-16,
+    4.75814158162855340e-16, 4.79304572263724704e-16, 4.82824671341258655e-16,
+    4.86375154978451191e-16, 4.89956744788614043e-16, 4.93570185413857748e-16,
+    4.97216245579170344e-16, 5.00895719205911408e-16, 5.04609426588843403e-16,
+    5.08358215641162445e-16, 5.12142963212354152e-16, 5.15964576484106179e-16,
+    5.19823994449949383e-16, 5.23722189484784844e-16, 5.27660169010988565e-16,
+    5.31638977268369024e-16, 5.35659697195905033e-16, 5.39723452433897885e-16,
+    5.43831409455963700e-16, 5.47984779841162965e-16, 5.52184822697523425e-16,
+    5.56432847249287216e-16, 5.60730215601396693e-16, 5.65078345696050637e-16,
+    5.69478714477634818e-16, 5.73932861283963536e-16, 5.78442391483599120e-16,
+    5.83008980381058637e-16, 5.87634377414005727e-16, 5.92320410669093137e-16,
+    5.97068991746009055e-16, 6.01882121002523628e-16, 6.06761893217000683e-16,
+    6.11710503708972175e-16, 6.16730254963062001e-16, 6.21823563806853269e-16,
+    6.26992969199332624e-16, 6.32241140693421147e-16, 6.37570887643942623e-16,
+    6.42985169241359472e-16, 6.48487105461890328e-16, 6.54079989036448088e-16,
+    6.59767298554456630e-16, 6.65552712834334282e-16, 6.71440126710648815e-16,
+    6.77433668409101032e-16, 6.83537718705127399e-16, 6.89756932090684778e-16,
+    6.96096260207488457e-16, 7.02560977844595884e-16, 7.09156711844958373e-16,
+    7.15889473320855308e-16, 7.22765693643812119e-16, 7.29792264752908509e-16,
+    7.36976584419124264e-16, 7.44326607216041458e-16, 7.51850902083251306e-16,
+    7.59558717533774877e-16, 7.67460055757842737e-16, 7.75565757121579058e-16,
+    7.83887596862285773e-16, 7.92438396157354999e-16, 8.01232150211308338e-16,
+    8.10284176591314635e-16, 8.19611287780612502e-16, 8.29231992858180916e-16,
+    8.39166734414679785e-16, 8.49438168364877010e-16, 8.60071496333494140e-16,
+    8.71094862938790402e-16, 8.82539833807213981e-16, 8.94441974851986457e-16,
+    9.06841559713166896e-16, 9.19784440981186494e-16, 9.33323132942295156e-16,
+    9.47518170652498405e-16, 9.62439834565847587e-16, 9.78170365478441980e-16,
+    9.94806847238387951e-16, 1.01246501442883194e-15, 1.03128436577561659e-15,
+    1.05143516040445497e-15, 1.07312819542240432e-15, 1.09662880685174078e-15,
+    1.12227749093503192e-15, 1.15052129630066634e-15, 1.18196352833042060e-15,
+    1.21744628323618153e-15, 1.25819580697551141e-15, 1.30609841071280816e-15,
+    1.36427861580578573e-15, 1.43848899321787231e-15, 1.54121907000641935e-15,
+    1.70910340771680548e-15,
+};
+
+/** Exponential: values of the density at the layer edges. */
+static const double zig_exp_f[256] =
+{
+    1.00000000000000000e+00, 9.38143680862174589e-01, 9.00469929925746371e-01,
+    8.71704332381203595e-01, 8.47785500623989607e-01, 8.26993296643050324e-01,
+    8.08421651523008378e-01, 7.91527636972495618e-01, 7.75956852040115552e-01,
+    7.61463388849896172e-01, 7.47868621985195103e-01, 7.35038092431423484e-01,
+    7.22867659593572021e-01, 7.11274760805076012e-01, 7.00192655082788162e-01,
+    6.89566496117077987e-01, 6.79350572264765362e-01, 6.69506316731924733e-01,
+    6.60000841078999700e-01, 6.50805833414570989e-01, 6.41896716427266090e-01,
+    6.33251994214366065e-01, 6.24852738703665866e-01, 6.16682180915207656e-01,
+    6.08725382079622013e-01, 6.00968966365232227e-01, 5.93400901691733429e-01,
+    5.86010318477268033e-01, 5.78787358602845026e-01, 5.71723048664825817e-01,
+    5.64809192912400171e-01, 5.58038282262587448e-01, 5.51403416540641289e-01,
+    5.44898237672439612e-01, 5.38516872002861802e-01, 5.32253880263043211e-01,
+    5.26104213983619728e-01, 5.20063177368233598e-01, 5.14126393814748561e-01,
+    5.08289776410642880e-01, 5.02549501841347723e-01, 4.96901987241549548e-01,
+    4.91343869594032534e-01, 4.85871987341884914e-01, 4.80483363930454210e-01,
+    4.75175193037377375e-01, 4.69944825283959977e-01, 4.64789756250426178e-01,
+    4.59707615642137690e-01, 4.54696157474615448e-01, 4.49753251162754997e-01,
+    4.44876873414548513e-01, 4.40065100842353896e-01, 4.35316103215636574e-01,
+    4.30628137288458834e-01, 4.25999541143034344e-01, 4.21428728997616575e-01,
+    4.16914186433002876e-01, 4.12454465997161179e-01, 4.08048183152032395e-01,
+    4.03694012530530277e-01, 3.99390684475231073e-01, 3.95136981833290157e-01,
+    3.90931736984797107e-01, 3.86773829084137655e-01, 3.82662181496009834e-01,
+    3.78595759409580790e-01, 3.74573567615902159e-01, 3.70594648435146001e-01,
+    3.66658079781514157e-01, 3.62762973354817775e-01, 3.58908472948749779e-01,
+    3.55093752866787460e-01, 3.51318016437483338e-01, 3.47580494621636982e-01,
+    3.43880444704502408e-01, 3.40217149066780022e-01, 3.36589914028677550e-01,
+    3.32998068761808985e-01, 3.29440964264136327e-01, 3.25917972393556188e-01,
+    3.22428484956089112e-01, 3.18971912844957239e-01, 3.15547685227128949e-01,
+    3.12155248774179550e-01, 3.08794066934560185e-01, 3.05463619244590256e-01,
+    3.02163400675693528e-01, 2.98892921015581792e-01, 2.95651704281261196e-01,
+    2.92439288161892574e-01, 2.89255223489677749e-01, 2.86099073737076826e-01,
+    2.82970414538780746e-01, 2.79868833236972869e-01, 2.76793928448517357e-01,
+    2.73745309652802971e-01, 2.70722596799060022e-01, 2.67725419932044795e-01,
+    2.64753418835062204e-01, 2.61806242689362922e-01, 2.58883549749016229e-01,
+    2.55985007030415379e-01, 2.53110290015629458e-01, 2.50259082368862296e-01,
+    2.47431075665327627e-01, 2.44625969131892107e-01, 2.41843469398877214e-01,
+    2.39083290262449177e-01, 2.36345152457059643e-01, 2.33628783437433346e-01,
+    2.30933917169627412e-01, 2.28260293930716701e-01, 2.25607660116684067e-01,
+    2.22975768058120166e-01, 2.20364375843359495e-01, 2.17773247148700527e-01,
+    2.15202151075378684e-01, 2.12650861992978280e-01, 2.10119159388988258e-01,
+    2.07606827724222037e-01, 2.05113656293837709e-01, 2.02639439093709017e-01,
+    2.00183974691911265e-01, 1.97747066105098873e-01, 1.95328520679563217e-01,
+    1.92928149976771324e-01, 1.90545769663195391e-01, 1.88181199404254290e-01,
+    1.85834262762197111e-01, 1.83504787097767463e-01, 1.81192603475496289e-01,
+    1.78897546572478305e-01, 1.76619454590494884e-01, 1.74358169171353494e-01,
+    1.72113535315320060e-01, 1.69885401302527661e-01, 1.67673618617250192e-01,
+    1.65478041874936005e-01, 1.63298528751901817e-01, 1.61134939917592035e-01,
+    1.58987138969314212e-01, 1.56854992369365231e-01, 1.54738369384468083e-01,
+    1.52637142027442857e-01, 1.50551185001039894e-01, 1.48480375643866791e-01,
+    1.46424593878344944e-01, 1.44383722160634775e-01, 1.42357645432472202e-01,
+    1.40346251074862427e-01, 1.38349428863580204e-01, 1.36367070926428857e-01,
+    1.34399071702213629e-01, 1.32445327901387522e-01, 1.30505738468330773e-01,
+    1.28580204545228172e-01, 1.26668629437510671e-01, 1.24770918580830961e-01,
+    1.22886979509545136e-01, 1.21016721826674833e-01, 1.19160057175327683e-01,
+    1.17316899211555567e-01, 1.15487163578633534e-01, 1.13670767882744314e-01,
+    1.11867631670056297e-01, 1.10077676405185385e-01, 1.08300825451033797e-01,
+    1.06537004050001660e-01, 1.04786139306570172e-01, 1.03048160171257716e-01,
+    1.01322997425953631e-01, 9.96105836706371317e-02, 9.79108533114921992e-02,
+    9.62237425504327976e-02, 9.45491893760558588e-02, 9.28871335560435413e-02,
+    9.12375166310401553e-02, 8.96002819100328585e-02, 8.79753744672702176e-02,
+    8.63627411407569129e-02, 8.47623305323681187e-02, 8.31740930096323827e-02,
+    8.15979807092374193e-02, 8.00339475423199054e-02, 7.84819492016064213e-02,
+    7.69419431704805035e-02, 7.54138887340584096e-02, 7.38977469923647462e-02,
+    7.23934808757087378e-02, 7.09010551623718288e-02, 6.94204364987287548e-02,
+    6.79515934219366013e-02, 6.64944963853397741e-02, 6.50491177867537490e-02,
+    6.36154319998073342e-02, 6.21934154085409946e-02, 6.07830464454796326e-02,
+    5.93843056334202660e-02, 5.79971756312006592e-02, 5.66216412837428767e-02,
+    5.52576896766970374e-02, 5.39053101960460870e-02, 5.25644945930716923e-02,
+    5.12352370551262815e-02, 4.99175342827063717e-02, 4.86113855733794967e-02,
+    4.73167929131815476e-02, 4.60337610761751698e-02, 4.47622977329432820e-02,
+    4.35024135688881833e-02, 4.22541224133162335e-02, 4.10174413804148194e-02,
+    3.97923910233741254e-02, 3.85789955030748574e-02, 3.73772827729593610e-02,
+    3.61872847819314225e-02, 3.50090376973974104e-02, 3.38425821508743299e-02,
+    3.26879635089595347e-02, 3.15452321728936086e-02, 3.04144439104666042e-02,
+    2.92956602246373932e-02, 2.81889487639786357e-02, 2.70943837809557997e-02,
+    2.60120466451342174e-02, 2.49420264197317831e-02, 2.38844205115581708e-02,
+    2.28393354063852402e-02, 2.18068875042835807e-02, 2.07872040725781172e-02,
+    1.97804243380097430e-02, 1.87867007446960305e-02, 1.78062004109113617e-02,
+    1.68391068260399478e-02, 1.58856218399731630e-02, 1.49459680116911485e-02,
+    1.40203914031819376e-02, 1.31091649312549911e-02, 1.22125924262553812e-02,
+    1.13310135978345970e-02, 1.04648101810299789e-02, 9.61441364250220989e-03,
+    8.78031498580897525e-03, 7.96307743801704000e-03, 7.16335318363498386e-03,
+    6.38190593731917909e-03, 5.61964220720548302e-03, 4.87765598354239233e-03,
+    4.15729512083379531e-03, 3.46026477783690405e-03, 2.78879879357407613e-03,
+    2.14596774371890626e-03, 1.53629978030157236e-03, 9.67269282327174536e-04,
+    4.54134353841496765e-04,
+};
+
+/** The mask for the layer of a word. */
+#define ZIG_IDX_MASK		0xff
+/** The bit of a word for the sign of a normal. */
+#define ZIG_SIGN_BIT		0x100
+/** The shift of a word to get the position in the layer. */
+#define ZIG_POS_SHIFT		12
+
+/**
+ * Retrieves a uniform double in [0, 1) from the buffer of generated data.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [out] u       The uniform double.
+ * @return  RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+static inline int random_buf_double(RANDOM *random, double *u)
+{
+    int ret;
+    uint64_t w;
+
+    ret = random_buf_u64(random, &w);
+    *u = (w >> 11) * (1.0 / 9007199254740992.0);
+    return ret;
+}
+
+/**
+ * Ziggurat fast path for normals: accept positions inside the rectangle of the
+ * layer. Accepted words are replaced with the normal in place. Rejected words
+ * are left in place and their positions recorded.
+ *
+ * @param [in, out] r    On in, random words. On out, normals or words.
+ * @param [in]      i    The position of the first word to convert.
+ * @param [in]      num  The number of words in the array.
+ * @param [out]     rej  The positions of the rejected words.
+ * @param [in]      nr   The number of positions already in rej.
+ * @return  The number of rejected words.
+ */
+static uint32_t zig_norm_fast(double *r, uint32_t i, uint32_t num,
+    uint32_t *rej, uint32_t nr)
+{
+    uint64_t w, idx, pos;
+    double x;
+
+    for (; i<num; i++)
+    {
+        memcpy(&w, &r[i], sizeof(w));
+        idx = w & ZIG_IDX_MASK;
+        pos = w >> ZIG_POS_SHIFT;
+        x = pos * zig_norm_w[idx];
+        if (w & ZIG_SIGN_BIT)
+            x = -x;
+        if (pos < zig_norm_k[idx])
+            r[i] = x;
+        else
+            rej[nr++] = i;
+    }
+
+    return nr;
+}
+
+/**
+ * Ziggurat fast path for exponentials: accept positions inside the rectangle
+ * of the layer. Accepted words are replaced with the exponential in place.
+ * Rejected words are left in place and their positions recorded.
+ *
+ * @param [in, out] r    On in, random words. On out, exponentials or words.
+ * @param [in]      i    The position of the first word to convert.
+ * @param [in]      num  The number of words in the array.
+ * @param [out]     rej  The positions of the rejected words.
+ * @param [in]      nr   The number of positions already in rej.
+ * @return  The number of rejected words.
+ */
+static uint32_t zig_exp_fast(double *r, uint32_t i, uint32_t num,
+    uint32_t *rej, uint32_t nr)
+{
+    uint64_t w, idx, pos;
+
+    for (; i<num; i++)
+    {
+        memcpy(&w, &r[i], sizeof(w));
+        idx = w & ZIG_IDX_MASK;
+        pos = w >> ZIG_POS_SHIFT;
+        if (pos < zig_exp_k[idx])
+            r[i] = pos * zig_exp_w[idx];
+        else
+            rej[nr++] = i;
+    }
+
+    return nr;
+}
+
+#ifdef RANDOM_ZIG_X86_64
+/**
+ * Ziggurat fast path using AVX2.
+ * Four words at a time: the layer's threshold and width are gathered, the
+ * 52-bit position is converted to a double exactly by placing it in the
+ * mantissa of 2^52, and a normal's sign is placed in the sign bit.
+ *
+ * @param [in, out] r     On in, random words. On out, numbers or words.
+ * @param [in]      num   The number of words to convert.
+ * @param [out]     rej   The positions of the rejected words.
+ * @param [in]      k     The table of thresholds.
+ * @param [in]      wt    The table of widths.
+ * @param [in]      sign  1 when the numbers are signed.
+ * @return  The number of rejected words.
+ */
+__attribute__((target("avx2")))
+static uint32_t zig_fast_avx2(double *r, uint32_t num, uint32_t *rej,
+    const uint64_t *k, const double *wt, int sign)
+{
+    uint32_t i, nr = 0;
+    int m;
+    __m256i w, idx, pos, s, kv;
+    __m256d x;
+    const __m256i mask = _mm256_set1_epi64x(ZIG_IDX_MASK);
+    const __m256i sbit = _mm256_set1_epi64x(sign ? ZIG_SIGN_BIT : 0);
+    const __m256i two52 = _mm256_set1_epi64x(0x4330000000000000ULL);
+    const __m256d two52d = _mm256_set1_pd(4503599627370496.0);
+
+    for (i=0; i+4<=num; i+=4)
+    {
+        w = _mm256_loadu_si256((__m256i *)&r[i]);
+        idx = _mm256_and_si256(w, mask);
+        pos = _mm256_srli_epi64(w, ZIG_POS_SHIFT);
+        kv = _mm256_i64gather_epi64((const long long *)k, idx, 8);
+        x = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(pos, two52)),
+            two52d);
+        x = _mm256_mul_pd(x, _mm256_i64gather_pd(wt, idx, 8));
+        s = _mm256_slli_epi64(_mm256_and_si256(w, sbit), 63 - 8);
+        x = _mm256_xor_pd(x, _mm256_castsi256_pd(s));
+        /* Accept when the position is less than the threshold. */
+        kv = _mm256_cmpgt_epi64(kv, pos);
+        x = _mm256_blendv_pd(_mm256_castsi256_pd(w), x,
+            _mm256_castsi256_pd(kv));
+        _mm256_storeu_pd(&r[i], x);
+        m = ~_mm256_movemask_pd(_mm256_castsi256_pd(kv)) & 0xf;
+        for (; m != 0; m &= m - 1)
+            rej[nr++] = i + __builtin_ctz(m);
+    }
+
+    if (sign)
+        nr = zig_norm_fast(r, i, num, rej, nr);
+    else
+        nr = zig_exp_fast(r, i, num, rej, nr);
+    return nr;
+}
+#endif
+
+/**
+ * Ziggurat slow path for a normal: the wedge and tail of the layer.
+ * New words are drawn from the buffer until a number is accepted.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [in]  w       The rejected random word.
+ * @param [out] r       The normal.
+ * @return  RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+static int zig_norm_slow(RANDOM *random, uint64_t w, double *r)
+{
+    int ret = 0;
+    uint64_t idx, pos;
+    double x, y, u;
+
+    for (;;)
+    {
+        idx = w & ZIG_IDX_MASK;
+        pos = w >> ZIG_POS_SHIFT;
+        x = pos * zig_norm_w[idx];
+        if (pos < zig_norm_k[idx])
+            break;
+
+        if (idx == 0)
+        {
+            /* Tail: x > R. */
+            do
+            {
+                ret = random_buf_double(random, &u);
+                if (ret != 0) goto end;
+                x = -log1p(-u) / ZIG_NORM_R;
+                ret = random_buf_double(random, &u);
+                if (ret != 0) goto end;
+                y = -log1p(-u);
+            }
+            while (y + y <= x * x);
+            x += ZIG_NORM_R;
+            break;
+        }
+
+        /* Wedge: accept when under the density. */
+        ret = random_buf_double(random, &u);
+        if (ret != 0) goto end;
+        if ((zig_norm_f[idx-1] - zig_norm_f[idx]) * u + zig_norm_f[idx] <
+            exp(-0.5 * x * x))
+            break;
+
+        ret = random_buf_u64(random, &w);
+        if (ret != 0) goto end;
+    }
+
+    *r = (w & ZIG_SIGN_BIT) ? -x : x;
+end:
+    return ret;
+}
+
+/**
+ * Ziggurat slow path for an exponential: the wedge and tail of the layer.
+ * New words are drawn from the buffer until a number is accepted.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [in]  w       The rejected random word.
+ * @param [out] r       The exponential.
+ * @return  RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+static int zig_exp_slow(RANDOM *random, uint64_t w, double *r)
+{
+    int ret = 0;
+    uint64_t idx, pos;
+    double x, u;
+
+    for (;;)
+    {
+        idx = w & ZIG_IDX_MASK;
+        pos = w >> ZIG_POS_SHIFT;
+        x = pos * zig_exp_w[idx];
+        if (pos < zig_exp_k[idx])
+            break;
+
+        if (idx == 0)
+        {
+            /* Tail: memoryless so R plus an exponential. */
+            ret = random_buf_double(random, &u);
+            if (ret != 0) goto end;
+            x = ZIG_EXP_R - log1p(-u);
+            break;
+        }
+
+        /* Wedge: accept when under the density. */
+        ret = random_buf_double(random, &u);
+        if (ret != 0) goto end;
+        if ((zig_exp_f[idx-1] - zig_exp_f[idx]) * u + zig_exp_f[idx] <
+            exp(-x))
+            break;
+
+        ret = random_buf_u64(random, &w);
+        if (ret != 0) goto end;
+    }
+
+    *r = x;
+end:
+    return ret;
+}
+
+/**
+ * Generate an array of standard normal random numbers: mean 0, variance 1.
+ * Random words are generated in bulk directly into the array and converted in
+ * place. Each block of words goes through the fast path and then the few
+ * rejected words go through the slow path.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [out] r       The array of normal random numbers.
+ * @param [in]  num     The number of random numbers to generate.
+ * @return  RANDOM_ERR_PARAM_NULL when random or r is NULL.<br>
+ *          RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int RANDOM_fill_normal(RANDOM *random, double *r, uint32_t num)
+{
+    int ret = 0;
+    uint32_t n, b, bn, i, nr;
+    uint32_t rej[ZIG_BLOCK];
+    uint64_t w;
+
+    if ((random == NULL) || (r == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+
+    for (; num > 0; num -= n)
+    {
+        n = RANDOM_CHUNK_SIZE / sizeof(*r);
+        if (n > num)
+            n = num;
+
+        ret = random_buf_get(random, r, n * sizeof(*r));
+        if (ret != 0) goto end;
+
+        for (b=0; b<n; b+=ZIG_BLOCK, r+=bn)
+        {
+            bn = (n - b < ZIG_BLOCK) ? n - b : ZIG_BLOCK;
+#ifdef RANDOM_ZIG_X86_64
+            if (__builtin_cpu_supports("avx2"))
+                nr = zig_fast_avx2(r, bn, rej, zig_norm_k, zig_norm_w, 1);
+            else
+#endif
+                nr = zig_norm_fast(r, 0, bn, rej, 0);
+
+            for (i=0; i<nr; i++)
+            {
+                memcpy(&w, &r[rej[i]], sizeof(w));
+                ret = zig_norm_slow(random, w, &r[rej[i]]);
+                if (ret != 0) goto end;
+            }
+        }
+    }
+end:
+    return ret;
+}
+
+/**
+ * Generate an array of standard exponential random numbers: rate 1.
+ * Random words are generated in bulk directly into the array and converted in
+ * place. Each block of words goes through the fast path and then the few
+ * rejected words go through the slow path.
+ *
+ * @param [in]  random  A random number generator object.
+ * @param [out] r       The array of exponential random numbers.
+ * @param [in]  num     The number of random numbers to generate.
+ * @return  RANDOM_ERR_PARAM_NULL when random or r is NULL.<br>
+ *          RANDOM_ERR_ENTROPY when entropy collection fails.<br>
+ *          0 otherwise.
+ */
+int RANDOM_fill_exponential(RANDOM *random, double *r, uint32_t num)
+{
+    int ret = 0;
+    uint32_t n, b, bn, i, nr;
+    uint32_t rej[ZIG_BLOCK];
+    uint64_t w;
+
+    if ((random == NULL) || (r == NULL))
+    {
+        ret = RANDOM_ERR_PARAM_NULL;
+        goto end;
+    }
+
+    for (; num > 0; num -= n)
+    {
+        n = RANDOM_CHUNK_SIZE / sizeof(*r);
+        if (n > num)
+            n = num;
+
+        ret = random_buf_get(random, r, n * sizeof(*r));
+        if (ret != 0) goto end;
+
+        for (b=0; b<n; b+=ZIG_BLOCK, r+=bn)
+        {
+            bn = (n - b < ZIG_BLOCK) ? n - b : ZIG_BLOCK;
+#ifdef RANDOM_ZIG_X86_64
+            if (__builtin_cpu_supports("avx2"))
+                nr = zig_fast_avx2(r, bn, rej, zig_exp_k, zig_exp_w, 0);
+            else
+#endif
+                nr = zig_exp_fast(r, 0, bn, rej, 0);
+
+            for (i=0; i<nr; i++)
+            {
+                memcpy(&w, &r[rej[i]], sizeof(w));
+                ret = zig_exp_slow(random, w, &r[rej[i]]);
+                if (ret != 0) goto end;
+            }
+        }
+    }
+end:
+    return ret;
+}
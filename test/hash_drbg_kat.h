@@ -0,0 +1,2410 @@
+/* Generated by test/vectors/gen_test.rb from Hash_DRBG.txt
+ * - do not edit.
+ */
+
+static HASH_DRBG_KAT hash_drbg_kat[] =
+{
+    { RANDOM_ID_HASH_DRBG_SHA1,
+      "\x37\x29\xdb\x84\x05\xee\x44\x99\xfd\x1a\x10\xbb\x38\xf8\x47\xa7", 16,
+      "\xce\xcb\xaa\x26\x46\x10\xf0\x17", 8,
+      "", 0,
+      "\x3e\xc4\x5e\xca\x01\x7e\x22\xdb\x10\x77\x1b\xb4\xce\xc2\x62\xcb", 16,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xfa\xa7\x76\x75\xcc\x89\xa4\xf5\xf3\x7f\xea\x8a\xde\x29\xf0\x86"
+      "\x11\xc4\x62\xa6\xf6\xc0\x71\x34\xed\x2d\x75\x5a\x99\x02\x34\xd6"
+      "\xf9\x7e\x02\xde\x3c\x2a\xbf\x58\x51\xea\x56\x7d\x09\x32\x40\xa0"
+      "\x10\xbf\xb7\x87\x10\xa7\x25\xe0\x76\xad\x24\x83\xd4\x5e\x74\x52"
+      "\x96\x6a\x21\x67\x57\x09\x33\xfe\x9e\xb7\x1a\xbc\x1e\x8b\x9d\x70", 80,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA1,
+      "\x42\x42\x1e\x08\x8c\x03\x13\x2b\x6d\x31\x05\x37\x37\x80\xc1\x96", 16,
+      "\xcd\x1b\x33\x12\xfd\xf3\xd4\x27", 8,
+      "", 0,
+      "\xb6\x80\x72\x8a\x65\x0e\x37\x77\x9c\xf2\xe3\xa1\xd2\x74\x45\xe0", 16,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xc5\xfd\xb6\xc7\xd5\x04\x20\x5d\xce\xe1\xb2\x0b\xa3\xeb\x57\xb9"
+      "\xee\x01\xfb\x82\x3c\xa4\x98\x63\x4b\xfb\x6b\x0e\x84\xf8\x6d\x2d"
+      "\xbc\xdb\x1f\xb8\x9f\xd1\x3f\x55\xd3\x39\x4f\x3c\xaf\xbe\xd1\x90"
+      "\x8e\x3f\xeb\x1c\xe4\xaf\xd6\xad\x0b\x75\xe8\x1a\x15\x78\x32\xdf"
+      "\x0e\xb3\x75\x98\x3e\xa9\x8f\xaa\x85\xed\xed\xfe\x54\x5a\xc4\x53", 80,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA1,
+      "\xef\x20\x6d\xab\x5b\xc7\xcf\xd4\x11\xe7\xc2\x43\xed\xaf\x58\x3b", 16,
+      "\xae\xb2\xef\xae\x53\x04\x3d\x88", 8,
+      "", 0,
+      "\x8f\x6e\x8f\x58\x6f\xe5\x74\xe2\xac\xec\x02\x60\x77\xc1\x76\xf1", 16,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x59\xa4\x5f\x11\xd6\x09\x9d\x49\x56\x98\xcd\x27\x1e\x3d\xe6\x93"
+      "\xc3\x56\xff\xae\x92\xe9\xac\xdf\x31\xd1\x63\xea\x12\x8d\x71\xce"
+      "\x6c\x15\xb9\x7b\xc3\x2f\xef\x96\xbb\x67\xe0\x31\xd1\xd1\x1a\x5b"
+      "\x58\x35\x3c\x30\x7f\x88\xaa\x87\x20\xf4\x5c\xef\x93\xa6\xff\xba"
+      "\x64\xa1\x71\x9e\xa3\xd4\x7b\xb3\xcc\x71\x74\x99\xb1\xf0\x39\xe5", 80,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA1,
+      "\xbe\x3b\x87\x14\x7c\x1f\x71\x6e\x44\x76\x39\x51\xce\x15\x14\x0b", 16,
+      "\x69\xdb\x23\xd1\xdb\x03\xed\xed", 8,
+      "", 0,
+      "\xea\x87\x6c\x7f\xcc\x2d\x6f\xe7\x45\x78\xa6\x14\xac\xe2\x6b\xe1", 16,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x46\xd5\xaf\x07\xdf\xd1\x54\xb6\x1f\x68\x05\xa4\x79\x0c\x43\x55"
+      "\xc5\x8e\x49\x9d\x7f\xea\xbc\x41\xe5\x59\x59\x2e\x37\x13\x5c\xfd"
+      "\x58\x31\x81\xab\x76\xbf\x70\xc1\xdd\x7a\x0f\x4d\x4c\xdd\x59\x18"
+      "\xb7\x3d\x7a\xda\xb8\xab\x9e\xeb\x1b\x63\xaf\xae\x1a\xa8\x7c\xac"
+      "\xe2\xec\xb5\x09\x10\x56\x05\x1e\x75\x77\xca\xd7\x83\xfd\x07\x76", 80,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA1,
+      "\x50\x8f\x55\x6c\x64\xad\x46\x0a\x5c\xfe\xa5\xf3\xf5\x53\xb5\x11", 16,
+      "\xd7\x62\xb5\xc7\x0a\x4e\x9c\x74", 8,
+      "", 0,
+      "\xd5\xca\x02\x51\xe1\xee\x7f\x6f\x21\xc6\x52\xdb\x4c\xb9\x69\xa7", 16,
+      "\x1a\x65\x50\xd0\x7f\x5a\x93\xfc\xf5\x14\x24\x70\xff\xbb\x4d\x74", 16,
+      "\xe1\xcc\x38\x82\xc7\xb6\xaf\x79\x50\x13\x29\x35\x5b\x8a\xf8\xf5", 16,
+      "\x1d\xc3\xe7\x55\xd9\x64\x51\xb9\x43\xf9\x6f\xf1\x41\x71\x2b\xdc", 16,
+      "\x49\x69\x16\x29\x11\x9b\xaa\xd8\xcd\xbc\x0e\xfe\x50\x46\x44\x8c"
+      "\x79\x5e\x17\x8a\x5b\x6f\x9a\xd6\x4c\x73\x0b\x58\x85\xc1\xeb\x1b"
+      "\x8a\xa6\x04\x53\x76\x23\xbd\x46\xbb\xbc\x17\x34\x2d\x5c\x7a\x4d"
+      "\xf7\xa6\xa3\x66\xaf\xa1\xfd\x8b\x29\xe4\x1a\x55\xac\x17\x89\x8f"
+      "\x5a\xac\x37\x88\x83\x77\xe6\x6c\x4e\xa2\x4f\xfb\x29\x5b\x2b\xb3", 80,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA1,
+      "\x2f\x75\x4d\xed\xe5\x01\xfb\xa8\x85\x85\x75\xb9\x0a\x7f\x8d\x69", 16,
+      "\x1c\x74\xc3\x79\xba\xb4\xbc\x52", 8,
+      "", 0,
+      "\xe9\x1d\x39\x6c\xdb\xe6\x7e\x52\x32\x0e\x58\x83\xe4\x70\xf9\x5c", 16,
+      "\xe2\x16\xff\x26\xa4\x51\x80\x08\x8a\x88\x8d\xe4\x9e\x7e\x54\x09", 16,
+      "\x5a\xe6\xc9\x06\xc9\xab\x6e\xe9\xf1\x64\xe9\x6d\x8a\x4c\xb8\x44", 16,
+      "\x4d\x43\x87\xa5\x10\xf0\x93\x6c\xad\x61\x57\x80\xe3\x55\x76\x47", 16,
+      "\xac\xc7\x0a\x3c\xa1\x32\x21\xe5\x3e\x73\x61\xe9\xac\x37\xc2\xbe"
+      "\xed\x43\x46\xd8\x19\x74\x78\xe8\xd7\x73\x09\xf2\x85\x2b\x04\x43"
+      "\xbf\x4c\x84\xe3\xc5\x9a\x06\xbd\x49\x58\xe9\xac\xe0\xe4\x6f\x49"
+      "\x5d\x0e\x8d\xd2\xb5\x70\x96\x54\xe4\xf8\xed\x01\xb2\x5b\x58\xbf"
+      "\x1c\x70\xb6\x0b\x59\xba\x03\x0f\xcb\x7b\xee\xf9\x07\x56\xfc\xd4", 80,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA1,
+      "\x36\xa8\xc3\xf2\xff\xb0\x28\xca\x4e\x0d\x1a\x0b\x2e\x58\x33\x6d", 16,
+      "\x73\x7e\x13\x04\x9d\xd3\xd1\xb9", 8,
+      "", 0,
+      "\xe7\x6f\x04\x15\x97\xdb\x60\x93\x4f\xb8\xc3\x3b\x3a\x0f\xdb\xe5", 16,
+      "\x0f\x5a\xdf\xe8\x41\x4b\x92\x13\x6c\x32\xe2\xfe\x86\x37\xc5\xf9", 16,
+      "\x91\x67\xe6\x52\x5f\x8a\xfa\x13\xd2\xdd\x01\x11\x7e\xea\xa1\xd3", 16,
+      "\xb0\xdc\xcf\xdb\xab\xd9\x83\x07\xa1\xcc\x03\x5d\xbe\x6e\x5e\xd2", 16,
+      "\x45\x46\x48\x7d\x34\x22\x74\x34\xa0\xbf\xd2\x28\x1f\xbb\x5c\x3d"
+      "\xbb\x95\x3a\xac\xb3\x33\x50\xc4\x35\xee\xf8\xf3\xd8\xbc\x87\xec"
+      "\x14\xe6\xdf\x92\xc0\xe8\xd0\xd4\xd5\xf9\x80\xe6\x20\x4f\x4b\x03"
+      "\x88\x4b\x6e\xd1\x95\x5f\x4c\x2d\x77\xe3\x65\x0b\xb3\xe7\xcc\x35"
+      "\xad\x63\xa3\x79\xdb\x9f\xe4\x21\x28\xe8\x5a\xdc\x5c\x4c\xbe\x4a", 80,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA1,
+      "\x77\xf5\x2e\x1f\x95\xd9\xeb\xfe\x41\x3a\xda\xde\xc1\x9a\x09\x00", 16,
+      "\x40\x72\x1c\x42\xd9\x64\x81\x10", 8,
+      "", 0,
+      "\x74\x6c\x1b\x78\x03\x0f\x30\x88\x48\xbb\x59\x18\x1b\x75\xcf\x0d", 16,
+      "\xc2\x44\x62\x7f\x28\x03\x63\xfc\x14\x1d\xa8\x35\x29\x64\x78\xdf", 16,
+      "\x0e\x70\xa9\xec\x36\xbc\x5e\x12\x0a\x91\x84\x9f\x75\x8e\xb4\xee", 16,
+      "\xd0\xd0\xac\x9e\x24\x68\xa8\x7b\x96\xf6\x14\x43\xaf\xc9\x4f\xbd", 16,
+      "\x83\x6b\xf4\x9c\xa0\x2c\x0d\x7c\x3a\x84\xc9\x8d\x2e\xb7\xa5\x2f"
+      "\x17\xa4\x28\x40\x79\xb7\xc9\xf6\x68\x23\xd9\x52\x36\x36\xe7\x8d"
+      "\xda\x0a\x41\xd6\x38\xb7\x2a\x67\x9c\xa9\xc6\x92\xea\xb9\x1d\x62"
+      "\xd6\x2e\x22\xfc\x55\xa2\xc8\x5e\x41\x56\xc1\x7b\x07\xd4\xe7\xf1"
+      "\xdb\x52\xc2\xe5\xad\x3c\xec\x4e\xeb\xaa\x1b\x0d\x1e\x74\x79\xd3", 80,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA1,
+      "\xe0\xda\x5f\x67\x7e\x53\xf7\x78\xf0\x5a\x6d\xc5\x71\xa0\x6b\x39", 16,
+      "\xb1\xa5\x18\xad\xa2\xb9\x00\x13", 8,
+      "\xd2\x4b\x07\xd8\xa9\x61\xbb\x31\x44\xb0\xa1\xb1\x4e\xe9\xfa\x1b", 16,
+      "\x5f\x3d\x1f\xef\xf0\x25\xcf\xa5\xcf\x92\x83\xb9\x70\xed\x22\x48", 16,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x3d\x5b\xcb\xb8\x21\xa8\xa5\x77\x20\x0d\xb9\xe6\x20\x71\x37\xf4"
+      "\x72\xac\x26\x82\x35\xef\x25\xde\xf2\x6f\x08\x1c\xe0\xde\x5e\x3a"
+      "\xb3\x47\x47\x1b\xfb\x51\x66\x32\x78\xc8\x61\x69\x21\xc4\x4a\xfe"
+      "\xa4\x33\xb1\x95\xab\xb0\xe8\x13\x29\x76\x94\xec\xfe\xa7\xa2\xea"
+      "\x8f\xe6\xe3\xe0\xfc\x9e\xd6\xc5\x7e\xc2\x42\xff\x8e\x04\x9a\x81", 80,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA1,
+      "\x90\x2c\x14\x64\x03\xd7\xe8\xad\x5a\x1a\x4e\x26\x02\x39\x67\x72", 16,
+      "\xcd\x46\x9c\x33\x22\x9f\xc5\x67", 8,
+      "\x24\x5d\x26\x2b\x1a\x16\x9a\x6c\xcf\xf7\x5e\x19\x01\x4e\xde\x02", 16,
+      "\x13\xda\x7f\x77\x3a\xdb\x1d\x26\xbc\x11\xc7\x9f\x0a\x61\x4c\x61", 16,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x52\x6d\xd0\x84\x29\x21\xf1\xc5\xad\x66\xd8\xc6\xa2\x39\x8c\xe6"
+      "\xf6\xcf\x58\xa4\x59\xa0\x9f\x8d\x5d\x18\xec\x14\x02\x58\x03\xbe"
+      "\x43\x62\xb3\x7d\x60\x09\x0c\xbf\xd1\xd7\x3e\xb1\x9e\xbe\x1e\x81"
+      "\xf8\x69\xd7\x60\x41\x73\x42\xcb\xec\x0d\x0f\x59\x0f\x49\x76\xc7"
+      "\x23\x45\x26\xf1\x21\x68\x0e\x73\xad\xc8\xd9\x9e\x19\x5c\xd4\x45", 80,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA1,
+      "\xb4\x4f\x9f\x82\xd4\xba\xa2\xb5\xfa\x0a\x1b\xce\x14\x09\x87\x2b", 16,
+      "\xdc\x3c\xee\x7e\x45\xd8\xda\xed", 8,
+      "\xd6\x32\x0b\x6a\xe1\x79\x94\xc5\x82\xeb\xa5\x65\x51\xf7\x42\x42", 16,
+      "\x0e\x30\xa7\xe4\x0c\xff\x80\x34\x18\x8a\xae\x93\x29\x56\x01\x33", 16,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x07\x50\xd8\x63\x5a\xff\x81\x23\x12\x4e\xef\x98\x51\x16\x76\x06"
+      "\xb3\xc6\x4d\x41\xfd\x35\xba\xa7\x71\x68\x6c\x7b\x3a\x75\x09\xb0"
+      "\x3e\x07\xe4\xfb\x83\xb4\x16\x56\x36\x3c\x67\xb4\x91\xe0\xbf\x50"
+      "\x83\x14\x13\x73\xdd\x50\x66\x97\x95\x43\x7e\xd3\xd1\x48\xec\xe2"
+      "\x5e\x52\xb1\x00\x5d\x03\x23\x75\xca\x7e\xe0\x76\x07\x77\xfd\x05", 80,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA1,
+      "\xd5\x74\x82\xfa\x24\x15\xbd\x84\x8b\xed\x28\x2c\x71\x98\xf3\xe3", 16,
+      "\x08\xa9\x3a\xee\xa7\xbe\x5f\x53", 8,
+      "\x2a\xf9\x0a\x16\x51\x3c\xd5\x9f\x72\x72\x13\x31\x8f\x7b\x31\x6d", 16,
+      "\xb6\x23\xf0\xff\x8c\xbf\x17\x4a\x22\xe8\xaa\x1a\x0a\xeb\x45\xfa", 16,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xbb\x58\xb2\xd9\x85\xde\xc0\x48\xaf\x5e\x98\xfb\x48\x2c\xd4\x22"
+      "\xc2\x3d\xe2\xdf\xf4\x74\x5a\xbd\x0c\xe0\x71\x19\xf6\x17\x70\x3f"
+      "\x19\x81\x4f\x0b\x28\x45\xfd\xdb\xa9\xb6\x70\x59\xb2\x4c\x33\x7d"
+      "\x48\x22\x09\x7e\xc3\xe1\x7b\x11\xa8\xed\xb3\x93\xcf\x92\x4d\xda"
+      "\xeb\x00\xb8\x2a\x30\xec\x47\xe8\x18\xd1\x31\xc7\x12\x23\xd4\x1e", 80,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA1,
+      "\x86\x40\xc8\xea\x2e\x8a\x1e\xdb\xdf\xe0\x92\xeb\xb8\x60\x3c\x2c", 16,
+      "\x0a\xe9\xb9\x6b\x16\xc3\xf5\xcd", 8,
+      "\x94\x1a\x60\xbf\x50\x97\x33\x23\x84\xca\x0c\xcd\x30\xe3\x58\x8e", 16,
+      "\xac\x12\x66\xcc\x9c\x1b\xaa\xf3\x7a\xdb\x0e\xc6\xf0\xa2\xb5\x13", 16,
+      "\x58\x7d\x4c\x5c\x7f\xfa\x99\x29\x26\xda\xff\xb5\xcb\x1d\x31\xc8", 16,
+      "\xa5\xde\x29\x64\xf6\x05\x2d\x10\x28\xb6\x20\x07\x6c\x39\x5e\xb7", 16,
+      "\xb0\x05\x95\xe8\x25\x89\x6b\x11\x63\x38\x9e\xcb\x3c\xfd\xd8\xbe", 16,
+      "\x2e\x30\x6e\xb3\x3b\x4d\xdf\x33\xac\x42\xf4\x1a\xc7\xee\x94\xd3"
+      "\x44\x77\x5e\x3c\x13\xfb\x6b\xcc\x5a\xb6\x7b\x54\xd0\x9f\xfb\x30"
+      "\xa8\x38\xbb\x5a\xa4\xe6\x04\x2d\x02\x60\x62\x0f\xc8\x3e\x01\xf9"
+      "\x76\x8a\x31\x8e\x81\x3f\x1e\x65\x2f\xdc\xae\x04\x5d\x26\x96\x42"
+      "\xc8\x06\x17\xbc\x8c\x5e\x52\xcb\x3e\x32\xb3\x78\x12\x14\x3b\xb5", 80,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA1,
+      "\xe2\xa5\xa7\x7b\x8b\x7d\x73\x53\x6a\x8e\x69\x57\x01\x5c\xff\xcd", 16,
+      "\x45\xa8\xed\x8c\x63\xfd\x41\x74", 8,
+      "\x5a\x59\xd5\x61\xd2\xad\xe7\xdf\x2c\x42\xcb\xb6\xe2\x4d\x2a\x71", 16,
+      "\xc6\x0c\x14\xa5\xd6\x8f\x2a\x44\x09\xff\xe6\x7a\x3f\x05\x05\xe2", 16,
+      "\xc3\x2a\x9d\xae\x2c\xbb\xb1\xc3\xb9\x43\xf7\xdc\xb7\x0e\x9a\x0e", 16,
+      "\x5b\x58\x52\x74\x7b\xeb\xc9\x0d\x21\x52\xb1\x85\x7a\x4b\x3a\x2e", 16,
+      "\x32\xe6\xef\x84\xa9\x3a\xfd\x9b\x04\xfb\x10\xe5\x25\x1c\xaf\x0b", 16,
+      "\xfb\x13\x17\xdd\x45\x9a\x66\x69\x3a\x52\x2d\xbc\xc2\x39\x1c\x66"
+      "\x84\x8b\xe0\xe5\x88\xd4\xa5\x96\xbb\x13\xdc\x0f\x79\xfe\x18\x51"
+      "\xd7\x75\xd4\xf2\x50\xa8\x85\x0a\xe1\x0a\x26\xc0\x49\x5b\x5f\x11"
+      "\x1a\xf4\xbb\x38\x6e\x92\xc3\xf2\xf9\x33\x11\xa2\x53\xc5\x06\xaa"
+      "\x08\xac\xe2\xe7\x8a\xf3\x26\xd4\xc4\xe8\xe4\x23\xea\xbb\x2f\xb5", 80,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA1,
+      "\x55\x43\xe7\xf0\x68\xcf\xbb\x56\xbe\x8f\x47\x5a\xe8\x7a\x9a\x68", 16,
+      "\x52\x50\xc4\x6a\x3f\x71\x39\x9d", 8,
+      "\x9c\x31\xa1\xb8\x15\xd9\x45\x59\xf9\x80\xb0\xdb\x77\x49\x66\xf8", 16,
+      "\xec\x0b\xe9\xc9\x06\xf8\x28\x7c\xa1\xf8\x04\x82\xf1\x21\xb9\x58", 16,
+      "\xf7\xac\xad\x8f\x07\x8e\xbb\x97\xf3\xb5\xfb\x99\x73\x00\xe0\x08", 16,
+      "\x60\x13\x22\x60\xe4\xd6\xf4\x70\x52\xa1\xeb\xfe\x8b\x52\x2a\xf8", 16,
+      "\x5a\xde\xaa\x87\xed\x37\xe3\xbc\x4d\x01\x84\xe7\xc9\x0d\x40\x77", 16,
+      "\x76\x78\x05\x04\x6d\xfe\x65\xa3\xd7\xf7\x95\x8a\x04\x7d\xd5\x0d"
+      "\x5d\xfb\x26\x38\xb8\x70\xde\xcb\x2c\x5a\xde\x7e\xf4\x17\x5c\x1f"
+      "\x41\x7b\xb1\x87\x62\x80\xa9\xfe\x76\xd9\x11\xdb\x46\x17\x1c\xa7"
+      "\x87\xfa\xfd\x12\x17\xaa\x5e\x51\x63\xc2\x38\x1a\x35\x8e\x18\x67"
+      "\x67\xde\x58\x7b\x48\x3f\x68\x88\x4a\x84\x53\x98\xd4\x05\xf4\x51", 80,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA1,
+      "\xf6\x84\xf6\x0d\x06\x81\xca\x63\xa1\xe9\xbc\x57\x92\x69\xa1\xeb", 16,
+      "\xda\x46\xd5\xba\xa2\x40\xbc\x6d", 8,
+      "\xf3\xe8\x92\x89\x25\x72\x80\xe2\x6b\x7c\xb1\xa2\xc5\xc0\x71\xb2", 16,
+      "\x6f\xd8\xf3\xd3\xa0\x14\xa3\xb8\xaf\x8a\x6c\x7d\x60\x3d\xad\x7a", 16,
+      "\xe4\x25\x19\x25\xf9\x1c\xa5\xe7\x87\x5d\x40\x64\x31\x07\x3b\x2b", 16,
+      "\xe4\x79\xb1\x75\x74\x17\x83\x9c\x0c\x03\x51\x45\x33\x58\x20\xd3", 16,
+      "\xec\xde\xef\xc0\x4b\xd0\x43\xfe\xf8\xd6\xdc\xc5\xa8\x8c\x5c\xfd", 16,
+      "\x37\x04\x8c\xfb\xd7\xaa\x01\xf7\x6e\x5c\x49\x3d\x78\xfe\xe3\xf3"
+      "\x26\x4d\xf1\xb5\x18\x9f\xbf\xd8\x92\xef\x28\x0a\x18\x3f\xf1\x86"
+      "\x48\xd3\x8d\x98\x93\x29\x6c\x83\xd4\x5d\x49\xe0\x38\xa2\x0c\x0a"
+      "\x26\xd8\x86\x54\xf4\x20\x95\x27\x53\xf7\x2f\x35\xd9\x4a\x75\x6b"
+      "\x12\xf3\x86\x96\x89\xc7\x92\x5a\x03\x51\x8d\xfc\x09\xa7\x1c\x9f", 80,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA224,
+      "\xeb\x48\xf3\x40\x44\xbb\x88\x57\x03\x0f\x94\x10\xb7\x45\xfc\x00"
+      "\x92\x17\xa9\x1d\x2c\xc5\x57\x98", 24,
+      "\x32\x61\xa2\xb5\xe2\x82\x46\xcf\x1a\x08\x5b\xda", 12,
+      "", 0,
+      "\xde\x3e\xee\x2d\x13\xc3\xa2\xb4\xbd\x2d\x7d\xdf\xe9\xa9\x4f\xda"
+      "\x3e\xfe\x0e\xe0\x40\xec\xfd\xf4", 24,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x2c\x1f\x9d\x25\x52\xe1\x4f\x82\xff\x0e\x05\x65\xc1\x11\xf3\xf9"
+      "\x29\x90\x27\x3b\x58\xba\xce\x1d\x44\x35\x20\x65\xa7\xd0\x42\x1a"
+      "\xf7\xc0\x22\x84\xa1\xee\x03\xab\xc7\x6a\x96\x53\xb2\x80\xa7\x15"
+      "\x53\x22\x85\x07\x9e\xca\x44\xd1\x2d\x28\xa0\x40\x8e\x26\x4b\x21"
+      "\x9b\xab\x83\xb0\x16\x5e\xb6\x1f\x4c\x57\x3b\x90\x11\xab\xcf\x2e"
+      "\xd2\xe7\x54\x06\xa7\x43\x78\xe7\xd0\xa3\x72\x43\x39\xce\xae\x9a"
+      "\xe3\xef\xee\xe7\x11\xbd\x60\x88\xde\x5c\x3b\x66\x94\xa0\x3a\xf1", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA224,
+      "\x6c\x10\x99\x14\xc9\x6a\xae\x5b\x81\x01\xa3\x34\x1e\xb5\x3d\xf0"
+      "\xff\xa5\x8f\x82\xc1\xaa\xfb\x78", 24,
+      "\x33\x98\x31\xeb\x0e\x7f\x77\x1b\xc0\xeb\x87\x06", 12,
+      "", 0,
+      "\xb1\x72\xe2\xeb\xf1\xe9\x33\x6e\x68\xca\xd7\xa2\x44\x5e\xca\x7f"
+      "\xa0\xbf\xb1\xd4\x95\x67\xec\xd9", 24,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xa8\xeb\x79\x8e\x6d\x4d\xef\x6a\x45\x32\x09\xf0\xa2\xd4\xf1\x19"
+      "\xec\x91\x33\x7f\x48\x45\x8c\x69\xac\x07\x2e\xc6\xf3\xc3\x2e\xe3"
+      "\x02\x26\x03\xa4\x85\xbb\xd5\xff\x0e\x45\xb4\x8b\x67\x8f\x05\x9c"
+      "\x80\xf8\x9a\x72\x79\xb7\x65\xe1\xa2\x86\xcd\x76\xcb\x73\x88\xd0"
+      "\x3a\x27\x2d\x07\x51\x45\x4b\xc1\xda\xaf\xe5\xea\xb1\xbe\x2a\xaf"
+      "\x8b\x54\x2e\x9d\x8b\xe1\x98\x5a\x52\x95\x57\x1b\x33\xab\xf1\xe7"
+      "\x20\xf1\x01\xd5\x14\x77\xcd\xf9\xd0\x98\x66\x5a\xe7\x0a\x04\x14", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA224,
+      "\x5e\xe0\x76\x20\xe7\x10\x51\x0a\xb5\xb2\xeb\x3f\x06\xa9\x15\xeb"
+      "\xa0\xcb\x7c\xd5\x01\x34\x85\x5e", 24,
+      "\x2e\x9d\xb6\xcf\x5b\x3b\x94\x34\xde\x22\x30\xbd", 12,
+      "", 0,
+      "\x30\x1f\x2d\x65\xc2\xa3\x4d\x65\x74\xeb\x8a\x22\xb5\xd6\x0d\x13"
+      "\xc8\xc7\x2f\x89\xde\x2f\x28\xe1", 24,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xd9\x43\xf6\xe6\x24\xb7\xc4\xce\xf7\x72\x9c\xb7\xf9\x20\x45\x53"
+      "\x2d\x04\xe3\xb2\xa1\x02\xf6\xdf\x93\x1d\x9f\x98\xcb\x1e\x18\x6d"
+      "\xe4\xd5\xce\x9b\x3a\xdb\xa1\x1f\xa1\x6d\x0d\xc7\x1c\x4b\x3c\x4a"
+      "\xa6\x69\x23\x0d\xfd\x51\x32\xbf\xbb\xf6\xfc\xc3\xd8\xd5\x2f\x48"
+      "\xbc\x05\xb2\x4f\x05\x99\x5c\xb8\x73\x37\xc6\xdf\xed\xa6\x00\x1f"
+      "\x58\x78\x76\x5c\x8a\x4d\xca\xfe\x2f\xc8\x86\x5f\x65\x21\x2d\x99"
+      "\x88\x1a\xb0\x3b\xe0\xb0\x62\x72\xc3\x46\xaf\xed\x8e\x61\x9a\x58", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA224,
+      "\x51\xfa\xd7\x8a\xc4\x22\x83\x6d\xd9\xdb\x47\x93\x8a\x01\x71\xd0"
+      "\x4a\x36\xcc\xc2\xd6\xfd\x75\x82", 24,
+      "\x08\xfd\x6f\xca\xdf\x28\xd8\xd7\xfa\xde\x8c\x65", 12,
+      "", 0,
+      "\xa7\xcb\x66\x64\x77\x61\x83\xaf\xc1\xc0\x2c\xab\xcf\x71\x89\x58"
+      "\x9c\x64\xab\xd9\xce\x5c\xf0\xf9", 24,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x89\x64\x5e\x3c\xb3\x44\x96\xd5\x82\x8b\x74\x7a\xeb\x95\xec\x47"
+      "\x99\x34\x4e\x96\xff\x21\x60\x85\x16\x95\xa9\x45\x18\x59\x5f\x21"
+      "\x1b\x3e\xdf\xd3\xbf\xae\x72\x90\x16\x00\x58\x90\xd4\x05\x13\x74"
+      "\xdb\x3b\x3c\xe5\x5e\xce\xaf\x01\xc4\x6a\x18\x17\xa8\x56\xec\x3f"
+      "\x36\x15\xf2\x97\xb1\x5a\x65\x3e\xdf\xc8\x4c\xb0\xc6\xc7\x0c\xf0"
+      "\x23\x7e\xfa\xcd\xd7\xaa\x45\x3e\xed\xb8\xf5\xde\x6b\xed\x0e\x1e"
+      "\xd1\x4c\xbc\x3e\x36\xeb\x89\x47\x69\x9c\x82\x71\x8c\xe5\x98\x92", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA224,
+      "\x0b\xf6\x74\xa1\x93\x9b\x35\xfe\x77\x75\x4c\x6a\xb2\x75\xdb\x0a"
+      "\x2d\x92\x5b\x9d\x40\xdb\x4a\xb4", 24,
+      "\xef\x25\x32\xd7\xd9\xb6\x31\x11\xac\x9d\xcb\xe5", 12,
+      "", 0,
+      "\xb3\xe9\x41\x9c\x6b\x88\x55\xa6\xba\x58\xd8\xcb\x82\xf0\x12\xb8"
+      "\x43\x85\x40\xf2\x12\xbd\xa8\x08", 24,
+      "\xc8\xc3\xda\x0f\x54\xe4\x65\xc0\xea\x36\x7d\x92\x2d\x5b\x05\x67"
+      "\xf2\x34\x1f\x85\xb0\x0d\x51\xac", 24,
+      "\xd4\x7f\x56\x03\x74\x6c\x44\x02\x92\xb6\xc9\x7a\xdc\x6e\x01\x6f"
+      "\xf0\x0d\x0e\x7f\x87\xe1\x44\x2f", 24,
+      "\x3d\xda\x7d\x48\xbe\xb1\x45\xe1\x47\x6d\x77\x4d\x0a\x68\x40\x15"
+      "\xc1\x3a\x2a\x78\x09\xe3\x38\x34", 24,
+      "\xa6\x02\xfd\xd5\x3e\xa7\x82\x36\x97\xc5\x44\xcb\x44\xbd\x26\x66"
+      "\xd2\x54\x9b\x12\x8c\x84\xf4\xb7\x83\x3f\x62\xf9\x2a\x29\x12\x15"
+      "\x52\x15\xb8\xeb\xb6\xaa\x31\x37\xa4\x0b\xfa\xb1\x58\x60\xd3\xc0"
+      "\xa0\xb9\xe9\x15\xfe\xe6\xbb\x0d\xab\x00\x93\x8d\xe8\x43\x54\x70"
+      "\x59\xca\xff\x28\x64\x18\xa5\xa3\xca\x2a\xd8\x9a\x13\xce\x88\x88"
+      "\xed\x0d\xc5\x15\x7d\x59\x3b\x1c\x7f\x97\x09\xd4\x01\x93\xa2\xac"
+      "\xee\x94\xde\x31\x00\x2a\x80\xb2\x66\xe8\x90\xf5\xfb\xec\x6c\xc4", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA224,
+      "\x7e\x39\xcd\xf0\xbc\x95\x5a\xa1\x28\x99\x66\x00\x02\xf6\xb6\xc0"
+      "\x2e\xd3\xe6\x37\xa2\xae\xca\x1d", 24,
+      "\x3f\xf8\x57\x3a\x88\xcb\x16\xf9\xb1\xad\x6b\x48", 12,
+      "", 0,
+      "\x9b\xc9\x56\xc5\xaa\x64\xe9\x27\x2b\xd0\x8c\xf4\x78\x18\x75\x8e"
+      "\x45\xbe\x6a\x2e\x35\x86\xd4\xe0", 24,
+      "\x51\xfc\x26\x88\x04\x05\x73\xfc\x1b\x90\xf3\xdb\x71\xcf\xac\x49"
+      "\x60\x2b\xb3\xe1\x4f\xa6\xf1\xdb", 24,
+      "\xd1\xf0\xae\x82\xf5\xa1\xd4\x05\x04\xba\x42\x81\x85\xb3\x75\xd1"
+      "\x10\xb9\x3b\x0c\xc8\xb5\x87\xf8", 24,
+      "\xa6\x4c\xd1\x2e\x53\x38\x7e\x27\xe2\xc7\xde\x3e\xc2\xb3\x30\xe0"
+      "\x67\x85\x28\xbc\x8b\xb3\x3c\xf5", 24,
+      "\xf8\x95\x56\x78\x49\xc5\x74\x55\x73\xa4\x9b\xaa\xee\x02\xe3\xb3"
+      "\xaf\x6b\xcc\x05\xa5\xae\x68\x53\x7f\x19\x06\x2e\xde\xb5\xcb\x95"
+      "\xc9\x8a\x1c\x06\xb1\x82\x32\x63\xb8\x33\x6d\xb6\xa6\xfa\x7b\x11"
+      "\x47\x97\x60\x23\xaf\x77\xd3\xad\xa7\x4e\x92\xc7\xf6\xec\x5c\x7a"
+      "\x2b\xbe\x09\xd5\x12\xac\xc5\x83\x23\x23\x3e\x89\x0e\xb2\xc3\xd5"
+      "\x50\x8b\xf5\x24\x5b\x79\xda\x39\x2d\x3c\xc9\x68\xbd\x1e\x9d\x5d"
+      "\xc7\x72\x11\x98\xad\x42\xae\xde\x20\x90\x09\x74\xc1\xf1\x36\x9c", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA224,
+      "\x6c\xc7\x6d\x39\x9a\x66\xeb\xd8\x89\xa8\x62\xab\x46\xfc\xd1\x68"
+      "\x2b\x87\xf6\x8d\x9f\x5e\xb1\x9a", 24,
+      "\xd3\x5b\x4e\xd8\x14\xc9\x4f\x8a\xbf\x0b\x73\x9e", 12,
+      "", 0,
+      "\xed\xc6\xb8\x8d\x50\x5e\x84\x7e\x81\x79\xfb\xe5\xeb\x5c\xe8\x56"
+      "\x22\x7c\xc2\xde\x53\x29\xd0\x7a", 24,
+      "\xef\x74\xf3\xa7\x82\x3d\xb2\x13\x15\xa0\x18\xeb\xb7\xb4\x81\x83"
+      "\x60\xc5\xa8\x9b\x7f\x98\x9d\x6b", 24,
+      "\x40\x9c\x3d\xbd\x7d\xfc\x2d\xfb\x15\x3b\x6d\x2d\x4e\x7e\x31\xe9"
+      "\xd4\xdc\x75\xcb\x40\x30\x32\xe6", 24,
+      "\xe4\xf0\xae\xc5\x98\xff\xe4\xcc\x7b\x19\xf1\xb5\x98\xff\xb2\xed"
+      "\x4f\x8e\x89\x77\x56\xf1\xb0\x61", 24,
+      "\xaa\x0a\x09\x5e\xe7\xc0\xfa\x95\x3e\x97\x91\xf1\x5c\xe5\x81\xde"
+      "\xd1\x36\xb7\xae\xe9\x8a\xbd\x2c\xd3\x85\x75\xab\xc4\xed\xae\xde"
+      "\xad\x34\xd2\xa4\x22\x7f\xa0\x5b\x9e\x33\xab\x9b\xec\x6b\x66\xe9"
+      "\x6f\x97\x20\x81\xdd\x4a\x49\xfc\x03\x30\xf8\xc6\x6d\xe4\x8c\x4a"
+      "\x82\x99\xbf\xd7\xaf\xcb\xaf\x0b\x5b\x0e\x7d\x04\xb6\xdf\x18\x27"
+      "\x18\xe6\xb8\x33\xaf\x60\x49\xe0\x56\xed\xc8\xcd\xf5\x5e\x25\x71"
+      "\xc3\x4a\x27\x22\xd5\x4c\xfe\x3a\x9f\xce\xf0\x52\xd1\x49\x63\x23", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA224,
+      "\x67\x41\xfc\x09\x2d\x99\xd3\x77\x94\x95\xf8\x3b\x85\x30\x19\x37"
+      "\x46\xb7\xce\xe0\x5e\xc3\x8e\xf9", 24,
+      "\xdc\x7c\x20\x38\xbd\xbd\xe6\xb5\x7b\xe3\xf6\x92", 12,
+      "", 0,
+      "\xc6\xdd\xd4\xb5\x17\xbd\x9a\x35\xb9\xca\xce\x33\x9e\x95\xbc\xdc"
+      "\x1a\x02\x16\x61\x7f\xa5\xc6\xa8", 24,
+      "\x4c\x3e\x26\x9f\x88\x9a\x73\x67\x6c\xb7\x22\x12\x9a\xbf\x32\xca"
+      "\x20\x1b\x71\xc8\xc1\xdc\x30\xb6", 24,
+      "\xea\x61\x23\x48\xbd\xd5\x8a\x30\xef\x0e\x7b\x89\x58\x4e\x98\x7b"
+      "\x37\xa8\xee\x2a\x1a\x08\x7d\x41", 24,
+      "\x0a\x7f\x84\x41\x1e\xb1\xac\xde\xcc\x22\x54\x08\x5c\x88\x91\x83"
+      "\x2f\x32\x58\x75\x2e\xa9\x59\xbe", 24,
+      "\x6c\x72\x33\x63\xaa\x18\x30\xa4\xc4\x31\x47\x55\x4d\xc2\xe8\x41"
+      "\x86\x2b\x44\x42\x40\x78\xda\xcd\x57\x2c\x43\x47\x66\xd2\x52\xab"
+      "\x76\x88\x64\xe2\xda\x02\x01\xbe\xf5\x94\xe0\x6d\xad\x4e\x23\xea"
+      "\xa3\x01\x32\x95\x83\xda\x73\x64\x86\x02\xe9\xa9\x12\xa5\x64\x91"
+      "\x2e\x85\x08\x2f\x81\xcb\x41\x02\xd0\x80\xeb\x1a\xa5\xb3\x65\xcb"
+      "\x72\xce\x70\x0e\x8a\x9d\xc3\x93\x7a\xd3\x4b\x96\x36\xd5\xf3\x99"
+      "\xa2\x78\xa7\xa7\x63\xc5\x8d\xab\xe7\x7d\x16\xa3\x52\x34\x2d\x82", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA224,
+      "\x31\x02\xfb\xab\xd9\x10\x9a\xa4\xf4\xeb\x19\x57\x43\x3a\x42\x21"
+      "\x65\xed\xe8\x53\xfb\xf8\x42\x96", 24,
+      "\x83\xf1\x34\xd3\x4a\xa0\x2e\xa4\x5c\xb6\xef\x63", 12,
+      "\x1e\xba\xe7\xa3\x64\xe5\x61\x20\x76\xac\x99\x10\xf6\xee\x18\x4a"
+      "\xaf\x5b\x61\x2f\x7b\xb0\x67\x2f", 24,
+      "\x10\x34\xaf\x21\x15\xd2\x03\xc3\x3f\xec\xe4\x0e\x41\xff\xe1\x1d"
+      "\xe8\xa4\x16\xf4\xc1\x0e\x4c\x42", 24,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x4f\x3b\xcf\x3a\x8f\x84\x75\x08\x98\xcb\x8d\xd9\x74\xd4\x8a\x6a"
+      "\x9c\x9c\x90\xc0\xb5\x5b\x9d\x57\x71\x43\x4d\xa7\x4f\x75\xa5\xa9"
+      "\xe7\x56\x8f\x3f\x2c\x1c\x89\x8a\x2b\x7c\x16\x3f\xb3\x09\xe3\x45"
+      "\x96\x38\x73\x42\xe9\x05\x53\x42\xff\xcc\xac\x5c\xec\x47\x9d\xf9"
+      "\x85\x67\xcc\x3c\x10\xc1\x76\x5e\xac\x06\xdc\x0e\x7c\xdc\xbd\xfd"
+      "\x6c\x1a\xc3\xf3\x13\x02\x9b\x81\xd6\x30\x91\x30\x5d\x00\xb6\x6f"
+      "\xc1\x83\x59\x80\x7c\xb6\xe2\x07\x53\xd0\x0a\x8b\x87\xd1\x8c\xed", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA224,
+      "\x51\xd9\xcc\x5b\x75\x62\x9b\x8b\x82\xae\x1f\x64\xe7\x49\xf3\x87"
+      "\x36\x8f\x06\xfe\xda\x16\xf8\xc1", 24,
+      "\x27\x3f\x26\xaa\x69\xdf\xca\x71\xd9\x0e\xe2\x46", 12,
+      "\x0a\xe9\x7e\xd2\xe7\x77\x18\x2e\x0e\x0b\xbc\xda\xa7\x93\x94\xca"
+      "\x33\x0c\x11\x2a\xb3\xd6\xe6\xb8", 24,
+      "\xa0\x03\x73\xee\x59\xbf\x6f\x97\x43\xb4\xd1\x15\xb7\x12\xd0\xa6"
+      "\x70\xb3\xd9\x3b\x66\xfd\x4d\x47", 24,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xf7\x93\xcb\xed\xec\xd8\x1f\x2b\x17\x8c\xbf\x1a\xad\x0a\x7c\x79"
+      "\xbc\x80\x53\x5c\xde\x2d\x45\x1e\x75\xce\x10\xd8\x7e\x6a\x6d\xfb"
+      "\xa7\xfc\xd6\xc7\xa8\x5b\x30\x61\xd6\xcb\xd8\x7a\xf8\x2e\x8f\xf4"
+      "\x87\x83\x04\x58\xa9\x86\x9d\xc5\x1d\x8e\x31\xf3\x89\x82\xdb\x8a"
+      "\x6d\x4e\xb9\x6a\x3b\x64\x13\xde\x99\xb7\xad\x64\x47\xfc\x4c\xc6"
+      "\x99\xea\x5b\x5c\xb8\xd2\xdd\x8b\x5b\x0b\x0a\xce\x7b\x1b\x19\xc3"
+      "\xc3\x30\xe6\x86\x5c\x50\xbb\x49\x0e\x7b\x99\x15\xf7\x62\x17\x42", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA224,
+      "\x29\xb5\x51\xeb\xbd\x22\xbf\x65\x2a\xa0\xd3\xc9\x50\xa2\x70\xea"
+      "\x00\xad\xd3\x51\x5a\x1d\x6a\x4b", 24,
+      "\x46\x56\xd4\xf3\xf4\xf3\x4d\x8b\xb2\xe8\x59\x60", 12,
+      "\xfd\xed\xb2\x90\x08\x4e\x8c\xdd\xca\xed\xe7\xf8\x99\x6a\xae\x6c"
+      "\xe9\x1b\x24\xd4\x45\x55\xd6\x74", 24,
+      "\xfb\xe9\x10\x27\x0c\xe0\x5c\x63\xcc\x60\xd6\x7f\x26\xe0\x46\xb8"
+      "\x4c\xbb\x89\x55\x67\x8a\x94\x44", 24,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xb9\xea\x3c\x16\xc2\x16\x69\xf1\x15\x84\x49\xe8\xc1\xb0\x55\x0d"
+      "\x30\xeb\x22\x51\x4b\x1e\xba\x0e\xb0\x46\x4a\x70\x16\x6f\xe9\xe5"
+      "\x0c\xc1\x89\x64\xa0\xe8\xd3\x66\x68\xd7\xac\x23\x6f\x9b\xaf\x19"
+      "\x5d\x29\x70\xbf\xb0\xad\x17\x9e\x2d\x4d\x7d\x46\x2b\x02\x7f\x55"
+      "\x01\xb7\x14\x3f\xb8\x5c\xb6\x6e\x5c\xa3\xc6\x20\x65\x05\x98\x57"
+      "\x3c\xab\xe9\xdf\x4f\xdc\xa0\x5a\x19\xf9\x3f\x38\x3d\x6d\x54\x21"
+      "\x59\xaf\x7e\x59\x8c\x55\xaa\x1a\x7c\x71\xda\x37\x21\x98\x34\xf9", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA224,
+      "\x5e\xea\xf1\xb4\xa0\x37\x25\xb6\x3c\x48\xad\xcd\xc5\x41\x52\x63"
+      "\xa6\x94\x8b\x7b\xf2\xae\xc3\x91", 24,
+      "\x0b\x50\x18\xa5\xdf\x4e\x3f\xcb\x53\x1d\xd3\xdc", 12,
+      "\x64\xf0\xd1\xbe\xd2\x96\x43\xb4\x4f\x1e\x0e\x6b\x7e\xc6\xb5\x27"
+      "\x26\xaa\x92\x4a\xf1\x32\xca\x95", 24,
+      "\xb6\x0a\x6f\x55\xdc\x5a\xd8\xff\x23\x26\x16\x46\x6a\xe0\x54\x60"
+      "\x4f\x9e\xdc\x55\x30\xf4\x14\x34", 24,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xa6\x40\xb5\x04\xeb\xfd\x23\x1b\xe9\x70\x2a\x5d\xdf\x6f\x0c\x22"
+      "\x62\x37\xad\xa7\xa7\x01\x41\x56\xa7\x15\xb2\xf6\x3d\xc4\xc0\x9c"
+      "\x6c\x4d\x29\x6a\x7c\x49\xef\x39\x50\xa8\x59\xa3\xdd\x83\xad\x95"
+      "\xe6\xe0\x80\x30\xbd\xd0\xd3\xee\xb3\x4e\x98\xcc\x19\x99\x5f\x9f"
+      "\x4f\xf2\x35\x78\x02\x06\xe1\xd4\x0d\xe7\x4e\x8b\x16\x4e\x07\x3d"
+      "\xde\x2e\x26\x89\xc4\xd4\x1e\x37\x47\xee\xc8\x80\x3c\x8e\x00\xff"
+      "\x63\x5d\x4e\x60\x7e\x63\xe8\x79\xc8\xf7\x87\x5b\xcd\xbb\xa2\x66", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA224,
+      "\xef\x52\xba\x0c\x6a\xce\x82\x4c\x95\xc8\x16\x13\x4b\x92\x5e\x07"
+      "\x0d\xbf\x25\x86\x8b\x01\xaf\x40", 24,
+      "\xf9\x63\xd1\x00\x65\xa6\x2e\x4d\x90\x0e\x07\x21", 12,
+      "\x22\x5f\xdc\x1f\x32\x96\xeb\x18\x74\x62\xe2\x90\x0b\x44\xb1\xdb"
+      "\xd7\x3b\xe1\xaf\x88\x5e\x93\xd8", 24,
+      "\x53\xbb\x7d\x71\x24\xe6\x79\x1d\xe0\x17\x78\x47\xb0\xdb\x16\xb8"
+      "\xb0\xfe\xae\x08\xe5\x5d\xac\x78", 24,
+      "\x50\x6e\xe1\x6f\x12\x0c\xee\xdf\xac\x8e\xd7\xb5\x83\x3b\xce\xce"
+      "\xac\x66\x72\x0f\xec\x9b\x7f\x5f", 24,
+      "\x49\x6d\x60\xb1\x5a\x64\xd5\x9d\xab\x01\x0e\xd1\xa0\x5a\x2f\x3b"
+      "\x87\xbc\x02\x72\x8f\xf2\x9e\x07", 24,
+      "\x8b\x38\x7a\x68\x57\x4a\xb0\xcc\x3b\x0f\xd2\xed\x92\x86\x3e\x5d"
+      "\xd8\x3e\x82\xf7\xf7\x5b\x0c\x40", 24,
+      "\x58\x15\x6d\xf0\xc4\xb4\xf3\xf8\xcf\x05\xaa\x82\xca\xda\xfe\x01"
+      "\xde\x87\xbe\x4a\xfd\x18\x99\xfc\x74\x98\x28\xf1\x87\xbd\x45\x23"
+      "\xd5\x02\x8b\xd0\x22\x18\x8e\xa0\xb7\x4e\x43\xf5\xc5\xdd\x93\xce"
+      "\x5e\x19\x4a\x69\xf9\x1f\x63\xb1\x8a\x55\xd2\x7f\xaa\x6d\xc6\xa2"
+      "\x2f\x64\x56\x05\x52\x42\x7b\xa6\x96\x72\x6f\x39\x2c\x9d\x72\x2f"
+      "\x98\x8d\xf0\x7f\x6f\xfc\x51\x6e\xf0\x07\xad\x3f\xc6\x15\xe4\x3c"
+      "\xd2\x94\x80\xe7\xcd\xc7\x42\x01\x64\xed\x3b\x1e\xc2\xc2\x39\x08", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA224,
+      "\x2e\xcf\xfe\xd9\x56\xc5\x6b\xd7\x2c\x99\x26\x6c\x89\x65\xd3\xad"
+      "\x91\x76\x7a\x82\x44\xc1\x45\x5c", 24,
+      "\x63\xee\x96\x83\x81\x2d\xcc\x8a\x76\x6e\xc4\x3c", 12,
+      "\x43\xf7\x67\x39\x15\x7a\x21\x48\xf0\xe7\xc5\x8a\xb2\x31\x77\x11"
+      "\xf5\x5b\x7e\xef\x70\xf8\xba\xff", 24,
+      "\x4f\x5e\x74\x19\xe4\x29\x28\xdd\xc1\xc3\x93\x60\xba\x04\xc0\x22"
+      "\xa4\x25\x3e\x3d\xc3\xa2\xbe\x5d", 24,
+      "\x02\x7e\x04\x9d\x7a\x45\xd9\xae\x4c\xf6\x77\x8d\x58\x5e\x86\xc2"
+      "\x34\xa3\xc1\x6e\x61\xe5\x74\x5d", 24,
+      "\x4a\x29\x22\x45\x57\xbc\xee\x83\x6b\xd2\xf0\x3f\x9a\x51\xa3\x62"
+      "\xad\x2f\xcd\x32\x84\x1a\xdd\x18", 24,
+      "\xa9\x72\xa3\xb9\xbe\x89\x81\xf6\x57\x74\x19\x5d\x96\xc8\x84\xcb"
+      "\x35\x32\x09\x60\x6b\xcd\x37\xd8", 24,
+      "\xec\xd1\x78\xd6\x38\x77\x7f\x4f\x51\x45\x6f\x16\x08\xf8\x74\x63"
+      "\x22\xad\x11\x62\x47\xa7\xcd\xb1\xe9\x93\x74\x28\x57\xcc\xdb\x66"
+      "\x11\xf0\xc4\x29\xbc\x26\xb4\xe8\xf0\x56\x13\x35\xcd\x6b\x15\x6d"
+      "\xa9\x9b\xcd\x80\x95\x7c\xfa\x07\xb3\x37\x1f\xb0\x14\x00\x0e\x6a"
+      "\xf5\xa6\x17\x84\xb7\x12\x1f\xf9\x6c\x33\xa2\xf4\x67\x34\xe9\x84"
+      "\x07\x4d\xab\x05\xf4\xa9\x03\x83\x30\x0d\x50\x7b\xde\x55\x63\x00"
+      "\xfa\x51\xa3\xbd\xc3\xd5\x0a\xba\xe3\x8a\x5c\xb1\x73\x82\x92\xc8", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA224,
+      "\x71\xf5\x58\x87\x0d\x53\xa3\xda\x92\x71\xb2\x90\x3a\x38\xd4\xec"
+      "\x4f\xc7\x95\xe0\x20\x6e\x63\xd0", 24,
+      "\x38\x0d\x56\xc9\xf2\xc5\x24\x94\xd5\x23\xe1\xc4", 12,
+      "\xe4\xea\xaa\xde\xdc\xc5\x4a\xba\x20\xa8\x35\xe0\x2c\x7f\x3c\xa2"
+      "\x3b\x77\xbd\x1d\x9b\xc4\x92\x84", 24,
+      "\x0c\x65\x0a\xbe\x76\xf7\x60\xef\xb6\x9f\xe6\xb9\xf1\x73\x7a\x41"
+      "\x8f\x92\x58\x5a\x7e\x4a\xce\xc3", 24,
+      "\x60\xb0\x2f\xdc\x6c\x86\xe9\xdb\xf6\x81\x04\x98\xe8\x48\x29\x92"
+      "\x86\xc0\x82\xee\x5d\x81\x6f\x65", 24,
+      "\x8f\xf8\xee\x4b\xe1\xd6\x0e\x2e\x51\x9d\x34\x96\x0c\xe0\x3b\x90"
+      "\x55\x21\x5f\x14\x9c\xf2\x43\x04", 24,
+      "\x8d\x5d\x75\x62\x06\x8f\x3d\xeb\x08\x74\x4f\xc5\x44\x3b\xc9\x37"
+      "\x00\x3c\x6a\x40\x3a\xe0\x91\xe8", 24,
+      "\xf7\xc2\xdd\x38\x48\x95\x68\x0c\xa3\x69\xf8\x18\x28\xfe\x54\xbc"
+      "\x40\x52\x28\x03\x33\x53\x9a\xb2\x74\x60\xf4\x79\xbe\xc8\x02\xd4"
+      "\x08\xb2\x02\x7c\x5c\xf9\x73\x21\x45\x10\x17\x61\x19\x40\x4b\x43"
+      "\x41\x89\x95\xe2\x91\x24\x8c\xcb\x1c\x00\x34\x90\x17\x84\x42\x60"
+      "\xc5\x49\xf9\x65\x6e\xd2\xdf\x63\x42\x25\xb1\x54\xff\x3f\x87\x46"
+      "\x5a\xad\xf5\x72\xdf\xf0\x1d\xca\x62\xf4\x63\x14\x0e\x42\xb8\x5f"
+      "\xc0\x38\xe4\x02\xba\xba\x3a\x82\x57\x83\x7b\xdd\x5c\x72\xa9\x6f", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA224,
+      "\xb9\xfb\x63\xfa\x6a\x3e\x40\x23\x07\x11\xa9\x13\x5d\x73\x75\x37"
+      "\xa6\xeb\x23\x3e\x9d\x89\x5f\xc6", 24,
+      "\x72\x2e\x84\xdd\x47\x49\x42\x67\x50\x60\x79\x77", 12,
+      "\xa6\x82\x23\x68\x60\x36\x69\xba\x9a\xb6\xad\x55\xf0\x3c\x01\xfe"
+      "\x86\xbf\x67\xa3\xbb\xb9\x3f\x57", 24,
+      "\xba\x7b\x5c\x76\xf8\x76\x7c\xbc\x19\x72\xfc\xe9\x68\x20\xb7\x92"
+      "\x39\x93\x50\x82\x96\x63\xa4\x16", 24,
+      "\xbb\x17\x42\xe5\xa1\xc6\x69\x33\x5d\x3b\xe6\xa5\x1e\x7c\x60\xe9"
+      "\x3b\x4e\xb1\xa7\x84\x8f\x51\x08", 24,
+      "\x37\x9b\x77\x15\x90\x97\x72\xfd\x7f\xfb\x43\x14\xeb\xa9\x6d\xbe"
+      "\xed\x4f\x63\x7d\x2f\x11\x93\x2a", 24,
+      "\xae\xdd\xdc\x48\xea\xf5\xd5\x3f\x72\x3e\xd9\x56\x18\x5c\x08\xe0"
+      "\x4d\xd3\xa0\x8a\xc7\x1f\x77\x61", 24,
+      "\xc6\x41\x9c\xbd\x90\xbd\x2c\x71\x2a\x95\x51\x8a\x03\x41\x46\x4c"
+      "\xe3\x5b\xbb\xde\xfc\x73\x1d\x98\xc2\x19\x04\x62\x68\xbe\xc1\xf0"
+      "\xd8\xd7\xfd\x27\x8e\x8e\xa6\x39\x01\x75\x12\xbb\x2f\xc0\x53\xc7"
+      "\xbc\x16\xa2\x65\x0e\x56\xf1\x42\x38\x9e\x3f\x37\x1f\xc1\x85\xf5"
+      "\xe3\x34\xe2\x13\x58\x8f\x63\xfd\x6e\xdb\xcb\x7e\xcd\xae\xba\xab"
+      "\xd5\x49\x50\xcc\xf1\x3d\x78\xf2\xf4\xf6\xa0\x0c\xa5\x16\x28\xae"
+      "\xe3\x28\x06\x3b\xc1\x36\xf2\xd0\x1e\xaf\xf3\xf0\xc2\x8c\x94\xd2", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA256,
+      "\x00\xd2\xa4\xe0\x30\x12\x33\xdd\xb0\x94\x2f\xd7\xa0\xfc\x36\xe0"
+      "\xb9\x74\xb2\xba\xf0\x8c\xa7\xe1\x8a\xd0\xc8\x2e\x32\x40\x60\x6c", 32,
+      "\x53\x94\xec\xe6\xd6\x10\xd7\xd3\xd0\x75\x2c\xb4\xaa\x7d\x39\x8e", 16,
+      "", 0,
+      "\xc1\x0b\x07\x54\x8a\x0a\x78\x7e\xa1\x04\xa0\x51\xf5\xbf\xfe\xaf"
+      "\xc9\xac\x2a\x6b\x25\x9f\xc9\x25\x07\xd9\x3c\x9c\x89\xb1\xdd\x31", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x58\x9f\x95\x8a\x8e\x2d\x6a\xe9\x5b\xcb\xf8\x04\x19\xac\x08\x8b"
+      "\xd6\xa4\x15\x6f\xeb\x35\x83\xf8\xa7\xef\xd7\x8c\x84\x3b\xcf\xec"
+      "\x20\x1f\x07\x95\x59\xfd\x44\xd2\x7b\xe7\xf3\x0a\xcd\x79\x2c\xe6"
+      "\x4c\x86\xc8\xc6\x88\x3e\xfa\xf8\x2d\xe1\x7e\x4c\x2e\x3a\xa1\x46"
+      "\x9f\x72\x61\x64\xea\x0e\x57\xc2\xf4\x90\xdf\x55\xc2\xf4\xfd\xf5"
+      "\xba\xe5\xaa\x2e\x10\x81\xf3\x6d\x89\x85\xc4\x65\xa4\xe2\x0b\x76"
+      "\x2d\x51\x93\x8d\x19\x52\xe7\xfe\x92\x71\x0d\xfb\xb0\xad\xd4\x3a"
+      "\x12\x38\xa3\x87\xab\x1b\xfe\x5d\x66\x7d\xd9\x83\xb5\xe0\x96\x96", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA256,
+      "\x6b\x23\x3a\xb9\xc7\xd5\xa5\x94\x5a\xe8\x38\x2c\xe5\x0c\xeb\xa0"
+      "\x06\xc8\x55\xef\x2b\x69\x34\x71\xef\x62\x36\x57\x62\xd9\x41\x31", 32,
+      "\xd1\xbe\x1f\xa0\xab\x24\x1e\x41\x1b\x48\x90\xc9\x0c\x50\x41\xf6", 16,
+      "", 0,
+      "\xef\x7d\x39\xb3\xf4\x76\x2c\x69\xc1\xc4\xa8\x58\x2c\xa3\x5a\xa3"
+      "\x8b\xfe\xae\xe2\x68\xd6\xda\x19\x6a\x8f\xc0\xe5\xbd\x4a\x4f\xac", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x66\xf6\xa2\x4a\xeb\x77\xc7\x96\x91\x86\xc5\x9a\x9c\x99\x46\xdb"
+      "\xe7\x90\xe1\x26\x1e\xa8\x64\x40\x90\xfe\x29\x3c\x23\xf3\x5d\xf7"
+      "\x66\x9a\xdf\x2a\x7b\x76\x68\x3b\x37\xdf\x19\xba\x84\xcd\x43\xe0"
+      "\xe1\x25\x4f\x07\xc2\x4a\x57\xba\x87\x06\x1a\x70\x72\x87\x66\x01"
+      "\xaf\x64\x94\x3b\x78\x40\xff\xbf\x8c\x44\xed\x5f\x81\x51\xb6\x71"
+      "\x94\xee\x33\xf7\x5b\x3c\xcf\xee\xd0\xb5\x8b\x42\x2c\x31\x42\x64"
+      "\x9a\x58\xb7\xdc\x62\xc9\x70\x60\x6b\x8e\x2e\x6a\x25\xa6\x28\xd2"
+      "\x19\xd4\xbf\x36\x76\xcb\x97\x5b\x2a\x2a\x38\x0b\x35\x37\x45\x0e", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA256,
+      "\xf4\x28\xf5\x6b\x25\x58\x64\x43\x9e\x93\xfd\x78\x24\x5d\xa5\x86"
+      "\x31\x2e\x21\xfd\x66\x3f\x17\x9f\x7e\xf9\xc8\xea\x1d\xd5\xe6\x3a", 32,
+      "\x43\x0a\x1e\x9f\x1c\xa1\xb6\x8a\x36\xb8\x5f\x33\x3a\x22\x97\x41", 16,
+      "", 0,
+      "\xdc\x6a\x19\xeb\xfb\xe9\xb8\x14\x9f\x77\x36\xd5\x98\x15\x4d\x9c"
+      "\x96\x18\x6d\x10\xac\xf3\x05\xf9\xda\x87\xe7\x0d\x8a\x19\x25\xd7", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x94\x3b\x54\x71\x39\xc5\x84\xae\x54\x41\xe8\x1b\xd5\x2e\xc8\xc0"
+      "\x17\x8e\x89\x00\xf2\x3c\x17\xeb\x0d\x1c\xbe\x48\xbb\x78\x3d\x39"
+      "\xc5\xbe\xb4\xa4\xa4\x3e\xc3\x27\x49\xaa\xf7\xfa\x17\xbc\xd7\xfa"
+      "\x09\x2a\xe2\x22\x9a\xed\x00\x7d\x20\xcb\xf9\x3c\x83\x69\x39\x7b"
+      "\x35\xb8\x4b\xc2\x07\x06\x6f\xb7\xe8\x0b\xf7\xf4\x06\x07\x6b\x9c"
+      "\xa2\x1c\xdd\xd1\xbc\x3b\x75\x8f\x28\xf1\xe9\x2e\xa5\x9a\xb0\xd2"
+      "\x79\xf6\x48\x6f\xfb\x18\x21\xb2\x10\x3c\x66\x5a\x21\x89\x72\xf0"
+      "\x19\xc7\x3d\xcc\x0e\xc5\xcd\xd5\x12\x40\xea\xa5\xda\x65\xa8\xb8", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA256,
+      "\x90\x65\x46\xc6\x2a\x98\x59\x8c\x2c\x6c\xd9\x33\xd6\xd0\x51\x08"
+      "\x53\xca\x7e\x9c\x96\xfc\x3e\x73\x25\x82\x44\x60\x6a\x99\x7d\x1d", 32,
+      "\x5c\x19\x84\xb2\x43\x7f\x22\x50\xe5\xfb\x51\xdc\xe2\xa2\x5f\x32", 16,
+      "", 0,
+      "\x3e\x93\x03\xa1\x90\xd0\x28\x73\x7c\xb7\x44\x5a\x48\xbf\x22\xad"
+      "\xa0\x88\xaa\x19\x76\x21\xc4\x18\xa7\xac\xe0\x6a\xf1\xe2\xb0\xdd", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x24\xc8\x98\x8e\x0f\xc0\x5c\x3b\x88\x50\xa5\xbf\xcd\x75\xf9\x65"
+      "\xd9\xa5\xc4\x8e\xf1\x00\xe0\x66\xe0\x24\xe0\x97\x62\xb1\x4e\xa7"
+      "\xa1\x49\x48\x0b\x1f\xe3\xf9\x33\x0e\xad\xdc\x6a\x4e\x20\xb3\x7f"
+      "\xc6\x0a\x68\x14\x95\x64\xd5\xfa\x29\xd4\x9f\x16\xd1\xd2\xe5\xd8"
+      "\xd7\x11\xcd\x38\x17\x67\xc1\xe9\xa4\x7a\x42\xaa\x3a\x60\x0b\x00"
+      "\xaf\x15\x2e\xdd\x50\xa9\x3a\x7c\x0c\x08\x22\xfd\x4a\xca\xcc\x52"
+      "\x42\x45\xbd\x42\xa8\xbd\x4e\xd7\x69\xa2\x5f\x39\x82\x4e\x47\xaa"
+      "\x9f\xb9\x45\xa0\x47\x2d\xf5\x5f\x05\x4c\x3d\x7f\x4b\x59\x85\x2c", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA256,
+      "\xe5\x09\xc3\xcb\x42\xa3\x96\x29\x10\xb7\xda\xe7\x9c\xe1\x8e\x3d"
+      "\xc0\xd8\xe3\x11\xa5\x9d\x9d\x26\xcf\xf3\xda\x7c\xb3\x94\x87\xd1", 32,
+      "\xba\x0d\x3a\x2e\x33\xae\x0e\xc6\x4e\xed\xb1\xca\xf6\x8a\xae\xb5", 16,
+      "", 0,
+      "\xdc\x08\x92\x85\x00\xe0\x12\xc8\xf7\x1b\x67\x1a\x2f\xcc\xcf\xf3"
+      "\x70\xa9\x59\x3a\xce\x88\xe2\xea\xb3\x98\x23\x00\x51\xb5\xd9\x4d", 32,
+      "\xcc\x03\x64\x2a\xfb\x61\x49\x2c\x54\x35\x80\x26\x4a\x70\x80\x0e"
+      "\xf0\x13\x23\x48\xd6\x16\xe8\x0b\x6d\x48\xe6\x58\xe6\xed\x89\x17", 32,
+      "\x62\x8d\xe7\x4f\x1c\xab\xf5\xbc\x62\x39\xa1\xb3\x2c\x61\x9c\xea"
+      "\xa7\xa4\xd2\x3b\x07\x69\x6d\xc0\x08\xea\x30\x83\x66\xc0\x0e\x69", 32,
+      "\xbb\x3a\x6c\xeb\xd3\x90\xc4\xe8\xe4\x82\xdc\x90\x7f\x3d\x57\xd8"
+      "\x05\x28\xe0\x7c\x3e\x6e\x69\x05\xcf\x43\xbc\x05\x8d\x73\x9c\x1a", 32,
+      "\xdb\xcc\xae\x3a\x49\x66\xf1\x04\x2d\xff\xad\x1f\xbe\x1c\x21\x0d"
+      "\x65\x16\x69\x0f\xb7\x30\x81\x38\x89\x1f\x81\xe6\x02\xec\x65\xf3"
+      "\x5a\x85\x58\xaa\x74\xb7\x51\x9a\x5a\x22\xef\x57\x9a\xa4\x1c\xc1"
+      "\x4a\x33\xb3\xd1\x8d\x6b\x4f\x43\x7d\x3f\xc6\xdf\x57\x5a\x7e\xc4"
+      "\x02\xf7\xa8\x20\xd1\xdb\x8a\x12\x49\x3d\x6b\x96\xc9\xdd\x87\x93"
+      "\x7f\x5c\xf2\xf4\xe7\xb6\x76\xca\xdd\x60\xe1\xe3\xac\xf4\x4d\xcf"
+      "\x53\xe0\xb8\x50\x1b\x88\x7a\xbd\xad\x34\x98\xfc\x2c\xa2\x6c\x53"
+      "\xe9\xc7\x3d\x04\x2a\x9d\x04\xc5\x2b\x58\x81\xae\x1b\x5c\x46\x60", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA256,
+      "\x31\xd8\x2c\x02\xa7\x35\xa3\x41\x81\x18\x95\xef\x7c\x31\x2f\x55"
+      "\x14\x2f\x35\xb1\x04\x4a\x05\xb9\x50\x4b\x37\x40\x25\x8a\x01\xf4", 32,
+      "\xc8\x02\xbb\x63\x5f\x1c\xd6\x8b\x78\xa0\xb5\x1f\xa9\x7b\x29\x7c", 16,
+      "", 0,
+      "\x6c\x75\x2d\xb9\xd7\xa1\x2d\x5d\x00\x29\x65\x5c\x31\xb5\x2e\xfe"
+      "\x9f\x9b\x4e\x79\xa3\x7a\x19\xb1\x53\x6d\x64\xf3\xd0\x28\xd1\x70", 32,
+      "\xe0\x1c\x28\xdc\x7f\x8b\x03\xa5\x62\x5c\xd1\xbe\xa6\xa8\x7a\x6a"
+      "\x0d\xdd\xd7\xea\x8a\x19\x07\xd3\x96\xb8\x1a\x45\x5c\x03\x59\x66", 32,
+      "\xb8\xc7\x6e\xa9\x09\xe2\xa7\xbd\x70\x82\xe0\x6f\x9e\xbd\x1c\xf2"
+      "\x6c\x96\xbb\xe2\x23\xa0\x1f\xbd\xc5\xf3\xfc\x3f\x35\xcd\xd1\x22", 32,
+      "\x81\x50\xcb\x7d\x18\x8a\x13\xe3\xe7\xe1\x7a\x8e\xb9\xf6\x95\xe3"
+      "\xd9\x81\x06\xf6\x71\x98\xb4\xc1\x7c\x94\x1d\x21\x63\x54\x15\xfe", 32,
+      "\x53\xab\xb3\xf3\x66\xde\x1f\xd9\x62\x45\x6a\xc5\xdb\x5a\x61\xf3"
+      "\xd6\x28\xcd\xf1\xf4\xfd\xdf\xd4\x9d\x92\x43\xd8\x6f\x23\xa6\x52"
+      "\x5c\x36\xfe\x19\xff\xfd\x77\xb3\x6f\xfb\xfa\x07\x32\xda\x49\x58"
+      "\x53\x44\x3a\xb0\x15\x51\xd6\xf4\xd5\x7e\x80\xe2\x5d\xf4\x51\x23"
+      "\x09\x04\xd7\xdc\x73\x31\x3a\x7d\x60\x91\x53\x9e\x0b\x89\xa2\xd8"
+      "\x0c\x1f\x0b\x5e\x04\xff\xc8\x42\xab\x85\x3b\xa6\xa9\x9c\x48\xeb"
+      "\xf6\xbb\xe3\x6f\x21\xc1\x8a\x5f\x13\xe0\xae\xc9\x59\x2a\x3b\x8b"
+      "\x65\xfb\x03\x74\x61\xd6\xc3\xa4\xd5\x78\xbf\x67\x58\xc2\xa5\xd1", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA256,
+      "\x24\xb0\x83\xb8\x3a\x57\xe8\xed\x89\x3e\xdd\x2d\xe3\x69\x48\x5b"
+      "\x7e\xa0\x65\x44\x32\x45\x50\x2a\xbb\x7c\xa9\x72\xc6\x56\x68\x89", 32,
+      "\x9a\x79\xfc\x6e\x81\x65\x0d\x61\xd6\x76\x53\xd6\x3e\x41\x8f\xa0", 16,
+      "", 0,
+      "\x7b\x02\x41\xab\x2a\x34\xc4\xe7\xef\xf3\xff\x58\xda\x8d\x27\x06"
+      "\x8e\xd8\x8e\x10\x65\x98\x74\xe2\xec\x6b\x82\xb5\xdb\xf2\x54\xa1", 32,
+      "\x6e\xc5\xcd\x94\x0d\xaa\x09\xe2\x2f\x4e\xa7\xd1\x2d\x77\xca\x82"
+      "\x83\x07\x30\x6b\xaa\xc3\x6d\x76\xa0\xe4\xe0\xc3\xc9\xae\xa1\x25", 32,
+      "\x53\x01\x59\xae\x01\x0f\x97\x0d\x4e\x29\x33\xca\x6a\xe0\x06\x82"
+      "\x95\x45\x8e\x17\x05\x93\x7c\x07\x1a\xf7\xef\x5f\xfb\x80\x57\xd4", 32,
+      "\xed\x5a\xa9\x67\xa4\x01\x04\x13\x51\x23\x50\x47\x51\x4e\xd0\x41"
+      "\xa3\x0f\x9e\xb9\xde\xf1\x89\x89\x26\x01\xba\x3f\xcb\x60\xae\x5f", 32,
+      "\xe8\xb8\x77\x2d\x82\xb5\xd3\x1d\xae\x45\xc6\x13\xcc\x93\x20\x65"
+      "\x56\x78\x7b\xd5\xd9\x87\xff\x2b\xea\xee\x70\x20\x8c\x8a\x3c\xc4"
+      "\x62\x53\x2b\xd1\x01\x35\xed\x67\xa0\x73\x58\xa7\x53\x1f\x9a\xeb"
+      "\x7a\x2a\x5a\x3f\x84\x86\xdd\x88\x7c\xb3\xb9\x9c\x1c\xb4\x24\x30"
+      "\xce\x75\x42\xfa\x6e\xb2\xa9\xc0\x1a\xac\xd2\xba\x96\x46\x90\x4c"
+      "\x6c\x66\xfd\x1f\x5f\x2a\x8d\xc8\x7b\x5a\x19\xcd\x8a\xfc\x7f\xb6"
+      "\x10\xf0\x97\xea\x5b\x81\x36\x2a\xd1\x82\x04\x17\x73\x77\x12\xab"
+      "\x9c\xbf\x73\x32\x0b\x2f\x4e\xb6\xd6\x39\x44\xe2\xa3\xca\x77\xc7", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA256,
+      "\x21\x6a\x16\x35\x2a\x3d\x89\x33\x89\xd1\x2a\xfb\xfb\xe0\x66\x49"
+      "\xcc\x7d\xd5\x4d\xa0\xc9\xb4\xfe\xd4\x7d\x2f\x2f\xb8\x45\x7c\x01", 32,
+      "\x52\xb5\x3a\x55\x62\x0d\x2a\x7f\x27\xf9\xeb\x09\xe6\x99\x91\x48", 16,
+      "", 0,
+      "\x87\x78\xf4\x40\x07\xd5\x62\x53\x62\xe2\x95\x87\x10\xa7\xc6\xd6"
+      "\x18\x8d\x46\x6e\xce\x92\xb1\x63\x38\xf5\x83\xa5\x32\x44\x70\xe3", 32,
+      "\x77\xad\xd8\x56\xf4\xdb\x44\x11\x10\xb8\x9f\x27\x47\x9b\xa5\xc0"
+      "\xc1\xf8\xe8\x51\xb9\x85\x12\x70\xb8\x26\xc4\xab\x0b\x3c\xf5\x3a", 32,
+      "\x8c\xcd\x95\x24\x06\x5e\x75\x89\xc0\x65\x1a\xbb\x8c\xd8\x2d\x58"
+      "\xb0\xe1\x54\xea\x23\x46\x7a\x5b\x70\xe0\xef\x19\x14\xf6\x5d\x12", 32,
+      "\x87\xb0\xdd\x4a\xfa\xe6\x84\x9f\x17\xa9\x0a\x36\x14\x25\x6d\x09"
+      "\xd9\x10\x82\x3d\xb0\x1b\xfa\x4d\xd7\x92\xb0\xd6\x66\xd8\x27\xbd", 32,
+      "\x51\xc8\x78\x5f\xfb\x33\x6b\xca\x84\x48\xee\xe2\x21\xff\x11\x2c"
+      "\x1e\x07\x35\x9b\x4e\xb3\x83\x31\x7b\x8b\x64\xd1\x8c\xd2\xbe\x40"
+      "\x05\xfd\x23\x98\xcd\x5d\x07\xa2\xa1\xcd\x67\x67\xac\xf0\x5f\x86"
+      "\x36\x22\x6b\x2f\xd8\x2c\x2f\x3d\xb7\xc6\xac\x32\x27\x87\x0e\xfa"
+      "\xd0\x10\xb4\x11\x8f\xd0\xe2\x05\x40\x42\xa1\x69\x8e\xfd\xc4\x24"
+      "\x7e\xc3\x96\x61\x9b\xb6\x03\x68\x30\x1b\x9b\x1f\xb6\xcd\xd4\x92"
+      "\x3c\x15\x5a\xa9\x0c\x09\xc3\x60\x96\x37\x79\x5a\xea\x43\x6c\xc3"
+      "\x8f\xf7\x2b\x2f\xef\x6d\xbc\xb3\xfa\x26\x4c\xce\x26\x38\x99\xf1", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA256,
+      "\x3c\x69\x59\x9c\x52\xf6\x00\x60\x12\xb6\xb8\x83\xfa\x76\xf4\x24"
+      "\xa9\x6b\xdf\x86\xda\x43\xd2\x39\xfd\x11\x12\x7e\xdc\x88\x59\x08", 32,
+      "\xec\xfe\x9b\xdb\xb5\xf0\xe4\x65\x3f\x4b\xec\xe9\x01\x94\x8a\x5a", 16,
+      "\x9e\x66\x4b\x5b\x26\x3a\xad\xec\xef\x09\x8b\x0a\xf0\x0d\x2e\x6c"
+      "\x42\x25\xab\x44\xba\x29\xcb\x2c\x85\x77\xff\xde\x4f\x49\xce\xaf", 32,
+      "\x88\xc7\xc3\x93\xc8\x90\x58\x68\x48\xfc\x6c\x30\x86\x9a\x32\x4f"
+      "\x41\xe3\x33\x03\xaa\xe3\xc5\xd8\x27\x40\x2d\x52\x83\x0b\x2a\x3c", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xd6\x29\x54\xf5\x88\x89\x55\x41\xaa\x79\x09\xe8\x07\x78\x92\x6f"
+      "\x2b\xdc\x4c\xee\xb8\xa4\x27\x3d\x17\x41\xa1\x3a\x33\xf6\x44\x43"
+      "\xd0\x51\xe3\x81\x08\x5c\x61\xdf\x66\x29\x2a\x5c\xe2\x63\xcd\xc4"
+      "\xea\x38\xb3\xd2\xc5\x02\x2d\x28\x9e\x63\x55\xed\x2d\xe1\x11\x55"
+      "\xfa\x4d\x48\x43\x70\xd9\xf4\x50\xf8\x83\x00\x66\xe1\x8c\xed\x6e"
+      "\x25\x96\x02\xf1\xc5\x05\x8e\x72\xff\x30\xed\x3a\x05\xdb\x92\xb2"
+      "\x9e\x6e\xc2\xb0\xce\xd6\xae\x40\x06\xb8\x6b\x72\xb3\xd7\xd2\x86"
+      "\x3c\x4c\x92\x50\xb8\x15\xd7\x3c\x61\x41\xfd\xee\x1b\xf7\x3b\xe4", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA256,
+      "\x03\x17\x07\x2b\x09\x85\xc9\x1d\x0a\x44\x5d\x4f\x74\x2f\x4d\x64"
+      "\x28\x3a\x7b\xcb\xf6\xc5\x0d\x5a\x60\x30\xa7\x0e\x8d\x7d\x72\x2e", 32,
+      "\x6b\x47\x54\x43\xea\x97\xa1\x1d\xf5\xaa\xca\xb0\xcd\x3b\x77\x1d", 16,
+      "\xbf\x04\xe8\xc1\x73\xaf\xf4\xdc\x25\xf8\xc9\x70\x72\xdf\x7c\xee"
+      "\x7d\x61\x48\x63\xb6\x0c\x98\xa1\x95\x58\xe4\x46\x9f\xf3\x23\x30", 32,
+      "\x46\xa5\xd1\x7b\x7b\x4a\x0f\x97\x87\xa2\xae\x82\xcc\xdb\x36\x2d"
+      "\x36\xea\xc3\x7d\xe8\xaf\xf9\xd8\x53\x21\xf6\x7b\xb9\x58\xab\x2a", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x84\x51\x45\xd7\x91\x92\x7c\x6c\x7f\x76\x52\x96\x2f\xea\x36\xc9"
+      "\x6e\x4c\x3b\x13\x7d\x51\x65\x4e\xe7\x62\x9e\x4e\x22\xe5\x27\xc3"
+      "\x3f\x54\x2e\xc1\x3b\xa7\x49\xae\xd5\xaa\x8f\x6a\x68\xa5\x2e\x8c"
+      "\xd1\xc3\x6d\x8d\xc9\x9a\xa9\xd8\xb3\xf9\xa2\x64\xe1\x5c\x43\x23"
+      "\x0d\x32\x93\xb3\xae\xbd\x9a\xb3\xa2\x81\xd0\x6d\xf6\xb1\xd0\xa8"
+      "\xdd\x5d\x4b\x47\x94\x40\x4d\x54\xac\xb9\x4a\x7c\xce\xd1\x0e\xcb"
+      "\xe7\x6f\x33\x27\x3f\x93\x36\x59\xad\x38\xc3\x5d\x98\x2a\x82\xd2"
+      "\xa1\xd4\x35\xa8\x9b\x94\x00\x55\xea\x36\x02\x0f\x69\xf6\x51\x7c", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA256,
+      "\xe3\x3d\x23\x72\x03\x23\xec\x0e\xf1\x9f\xe7\x2e\xf1\x35\x14\xc5"
+      "\x47\x68\x24\xc1\x20\xcb\x88\xa7\x67\x7f\xf9\x2f\x33\x37\xdb\xe1", 32,
+      "\x86\x4f\x55\x59\x3d\x03\x9b\x15\x8c\x2c\x39\xaf\x9d\x58\xb8\x90", 16,
+      "\xc1\x59\x61\x47\x9b\x59\x1b\xf8\xda\x06\xa9\x2d\x48\xf4\x4e\x00"
+      "\x6c\xc8\x83\x1b\xec\xe7\x63\x9b\x92\x32\xea\xdb\x2a\x8f\xe4\xc9", 32,
+      "\xf8\x4f\x8e\xcf\xc9\xcb\x48\xf0\x11\xa7\x95\x63\xf3\xd2\x7b\x71"
+      "\x02\xa0\x1b\x01\x4d\x69\x20\xc0\xfb\xf0\x8e\x30\x64\xee\xef\x53", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xc7\x3d\x53\xe3\x8e\x0b\x6a\x8b\xaf\xd5\x32\x0e\x50\x57\x49\x36"
+      "\x93\x54\x42\x18\x2b\x4a\xc1\xe2\x30\x25\x58\xff\x6b\x82\xc5\x28"
+      "\x47\xea\x7f\xee\x25\x4b\xfd\x1c\xab\x20\x17\xc6\xed\x03\x41\x92"
+      "\x61\x87\xa0\x3c\x38\x43\x34\xf6\x3e\x29\xe9\x46\xca\x0f\xf3\xf3"
+      "\x06\x30\x94\x91\xd4\x81\x71\xfc\xc2\x02\x1a\x4c\x15\x62\x3f\x0f"
+      "\x15\x62\x23\xc5\x5b\x0f\xdf\xc8\x39\xe5\x38\x84\x67\xac\x3c\x16"
+      "\xe6\x98\x71\xc9\x5b\x8f\x51\x0d\x22\x39\x16\x42\x2e\x9e\x93\xe9"
+      "\x07\xc0\xc5\x51\x6c\x50\x6a\xc6\xdf\x53\x95\x51\x20\x65\x30\xe7", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA256,
+      "\x63\xa0\x32\x07\x1f\x58\xec\x06\x59\xbb\x07\x62\x59\xfd\x39\x1c"
+      "\xe0\xd1\xad\x54\xa8\xff\xea\x84\x05\x8a\xd2\x0d\x0e\x8a\xe5\xb3", 32,
+      "\xcb\xac\x7e\x58\x91\x73\xc9\x27\x88\x34\x26\x25\x43\xe9\x7d\xee", 16,
+      "\xc0\x6c\x03\x9e\x9e\xde\xa1\x09\xa9\x97\xc3\x5c\x59\x0a\x9e\x15"
+      "\x7d\xe5\xf3\x9b\x6d\xac\xb8\xa8\x23\x98\xd0\x6d\x1c\x22\xfb\x9a", 32,
+      "\x84\x05\xcb\x73\x89\xfc\x00\x4c\x36\x16\x46\x54\x78\x55\xe9\x52"
+      "\x3a\x92\x9b\x35\x67\x99\x5e\x1b\x9f\xe5\x04\x06\xe1\x93\xc4\x96", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xee\x82\xa5\x68\xcd\xc8\xe7\xa0\x48\xc8\x05\x31\xb3\x78\x27\x66"
+      "\x1e\x45\xac\xd0\xf5\xea\xaf\xee\x4a\x24\x58\x54\xcd\xa8\x45\xe3"
+      "\x9f\x14\xc8\xb9\xf1\x51\xfa\x31\xa0\x22\x9d\xf7\xf2\xb5\x17\xa9"
+      "\x8d\xf6\x06\xa3\xf6\xb4\x64\x0e\x2c\xdf\x78\xbc\x58\x03\x1e\x3e"
+      "\xa3\x87\xcc\xeb\xa3\x39\x8d\xc3\x0b\xf5\xb0\x1f\x5e\xe0\x16\x34"
+      "\x88\x34\xd3\x24\x47\x78\x31\xe0\xbb\xaf\xc8\xcf\xae\xd0\x2e\x36"
+      "\xbb\x39\x4d\xe4\xad\xef\xcf\xff\xc9\x90\xb7\xd5\x0a\xa4\x19\x82"
+      "\xf4\x2a\x25\xcc\xb3\x32\x83\xc7\xf8\x35\xf3\x5c\x6c\xf5\x52\x5d", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA256,
+      "\xae\xcd\xc9\xf2\xf9\xdf\x00\x2c\xb1\x98\xd1\xd5\x12\x1e\xa7\x57"
+      "\x02\x51\x9c\x69\x26\x2b\x16\xd7\x27\x2a\x47\x27\x83\x9a\x67\x39", 32,
+      "\x38\xc0\xac\xda\x3e\x78\xe2\x1f\x09\xf4\x84\xca\x03\x0a\xee\x44", 16,
+      "\x9e\x94\xff\xb8\xb0\xc0\xad\x3a\xaa\xf5\x12\xa9\xe4\x0c\x6f\x16"
+      "\x0c\xfc\xc5\x9b\x7c\xe3\x54\x77\x60\x39\x16\x06\x3b\x1d\x7b\x56", 32,
+      "\x42\x6b\x10\x59\x4d\x6a\x02\x57\x98\xa3\xa9\x75\x9a\x21\x13\x8a"
+      "\x9d\xbd\x15\xab\xed\xaf\x83\x99\x73\xf6\x64\x9a\x00\xb1\x71\xac", 32,
+      "\x7f\x62\xe1\xc0\x67\xf1\xbf\x78\x3f\xb8\xb8\xf8\x9d\xc0\x7d\xb1"
+      "\x51\x24\x49\xc7\x3e\x85\x41\x3e\x5d\xd5\x6c\xa1\x9d\xde\x72\x7b", 32,
+      "\xd6\xc4\x47\xd4\x27\x7f\x52\x44\x8f\x4a\x1c\x61\xdd\xa1\x9f\xb7"
+      "\x8a\x8a\x18\x65\xbb\xf2\x7d\x4d\x5c\xfa\x67\xd7\x17\x93\x13\x83", 32,
+      "\x75\x2a\x00\xdf\x0f\x5f\xdd\xd0\x66\x08\x79\x63\x6e\x8c\x77\xaf"
+      "\x0b\x6c\x08\x0d\xf0\xb5\x33\x22\x9c\x20\x24\x03\x3c\x2e\x46\x06", 32,
+      "\x9e\xe7\x10\x4d\x9e\x93\x3d\xb8\xd1\x63\xc5\x56\x86\x74\xb0\xbe"
+      "\x79\x8d\x33\xb0\xa2\x92\xa3\x4f\x02\xf3\x73\x38\x41\x98\x8c\xa8"
+      "\xea\x0b\x3f\xdd\xdd\xbb\x3d\xc8\x86\x69\x97\xd9\x7c\x10\x8c\x5c"
+      "\x10\x1e\x25\xe7\x30\x41\x00\x48\x17\x20\xa8\x46\x6e\xdb\x06\xa8"
+      "\x68\x04\x2a\xa3\xce\x62\x19\xad\x9c\xe0\x9d\x10\x73\xa1\xed\x1b"
+      "\x17\x4b\x68\x82\x7a\x86\x65\xe6\x20\xbe\xe0\x6d\x24\x44\x9f\x84"
+      "\x44\xda\x89\x35\x46\x5a\xe8\x3c\xbb\xc5\xcb\xfc\xca\xa3\xc6\xd5"
+      "\xa5\xc0\x75\x25\xe6\xb0\x50\xea\xce\xe4\xff\x9d\x53\x9a\x04\xe8", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA256,
+      "\xed\x9c\x8b\x7f\xb6\x12\x0c\x2f\xe6\x2f\x90\xf4\x34\xa3\x0f\xa9"
+      "\xde\xa4\xb2\x4f\x0b\xee\x7d\xcd\x1c\x5c\x42\x17\xd6\x9c\x98\xbd", 32,
+      "\x1d\x99\x18\x0a\xc1\xce\x5c\x74\xd9\x56\x2d\x2c\x41\x15\x6f\x7c", 16,
+      "\x30\x9e\xd5\x5e\x50\x11\xdf\x0c\xdd\x76\xf5\xbc\xf4\xd5\x8e\x81"
+      "\x8d\x93\x61\x40\xcc\xd3\xca\x04\x12\xaf\x9c\xc9\x60\xcd\xd1\xe7", 32,
+      "\xee\x83\x4e\xd1\x58\x79\x99\x4e\x9a\x99\x1e\xab\x21\x3a\x03\xf6"
+      "\x96\xf8\xda\x6c\xab\x1d\x1f\x8d\xbb\x89\x4a\x57\xd4\x3a\xf1\x30", 32,
+      "\x46\x33\xbf\x66\x28\x26\x0c\x46\x9a\xfe\x3a\x78\x0d\x51\xa0\x83"
+      "\x4c\xaa\x42\xf1\x94\x18\x76\x5c\xb4\x8d\x5d\xbb\x0b\xb9\xb6\x95", 32,
+      "\xcc\x66\x8f\x20\x1a\x72\x1b\xa3\x13\x34\x52\xbd\x70\x72\xfb\x04"
+      "\xd5\x86\xe0\x0a\x1d\x62\x27\x0c\x0e\xfa\x1f\xab\xe7\xf2\x8d\xd6", 32,
+      "\xd5\x12\x89\xcf\xcb\xa6\xb4\x8f\x34\x63\x3d\x4b\xf7\x76\xd7\xc8"
+      "\x97\x84\xe8\x36\xf7\xbb\xae\x85\x17\x96\x01\x33\x6a\xca\xdc\x10", 32,
+      "\x36\x1a\x41\x92\x69\x29\xd6\x7f\xd2\x7c\x99\xe0\x84\x82\x25\x82"
+      "\x52\x4f\x21\x34\x72\x69\x43\x1e\x32\x98\x8f\x87\xcb\xcf\x11\x02"
+      "\x6a\xf2\x90\x3b\x2d\x29\x16\xfe\xed\x19\x3a\x93\xd3\xd5\x5a\x79"
+      "\xb4\x85\x2c\x4e\xe3\x8a\x11\xf4\xb8\x97\x9c\xa2\x0f\x0d\x31\xe4"
+      "\x6e\x75\x18\xed\x65\x1c\x75\xa3\x3a\x39\xac\xfe\xc4\x4f\x89\x75"
+      "\x36\x26\xcf\x87\xe5\xbb\xd0\x32\x82\x2d\xfe\xc3\xda\xe6\xbb\x41"
+      "\x5a\x09\x2c\x47\xba\x2a\x25\xde\x63\x93\xa8\x20\x00\x94\xed\x91"
+      "\xc9\xfe\xa4\xf9\x44\x7d\xc6\xb8\x8f\x90\x99\x1b\xf3\xd1\x1e\x1e", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA256,
+      "\xcd\x3e\x5d\xf3\xab\x20\xa5\x27\xad\x9d\xe4\x70\xf5\xdb\xb1\x76"
+      "\x35\xe8\x67\xea\x30\xd4\x55\x69\xe5\xc5\x73\x42\x9b\x6c\x21\x92", 32,
+      "\x81\x51\x76\xf3\xa1\xd0\x46\x30\x90\xc2\x39\x17\x12\xe7\xc9\x6d", 16,
+      "\x1b\x1f\x26\xac\x11\x08\xe6\x90\xaa\xc1\x3e\xda\x6b\xbc\x06\x7f"
+      "\xb8\x6f\xa1\x32\xf4\x36\x5b\x06\x4c\x20\x43\x05\xb6\xf2\xb4\xd4", 32,
+      "\x8e\xc7\x77\x95\x8c\x10\xd1\x3e\x98\xf7\x3f\x3b\xc8\x50\x68\xc7"
+      "\x52\x0b\xde\x10\x7e\xbb\x08\x92\xbb\xb2\xdb\xd2\x84\xf5\x91\x07", 32,
+      "\x04\x11\x52\x57\x6a\x2d\x02\xc7\xcc\xe6\xd4\x71\xae\x85\xd2\xfe"
+      "\xc1\x2e\xac\x1a\xcf\x7a\x56\x06\xbd\x6b\x33\xc7\x6e\x83\x1a\xbc", 32,
+      "\xdd\xaf\xc9\x77\xf7\x0d\x36\x63\x89\xef\xee\xdd\xd4\xa5\x3c\x39"
+      "\x88\xad\x39\x03\x94\xf7\x5b\x0c\x96\x2c\x14\x0d\x45\xe6\x3d\x85", 32,
+      "\x3d\xc3\xab\x15\x6b\x8e\xa1\x7c\x61\x23\x8e\x88\x64\xe3\xab\xe5"
+      "\xfa\x52\x18\x65\x3e\x89\x5b\x33\x69\x0f\x74\xe3\x9e\x2c\xb9\x24", 32,
+      "\xc5\xc1\x09\x00\x12\x38\xc5\xfb\xee\x5c\xee\xfe\x6c\xe9\x9e\x35"
+      "\xff\xeb\x2e\xd2\x9e\xb6\xee\xb7\x52\x19\x56\xe0\xde\xe7\x1a\x1e"
+      "\x5d\xbe\xe7\x51\xa9\x7c\x7f\x1d\xf6\x76\x31\xd1\x79\x73\x4b\xe7"
+      "\xb1\x35\x20\x6b\xfb\x60\x1b\xaf\xe9\x4a\x1f\x03\x65\x98\x31\xe8"
+      "\x36\xbe\x1b\xa1\x39\x74\x55\xc7\x93\xf5\xd2\x6c\x54\x1b\xc0\xef"
+      "\x64\xf5\x93\x65\xa8\x45\x4c\x8e\x61\x6f\xe9\x42\x72\xe0\xc6\xc6"
+      "\xa5\x15\xb3\xd4\xed\x68\xa6\x5f\x1a\x6d\xc9\x36\xf1\x5d\x34\xef"
+      "\x12\x57\xa7\x54\x77\x23\xcb\x3e\xec\xc5\x39\x08\x36\x59\xe6\x00", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA256,
+      "\x5b\x1a\x13\x0a\xc2\xff\x84\x27\x06\x81\xad\x38\xe1\x66\x35\x1f"
+      "\xc7\x22\x5a\x8f\x1d\xf9\xb1\x92\xb5\xc4\x37\x5e\x22\xd2\xd2\x42", 32,
+      "\x16\x85\xfb\x3e\x61\x22\x80\x23\xd0\xf2\x0f\x18\x1a\x5b\xa9\xef", 16,
+      "\xc3\xdf\xcb\xc5\x36\x73\x6b\xdf\x07\x3f\xf5\x63\xa2\x38\xd7\x4e"
+      "\x16\x5b\x93\x7f\xd0\xb1\xfb\x50\xc3\xa0\x84\x54\x98\x86\xa4\x4a", 32,
+      "\xe4\x6e\x99\xc4\x1d\xfc\xc7\x83\x96\x5a\x1d\x20\xc3\xf2\x39\x06"
+      "\xa2\x6f\x42\x54\xe8\x5c\x69\xfc\x03\xab\x81\xc6\x74\x2c\x22\x2c", 32,
+      "\x52\x47\x4b\x90\x29\x01\xe2\x0d\x44\xe2\x8d\xe0\xef\xc8\x94\xd9"
+      "\xb9\x2d\xe3\xcd\x37\xc4\x7a\xcb\xea\x61\xbc\x51\xee\x37\x90\xeb", 32,
+      "\x0c\x72\x66\x06\x41\xd6\x81\x43\x6b\x46\x05\xbb\x96\x7e\x90\xc0"
+      "\x1c\xee\x1d\x4e\xb0\x76\x21\x3e\x61\xaf\xf8\x01\xbb\x33\x41\xc1", 32,
+      "\x8a\x53\x71\x87\x32\xd9\x0c\x52\x82\x9f\x5b\x73\xab\xc2\xf0\x66"
+      "\x91\xc5\x02\x90\xd8\x0c\x86\x3f\x16\x98\xd8\xec\x63\xaa\xe5\x36", 32,
+      "\x61\x58\x5f\x72\x70\x7e\x22\x83\x3e\x67\xbb\xb1\xb6\xfc\x70\xbf"
+      "\x24\xcf\x78\xca\x7d\x66\x3e\x3e\x63\xbf\xa3\x65\x85\x0f\xc7\xa4"
+      "\x31\x98\x00\x87\x08\x87\x3e\x4b\x5f\x24\x93\x83\x85\xda\x87\x1a"
+      "\x47\x40\x96\x5b\xdc\xcf\xb1\xf5\xe2\x10\x47\x85\x40\x65\xb7\xff"
+      "\x6d\x0d\x37\xe4\x0d\x79\xa1\xa3\x30\x8c\x7d\x04\x04\x81\x85\x12"
+      "\x7c\x75\x41\xeb\x23\xf5\xf0\x3c\x00\x40\x7f\x9f\xbf\x21\x11\xb3"
+      "\xc6\x61\xb9\xd4\xe7\xf6\xf4\xd6\x81\x25\x6d\x91\x91\x43\x53\xdc"
+      "\xeb\xc3\x78\x81\x76\x2d\xd3\x83\xb4\x93\x70\xe6\x89\x61\x36\x6b", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA384,
+      "\xad\x18\x93\x7c\x59\xf5\x2b\x28\xf9\xe7\xee\xd4\x9b\xb9\xd0\x2a"
+      "\x57\x8e\xa9\x85\x54\xf2\x58\xe4\x0d\x40\x38\x67\x9f\x60\x7f\x73", 32,
+      "\xd5\x81\xeb\x9e\x8e\xcb\xa3\xdd\x7c\x3f\xf9\x9c\x5a\xc8\xad\x47", 16,
+      "", 0,
+      "\x78\xb9\xf1\x21\x14\x5b\x7c\xbf\x0b\x0b\xe5\x82\x89\x08\xd0\x19"
+      "\xbf\xb3\x88\xe3\xde\x45\x61\xd1\x04\xdb\x79\xa6\x0a\x69\xe9\x0d", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xb1\xc0\x4e\xd4\xbe\xa8\x11\x1f\xff\x4d\xaf\xc2\xe1\x00\x1b\x4a"
+      "\x13\x93\x6d\xb8\x44\xbd\x13\x0d\x1d\x68\x03\xed\x61\xa5\xc0\x06"
+      "\xb7\xc9\x03\x1f\xcb\xb9\x92\xdb\x33\xbf\xd2\x06\x27\x85\xfb\xdd"
+      "\x86\x27\x5d\xb7\xaf\x90\x9e\x82\x4c\xb7\x3e\x76\x86\xd9\xe4\x61"
+      "\x54\xca\x47\xec\x06\x80\x89\x80\xf7\x90\x19\xe5\x24\x32\xbc\x47"
+      "\x18\xae\xa3\x1a\xd2\x26\xfb\xd9\x2d\x98\x10\xd5\xd9\x3c\xad\xa3"
+      "\xd6\x6f\x74\x60\x3e\x2c\xd9\xba\xc9\xc3\xa4\x7a\x46\x2a\xb9\x3e"
+      "\xcd\x8b\xbb\x97\x14\x33\x62\xec\x4b\x6f\xcf\x82\xa3\x36\xde\x6b"
+      "\x48\x33\xf0\x86\xf5\xf3\x88\x1d\xed\xbf\x7f\x23\x6d\xa8\x0d\xdd"
+      "\x7b\x60\x59\x1a\x50\x04\x53\x65\xc5\x21\x13\x5d\xfc\xbf\x3c\xed"
+      "\xf7\x57\xf7\xf6\xe0\x5a\x81\xa6\x3b\x99\xe0\xf7\x01\xbc\x61\x95"
+      "\x70\x73\x93\xf5\x65\x67\x0e\x75\x7e\xa4\xd3\x82\x8e\x04\xe8\x8a", 192,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA384,
+      "\x89\x82\x96\x37\x1e\x2f\x26\x1a\x90\xab\xcc\xb1\xab\x94\x55\x23"
+      "\xf3\x97\xb4\x9b\xde\x2a\xff\x86\x0e\x9f\x25\xd4\x72\x75\xfd\x33", 32,
+      "\xbb\x31\x9b\xea\x35\xd5\xbc\xe0\xca\x41\xa1\x84\x36\xd2\xda\x51", 16,
+      "", 0,
+      "\x30\x52\x58\xa4\xbe\xb5\x81\xdf\x1f\x4e\x6e\xa6\x94\x2a\x21\x06"
+      "\xf2\xa9\x20\xce\x84\x6a\x70\x34\x03\xc0\xdf\xd4\x07\xed\x25\xf6", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x0a\x11\xac\x44\x78\x38\xcd\x47\x1c\xf5\xdf\xd7\x57\xde\x96\x54"
+      "\xf9\xdd\x02\x6c\x2d\x00\x4a\xa9\xba\x24\x96\xad\x31\xd8\xd4\xe0"
+      "\x68\xe9\xfe\x6d\x55\x8c\x4a\x59\x5c\x76\x83\x39\x7d\xfb\x4a\xdd"
+      "\x7b\x5b\xdd\x1e\x2c\xbf\xf2\x22\x8c\xb6\x43\x45\xe9\xb2\xde\xa5"
+      "\x9a\xa5\x87\x5c\x39\x3d\x5f\x81\x5e\x42\x84\x93\x57\x36\x05\xab"
+      "\x1b\xbc\xfd\x68\xd9\x41\xc6\x19\xf3\x22\xbc\x5e\x9e\xd1\x85\x8f"
+      "\x0f\x1f\xbc\x49\x91\xb0\x6e\x50\xdf\xa2\x77\x28\xac\xb0\x2f\x60"
+      "\xa3\x44\xba\x6b\x4b\xf8\x51\x76\xe4\x9b\x1f\xcb\x3e\x82\x0e\x2a"
+      "\xa7\x0e\x18\x57\x3a\xf7\xaa\x57\xc9\xe7\xed\x89\x35\x45\xa0\x38"
+      "\x62\x66\x27\xea\x62\xa5\xd4\x4d\xaf\xdf\x92\x7f\x09\x87\xc5\x28"
+      "\xaf\x41\xa0\x2b\x12\xa4\x5d\xcd\x32\x4f\xee\x77\xd4\x10\xeb\x20"
+      "\xbd\xa0\x4e\x93\x08\xf2\x06\xf0\xca\xf2\x49\x97\x06\x85\xeb\x26", 192,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA384,
+      "\x97\xf4\xc7\x4b\x6c\xaf\xd5\xf1\xcd\xc4\xa7\x01\x0a\xa4\xb7\xcb"
+      "\xb5\x92\xbf\xaa\x3e\xb8\x19\x71\x25\xed\x07\x6c\xfd\x2e\x62\x77", 32,
+      "\x12\x9e\xb3\xb1\x7e\x0b\xa6\xed\xdd\x31\xae\x9b\xd1\xd0\x02\xb4", 16,
+      "", 0,
+      "\x96\xa4\xd7\x4a\x37\x4d\x42\x58\x9d\xaf\xf3\x78\x92\xff\x2c\x66"
+      "\xc0\xae\xfc\x36\x56\x82\xea\xd0\x35\x11\x72\xaa\xb5\x26\xd0\x49", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xe6\xe0\x6c\x3f\x50\x98\x79\xcb\xaa\x53\x74\x59\x68\x35\x30\x6d"
+      "\xa9\x8a\x17\x85\xcc\x50\x26\x6d\x27\x19\x04\x2e\x0f\xac\xd9\x53"
+      "\xd2\x21\xd0\xe5\xd0\x8f\xd4\xbc\x6b\x8c\xc8\x43\x3a\xb1\xcf\x46"
+      "\xb1\x0a\x5a\xca\x07\xae\x44\xea\xab\x70\x28\x56\xac\x4c\x61\x8f"
+      "\x5c\xec\x58\x26\xcb\x88\xc2\x44\xdb\xd7\xe7\xfb\x3d\x86\x45\x1e"
+      "\xdc\x69\x14\x17\xca\x04\x4c\xcf\xc9\x20\x09\x77\xc0\xa7\xe0\x87"
+      "\xcc\x03\x86\x3a\xf8\x75\x52\xb2\x0c\x39\xca\x4b\x22\x9d\x6d\x50"
+      "\x78\x20\x25\xfb\xcc\x6f\x49\x18\x09\xdf\xcf\x07\x3a\x83\xd4\x49"
+      "\xf4\xe2\x0e\xed\x94\x03\x67\xd8\x00\x38\x5b\xff\xc8\x6a\x01\x0a"
+      "\x27\x79\xe2\x29\x52\xf0\x8d\x42\x55\x5e\xcd\x12\xa0\xba\xf3\x07"
+      "\xb0\xcb\x69\xa5\xf4\x3a\x81\x86\xb5\x01\x7b\x0e\x9c\xc5\x50\xa1"
+      "\xf3\x82\xff\xaa\xde\x81\x59\x34\x9e\x33\x22\x6c\x5d\x65\x2b\x6f", 192,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA384,
+      "\x8b\x4d\xbe\x86\x2d\x16\x66\x1d\xa5\x67\xb3\x5a\x89\x6e\x0e\xd0"
+      "\xf1\x94\x8c\x63\x83\x80\x69\xbe\x3c\x96\x59\x4d\x53\xce\x65\x94", 32,
+      "\x5f\x84\x85\x71\x91\x13\x3a\x0e\x36\xdb\xd2\xcc\xc1\xfc\x7d\x55", 16,
+      "", 0,
+      "\x92\x7e\xcd\xda\x8e\x1f\x03\xa5\x2c\xe3\xa4\x2b\x43\x23\x26\xd5"
+      "\x86\x4d\xd3\xd7\x2a\x54\x51\x3d\x34\x23\xf5\xf5\x2e\xf7\xb1\x60", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x02\x53\x4b\xaf\xcb\xe8\x78\x42\x14\xb2\x67\xd2\x62\xa7\x52\x3d"
+      "\x5c\x41\xba\x6a\xe7\x9e\xff\x02\x98\x72\xdb\x46\x4a\x81\x2c\x2d"
+      "\xde\xab\xca\x40\x4b\x43\x5c\x9c\x8e\x63\xe2\x5b\x61\x15\x7c\xc5"
+      "\x92\x41\x0f\x20\x78\x51\x54\x94\xcd\x28\xe3\xe9\xe5\x91\x2f\x2f"
+      "\x14\x6e\xe8\xf3\x02\x0a\x59\x52\xa2\x2d\xe1\x5e\x60\x8d\x62\x36"
+      "\x9f\x80\x5d\x11\xa6\x50\x80\xfe\x08\x6f\xa1\x62\x65\x4f\xd2\xe6"
+      "\xef\x7f\x5b\x1b\x94\x63\x29\x3e\xe8\xcb\x2e\x55\xc9\x41\x99\x26"
+      "\xe3\x8c\x4d\x4e\x8e\xd2\xad\x59\x7e\xa0\xc3\x4d\x57\xd9\xa6\xac"
+      "\xae\x17\xed\xcc\x2c\x76\xc5\x5f\xfd\x3f\x3b\x0d\x1a\x82\xb8\xa0"
+      "\x87\xa5\xf7\x21\x7e\xa8\x2d\xe4\xc2\xa4\x0a\x5d\xbf\xdc\x76\x4e"
+      "\x42\x03\xe5\xfe\x19\x7e\x81\x32\xbe\x37\x0a\x5d\xc8\xa5\x28\x15"
+      "\xcc\xb6\x9f\x3e\x07\xcd\x7a\xbc\x72\x29\x9d\xf3\xdd\x7a\xd8\x92", 192,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA384,
+      "\x15\xcb\x7c\x1f\x79\x80\x01\xde\x27\x98\x35\x99\x9e\x3b\x8a\x22"
+      "\x0f\xaf\x7c\xc2\xfb\xe6\x18\x37\xc0\xf1\x35\x39\x83\x1f\x81\x31", 32,
+      "\x66\x00\x24\x43\x5b\x00\x7d\x4c\xa4\xde\xed\xdf\xc4\xbe\x2d\x9c", 16,
+      "", 0,
+      "\x2b\x2f\x42\xec\x77\x2a\x35\xc6\x0b\xbc\x15\x56\x0c\x3e\xfc\xc0"
+      "\xb9\xb2\x2f\xd3\x10\xe6\x6f\xf1\xa4\xa8\xfa\x37\x77\xa1\x64\x2a", 32,
+      "\x64\xb9\xe7\x5b\x35\xf4\x1a\xb3\x2f\xc2\x1a\xc1\x7a\x6d\xc8\x5a"
+      "\x10\x34\x23\xf5\x7a\xcc\xb3\xba\xd6\x72\x84\x67\x25\xae\x2e\xcc", 32,
+      "\x0e\x12\xb6\xd4\x1e\x7c\xca\xeb\x31\x00\xe4\x84\x5a\xc0\xd3\x67"
+      "\x1e\x30\x3e\x95\x3d\xab\x65\x0d\xae\x36\xfa\xa8\x88\x5f\x50\x03", 32,
+      "\xe2\x71\xa0\x21\x79\x25\x07\x1c\xb7\x71\xe6\x8a\xe5\xbd\x39\x7c"
+      "\x4a\xf1\x66\x88\x48\xbb\xa1\x2e\xa1\x97\xdd\xa4\x19\xd4\xfb\x93", 32,
+      "\x39\xc7\x2c\x5e\x4c\x48\x82\x4b\xfd\xcc\x7f\x49\x2c\xf9\x19\x4a"
+      "\x24\xad\xef\x88\xed\x96\x71\xb5\xef\xb8\x96\x0d\x70\x8f\x98\xca"
+      "\x6a\x0b\xf4\x88\x58\x02\x3a\xa6\x3d\xc7\x11\x4e\xd5\x3c\xa6\xe7"
+      "\xd4\x3b\x62\xbb\xf9\x76\xeb\x20\x97\x43\x61\x25\x01\xbb\x21\x39"
+      "\x27\xe0\x59\x6c\x07\x86\xdb\x7c\xc4\xe4\x47\xe5\x84\x69\xef\x6e"
+      "\x7f\x6f\x69\x07\x25\x85\x83\x92\x01\xc1\xb4\xb9\x5b\x1a\x5c\x38"
+      "\x5a\x91\x08\x82\xeb\x94\x54\x55\x5e\x6c\x63\xd5\x00\x1c\x2e\x4e"
+      "\x40\x63\xcd\xd7\xb1\x83\x10\xea\x1f\x44\x57\xab\xc0\x4c\xe3\x69"
+      "\x95\x67\x71\x02\x85\x78\xd9\x9d\x13\x12\x4f\xb3\x00\xa3\xfd\xcd"
+      "\x49\xae\x67\xa7\x72\x20\x00\xbe\x3e\x67\xd0\x3f\xb9\x49\x5e\xd9"
+      "\xfb\xcb\x27\x43\x74\xcd\x0d\x71\xbb\xbd\xaf\x14\x64\x0f\x20\xb0"
+      "\x06\x38\x7e\xc9\x52\x8d\xf9\xc3\x82\x53\x70\x39\x79\x1e\x2c\xc8", 192,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA384,
+      "\x44\xbc\x33\x2c\x24\xfb\x8b\x35\xf1\x5a\xcf\x1b\xe9\xcc\x67\x9b"
+      "\xf8\xaf\xf6\x9f\x6f\x84\x43\x85\x6c\x97\x6f\x9a\xc6\x1e\x27\x98", 32,
+      "\xdb\x12\xcd\x24\x50\x8f\x81\x91\x33\x2b\x6c\x58\x76\x02\x3a\x25", 16,
+      "", 0,
+      "\x1c\xd8\x90\x54\x92\x50\x65\x86\x94\x8f\xfb\x73\x1c\xf7\xef\x94"
+      "\xf9\x8d\x41\x11\xf3\x21\x47\x68\x9e\xdb\x6c\xfc\xab\x78\x10\x8a", 32,
+      "\x6d\x45\xad\xc2\xa5\x9b\x5b\xd6\x66\x1d\xe3\x95\x8c\x19\xda\x08"
+      "\x1a\xf1\x4f\x00\xe0\xbf\x2f\x16\x3c\x51\xbe\x48\x55\x17\x5b\x43", 32,
+      "\x30\x16\xe7\x99\xc3\xdf\x4c\x71\x51\xd6\x14\x6c\xc4\xdc\xb8\x93"
+      "\xb9\x0a\xe7\xb1\x7e\xb9\x70\xb3\x18\x70\x1f\x10\xd1\x94\xfb\x83", 32,
+      "\xae\x9d\x98\xe9\x0a\x5d\x05\x6c\x34\x24\x39\x6d\x46\x18\x16\xa2"
+      "\x35\x0a\x7b\x82\x89\x4d\x9f\xde\x60\x47\xa6\xcb\xd2\xa5\x79\x61", 32,
+      "\xd7\x79\x79\xfd\x41\x01\xf7\x6e\x93\xc0\x94\xf7\xef\x42\xab\xd6"
+      "\x8f\x7c\xf1\xe7\x6b\xfb\x4f\x6c\xad\x23\x3a\xa7\x69\x04\x97\xa9"
+      "\x51\x1c\x0e\x3f\xfb\x06\x40\xc0\x18\xd7\xd8\x6f\x43\x24\x1c\x6a"
+      "\x5c\x99\xbf\xb8\x89\x81\xda\xeb\xd9\x5a\xf1\xa4\xf2\x45\x0c\xf0"
+      "\x8d\xe1\x6f\xee\x24\xd5\x16\x40\xd8\x18\x40\xc9\x13\xb6\x61\x7b"
+      "\x7d\xda\xa4\xdf\x16\xfd\x9a\xda\xf4\x40\xe0\x1a\xce\x17\x77\x8d"
+      "\x6c\xc9\x99\x87\x53\x4c\x6c\x54\x54\x5f\xd6\x61\xbd\x37\xaa\x36"
+      "\x06\x29\xa4\x9c\x6f\xa1\xd3\xb7\x88\xd5\xef\x8c\xa4\x6e\xad\x46"
+      "\x66\x88\x28\x8c\x49\x1c\x5b\x21\x98\xbd\x73\x74\x45\x23\x86\xda"
+      "\x76\x12\x3f\x97\x2d\x26\xa4\xac\xa9\xe2\x06\xab\xa6\xf1\x7b\x1e"
+      "\x7b\x12\x86\x4e\x6f\x66\x02\x02\x95\xb8\xf7\x9d\x56\xb3\x51\x33"
+      "\x17\xad\xca\x2d\xf9\xd6\x3d\xe1\xdb\xf1\x14\xf2\xa7\xb8\xad\x30", 192,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA384,
+      "\x24\x12\xb6\xd4\x69\x6b\xba\x2d\x65\x90\x63\xc6\xfb\x67\x25\x4a"
+      "\xe4\xc9\xa6\xc6\x64\x22\x5e\xdb\x49\x8a\xce\xe3\x70\x5d\xf2\x5f", 32,
+      "\xf7\x03\xdf\xc1\xbb\xc7\xba\xed\x70\xdd\xb9\x45\xf0\x73\xb0\x22", 16,
+      "", 0,
+      "\x41\xbf\x6b\xa2\x5c\xcd\x2a\xad\x52\xbb\x87\x62\x08\x45\x97\xb7"
+      "\xac\x57\xe7\xcb\x28\x18\xf6\xfd\x53\xdc\x78\x62\x52\xfe\xe5\x92", 32,
+      "\x90\xe9\x42\x67\x96\x51\x08\x5d\x76\x2e\xce\xfe\x92\x1a\x70\x6c"
+      "\x7b\x3a\x1d\xa7\x78\x6e\x09\xa8\x72\x9f\xb6\x0d\x03\xee\xf9\x9a", 32,
+      "\xc9\x5f\xf7\x9c\x45\x7a\xc4\xed\x62\x3d\xee\xb3\x17\x75\x79\x40"
+      "\x96\xad\x43\x92\xa2\x9a\xb8\xa4\xb9\x1a\xf1\x7f\xf5\x84\xa0\x57", 32,
+      "\x0b\xbe\x5c\x3c\x58\x96\xcb\x2a\x40\x84\x47\x93\x65\xea\xe4\xb2"
+      "\x55\xf6\xef\x8e\x3e\x81\x80\x08\x94\x19\xe7\x2a\x6d\xde\xf4\x2d", 32,
+      "\x8b\x8d\x58\x72\x8f\x52\x0b\x2a\x3c\x3f\xa1\x7d\xaf\x8f\xe8\xc4"
+      "\xfb\x4b\x9d\x3e\x45\x8f\x5f\xd9\xdd\xc6\xaa\x8d\xd8\x27\x1a\x26"
+      "\x04\xd5\xa9\x5e\xe1\xbf\x47\xc5\xde\x84\x89\x4e\x99\x2c\xa1\xc4"
+      "\xc2\x97\x1e\xf5\xcc\xf3\x0e\x84\x7a\x9d\xf7\x14\xe5\x12\x7e\xb9"
+      "\x8a\x3c\xd0\x18\x81\x46\x13\x5d\x94\x1e\x44\xc0\xa9\x85\x03\xb2"
+      "\x5c\x22\xf6\x68\x9d\xaa\xd7\x31\x83\x4b\x92\x46\xa0\x04\xeb\xc7"
+      "\xd8\xbe\xa7\x55\x99\x81\xa9\x11\x8f\x0d\x45\x35\x3f\x2f\x58\x7c"
+      "\x47\x14\xf7\xe4\x17\x98\x2a\xc8\x70\xe3\x3f\x7e\x5a\x03\x82\xf5"
+      "\xcc\x7f\x58\xa9\x07\x26\xf8\x58\xca\xc2\x87\x8d\x65\xe3\x73\xed"
+      "\x0d\xc9\x0e\xfd\x0c\x2e\xbd\x65\x2d\x48\x4f\x88\x40\x40\x99\x66"
+      "\x2b\x54\xf5\x68\x75\xd5\xd1\xb0\xf3\x9c\xec\xad\xaf\xc5\x42\x54"
+      "\xec\x46\xeb\xae\x2a\x04\xd7\xab\xda\x71\x2c\x5a\xdd\x9c\xcb\xd1", 192,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA384,
+      "\x0d\x9a\x68\x63\x9b\xc1\x25\xb4\x8e\x58\x20\x2e\x1c\x7e\x23\x20"
+      "\x09\x35\xd1\xaa\x7a\xdd\xa5\xad\xff\x5b\xba\x23\xa9\x9f\xe6\xac", 32,
+      "\xd7\xf0\xef\x23\xb1\x6c\x1f\xfe\x02\x05\xa8\x5c\x17\x2b\xc3\x39", 16,
+      "", 0,
+      "\x16\xf5\x05\x72\x2b\x4b\x50\xba\x04\x8c\xb1\x85\xe7\x94\x17\x67"
+      "\x4a\x3a\xfa\xf3\x24\x11\x1d\x2e\x8d\x4f\x6f\x6a\xee\x07\x43\x37", 32,
+      "\x05\xe5\xbd\xe6\xcc\x6f\xc7\xcc\x74\x6a\xe4\xc2\x20\xd1\xe0\x00"
+      "\x37\x12\x8e\x2e\x4d\xee\x04\x64\xec\x60\xa0\x0b\x4f\xd6\x46\x3a", 32,
+      "\x6e\x69\x1b\x25\x91\x72\x57\x2f\x04\xfc\xca\x3d\x54\xdd\xaa\x18"
+      "\x00\xf1\xd2\x4b\x90\x66\x02\xc9\x18\xb5\x4c\x62\xe1\x39\xbf\xb7", 32,
+      "\x50\x53\x96\x6f\xea\xe8\x8e\xa6\xd4\xf0\xfd\xdf\x56\x6a\x18\x7e"
+      "\x4e\xc6\x7e\xa9\x36\x4b\x71\x75\xc9\xc3\xa7\x62\x66\x6f\xe3\xfc", 32,
+      "\xdf\x63\xb4\x47\xc4\xeb\xe1\xa4\xc0\xee\xdb\x6f\x59\xab\x50\xd9"
+      "\x67\x59\xd8\xb1\x57\x64\x80\xe3\xae\x96\xeb\x7e\x51\xb4\xc8\x0b"
+      "\xb2\x1c\x03\x83\x2a\xf2\x4c\xd2\x41\x9f\x52\x46\x23\x56\xc5\x8f"
+      "\xce\x31\xa2\xcf\x38\x58\x47\xb6\x65\x30\x02\x5b\xb7\xe2\x52\x85"
+      "\xa0\x5f\x28\x65\x51\xf7\x7e\xf7\x9e\xb3\x7c\x04\x8e\xea\xbb\x5e"
+      "\xeb\x79\xdc\xc1\xbd\xb6\x88\x2d\x38\xea\x7c\x08\x10\x1c\xfd\x81"
+      "\x13\xeb\xf2\xd5\x2e\x8e\x66\xcc\xbd\x3e\x64\xb7\x7a\xfe\x93\x02"
+      "\x78\xda\xbc\x66\x02\xf4\x4e\x83\xc5\xdc\x59\xcd\x4f\x9a\xf1\x14"
+      "\x76\x10\x30\xc6\xe2\x9f\x59\x04\x30\x99\x76\xa6\x3f\x6b\x17\x90"
+      "\x98\x3c\x93\xcd\xbb\x13\x3f\x0c\xad\x14\x0f\xb0\x69\xe6\x91\x7b"
+      "\x01\x2d\xbc\xc5\xa5\xd5\x4f\xdb\x29\x34\x4e\x53\x59\xce\x9c\xa0"
+      "\x57\xd5\x69\x6b\x65\xbf\x30\x28\x2e\x30\x7f\xdb\xce\x7c\x4f\xd8", 192,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA384,
+      "\x07\x4b\x24\x15\x7c\xba\xb0\x2d\x8a\x43\xce\x0e\x48\xc9\x7c\xb3"
+      "\x20\xa0\x43\x2c\xc0\xd5\x46\xf0\xab\x12\xe9\x94\x3c\xce\xc4\x68", 32,
+      "\xf2\xc6\xde\xbc\x2b\xe1\x5b\x24\xb6\x53\x98\x64\x5b\x27\x11\xf5", 16,
+      "\xaa\x79\xf5\x3e\x5b\x19\xfd\x33\x3b\x3e\xfb\xcf\xbd\x9c\x9c\xf9"
+      "\xa9\xa4\xad\x80\xc8\x58\xc6\x6b\x86\x32\x3e\x48\x2c\x80\x63\x00", 32,
+      "\x24\x26\x4c\xc1\xca\x52\x12\xee\x3b\x63\x4d\xc9\x9f\x94\xe5\x46"
+      "\x6b\xf6\x93\xda\xba\xbe\xe1\x72\xea\xbb\x1c\xfe\xcb\x78\xbf\x09", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xd2\xa0\x1e\x38\xc4\x2d\xa9\x8b\x62\x04\xed\x24\x9c\xd8\x5c\x9d"
+      "\xac\x55\xc7\x8a\x2e\xc0\x94\xec\x9e\xb1\x40\xd9\x93\x01\x12\x8b"
+      "\xd1\xb6\xf8\x86\x1d\x8c\xb8\xed\xd3\x04\x83\x77\xa3\x19\x1f\x10"
+      "\xe2\x3f\x5c\x88\x38\xe4\x53\xb6\x47\x25\x36\x40\x4b\x9b\x78\x97"
+      "\xb1\x07\xe3\xe2\x70\x43\x58\x1d\x93\xe6\x45\x42\x40\x5b\x64\x8c"
+      "\x93\x7d\xbb\xde\xef\x10\xfe\x3c\xdb\xc8\x38\x8b\x8b\x62\x3c\x40"
+      "\x0d\x87\x8a\x4b\x1a\x75\xe1\x42\xc8\x79\x3c\xc3\xe4\x76\x70\x8a"
+      "\xd4\x29\xbd\x0b\xe9\x7a\x0e\x35\x99\xd7\x4b\xd5\x82\x11\x0c\x69"
+      "\x55\x86\x2a\x9c\x07\x3f\x07\x18\xd2\x8e\xab\x9a\x39\x7a\x65\xb2"
+      "\x6f\x0d\x33\xb0\x4a\x9a\xb8\x72\x4c\xf7\x25\xbe\x51\x18\x7b\x48"
+      "\x61\xfd\xf9\xd9\x22\x24\xbd\x3c\x62\xda\x6b\xe2\xf0\x05\x38\x31"
+      "\x6b\x9a\x8b\xfd\x89\x59\x38\xeb\xc6\x12\xfc\x56\xce\x14\x48\xa3", 192,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA384,
+      "\x63\x22\xc1\x3c\x3b\x3c\x94\xb2\x17\x2b\xe8\x07\xc3\x42\xb9\xcc"
+      "\x6c\x6b\x04\xd6\x76\x37\xe1\xe0\x9d\x55\x98\x83\x0c\xab\x64\x4e", 32,
+      "\x48\x3f\x3c\x15\x05\x44\xb7\x1f\xfb\x3b\x28\xaa\x72\x37\x0d\x38", 16,
+      "\x74\xbc\x4d\x46\x59\xfa\x15\xd5\x91\xa2\x48\xe7\x6e\xc9\xf5\x88"
+      "\x38\x97\xdd\x08\x2c\xa0\xef\xf1\x08\xc5\xd2\x13\x3c\xba\xaa\x4e", 32,
+      "\xab\x72\xbd\xb2\x44\xe5\x4b\xee\x26\xd5\x6e\x2d\x4e\x9a\xa4\x79"
+      "\x66\xdd\x09\x4e\x22\x97\xf5\xa4\xca\x73\x4f\xd7\x07\x53\x3e\x5f", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x82\x71\x98\x67\x7d\xdf\xdc\x8b\x12\x2e\xc8\x34\xf7\x4e\x56\xab"
+      "\x29\xa2\x53\xd7\x92\x76\xa7\x7d\x89\x89\xc6\xd3\x3a\x89\xe1\x5d"
+      "\x1b\xf0\x25\xf3\x95\x1f\xc0\x27\x8f\xf7\x99\x8f\x17\x47\x42\xc9"
+      "\xf7\x68\x91\x9f\xe1\xdb\xda\x77\x12\x0e\x6f\xb3\xff\x58\xc2\x4b"
+      "\xaf\xc8\xf0\xc5\x17\xed\xc7\x1d\x43\xc4\x04\xf3\x40\x37\x07\x6e"
+      "\x9e\x5c\x0a\x26\x6c\xd1\x42\xa8\x4c\x7d\xbc\x24\xda\xdd\xdd\x5b"
+      "\xdc\x51\x9f\x68\xea\x13\xa8\x0c\xdd\xa4\x6f\xd0\x60\xbe\xd8\x0b"
+      "\xb8\x71\xe8\xe5\x93\xc6\x6c\xf9\xeb\xc1\x36\x2a\xe5\xaa\x29\xcc"
+      "\x58\xa5\x6c\x66\x4b\xac\xed\x2d\x4b\xe3\x0c\x9d\x74\x54\xdb\x3d"
+      "\xf1\x05\x18\x7a\xae\x44\xc4\x2f\x83\x4c\x73\x6c\x6f\xba\x59\x22"
+      "\xed\xb7\x85\x7e\xda\x5c\xcf\x38\xf0\x70\x8f\xed\x36\xb2\x9f\x0c"
+      "\x7f\xd6\x9a\x8e\xb7\x42\xbe\x5e\xa3\xfa\x93\x20\x03\x29\x6d\x6e", 192,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA384,
+      "\x8e\x01\x3d\x9f\x4b\x0a\x94\x45\xb9\x67\x22\x0f\x73\x26\x2c\x36"
+      "\xd8\xf5\x4c\xc3\xaa\x07\x7f\x7a\x25\x34\x99\x24\xd2\x94\x6c\x46", 32,
+      "\x2a\x6b\xbd\x37\x69\x19\x8f\xc7\x63\x34\x06\x8b\x13\x9b\xf8\xf6", 16,
+      "\x74\x71\xba\xc4\x07\x94\xbd\x92\xbf\xf4\x4b\xad\xa6\x2e\x32\x9f"
+      "\x4d\x9a\x88\xd4\xab\xfc\x89\xbf\xec\xab\x8d\x9d\xcc\x9f\xd0\xaa", 32,
+      "\x5e\x8a\x7e\x1c\x80\x28\xd1\xbc\x14\x32\xdb\x41\x9d\x1f\xf1\xc4"
+      "\x78\x5f\x25\xae\xee\x42\xd7\xda\x76\x53\xb0\x38\x1f\xdf\xd4\x19", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x2a\xbf\xdd\xb6\xeb\xd2\x83\x81\x77\xbd\x30\x44\x48\x86\x6a\xf9"
+      "\x45\xa1\xb8\x0d\xff\xb9\x46\xff\xd7\xde\xe4\x2a\x01\xbd\xc5\xc3"
+      "\xae\x73\xac\x64\x7d\x27\x52\x8f\x0f\x32\x81\x98\x34\x3f\xc3\xab"
+      "\xbf\x15\x05\x34\x18\x8a\x10\x2f\xf9\x70\x63\xf2\x76\xc1\xf8\x8e"
+      "\x85\x90\xfd\x5e\x5e\xb9\x9e\x57\xf4\x6b\x19\xf1\xe7\x90\xf0\x23"
+      "\x2f\xcb\xf7\xbf\xdc\x3f\xfb\x6e\x94\x43\x7b\x2f\x63\xba\xef\xba"
+      "\x82\x2c\xd4\xf4\xa7\x77\xa7\xf3\xef\x3d\x32\x46\x56\xa8\x0c\xf9"
+      "\xc7\xb8\x86\x4c\xe2\x9e\x93\x4e\x23\xf3\xe9\x59\x2e\x72\x29\x89"
+      "\x81\x0f\xf3\x63\x20\x7a\x39\x7e\x0a\x6d\x6b\xdc\x03\xfe\x83\xf7"
+      "\xd1\x13\x8d\x4a\x96\x9c\x0a\x18\x28\xf2\x6f\x84\xd5\xf8\x29\x18"
+      "\x28\x8d\xb7\x0a\x09\x10\x8e\x21\x74\xbf\x58\x08\x11\x00\x4f\x7a"
+      "\x59\x4c\xc9\x27\xee\xad\x31\xe7\x25\x65\x5b\xf6\x85\xa5\xf2\x20", 192,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA384,
+      "\x9f\x00\xe6\x9d\x2a\xa5\x9c\xec\x7e\x11\x3d\x5c\xf2\xdd\xf8\x2e"
+      "\xe3\x8f\x86\x9b\xfd\x7c\xf0\xc4\x48\x3c\x8b\x86\xff\x88\x10\xec", 32,
+      "\x57\x89\x17\x1b\xa3\xbd\xc2\x79\x55\xf6\xa9\xc1\x74\x7f\x3c\x50", 16,
+      "\x53\xb0\xb9\x01\x28\x4f\xaf\xb9\xf1\x10\x39\xf7\xad\xc0\x27\xc4"
+      "\x27\x40\x46\xed\xd4\x42\xea\xa8\xf8\xaa\xce\x0f\x28\xdd\x87\xf3", 32,
+      "\xa4\xc5\xa5\x84\x92\xc2\xc7\x45\x42\x1e\x00\x1f\x20\x6b\x15\x4c"
+      "\xc4\xdb\x9b\xc6\x4d\xc4\x35\x09\xfe\x29\x24\xc4\x9f\x30\x02\xac", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x79\xab\xe9\xbc\x8c\x73\xfc\x32\x39\xa3\xf5\xb8\x7f\xcc\x2b\xb9"
+      "\x83\x63\x03\x86\x28\x44\x07\x21\xcd\xbf\xcc\x34\xa2\xfa\x7d\xe6"
+      "\x42\xe4\xce\x26\x97\x70\xff\xa4\x60\xc6\x35\x39\xb0\x84\x0d\xec"
+      "\x29\xfa\x56\xcd\xf9\x08\x20\xa6\x88\x4e\xda\x4d\x1b\xff\xbf\x97"
+      "\xc8\xfb\xbd\x78\x4d\x8d\x2a\x84\xc8\xf7\xf0\xe2\x73\x4f\x31\xbb"
+      "\xca\x84\xfd\xab\x1b\x99\xb4\x6a\x44\xe5\x76\x24\x01\xc6\x11\xea"
+      "\x2f\x4c\x0c\x35\x06\xec\xbc\x15\x86\x21\x0e\xac\x47\x6c\xb0\x31"
+      "\x32\x8e\xc6\x33\xff\x28\xd7\x6b\xb7\x87\x95\x4e\x27\x93\x49\x2c"
+      "\xc5\xd3\xc2\xdf\x92\x59\xb8\x12\xfb\x7c\x74\xb3\xae\x0a\x79\x50"
+      "\x03\xba\x7d\x4b\xd7\x6b\xd3\x0a\x1b\xcb\xff\xf4\x16\x07\xd0\x21"
+      "\xc5\x89\x1c\x49\x25\x35\xca\xdc\xb1\xe3\xb5\xad\x2e\x25\xf4\x94"
+      "\xcf\x8f\x09\xb9\xb2\x57\xaa\x24\x50\x65\xde\x1d\xd7\x2c\x3b\x88", 192,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA384,
+      "\x48\x17\xf9\x81\x7d\x8f\xc8\x42\xc2\x30\x03\x5f\x40\x14\xc0\x7a"
+      "\x58\x2e\x22\x86\x38\x98\x40\xb5\x9d\xfa\xfb\xb4\x96\x55\x55\x07", 32,
+      "\x70\x56\x44\x56\x47\x7d\xfd\x6b\xe5\x9e\x32\x20\x60\xf3\x36\x2a", 16,
+      "\x7d\x23\xef\xe9\x2e\x24\x86\x71\x7e\x2b\x1e\xbb\x06\x27\x50\x83"
+      "\x75\xf7\x7f\xbe\xad\x18\x81\x98\xee\x8b\xa7\x19\xfd\x99\xf4\xc5", 32,
+      "\x1a\x4b\x8c\x60\x83\x21\xff\xe2\xeb\x8f\x90\xb1\x02\xd9\x1a\x3d"
+      "\xf1\x24\x48\x65\xb7\x26\x71\xda\xda\x50\xd7\xf5\x20\x8b\xac\x42", 32,
+      "\xfc\x0a\x37\x25\x71\x8b\x3d\xc8\x2e\xdd\xb6\x3c\xad\x61\xec\xf0"
+      "\xa0\x7f\x09\x2b\x79\xe5\x8e\x5e\x31\x49\x53\x61\xe3\xbb\xa6\x93", 32,
+      "\x82\x94\x10\xd6\xa6\xab\x48\xd3\x60\x84\xe4\xc3\xa0\x8e\xef\xb9"
+      "\x20\xbb\x7e\xce\x52\x69\xe4\xe1\xa2\x73\x29\x42\x07\xb5\x96\xd1", 32,
+      "\xdf\x62\xb6\x87\x01\xc0\x31\xf6\xa0\x2e\x96\x2b\x99\xf4\x02\x20"
+      "\x65\x73\x80\x02\x8f\xee\xed\x99\xb2\x5a\xa6\xd1\xc8\xdd\x5b\xe6", 32,
+      "\x37\x1f\x60\x8a\xe5\x9d\xc5\xf2\xba\x25\x01\x66\x91\x3d\x8d\xd5"
+      "\xed\xc6\x69\x45\xc3\xa9\xa7\x39\x3e\x63\x8e\x09\x85\xc5\x7b\x23"
+      "\x55\x4e\x6a\x2b\xd5\x85\x74\x13\xe6\x53\xfd\xd0\x24\x42\x75\x50"
+      "\x7f\xe8\x05\x90\xa9\x71\x50\x7e\x93\xa1\x67\xc9\x98\xb1\x3d\x6c"
+      "\x1c\x4d\x54\x03\xad\x16\x24\xc7\x8e\x18\x7a\xa1\x86\xe0\x32\x50"
+      "\x58\x6c\x5a\xcd\xcf\x1b\x70\x3d\x57\xf9\x93\xa8\x83\x6d\x26\x83"
+      "\xcc\x02\x20\xe9\x02\xf9\x5c\x34\xc4\x37\x77\xe5\x11\xdb\xb9\xaa"
+      "\xaa\x69\xea\x8b\x1c\x42\xdb\xec\xa5\x72\xf8\x8d\xd0\xf8\x4f\xcf"
+      "\x9d\xd6\x74\x23\x5a\xa3\x77\xb5\x17\x54\xd0\x67\xa9\x30\xb8\x8c"
+      "\x6f\x64\x65\x89\xd2\xf3\xc7\x85\xbb\x82\x2d\x25\x09\x69\x09\x8b"
+      "\x0b\xa2\x9b\xdf\xeb\xbf\x4d\x9f\xb8\x08\xd6\xac\x94\x28\x9b\x23"
+      "\xfa\x2c\x8d\x13\x0d\x7d\x6b\x13\xbe\x36\x2e\xec\xaa\x4f\xa0\x24", 192,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA384,
+      "\x8e\x19\xe6\xe5\xd8\x19\x1a\x36\x13\x22\x9b\xde\xff\x4a\x94\x54"
+      "\xf7\x72\xc0\x38\x00\x1f\x36\xd8\xd7\xe9\x62\x76\x21\x9a\x71\x89", 32,
+      "\x91\x88\xaf\xb8\x03\x71\x6c\x95\x31\x78\x8d\x41\x68\x00\x3c\x02", 16,
+      "\x24\xbf\xe1\xad\xca\x7d\xcc\x3d\xf3\x85\x80\x91\x03\x5a\x48\x87"
+      "\xcb\xdf\xdd\x93\xa8\x17\x8d\xbd\xef\x72\xcb\x93\x41\x83\x28\x5f", 32,
+      "\x20\x96\x60\x6f\xb6\x1a\x31\x0e\x97\xb3\xbb\x37\x90\x51\xd3\xff"
+      "\x62\x55\x83\xeb\xf6\x1d\xb6\x66\x0a\x81\x23\x4f\xe6\x6f\x45\x9b", 32,
+      "\xc5\x78\xa7\x00\xce\x37\x06\x7b\xbe\xa4\x4f\xda\x46\x6b\x50\xf8"
+      "\x2d\x5f\xff\xdb\x99\x36\x1d\x24\xbf\x5b\x07\xdd\x69\xa4\x89\x62", 32,
+      "\x26\x1b\xcd\x06\xa4\x0f\xbb\x5e\x4d\x65\x1b\x15\x92\x7e\x2d\xfb"
+      "\x03\x6c\x6b\xec\x7c\xcd\x4b\x80\x11\x04\x99\xdd\xa3\x50\x3e\x70", 32,
+      "\x4a\xed\x1d\x51\x22\xcc\xd8\xcf\x39\xc9\xbf\x7e\x1b\x4f\x7c\xe9"
+      "\x72\x6d\x0b\x4e\x54\x8f\xac\x0e\x53\x96\x64\xf7\x2f\x34\x2c\x8d", 32,
+      "\x19\x49\x87\x1a\x05\xf9\x35\xf4\xb3\xe3\xa9\xb1\x6f\xbf\x59\x6b"
+      "\x30\xa2\x20\xec\xa2\x10\xd7\x00\x21\x79\x6a\x27\xc4\x63\x57\xd3"
+      "\x98\x18\x03\xef\x36\xb5\x8b\xe4\xf6\x0a\x95\x4d\xb6\x26\xe3\xbf"
+      "\xdf\xc7\x00\xaa\xc4\xeb\x47\xb4\x72\xc9\x9f\x57\xac\x77\x1d\x6e"
+      "\xcc\x03\xe7\x66\xc3\x28\xb4\x7c\xf6\xa6\x7d\x72\xb7\x1a\xf7\xe9"
+      "\xbc\xe8\x32\xea\x8b\x0d\x10\x1d\x31\x2c\xf9\x42\xea\xb0\x89\x35"
+      "\x37\x55\x71\x65\xb9\x97\x61\xca\x24\x44\x2f\x31\x4b\x36\x06\xf9"
+      "\xa0\x9d\xbd\x39\x7c\x0c\x27\xc9\x85\x95\xfd\x80\xac\x7d\xc1\xf1"
+      "\x88\x1c\x16\x3e\x38\x7d\xe1\xb4\x0c\xb5\x88\xbf\xb8\xb9\xf7\x9a"
+      "\x68\x9a\x14\xce\xb9\x42\xbc\x1f\x7a\x4a\x0d\x85\xe9\x80\xcd\x68"
+      "\x2a\xd5\x94\x09\x40\x51\x9d\xf9\x21\x42\x14\x7c\xda\xe1\xc6\x36"
+      "\xf2\x54\x20\xb6\x96\xc1\x82\x0e\x9c\x52\x5c\x28\xb5\xa4\x96\x5a", 192,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA384,
+      "\xcf\xb6\xd4\xde\xd6\x19\xd2\x52\x47\x2f\x0f\xcf\x35\x76\x84\xcf"
+      "\x11\x8f\x3e\xdd\xe6\x10\xcd\xa0\x7a\x43\x29\xdb\x77\x32\x9e\x8f", 32,
+      "\x96\x3b\x6e\x88\x39\xb0\x4b\x6b\xf1\xef\x50\xcd\xc8\x6c\xce\xdb", 16,
+      "\x52\x6d\x71\x98\x0f\x73\x94\xf7\x9c\xf6\x9b\x1b\xaa\x08\xe1\xcf"
+      "\x93\x8a\x0c\xff\x60\x25\xe3\x9a\xd1\x68\x7d\xda\x43\x92\x59\xe0", 32,
+      "\x82\x54\xc3\x4e\x8b\x59\x95\x7c\x37\x92\xc3\x1e\x97\x87\xfc\x64"
+      "\x19\xc1\x40\x13\x9c\xe1\xbe\x3f\xa8\x78\x5c\x65\xc5\x66\x98\x91", 32,
+      "\xe5\xc1\x5d\x12\xf5\xe4\x45\xe9\x38\xff\x48\x75\x1f\x0c\x34\x63"
+      "\xcb\x41\x5e\x01\x6b\x79\xd7\x28\x0b\x4b\x54\x31\xa7\x62\xa4\x07", 32,
+      "\x88\x18\x8a\xc5\x7b\xa8\xb8\xdf\xd6\x6c\x4a\x73\x1a\x2f\x50\x61"
+      "\x1a\xa2\xae\x4a\x94\x97\xcf\x41\x72\xc4\x01\x23\x65\xa2\xaf\xa3", 32,
+      "\xa3\xfc\x6a\x56\xbf\xf5\xf2\xef\x2b\xff\x34\xdf\x1c\x72\x72\xdf"
+      "\x50\xd8\x0f\x53\x0a\x72\x9d\xed\x03\x55\x40\xc6\x2c\x0d\xec\xe3", 32,
+      "\x1d\xd3\x25\xc6\x0e\xc7\xa6\xa1\x62\xb5\xaf\x50\xf4\xc4\x74\xea"
+      "\x20\xb9\x2a\xb6\xdb\x00\x6c\x9b\x58\x2e\xec\xf6\xfe\x37\x98\x61"
+      "\x77\xa1\xd1\x13\xf2\xb7\x60\x81\xcb\xbd\x56\xdf\x69\xe5\xdb\x8b"
+      "\x87\xb5\xc6\x74\xd4\xd0\xea\xce\x99\x03\x04\x89\xc3\x95\x28\x79"
+      "\x08\x6d\x70\x8a\x5d\xfd\xea\x29\x45\x0e\x94\x00\x91\xe3\x3b\xc0"
+      "\xd7\x3b\xca\x43\x44\x52\x86\x6e\x96\x41\x6a\x79\x85\xed\x37\xd1"
+      "\x76\x7d\x08\xb6\xa4\xef\x6d\x69\x71\x3d\x21\x11\x75\x55\xd7\x89"
+      "\xbc\xd4\xa2\xa8\x15\x56\x7c\x1f\xd2\x0b\xf4\xec\x88\xcd\xf7\x48"
+      "\xf9\x7f\xf1\x2b\xfe\x72\xe2\xbb\xb1\xf1\x24\xeb\x41\xf5\xc2\xb4"
+      "\x79\xfb\x32\x33\xbd\x4f\xfb\x64\xe0\xe3\x3f\x63\xfe\xe2\x3c\xd9"
+      "\xa7\x5a\x3f\xd2\x4b\x3e\xc3\xa8\x36\x17\xf7\xd5\xd3\xb5\xbc\x31"
+      "\xa4\x88\xc3\xb9\xd0\xf0\x28\xff\x71\xec\x57\x9e\x37\x5f\x86\xe4", 192,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA384,
+      "\x5f\x45\x6f\x02\x2d\xcc\xd4\x44\xef\xc9\xae\x4b\xf4\x35\x09\xd2"
+      "\xa8\x6c\xbd\x52\x0f\x4a\xe5\xef\x45\x72\xbd\x81\x35\xe5\x3c\x43", 32,
+      "\xbc\x96\x73\x1e\x22\xbe\x37\xa4\x6b\x66\x71\xca\xdd\x7e\x4d\x9a", 16,
+      "\x8c\x79\x6f\x74\x6a\xe4\x75\x7c\xe6\x64\x71\x36\x02\x7a\xd3\x3c"
+      "\x92\x96\xa3\xe2\xb5\xd3\xa0\x0c\xe0\xb4\x3c\xd4\xe3\x6c\x32\x58", 32,
+      "\xf8\xca\x90\xdb\xd4\x5e\x9f\xcc\xae\x8e\x65\x6b\x8c\xf9\x01\x1a"
+      "\xf3\x30\xdf\x05\xd7\xfb\xfa\x4a\x55\xd4\x0a\x60\x31\xa5\x01\x9c", 32,
+      "\x7a\x0f\x1c\x45\xad\x86\xb4\x57\x52\xc5\x48\x08\xd1\x77\x6b\xab"
+      "\x5f\xc6\xb7\x19\x71\xbd\x06\xfd\xed\x1d\x8c\x4f\x61\x4c\x90\xb6", 32,
+      "\x6b\xa2\x10\xc9\xcd\x75\x83\x56\xeb\x88\x01\x11\xc4\xd1\x8e\xc7"
+      "\xf9\x51\xea\x66\x4b\x02\xbe\xa9\x2b\x11\xa0\x68\x71\x46\x25\xa7", 32,
+      "\x2d\xa8\x17\x11\x78\xb9\x9f\x8a\xcf\xfe\xb2\x6a\x70\xd9\xa2\xaf"
+      "\xbf\xcd\x6a\xfd\x87\x52\x8a\xe8\xbf\x76\xa4\x9d\x98\x41\xe8\xd5", 32,
+      "\xf4\xe1\xc4\x51\xde\xe2\x92\xd5\xc6\x4f\xe0\x97\x49\xce\x6c\x2d"
+      "\x20\xbe\x3c\xb6\x10\x0b\xc8\xfe\xca\x7b\xd9\xd3\x51\x24\x09\x7a"
+      "\x87\x91\x0d\xc1\xcb\xbe\x42\x8c\x9f\xab\x3a\x9c\xd2\x40\x3d\xe9"
+      "\xa1\xfe\x38\x1b\xac\xe3\x98\xb2\x80\x9e\xe8\xa2\xee\xe2\x12\xc5"
+      "\x83\xd1\xe3\x54\x9b\x43\xa2\xd2\xd1\xcb\x57\xb8\x7e\x91\x0a\x1c"
+      "\x82\xb1\x05\xc6\xde\x1a\x38\x91\xc4\x73\x5a\xfe\xe4\x79\xbf\xd5"
+      "\x95\x5e\x53\x6e\x44\x28\xbe\xe2\x5b\xd9\x6a\x3d\x69\x47\x5b\x19"
+      "\x5b\xdc\xd5\xf5\xc8\x45\x66\xd1\xeb\xd6\x2c\x39\x74\x06\x7b\x52"
+      "\x0e\xf5\x0d\x13\xdd\x45\xa2\xd8\x17\x5f\x22\xec\xa1\x76\x5f\xc1"
+      "\xec\x79\x06\x8c\xc7\xa5\x7a\x11\xdc\xac\xd7\x73\xf4\x51\xf4\xd0"
+      "\x29\x71\xbf\x9e\x8d\x0d\x65\x3a\x4c\x3f\x98\x72\x2e\x04\x78\xaf"
+      "\x3a\x05\xcb\xd6\xfa\x89\x74\x83\xc4\xfa\x4b\x0c\xbf\x25\xbc\xc7", 192,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512,
+      "\x47\x36\x24\x19\xe5\xfe\xca\xc2\xac\x8f\x67\xe1\xaf\x57\x18\xab"
+      "\x96\x12\x94\xb1\x67\xe2\xa1\x93\x86\xa3\xf6\x39\xcd\xe7\x4a\xac", 32,
+      "\x6a\x2d\xbd\x8c\xd2\xf5\xc4\x0f\x35\xab\x71\xdc\xc3\xc2\xba\xfe", 16,
+      "", 0,
+      "\x30\x44\x15\x76\xec\x62\xef\xaa\xf9\x7c\x04\xb2\xce\x63\xba\xf9"
+      "\x16\x3d\xe4\xaf\xc7\x07\x32\x2e\x2c\xe7\x3c\xb4\x0a\xa5\x62\x5c", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x80\xa5\x24\x9a\xe2\x1c\x2a\xd1\x8c\x75\x97\x1b\xf2\x7b\xd9\x42"
+      "\xce\x8f\x57\xad\xb3\x61\x39\x36\xd0\xde\x34\xef\xfc\x98\x5c\x89"
+      "\x04\x64\x8e\x40\xd4\xef\x18\xb8\x91\xd8\x04\xc3\xe3\xc0\x7f\x5b"
+      "\x96\xb7\xca\x57\x74\x6c\x54\x44\x2e\x0a\x39\x60\x85\x53\xcf\x1d"
+      "\x86\x19\x53\xea\xfb\x55\xd2\x0e\x6c\x9b\x24\x5f\x3c\x8a\x89\xd6"
+      "\xf1\x05\x1c\xb9\xdb\x7c\x96\x5b\xea\x07\x8a\x95\x4b\xb8\x03\x00"
+      "\x31\xb9\x6e\xa9\x1c\x7b\x0b\xae\x01\x12\x60\x2c\x16\xbb\x00\x64"
+      "\x2f\xa6\x9b\x61\xa5\x62\xc2\xbe\xcd\x7c\x91\xa2\x94\xb5\x62\x69"
+      "\x6e\xe8\xa5\xea\x6a\x19\xc7\x47\xc5\xcc\xcb\xeb\x77\x90\xdf\x36"
+      "\xab\xf8\xbb\xe2\x41\x82\x0a\x26\xef\x16\x25\x36\xaf\xf4\x45\xa5"
+      "\x5b\xa2\x75\x3f\xbb\xd2\x2c\x52\xe3\x41\x53\xda\x08\x64\xaf\xe5"
+      "\x6e\x9d\x73\x87\xda\x4a\x16\x81\xf0\x44\xfd\xd2\x85\x31\x7a\xeb"
+      "\x8a\x92\x07\x3b\x79\x6a\x75\xd1\xb2\xf2\x55\xad\xb3\x08\xcc\xbe"
+      "\x8f\x1f\x1f\xdb\x18\x98\x05\x90\x38\xe8\x8d\xc1\x13\x8e\x43\x7a"
+      "\x8c\xa7\x7d\x5c\x22\xc9\x23\x31\x80\x34\x49\x16\x61\xe2\x5e\x6b"
+      "\x5a\xf2\xfb\x0a\x5c\x38\x72\x72\x1d\xec\xec\xf5\xcb\xac\x06\x7e", 256,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512,
+      "\x43\x20\xdb\x27\x33\x3b\xa6\x81\x25\x0b\x4b\xd6\xe8\xfe\x59\x03"
+      "\xca\x77\xb2\x20\x7f\xe6\x29\x4f\xf6\x60\xc7\x91\xf2\xb4\xa8\xd0", 32,
+      "\x7a\x87\x8e\x45\x48\xad\x3f\x02\xb0\xf3\x88\x67\x58\xec\x81\xeb", 16,
+      "", 0,
+      "\x3b\xe6\xa6\xc4\x8e\x73\x2f\xe0\x62\x57\x1d\xa1\xb3\xbc\x3f\x47"
+      "\x30\xcc\x27\xa0\xd9\x55\xfa\x3b\x3b\x04\xac\xa5\x2d\xea\xc0\x74", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x8a\xc4\x31\x85\x2c\x11\xe5\x97\x11\xcb\x64\x6e\xa7\x22\xb4\x03"
+      "\x26\x7a\x46\xd8\xa0\xe3\x74\xd4\xe5\x8d\xe0\xd5\x27\xe2\x33\xd7"
+      "\x3a\x77\xef\x64\x5c\xb8\xa1\xb6\x7f\x40\x7f\x66\xa2\xb1\xf2\x7f"
+      "\xce\xdd\xf3\xa7\x44\xe7\xf6\x83\xb3\xe7\xfe\xdc\x47\x76\x79\x03"
+      "\x42\xff\x29\x9f\x2a\x3a\x25\x2c\x7c\x81\xcd\xee\xc9\x4d\x07\x93"
+      "\xe0\xac\x48\xc4\xaa\xdf\xc3\x6a\xc8\xa1\x07\x9d\xf0\x7c\xbb\x1e"
+      "\xa6\x51\x3e\x35\xa2\x58\xa7\x05\xdc\xc6\x9b\xe6\x35\x61\xd1\x0d"
+      "\x96\x3e\x1f\x6e\x1d\x2d\xb7\x6e\x6c\xfc\xdb\x81\x25\x65\x6d\x9c"
+      "\x01\x5a\x95\x05\xdc\xa3\xb7\x73\x31\xb6\xbb\x65\xc9\x6c\xde\xbe"
+      "\x99\x44\x07\xab\xf7\xed\x6c\x59\x38\x83\x82\xfb\xb4\x42\x48\xcc"
+      "\x3a\x0b\xcf\xa0\x2d\x01\x61\x71\x1d\x29\x53\x97\x14\xd1\x38\x12"
+      "\x9c\xd0\xff\x28\x42\x38\xa4\x00\x65\xbc\x9d\x5e\xe7\xe2\x8c\x19"
+      "\xb4\x2d\xef\x71\x57\x3b\x9b\x30\x28\x3b\x8f\x29\x53\x3e\xe5\x9e"
+      "\x7f\xcb\xd9\x6c\xd7\xb9\xed\x1b\x30\x82\xee\xc9\x41\xe3\xf4\xbe"
+      "\xf6\x5e\x36\x29\x18\x48\x64\x88\xd6\xe0\xdf\x44\x54\xdd\x0b\x0a"
+      "\xdf\xb1\x79\x22\xc1\x5a\x13\x66\xbf\xae\x60\xbc\x64\x00\x8d\x7d", 256,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512,
+      "\x43\x67\x4c\x5a\x07\x65\x98\x0a\x12\x4d\x09\x2b\xaf\xa3\x96\x39"
+      "\xff\xf0\x24\xb0\x47\x67\x51\x71\xd4\xc1\x39\x38\x84\x33\x4e\x71", 32,
+      "\x7b\x8b\xa6\xe8\x14\x74\x15\x8d\x1c\x16\x21\x1d\x48\x89\xae\xf3", 16,
+      "", 0,
+      "\x29\x35\x02\x98\xd0\x30\x41\xa7\x7a\xd5\x60\x04\xdf\xa3\xbe\x19"
+      "\x8a\x8a\xec\x76\xb1\x23\xda\x61\x18\x1a\x6a\xc7\x0d\x71\xc3\x6d", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x7e\x48\xea\x1f\x24\xc2\xe3\x0e\xec\x55\x11\xb3\x44\xbb\x26\x1d"
+      "\x69\x4d\x9e\xa8\x0c\xde\x9f\x3d\x56\x1f\xa7\xab\x3d\x79\x8a\x91"
+      "\xce\xc0\x60\xb0\xb2\xa0\x0d\x5e\x54\x0b\x63\x8d\x66\x97\x60\x27"
+      "\x1e\x46\xbc\x5f\xd8\x79\x50\x26\xfd\xae\xf0\x99\xd5\xc3\x69\x3b"
+      "\xd9\x6c\x02\xa1\xad\x7e\xf8\xce\xf4\x3d\xe8\x5c\x7d\xe3\x1d\x26"
+      "\x75\xf4\x41\xf5\xd7\x2c\x86\x0e\xb3\xf6\xf1\xfc\x87\x14\x8c\x14"
+      "\x5b\x6c\x6e\xb4\x6d\x08\x7e\xc8\xd3\xcd\x81\x8e\x89\xa3\x48\xe1"
+      "\xf6\x85\x2c\xc7\xde\xf4\xd1\x17\x4f\x7d\x75\x0a\x0a\xa4\xd0\x41"
+      "\x89\x7b\x1f\xc3\x27\x31\xdb\x45\xeb\xef\xd7\x61\x66\x10\x19\x79"
+      "\x59\x39\x0f\xdb\xa3\xa1\xfc\xdc\x4a\x82\xdb\x0f\xe4\x39\xa0\xb7"
+      "\x72\xf3\x46\xe6\x29\x89\xb1\x25\x08\x5b\x3c\x3d\x0f\x61\xfa\x6e"
+      "\x69\x18\x17\x6c\x35\x1d\x6e\x06\x64\xd1\xaf\xb3\x9f\x2e\x34\x73"
+      "\x0c\x91\x34\xb1\x1c\x1a\x73\x46\x8b\x5c\xfa\x14\x4d\x8c\x14\xd2"
+      "\xbc\x73\xda\x3f\x32\xfa\x24\x10\xd5\x4b\x78\x91\xcb\x66\x8a\xc2"
+      "\xb6\xcc\x48\xc3\xd7\x49\x3a\x17\x37\x83\x9d\x8a\x78\xf3\x5c\xda"
+      "\x5f\x82\x91\xe4\xa4\x40\xa3\x0a\x3a\x32\x23\xe8\x60\x7a\xb6\x02", 256,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512,
+      "\xd1\xaa\x54\xc9\x1d\x40\xc8\x4a\x47\x05\x23\x3e\x0c\x46\xd2\x01"
+      "\x50\x05\xd9\x93\xfe\x9c\x25\xd9\x97\xda\x68\x84\xa0\xcc\xbb\x41", 32,
+      "\x7b\x4b\xd0\xc8\xac\xda\x53\x7c\x8c\xf6\x52\x12\x96\xac\x88\xe8", 16,
+      "", 0,
+      "\xf1\xed\xe6\xf5\x90\x65\x51\x71\x3d\xb9\x4a\x9d\x74\x49\xb0\xc1"
+      "\x46\xbd\x68\x49\xf5\x7f\xbd\x1d\xae\x7d\xf1\xe7\x8a\x30\xd3\x73", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x05\x26\x10\x2b\x7c\x6f\x20\xdc\xc9\xc6\x12\x29\xe7\xac\x3f\x2e"
+      "\xfb\x6e\xce\x0f\x21\x2e\x5f\xc3\x84\xd8\x8d\x6f\x09\x35\x6c\xe8"
+      "\xb6\x0a\x13\x72\xb8\x00\xa0\x70\x92\x47\xa0\xf7\x1f\x5d\x81\xd8"
+      "\x36\xdf\x3c\x9f\x32\x06\x90\x74\x16\xc6\xcc\xd5\x8d\xec\x0d\xb1"
+      "\x9d\xbd\xd8\x28\x8f\x78\xd2\x48\x1a\x3d\xc7\x23\x62\x97\xc7\x91"
+      "\x33\xde\xe4\xc6\x0d\xb5\xc6\x28\x30\x4b\xfa\xdc\x96\xae\xa7\xa7"
+      "\xf5\x2f\x39\x46\xfb\x7b\xa8\x4a\x0f\x26\x76\x63\x36\xb5\xe7\x4d"
+      "\x62\x6d\xf9\xe4\x6d\x4a\x7b\xb5\xa4\x72\x57\xf8\xf9\xbb\xfa\x88"
+      "\xc1\xd0\x52\x5e\x78\x94\x1d\x81\xc6\x14\xce\x19\xf2\x60\x2c\xb5"
+      "\x6d\x73\xb1\xeb\x5c\xef\xef\x55\xa1\x5d\xd1\x3d\x36\x4a\xd7\x6c"
+      "\xe9\xee\x60\xe9\xea\xe6\xeb\x42\x4d\x83\x18\xe6\xdf\x82\x89\x03"
+      "\xdd\xe7\xaa\xfb\x96\xa4\xb4\xd9\xfa\x05\xf5\x0b\x46\xb7\xe6\x75"
+      "\x0a\x80\x1f\x95\xaa\x27\xd2\x2e\x53\x98\xae\xb8\x2b\x7a\x56\x5c"
+      "\x58\x6e\x20\x2b\x00\x18\xf1\xa0\x49\x69\x75\x20\x32\x87\x1e\x58"
+      "\x4e\x59\x7f\x49\xb7\xb7\xe9\xa5\x4d\x6e\x60\xc9\xc1\xc4\x70\x4d"
+      "\x3f\x74\x68\xc7\x24\x84\xc9\xb3\x9f\x71\x78\x0f\x7f\xd9\x74\x83", 256,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512,
+      "\x68\xd2\xdf\xe9\x3b\x17\x16\x57\xcd\xf7\x3f\x7f\x8b\x6a\x8c\xe8"
+      "\x7f\x2b\x83\xb4\x71\x99\x5c\x74\xfe\x59\x66\x8f\x96\x78\x5b\x3d", 32,
+      "\x07\x7e\xa3\x72\xaa\xe9\x56\x9d\x7b\x00\xb0\x3b\x4f\xc1\x93\xd0", 16,
+      "", 0,
+      "\x99\xe5\x82\x3e\x92\x6f\x65\x1b\x72\x80\x6b\x0b\xfd\xd2\xc6\x24"
+      "\x20\x21\xdc\xbc\xe1\xb1\x77\x23\x9f\x22\x38\x2e\x7d\xd6\xd0\x69", 32,
+      "\x0e\xa1\x65\xbc\x61\xf3\x56\x73\xe7\x9b\x9c\xd9\xb7\xf4\x4f\xa1"
+      "\xa8\x84\x87\x17\xce\x88\xca\x47\xc6\x24\xbc\xd7\x08\xc2\xc7\xaa", 32,
+      "\x52\xfd\xad\x87\x21\xa9\x64\xee\x55\x20\x99\xdf\xda\xee\x7a\x57"
+      "\x43\x53\xfe\xb8\xd2\x11\x76\x9c\x5f\x85\x84\x18\x26\xd2\xb7\x26", 32,
+      "\x8f\xd1\x1b\x43\xe8\xd3\x72\x1f\x2b\xcd\x39\xbc\xe2\xa6\x64\x2f"
+      "\x66\x70\x87\x51\x26\x63\x01\x13\xae\xaf\x9d\x67\xff\xfb\xe8\x71", 32,
+      "\x89\xfd\xba\x02\xaf\x5d\x1c\xa1\x1e\xe1\x03\xdb\xb9\x9b\xc5\xf8"
+      "\x4c\xc0\xcc\xc4\x8f\xf8\x64\xb2\x25\x0d\xa7\xaf\x2e\xfe\x20\xd5"
+      "\x8f\x78\x6b\xea\xe7\x20\x76\x2e\x58\x9b\x3a\x31\xc1\xf2\x8e\x03"
+      "\x49\x9f\xe1\x9a\x32\xd3\xd5\xef\x77\xf3\x49\xdc\x58\xdd\x2b\xc1"
+      "\x2c\xb3\x89\x6e\x40\x99\x96\x6f\x8a\xcc\xea\x73\xb3\xb0\x7a\xbe"
+      "\x4e\xdf\x7b\xe7\xb9\x32\xef\x84\x2d\x4b\x05\xc5\xac\xe2\x12\x2a"
+      "\x93\x70\xc3\x6e\x6a\xa4\x48\x56\xf8\xb5\x1b\x2a\x2d\xcd\xcf\xb2"
+      "\x8e\xb3\x79\x4d\xbf\x6d\xa9\x50\x77\x49\x34\x0b\xb7\xdf\xcc\x2c"
+      "\x34\xde\x8c\x5b\x46\x41\x81\xb5\xbd\x68\x07\xfc\x27\x23\x52\xe4"
+      "\xdf\x51\xfe\x3a\x28\xc3\xe8\x78\xfa\xd0\x6e\xcb\x7f\xc0\xc9\xb0"
+      "\x32\xb0\x01\x03\xe2\x05\x1d\xd6\xba\x65\x92\xdb\x21\x93\x11\x50"
+      "\x5c\x3d\x34\x71\xc6\x60\x0b\x63\x89\x17\x12\xf8\x54\x71\x2d\x37"
+      "\xb9\x5e\xf9\x61\xcd\x10\xc6\x05\xb1\x73\xdb\x1d\xdf\xe7\x18\xaa"
+      "\x90\x40\x34\x8c\x1d\x3c\x39\xb5\x85\x8a\x8a\x1e\x2e\x67\x44\x8c"
+      "\x47\xf9\x42\x67\x06\x36\xfe\x90\xc1\x47\xcd\x81\x82\xd1\x7c\x4f"
+      "\xf1\xf2\xf9\xab\xde\x8c\xb5\x63\xf2\x19\xd5\xfe\xb0\x22\x0b\x5a", 256,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512,
+      "\x57\xf1\xd8\x70\xd1\x2f\x1f\x57\x05\x6a\x29\x22\x70\x74\x4d\x05"
+      "\xf1\x26\xfb\x28\x9f\xdb\x43\x99\x77\xe1\xe3\xe1\x59\xa5\x10\xee", 32,
+      "\xdf\x2f\x9e\xa1\x4d\x60\x76\x2e\x46\xe5\xdd\x2b\xae\xc9\x56\x00", 16,
+      "", 0,
+      "\x04\x32\x01\xc4\x7f\x8f\x32\x72\x26\x9a\xca\x5c\xa1\x54\x2b\xff"
+      "\x03\x2c\xe2\xa9\xc4\x29\x55\xe4\x47\x2c\x5b\x57\xab\x36\x37\x03", 32,
+      "\xf3\x78\x90\x34\xdf\x31\x4d\x2b\xd8\x15\x88\xa2\xfb\x57\x82\x0b"
+      "\x26\x12\x42\xec\x42\x7a\xf4\x0f\x70\xf5\x58\x70\x4e\xb2\xe1\xb9", 32,
+      "\xdb\xf9\xe0\x1d\x90\x71\xc9\xee\x6d\x09\x8c\x06\xfd\x86\xe6\xbe"
+      "\x41\xee\x87\x9d\x26\x95\x0f\x06\xb9\x81\xa8\x1c\xe0\xbe\x1d\x8f", 32,
+      "\x56\x7e\x3e\xb8\xe2\xbc\xe2\xb3\x68\xeb\x86\x4b\x88\x28\x30\x2f"
+      "\xe7\x51\x63\x4d\x46\x42\xac\x70\x80\xa5\x6d\xca\xda\x78\x13\xfe", 32,
+      "\xa8\x45\xec\xf4\xfe\x92\x12\xc1\x8c\x2a\x24\xf3\x32\x32\xb9\xe9"
+      "\x24\xda\x1e\xb8\x87\x12\xeb\x0d\x9d\x04\xd5\x19\xaa\x13\x3e\xcf"
+      "\xac\xcc\xdc\x6f\x58\xd1\x4c\x81\x08\x5e\x40\xa5\x4e\x9e\x66\x29"
+      "\xc5\x0c\xa4\xd4\x7d\x77\x5c\x40\x34\x6c\xdf\xd4\x4e\x0e\x20\x7a"
+      "\xf6\x95\x23\xc4\xc0\x88\x14\x62\xa7\xaa\xaa\x64\xa7\xbc\xbe\xf9"
+      "\xaa\x7f\x8b\x5d\x3b\x73\x18\x81\xc9\xfb\x00\xa2\x6d\xf2\xfb\x4f"
+      "\xea\xa1\x18\xbe\xa0\x41\x20\xd7\x04\x25\x38\x0c\xcd\x41\xaf\xc6"
+      "\x62\x62\x5c\xaf\x19\xac\x2c\xd9\x7c\x93\x7f\x3e\x9e\x85\xc1\xc3"
+      "\x75\xaa\x6b\xd5\x39\xa1\x39\xac\x49\x46\x89\xec\xc7\xd4\x9f\xbd"
+      "\x98\x5b\x0d\xcb\x17\x6f\x0d\x89\xa6\xfe\x7f\x1e\x5f\x09\x8f\xc2"
+      "\xff\xb2\x61\x0c\xbf\xd8\x1c\xc7\xfc\x8f\x7a\x39\xef\x83\xf8\xcc"
+      "\x10\xfe\x6b\xba\x3d\x95\x14\x94\x1d\x40\x0c\x73\xca\x52\x9e\x21"
+      "\x99\x4f\xc4\x0e\x43\x9b\xb7\x6f\x1b\xd7\x0b\x04\xc4\x97\x0a\xe1"
+      "\xd6\xae\xda\xb4\x20\x61\x03\x2a\x34\x78\x41\x4f\xc2\x85\xba\x06"
+      "\xa5\x11\xe5\xc9\xd3\x3a\xd1\xd7\x2c\xab\x8d\xef\xe2\xaa\xdc\xbd"
+      "\x6f\xbb\x87\x09\xdd\x2f\xa6\xec\x79\xa0\x0c\x58\xc6\x15\xcd\x0d", 256,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512,
+      "\x92\x77\x40\xd3\x37\xa8\x99\x9f\x64\xed\xb3\x31\x92\x83\xa3\xf1"
+      "\xb7\x75\x12\xa6\xb7\x9e\x81\x12\x36\x73\xa7\x4b\x5a\x99\xd2\xca", 32,
+      "\xc0\x60\x3e\xcd\x28\x8e\xa2\x5d\x76\xdc\xa5\xdf\x55\xf7\x9e\x31", 16,
+      "", 0,
+      "\x5a\x43\x5d\xf4\x60\xc0\x90\x1a\xd1\x59\x20\x11\x5c\xfe\xb7\xfd"
+      "\x6a\xc4\x00\x91\x18\x4c\x90\xb7\x0d\x74\x69\x48\x47\xe6\xa0\x8e", 32,
+      "\x3f\x30\x1e\x6e\x85\x3e\x3b\xd2\x25\x36\xea\xe0\x49\x10\x1f\x14"
+      "\x7f\x87\xbc\x03\x25\x66\x60\xda\xec\x53\x6f\x0a\x97\x49\x9a\x5e", 32,
+      "\xc7\x95\xf6\x52\x35\xb1\x1c\x70\x0b\x76\x86\x9a\x9a\x36\x8a\x2c"
+      "\x77\xbe\x9e\x2d\xaa\x22\xbd\xff\x96\x50\xae\xd8\xd0\xc2\x6a\x0a", 32,
+      "\xf7\xc9\x30\x7b\x20\x0e\x4c\xea\x89\x9b\x49\xc3\x50\x0a\xe2\xa7"
+      "\x56\x4b\xae\xe5\x8c\xb5\x1f\xa9\x78\xdd\xf1\x4b\x9d\x46\xef\xdc", 32,
+      "\x15\xb9\x8e\xbe\xdf\x93\x22\x55\x8e\xa1\x2f\x60\xe6\xfd\x4f\x43"
+      "\xf0\x74\x6a\x30\x82\xd0\x14\x06\x3f\x05\xfa\xd3\xa6\xee\x69\x62"
+      "\x6d\xf2\x83\x54\x2d\x7a\x29\xb3\xe7\xb6\x79\x5e\xad\x97\xe8\x1f"
+      "\x6b\x76\x1e\x84\xf7\xb9\xc2\xd3\x97\x91\x1e\xd4\xc4\x47\xa7\xab"
+      "\x2b\x6e\xf7\xa6\xa7\x4d\xb2\x7b\xb1\xc6\x5d\xe1\xab\x89\x34\x5a"
+      "\x9a\xdb\x8b\x8b\xa8\x4c\x8f\x4d\x7d\x78\xbd\x86\x5d\xb0\x21\xb5"
+      "\xb2\x0e\xa8\x61\x8f\xf2\xb2\x97\xcb\x0e\x3e\x07\xc0\x2a\x17\x89"
+      "\x39\xca\x0b\x43\x74\x21\xce\x60\xc6\xdf\xdf\x68\x23\x03\x9f\x49"
+      "\xb5\x3f\xd6\x73\x80\x11\x30\x44\x58\xf8\x12\x9a\xdf\x38\xed\xa8"
+      "\x4d\xc2\x27\x62\x41\x55\x33\xab\x36\x89\x57\x6c\x0b\x0d\x65\xe6"
+      "\xf1\x93\x7c\xb1\xc6\xb5\x4e\xfd\x33\xad\x4e\xad\x7d\x5d\x59\xfb"
+      "\x30\x19\x9c\x3f\x56\x78\x46\xc5\xe9\xc0\x6e\xdf\x31\x5d\xcb\x8b"
+      "\xe5\x0e\xb5\x13\xc6\x61\xec\xa2\xa9\x4e\xa6\x8c\x93\xea\xed\xd4"
+      "\x09\x1a\x6f\x59\x25\xde\xdf\x6b\x7b\x03\x24\xc7\x7f\x82\xbf\xfc"
+      "\x14\xf4\x3b\x41\x32\xab\x19\x08\x7a\x3a\xdf\xc6\x33\xc9\x20\xdf"
+      "\x59\xff\x34\x6c\x27\xa5\x30\xd3\xed\xf5\x08\x8d\xe6\x3d\xfc\xbf", 256,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512,
+      "\x3c\x1f\x6a\xb2\x58\x8e\xc8\xc8\xeb\x9c\x8c\xf2\x61\xc0\xd9\x67"
+      "\x74\x30\x82\x5e\x79\xb6\x84\x97\x00\x70\xa8\xd0\xec\x68\x22\xdc", 32,
+      "\x21\x06\xee\x9d\x65\x23\xfb\xc4\x20\xe5\xe8\x69\xfa\x60\xc2\xcb", 16,
+      "", 0,
+      "\x75\x82\x1b\x72\x9a\x40\xc3\xbd\x97\x72\x71\xfd\xc0\x9a\x5b\x32"
+      "\xf4\x93\xf4\x6a\x5c\x82\xee\x97\xfd\xa1\xc1\x2e\x5c\x54\xa7\x39", 32,
+      "\xe2\x13\x57\x16\xde\x5f\x30\x79\x46\xd0\x69\x98\x50\xac\x2c\x65"
+      "\x8d\xbb\x08\x4a\x7b\xf7\xcc\x56\xbe\x90\xf7\xbf\x14\x51\x36\x02", 32,
+      "\x70\x77\x91\xb3\x44\xc9\x9a\x63\xd9\x74\xb8\xfc\x23\x28\x95\x96"
+      "\x2f\x35\x09\x9e\x3e\x9d\x27\x2d\x26\x7d\xb0\xf8\xbf\x1a\x55\xec", 32,
+      "\x44\x3e\xee\x8d\x54\x96\xcf\x91\x24\x49\x16\x98\x4e\xbb\x6b\x12"
+      "\x11\xa2\xd9\x95\x78\x2c\x5d\xb3\xdc\x1a\x05\xe0\xdb\x0e\x37\x84", 32,
+      "\xce\x71\x5e\x37\x8b\x85\x09\x5d\x29\x23\x10\x17\x20\xf2\xff\x25"
+      "\x5c\x20\xbe\xbd\xab\xa5\xab\xfc\x73\x99\x95\x3f\xea\xc5\x9e\xe1"
+      "\xe6\x32\x0a\xe3\x00\xbe\x3f\x1b\x24\x67\xa4\x32\xf7\x7e\xba\x4f"
+      "\x3d\x74\xbd\x18\x2c\xca\x00\xf5\x88\xdd\xd7\x97\xce\x6f\x06\x39"
+      "\x6a\x9e\xa7\x96\x6d\x6e\x72\xba\xae\x5b\xff\x9f\x4c\x09\x33\x9f"
+      "\xd6\x7b\x42\x96\xc2\xcc\xf7\x69\x65\xa9\x57\x7c\xaa\x1d\x77\xb8"
+      "\x44\x24\x0b\x10\xf2\x05\xd4\x0d\x5d\xa5\x1f\x75\xe0\x31\x55\x8d"
+      "\x94\x60\x7e\xe5\xae\xb4\xac\x26\x08\x3c\x33\xde\x6b\x1d\xc4\xbd"
+      "\x7a\x31\xac\xd2\x24\x04\x83\x9c\x5c\x18\x7d\xae\x0d\xc5\xad\x7c"
+      "\x52\xf2\xbf\x24\x6e\xa3\xee\xe2\x4c\x84\x03\xce\xee\xe1\xe6\x5a"
+      "\xc0\xab\x0a\x42\x57\x3e\xa8\x40\x83\x17\x1f\x0b\x8c\x51\xc8\x17"
+      "\xb6\x1d\x2c\x80\x3f\xcf\x35\x86\x04\x63\x06\x19\xa6\x0c\x67\x5c"
+      "\x2e\x79\x66\x64\xd8\x2f\x8b\x10\x38\x9e\x2d\x12\x7b\xff\x05\x28"
+      "\x87\xd2\x82\x88\xd5\x9d\x51\xd2\x68\x39\xb7\x66\xfa\x72\x48\x41"
+      "\xf1\x1f\x91\xb1\xf4\x87\xed\x78\x77\xe2\x7b\x91\xd7\x62\x5b\x0b"
+      "\x5c\xec\x0b\x7f\xd5\x96\xfb\x7c\x3a\xf3\xac\xdd\x85\x10\xc7\x51", 256,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512,
+      "\x64\xd4\xb1\x6d\x52\xa7\x01\x9a\xe0\xec\x2e\x7d\xc0\x58\x1a\xfd"
+      "\xef\xbc\xfd\xc9\x46\xa6\x03\x3e\x57\x82\x78\x9f\x7d\x3b\x42\xcd", 32,
+      "\xba\x5c\xaa\x05\xb0\x9d\xad\x8a\x5c\xd5\x78\xd8\x14\xd0\x4e\xc5", 16,
+      "\x23\xd1\x41\x3c\x2a\x9b\x30\xd8\xbe\x7c\x55\x40\xe1\x8f\x2a\xd4"
+      "\xec\xf1\xea\x58\x75\xe0\x6f\x73\x01\x52\xf2\xe0\x5e\x56\xb2\xbf", 32,
+      "\x61\x54\x13\xfa\xe4\x19\xb0\x95\xad\x71\x1a\xd1\x48\x80\x71\xc6"
+      "\xab\xa4\x5a\x0b\x1c\x2d\x3b\xe8\xb3\xeb\x56\x6a\xce\x67\x6c\x01", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x72\xcd\xf1\x4d\x04\xdf\xbd\x5a\x10\x84\x1e\x4d\x14\x6f\x07\x5e"
+      "\x5d\x4f\x08\x4e\x3a\xbc\x99\x70\x9c\x05\x0a\x50\xaf\x35\xe4\x40"
+      "\xac\xb5\xf9\xbe\xa7\xf1\x5c\x22\xc9\x1e\x19\x79\x8d\xf0\xc7\x31"
+      "\xb8\x23\xb9\xd3\x44\x5d\xb7\x1b\x59\x60\x10\x58\x0b\x56\x0a\x01"
+      "\xbf\xb3\xbb\xab\xd4\xea\x12\x1f\xc6\x09\x7a\x57\xde\x4a\x4e\xf0"
+      "\xb5\x63\x0e\xd8\x3e\x3a\xd2\x3a\xcf\x3c\x17\x0c\x8d\x87\x65\xf2"
+      "\xe0\xca\x61\xc0\x27\x4c\x1d\x83\x72\x64\xab\xf5\x6d\x5b\xfc\x16"
+      "\x83\xbe\x4d\xf2\x5e\x39\x4f\x9d\xf2\x9a\x7d\xff\x8d\x5a\xc2\x50"
+      "\x8f\x56\x99\x67\x62\xee\x7b\xd5\x85\xe8\xde\x1b\x8e\x86\x3e\x5b"
+      "\x37\x39\x82\x80\x47\x8c\x84\xf1\x8c\xb8\x2e\x53\x79\xf6\xdb\xcf"
+      "\xfe\x53\x8b\xac\x8a\xe8\xa4\x16\x3f\x8d\x6d\xec\xa5\x40\x72\xd3"
+      "\x58\x6c\x23\x70\xbc\xa7\xa5\xd6\x00\x30\xf1\x33\x7c\x09\x21\xa2"
+      "\xb9\xc1\xb5\x33\x43\xda\xcb\x6c\xc4\xa5\x3d\xb6\xdf\x1f\xac\xf4"
+      "\x17\xc1\xce\x1c\x65\x38\x65\x0c\xab\x08\xa3\x0d\x40\x8d\x61\x16"
+      "\xba\x6a\x21\x4e\xc6\xdd\x86\x16\x7b\x74\x73\x08\x18\xe4\xb1\xf5"
+      "\xd9\xf5\x8a\xcd\x93\xbd\x0e\xb8\x13\xc4\xe0\x10\x5f\xfe\xe2\xde", 256,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512,
+      "\x40\x65\xa0\xf9\x92\x70\x85\xd6\xd9\x93\x6e\x98\xc3\xa4\x25\xcb"
+      "\x3f\x25\x6f\xae\x09\x19\xa3\x0c\x32\x4f\x47\xa0\x3c\xe9\xac\x6d", 32,
+      "\x6b\xa5\x00\xee\xf9\x4c\x19\x02\x11\x1b\x7e\x76\x24\xfa\xfe\x54", 16,
+      "\xc0\x10\x6d\xff\xb6\xf8\x8d\x5c\xa0\xd0\x62\xf1\x90\x26\x36\x76"
+      "\x33\x47\x58\x2f\xa3\x83\xa7\x37\x3d\x35\x2d\xd8\xef\xed\x0d\x60", 32,
+      "\x4f\x9d\x8f\x5f\x0e\x16\x72\xfd\x5b\x40\x79\x69\xb0\x43\x81\xde"
+      "\xd0\xfe\x0a\x66\x9c\x45\xc0\x45\xd6\x01\x3a\xa8\x65\x90\x4d\xf8", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xbd\x8e\xd6\x47\x6e\x88\xf1\xea\x7e\x45\x16\x56\xd7\x76\xe6\xd5"
+      "\x21\xc8\xab\x41\xe5\x6f\x0d\xe0\x93\xa6\x40\x0e\x26\x20\xc9\x93"
+      "\x6f\x36\x75\xf3\x02\xb9\x55\xbc\xf4\x05\x13\x2d\x19\x1d\xfa\xd3"
+      "\x72\x75\x35\xdf\xcf\x26\x1a\x06\xaf\xf0\x83\x57\xdf\x09\xb8\x2c"
+      "\x75\x09\xf8\x27\xa7\xec\x09\x31\x78\xd1\x44\x91\x16\x02\x68\x72"
+      "\x69\xb8\xd9\x9d\xc3\x79\xad\x7a\x57\xa2\xef\xed\x9a\xd2\xe9\x4e"
+      "\xc9\x2a\x68\x95\x18\x0b\x70\xc8\xa8\x17\x66\xad\x1c\xe7\x7a\x6d"
+      "\x04\xd5\xf2\xdb\xca\x12\xbe\x7c\xb6\xce\x17\x16\x9d\x21\xb0\x61"
+      "\x06\x38\x98\xe1\x87\xde\xed\x82\x8a\xd1\xd7\x02\x7f\x20\x81\x58"
+      "\xdb\x5f\x60\xf8\x93\x7b\x82\xca\xc2\x57\x6c\xb3\xaa\xa8\x0d\x58"
+      "\x72\xa7\x19\x71\xe7\x21\x4e\xed\xf0\xdf\xf3\x2c\xb4\x30\xba\xd5"
+      "\xa8\x9a\x1a\xf3\xe0\xdd\xe3\x46\xd1\x38\xa1\x66\xe5\xfd\xb7\x12"
+      "\x27\x34\x21\x53\x43\x5e\xca\x4e\xc7\x39\x1b\xf5\x1f\xf2\x9f\x65"
+      "\x50\x9c\x09\x4c\xf1\x53\xb3\xd4\x4f\x7a\xd1\xe1\x4b\xda\xbd\x00"
+      "\x32\x4b\x23\xcf\xc2\x03\xcf\xa7\xf1\x59\xfa\xc3\x67\x9c\xbe\x71"
+      "\x45\x69\x3a\x1a\x64\x2b\x22\x26\x14\x57\xef\x6c\xcf\x88\x0b\xfc", 256,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512,
+      "\x5f\xa1\xac\xc4\xae\x8d\x37\x0a\x58\xfe\x3a\x15\x3b\xc4\x69\x1a"
+      "\x1f\x97\xd7\x00\x30\x51\x6a\x34\x14\x19\x7f\xab\x40\x20\x49\xfd", 32,
+      "\xb8\x94\xa1\x2b\x1a\x35\xad\xe3\xd0\x56\xb0\xb6\xae\x7e\xac\x41", 16,
+      "\x32\x18\x17\x1f\x59\x9a\xd6\x11\x03\x4b\x7a\xee\xf6\xd2\xf5\x8f"
+      "\x4b\x1d\x88\x8c\x03\x1b\x53\x54\xf2\xea\x15\x98\xc0\x76\xbc\xee", 32,
+      "\xca\x0a\x7e\x04\x65\x83\x9a\xf9\x26\xff\xff\xf0\xcc\xd0\xf0\x50"
+      "\x4a\x69\xd5\x96\x4f\x52\x27\x5b\xab\x45\xd5\xcf\xd2\xc7\xd0\x92", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x86\x3f\x67\x01\xde\x9b\x1b\xd8\x65\x3f\xf3\x44\x3b\x02\xe8\x71"
+      "\xec\xd7\x75\x18\xeb\x9e\x9b\x6a\x22\x82\x62\xf4\x81\x0d\x7e\x64"
+      "\xc0\x7d\xe4\x9a\xc4\xe3\x44\x83\x90\xcc\x95\xc6\x73\xbe\x33\x30"
+      "\x4c\xdd\x44\xce\xff\xa9\x4b\xa9\x04\xc3\x3b\x24\x7b\x37\xa9\x88"
+      "\xdc\xc3\x37\xca\xf6\x1d\xdc\x78\x8f\xaa\xec\x77\xa0\xe0\x8b\xc0"
+      "\x71\x45\x29\x05\x51\xbb\x6e\x12\x77\x27\x82\xe4\x60\x0c\x22\x22"
+      "\xfa\x7e\xe3\x69\x78\xf5\x5b\x7c\x65\x19\x5e\x6e\x44\xf2\x5f\x79"
+      "\x23\xf2\x57\x41\xe4\xe4\x3e\x46\xe9\x3e\x06\x6f\xeb\x48\xb0\xb8"
+      "\x10\x78\x36\xab\x1e\xc6\x3d\xd9\xf9\xc8\x9f\x62\x34\xde\x35\x48"
+      "\xe8\x3f\xcd\x76\x4c\xf2\x10\xda\xb1\xa9\xda\xf0\x88\xc5\xac\x85"
+      "\xd0\x10\xd1\xda\x55\xbb\x73\x4c\xfa\x08\x08\xa7\xe8\xa4\xdc\xaf"
+      "\x1d\xe3\xce\x3f\xc9\x96\x28\x6b\x65\x41\xa4\x80\xf8\x54\x2d\xf2"
+      "\xd6\x82\x9d\x4c\xe5\xf5\x7b\xea\x62\x9c\x7d\xcd\x45\xba\xb7\xa8"
+      "\x93\xc1\x70\x30\xe2\x2e\x9d\x3b\x3f\x82\xee\x34\x44\x91\x43\xd4"
+      "\x9e\xa7\x3c\x3a\x74\x2b\x0b\x71\x19\xc9\x3f\x54\x33\x42\xfa\x0d"
+      "\xde\x20\xaa\x87\xbc\xda\x54\x09\x08\x47\x45\x88\x20\x61\xbd\x05", 256,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512,
+      "\xd1\x14\xfe\x65\x13\x01\xc1\x54\xa6\x79\xfe\x3e\xd7\x4b\x1a\x7f"
+      "\x4a\x81\xc9\xc9\xd9\xe9\x8d\x87\x8a\x6a\x06\x0e\xd4\xb4\x21\xe3", 32,
+      "\xe0\x85\xb1\xea\x52\xc9\xd1\xd9\x02\xea\x79\x54\xd9\x8f\xe3\xc7", 16,
+      "\xd8\x52\xdd\x68\x5b\xb8\x69\x60\xfd\xaa\xf7\x1c\xc0\xe3\x34\xf0"
+      "\xf0\xa9\x81\x46\x93\xa7\x92\xb8\xd3\xdf\xc2\x34\x71\xc1\xa7\xf1", 32,
+      "\x1e\x4e\x2c\x87\xe0\x49\x28\xf3\x90\xe4\x90\x04\x90\xaa\xe7\xab"
+      "\xfc\xc2\xf5\x17\x4d\x35\x4b\x81\xf6\x77\xae\x7f\xbd\xb1\xa0\x30", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x1d\xd7\xc6\xe6\x9c\xd3\x0e\xc7\x10\xba\x5a\xaa\xc2\x2b\x13\xc9"
+      "\x88\x83\x72\x7a\xd3\x5c\xeb\x75\xa6\x95\x21\x4a\x08\x40\x11\x69"
+      "\x15\x1d\x18\x2b\x5c\x17\x8d\x1c\xc5\x93\xac\xcb\x41\x19\xb8\xbb"
+      "\xa3\xab\x33\x94\xb2\x7b\x51\xfe\xde\xc2\x17\x36\x91\xbe\xb2\x1c"
+      "\x88\x5a\xd3\x28\x65\xfa\x1b\x1b\xd8\x39\xcc\x6b\x22\xe5\x30\xd1"
+      "\x7a\xc0\xa4\x1e\x13\x71\x36\xfd\x84\x0e\x86\xba\x11\x59\x57\x71"
+      "\x20\xad\x3b\x18\x13\x17\xb0\x6f\x73\x58\x80\x94\x3d\x6a\xd5\x5b"
+      "\x84\x01\x27\xb9\x8c\x06\xd2\x61\xfd\x93\xf7\x8d\xc4\x9a\xf5\x8d"
+      "\xf5\xc5\xbc\x63\xeb\x98\x0b\xb9\x00\x15\x4d\x5e\x10\x40\xa1\x69"
+      "\x80\xd5\x08\xf5\xf8\xe2\xed\x07\xf3\x26\x62\xdc\xe0\x06\x70\x70"
+      "\x6e\x67\xd9\x96\xf2\x12\x0c\xbd\xb1\xe4\xa8\xb9\xdf\x3b\x21\x51"
+      "\xa1\x3d\xb9\x0a\x55\x11\x4d\xd3\x87\x09\x35\xb9\xa6\x89\x36\x28"
+      "\x41\x2a\x24\xb9\xda\xf9\x7f\x88\x3b\x9b\x36\xf8\x5c\x37\x89\x23"
+      "\xc2\xda\xf4\x90\x24\x93\x5a\x1e\xec\x2e\x86\x02\x6e\xf7\xd6\xbc"
+      "\xfe\xd5\x75\x12\xa2\x3d\x03\xda\xba\x2b\x00\x49\x74\x43\x2a\xb2"
+      "\x0d\xf2\xf9\xc1\x69\xf4\x4e\x46\x2e\x73\xf4\xe7\xf7\xe2\xab\x61", 256,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512,
+      "\x6e\x21\x1b\xc0\x1d\x35\xd3\xd4\x8a\x58\xd6\x68\xfe\x6c\x81\x0a"
+      "\xcd\xcf\xa1\xc0\xb6\x8e\xef\xfe\xc3\x30\xe3\xad\xb9\xc0\x9e\x35", 32,
+      "\xb7\x92\x9b\xaf\x18\xcb\x7e\xd3\xed\xb3\x43\xf5\x5d\x47\x6d\x2b", 16,
+      "\xe7\xdc\xc0\x7e\x6d\xeb\xa8\x85\x20\x29\x87\xa6\x72\xdb\x19\xcf"
+      "\x4b\x12\xac\x35\xd1\x67\xa7\x18\x76\x01\x7c\x01\xda\xde\xb1\x9f", 32,
+      "\x13\x6f\x71\xee\xe8\xd8\x22\x61\x63\x06\xd2\x7d\xf6\xb7\xb7\x6a"
+      "\x55\xd1\xbd\x50\x07\xf0\x0b\xad\x4c\x7a\x75\x19\x76\x65\xc2\x13", 32,
+      "\xcb\x35\x71\x95\x4a\xa0\x16\xf2\x4c\xa4\x57\xa0\x8f\x92\x06\x91"
+      "\x35\x1b\x97\x2e\x65\xe1\x0f\x3c\x93\xfe\x3c\x2b\x5b\x13\x0b\x1a", 32,
+      "\xe0\x0c\x88\x03\x74\xbd\x4b\xb0\xb3\x06\xa6\x1b\x28\x15\x69\x13"
+      "\x8f\x50\x03\xa3\xd6\x31\xef\x93\x4d\x60\x70\xbb\xaf\xba\x77\xb8", 32,
+      "\x99\x04\xbb\x0e\x34\xf9\x19\xd8\x62\xcc\xd6\xe5\xe3\x7f\x66\x7e"
+      "\x7c\x36\x0a\x81\x78\x5c\xa3\x05\xd9\x46\xf4\x27\xc9\xb0\x90\x7d", 32,
+      "\x44\x5a\x59\x6d\x2a\x18\x5e\xc6\xbc\xd2\x90\xb6\xee\xa5\xde\x0b"
+      "\x39\xff\x9c\xf0\x5c\x20\x93\xaf\x52\x7e\x69\x53\x07\x39\x98\xa1"
+      "\x67\x9c\x9f\x77\x70\xfd\x86\xab\x9b\xc8\x97\xae\x84\x25\x9a\xf2"
+      "\x41\x7c\x54\x29\x98\xfe\x75\xd1\x1e\xbf\x95\x84\xe7\x41\x06\x76"
+      "\x88\x4c\xa5\xf8\x16\xe1\xe7\xb3\xef\x9d\xb8\xfe\xbb\x29\x02\x60"
+      "\x53\x59\x84\xd2\x09\xb5\xb8\x2c\x69\xcc\x8c\x16\x7d\x12\xe5\x47"
+      "\x05\x77\x17\x23\x2f\x60\x9e\x74\x51\xbe\xcf\x2d\xa5\x6b\xeb\x95"
+      "\xa3\x61\x0e\x48\x6c\xd8\x24\x0a\xf1\x58\xe2\x6a\x90\xb1\x2c\x73"
+      "\xc4\xcc\xb5\x94\x80\x44\xed\xaf\x0b\x63\x77\xee\x79\xb5\xc0\x0f"
+      "\xc7\xda\x0d\xec\xde\xb0\xcd\xda\xae\x55\x16\x0b\x96\x06\x47\xa1"
+      "\xc2\x55\x4a\x8f\x71\x60\xaa\x2c\xf8\xa2\xff\x0f\xc9\x40\xa7\x10"
+      "\xa7\xd7\x86\xa5\x8b\x6b\x6d\xbc\x31\xfe\x5a\x86\x16\x25\xe8\xca"
+      "\x05\x0d\x0c\x93\xbd\x49\x86\x41\x37\x2b\x96\xae\xdd\x68\x92\xa3"
+      "\x1a\x2c\x75\xe7\x1c\x77\xad\x86\x81\xa4\x34\xfd\xbd\x0c\xa8\x8c"
+      "\x8d\x3b\x57\x3f\x27\xbb\x0d\xc2\x9b\x4f\xf7\x5a\xa2\xf5\xb6\xa9"
+      "\x0b\xd8\x5e\x24\xb9\xf6\x50\xc6\xc0\x5d\x20\x28\x9c\xf5\x81\x38", 256,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512,
+      "\x95\x1d\xf9\x4a\x75\xca\x12\x67\x00\xa2\x0a\x71\x2f\xa6\x59\xcd"
+      "\x24\xf8\x51\xbd\x3e\x13\xe9\x60\xac\x21\x64\x2d\x42\x4f\xce\x1e", 32,
+      "\x12\x23\x3e\x18\xe1\x37\x17\x49\xdc\xa1\x54\xb6\x4e\xe5\xfb\xee", 16,
+      "\x28\x35\x3c\x78\x6b\x56\x4a\x2e\x36\x09\xf6\xea\xf4\xc9\x3a\x6f"
+      "\xb7\xd3\x48\xf9\x45\xbb\xe8\xd3\x24\x41\x65\xa2\x52\xd3\xd9\x62", 32,
+      "\x49\x3f\xc9\xb2\x85\xc2\x7f\x95\x22\xee\x91\xac\x63\xfb\xa6\x5d"
+      "\x8b\x28\x45\xff\x6f\x31\xad\x83\x2f\x0f\xec\xaf\xdd\xba\x08\x2f", 32,
+      "\xa9\x0e\x40\x20\x35\x33\x11\xb8\x5b\x37\x26\x41\xdf\xe6\x95\x26"
+      "\x8e\xc1\x2e\x74\x90\xea\xe4\xa2\x1a\xee\x04\x1d\xff\x88\x72\xf0", 32,
+      "\x3a\x5b\x48\x80\x4d\x63\xd1\x60\x30\xab\x66\xce\x8c\x45\xc1\xb9"
+      "\xfa\xd2\x66\x8f\xd2\x94\x8a\x0f\x3c\xf1\x9b\xd6\xcb\x51\x41\x2f", 32,
+      "\xb1\x6c\x76\xb0\x03\xa7\x7a\xf4\xba\xb6\xba\xd4\x14\x4a\xae\x5d"
+      "\xff\x43\xfe\xc3\x33\x5f\x76\x86\xdd\x56\x9f\xeb\xdb\x78\x38\x2d", 32,
+      "\x14\xa8\x89\x61\x6c\x37\x28\x67\xa5\x31\x04\x5d\x03\x09\x21\x82"
+      "\x48\xcf\xe3\x20\x65\xdf\x07\xf8\x14\xe7\x6f\x39\x5f\x99\x83\xd1"
+      "\xa0\x03\xab\x31\x04\x8f\x17\x8e\x54\x0b\xb8\x65\x70\xb7\x1e\x81"
+      "\x72\x2a\xb3\xd1\x72\x08\xc1\xa2\xcd\xe0\xf7\x05\xd8\x24\x03\xbf"
+      "\x2f\x3d\xcc\xc9\xac\x45\xe4\xde\x12\x57\xa5\x49\xcc\x9c\x7d\xcf"
+      "\x84\x6d\xc1\x73\x08\x1b\x26\x06\xa6\x88\xb4\x4f\xc0\x5b\x21\xe2"
+      "\x6a\x21\x27\xd3\x99\x2c\x87\x10\x09\x0d\x46\x4d\x06\x48\x4a\xab"
+      "\x4c\x84\xf9\xec\x18\x58\xe2\x42\x2c\xc6\xe1\x8d\x2b\xcd\x52\xe3"
+      "\x2c\x48\xbe\xca\x9b\xcf\x28\xa8\xb0\x4e\x94\xbb\x87\xa4\x91\x95"
+      "\x0c\x0a\x89\x3c\xe0\x83\x62\x21\x8a\xa8\xf3\x28\xd0\xd0\x42\x05"
+      "\x9e\x01\x28\x92\x04\xd3\x38\x7b\x12\x02\x59\xf6\x92\xe7\x6c\x8f"
+      "\xb4\xd0\x5d\xe9\xe0\xca\x84\xd0\xb4\xfc\x8b\x67\x83\x3a\x81\xdd"
+      "\x0e\x17\x1a\xc2\x9b\x1d\xd5\xb2\xaa\x04\xab\x6e\xbc\x26\xd2\x92"
+      "\x70\x10\xfd\x05\x3e\x02\x31\x9f\x69\x65\x22\xcf\x5f\x61\x52\x7d"
+      "\xe5\xc0\x54\xc0\x44\x6b\x37\xf4\x8b\x0b\xc7\x91\x5f\x7a\x8e\x0f"
+      "\x37\xe1\x99\xff\x98\x91\x6e\xb2\x11\xea\xcc\x9c\x51\xc0\x15\x0c", 256,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512,
+      "\x4d\x72\xbd\xe9\x5d\x31\x93\xa8\x31\x1f\xfd\xeb\xf7\x84\x54\x3e"
+      "\x9a\x41\xca\x38\x1a\x33\x96\x90\x10\xb1\x52\x30\xaf\x74\xf1\xf6", 32,
+      "\xc6\x65\xc5\x46\x24\x5f\xe6\xdc\xc6\x2c\x38\x50\x20\x9b\xfc\x49", 16,
+      "\xf0\x95\x3a\x99\x2b\x4a\xba\xc3\x3a\x57\xef\xaf\x12\xfa\xde\xed"
+      "\x35\x95\xa5\x70\x52\xad\x9f\xdf\xad\xb5\xa1\x47\x0b\xfe\x6c\x3d", 32,
+      "\x77\xdb\x82\x13\x5a\xa1\x81\x65\xa4\xff\x49\xe7\xf8\x12\xed\x57"
+      "\x0f\x29\x48\x69\xcc\xa0\x98\xcd\xaf\xe1\xb4\x9a\x10\xa1\x20\x32", 32,
+      "\x8d\x3f\x0d\x09\x41\x6a\x60\x43\xbd\xbd\x99\x41\x2d\x79\xa1\xc7"
+      "\x82\x64\x2c\xc3\x80\xea\x6d\x63\xfb\x07\x26\x8d\x2f\xf0\x55\xb3", 32,
+      "\x98\x79\xd6\x1e\x79\x37\x97\x76\xa0\x6a\x28\x0f\x44\xef\x26\x22"
+      "\x0f\x6c\x4b\x69\x10\x0d\x02\x59\x48\x5e\xff\x67\xe9\x4b\x02\xa2", 32,
+      "\x37\x36\x82\x47\x8f\x88\x78\x86\xe3\x4c\x6d\xde\x43\x00\xdb\x65"
+      "\x4a\x0d\xa1\x25\x30\x86\x0f\x11\x04\xe9\x95\x08\x0b\x53\xee\x7d", 32,
+      "\x22\xf2\xdd\x57\xcd\xaa\x44\x09\x12\xa7\x1e\xa1\x78\xae\x71\x62"
+      "\xdd\xc8\xac\x93\xe5\xad\xab\x7c\xf3\xfe\x0a\xa0\x3c\xea\xf2\xaf"
+      "\xc6\x70\x46\x0f\xd0\x51\x28\x54\x9e\x16\x53\x4d\x88\xc8\x1d\xaa"
+      "\x7e\xce\x70\x32\xfe\xb3\x01\xce\xf3\xb4\x50\xd8\x2d\x9a\x36\x8d"
+      "\x8e\x00\x1c\x2d\x6b\x7d\x7a\x80\xb3\x8f\xc7\x52\x90\xa8\xcc\xd1"
+      "\xcf\xc8\x1c\x65\xc9\x83\x9c\x99\xab\xe2\x18\xa4\x7b\xe5\x04\x5f"
+      "\x41\xcf\x89\xd4\x53\x00\x63\xd0\x44\xc9\x3c\xac\x77\x17\xcb\x99"
+      "\xcc\xa8\x30\xd3\xbc\x4f\x89\xa9\xb0\x4c\xcf\x62\x17\x53\xa9\xcc"
+      "\xa6\x18\x08\x73\xbc\x00\xd3\xcd\x5e\x8e\xb2\xb9\x34\xc2\xba\x4b"
+      "\x99\xe5\x3e\x9d\x74\x80\x39\x91\x66\xa6\x1a\xc0\x60\x07\xb8\xf8"
+      "\x2c\xab\x31\xf5\x34\xe5\x0a\x53\x6d\x60\xfd\x07\xc0\xa7\xdf\x6a"
+      "\x74\xba\xea\x1d\xdb\x40\x4c\xb6\xf4\x63\x9f\x58\xf9\xe7\x4f\x07"
+      "\x4d\xa0\x0e\x2a\xaf\x63\x9c\xba\xba\x15\x2d\xf1\x48\xd8\x56\xe5"
+      "\xb1\x22\x2a\x40\x0c\x11\x69\x19\x3b\x9d\xaa\x1a\x9d\xc3\xf5\xe8"
+      "\x51\x91\xa5\xf9\x2b\x30\x50\x74\x81\xd4\xa3\x9a\xa5\xc7\xcd\x38"
+      "\xe7\xe0\xe2\x62\x7b\x02\x7b\xdc\x92\x8e\x74\xa5\xe0\x87\xf7\x72", 256,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512,
+      "\xff\x95\xf0\xdc\x14\x24\x4b\x6d\x46\x9d\xff\xdf\x41\x58\xfd\xbf"
+      "\x97\x6d\x40\xdf\xad\xe4\xbe\x46\x5d\x7e\x77\xf5\xb7\x48\x8d\x1a", 32,
+      "\x61\x55\x28\xcc\xd9\xf9\xa6\x0e\x43\x49\x77\xbd\x15\x32\xa0\x40", 16,
+      "\x4f\xb2\x08\x39\x17\xea\x47\x5d\x48\xc5\x5e\xae\x01\x4a\x18\x63"
+      "\x66\x30\xa7\xf2\x0f\x67\x0b\x20\x42\x3d\x71\xce\xc7\xb4\x7e\x83", 32,
+      "\x6c\xcf\x8c\x03\x59\x68\x71\x66\xa0\x8d\xae\xf0\xea\x5f\xb4\x36"
+      "\xc7\x86\x46\x46\xf6\x44\xf4\xf6\x53\xce\x7a\x71\x79\x04\x17\x0f", 32,
+      "\xfb\x37\x34\x1d\xc1\xc3\x62\x92\xc5\xfd\x6b\xb2\xb0\x7f\x68\x01"
+      "\x58\x6e\xa3\xde\x57\x8e\x1a\xa0\x1e\x31\x02\x26\x5c\x69\xee\x6e", 32,
+      "\x93\xe2\x78\x02\xc4\x5d\xec\xa7\x71\xb8\xdf\x09\xe6\x57\xa3\x3b"
+      "\xbf\x77\x54\x02\x09\x6e\x8e\xe8\xd0\x63\xb1\x1b\xa4\x73\x96\x3e", 32,
+      "\xab\x06\x59\x5a\xc2\x29\x0c\xf7\xa0\xec\x7a\x6d\xb4\x33\x3f\xb1"
+      "\xdb\xc1\xa3\x0c\xe5\x75\x2b\x58\x74\x97\xb2\x5b\xce\x6d\x0f\xaf", 32,
+      "\x33\x3b\x2a\x4a\x8e\xeb\x0d\x11\x45\x96\x1c\x29\x48\x70\x66\x47"
+      "\xb9\xdd\xcf\xfa\x5e\x6c\x70\x69\x2a\xd9\x47\xb8\x7b\x84\xa0\xe9"
+      "\x5e\x4c\xc7\x14\xcb\x8e\xf0\x94\x35\xc0\xfc\xab\xcb\xe0\xb8\xf1"
+      "\xda\x83\x07\xa0\x29\x14\xb1\x0c\xca\x70\x9e\x15\xd1\x58\x34\x01"
+      "\x92\xe1\xa5\x34\x16\xc6\x4a\x94\xd4\x52\xe9\x10\x80\xca\xd4\x27"
+      "\x96\x70\x8a\xac\x29\xca\x65\x1c\x1b\xc4\x9f\xdc\x9f\xeb\xd8\xf7"
+      "\xd1\x50\xd3\x71\xd3\x91\x86\xfb\x46\x29\xec\xc9\x15\xc4\xe2\x87"
+      "\xf9\x65\xa6\xee\xef\xba\x69\x74\x37\xbc\xc9\xe4\x74\x4e\x99\x01"
+      "\xfa\xe1\x17\x56\x86\x92\xff\xae\x04\x58\x30\xeb\xc6\x53\x3a\x1b"
+      "\x34\x29\x13\xce\x39\x2b\x9c\x61\x1d\x31\x54\x7a\xb7\xa9\xd6\x12"
+      "\xa8\x97\x2b\x87\xcf\x80\x23\x34\xdf\xb2\x25\x7b\x7c\x80\x10\x6c"
+      "\x6e\x2c\x56\x00\xce\x1a\x7a\x36\x74\x13\x1b\x15\xb4\x3b\xa3\xf9"
+      "\x8e\x97\xb7\x07\xa2\x8c\xa5\x99\x6a\xce\x3a\x4d\x83\x36\xac\xd6"
+      "\xa2\xab\xad\xc8\xd7\xcd\x4d\x1a\x1a\x9d\x49\x7b\x89\x00\xe1\x91"
+      "\x11\xdd\x0d\xf1\x8f\x9c\xf5\x03\x74\xc6\x3b\xb6\x58\x49\x9e\x15"
+      "\xa8\x56\x57\x86\x88\x35\x9b\xd8\xc4\x35\xc4\x44\xde\x55\xf3\x57", 256,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_224,
+      "\x70\xe7\xa5\x75\x03\x04\xcb\x96\x48\x89\x3a\x99\x4d\xaf\xc5\xc3"
+      "\x5d\x3c\xce\x8a\x88\xc0\x7e\x1b", 24,
+      "\xbe\x87\x7d\x3c\x29\xd8\x78\x40\x9a\x58\x35\x3c", 12,
+      "", 0,
+      "\xc0\x7c\x14\xcc\x59\x30\xfa\x77\x1e\x97\xbc\x2e\x6c\xb7\x44\x94"
+      "\xcd\xa3\x53\xa2\x6f\x61\x11\xbe", 24,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x47\xbb\x17\xdd\xdc\x8c\x41\xb7\xb6\x73\x2a\x61\x47\x38\xf7\x31"
+      "\x78\xbe\x2e\x5a\xaa\xc1\xcc\x4c\x78\x24\xcc\xb7\x81\xbf\x27\x3f"
+      "\xcb\x03\xac\x38\x2e\xe4\xcc\xea\xfe\x96\x3a\xc9\x7f\x0c\xac\x07"
+      "\xce\x2d\xd8\x3f\x3c\xf7\x46\x3b\x50\xdc\xac\xb0\xe1\x3b\x90\xf9"
+      "\x14\x16\x9e\x11\x3d\x59\x34\xef\xc4\x99\x72\x0c\x56\xf8\x75\xa9"
+      "\xbf\xae\x9e\x1f\xc6\x95\xc3\x68\xe8\x95\xbc\x72\x9c\xa9\x07\x75"
+      "\x62\x5c\x89\xa2\x55\x28\x66\xc1\x77\xe3\x7d\x6c\xb9\xbc\xe7\x46", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_224,
+      "\xb6\xe5\x1a\x9d\xab\xd0\xb6\xd5\xf4\x22\x0f\xf5\x13\x59\xa8\x1e"
+      "\x95\x3a\x70\xc4\x7c\x7b\xa6\xcf", 24,
+      "\x1f\x4b\x66\x05\x93\xd6\x4b\x52\xbf\xe8\x49\x8d", 12,
+      "", 0,
+      "\x88\x22\x18\x16\xdc\x27\xdc\xbd\x85\xe7\x1a\x0e\xe2\xc5\x87\x2c"
+      "\x9c\xb4\x01\x55\x4f\x1f\x87\x52", 24,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xb9\x40\x8c\xa4\x8f\x34\xfd\x0d\x8e\x7f\x5e\x9e\x4c\x04\x6f\x5a"
+      "\xe6\x62\x4b\xc0\xa5\x5d\x3f\xa7\x16\xc1\xaf\xfd\x38\x1e\x7f\xff"
+      "\xc7\x97\x1a\x82\x39\x01\xcc\x55\x20\x96\xdd\x89\x4a\x2c\x42\xdf"
+      "\x83\x04\x9e\xa3\x7d\x2e\x2c\x35\xdd\x01\x5e\xfd\x2c\x2a\x3c\x54"
+      "\x97\xce\x36\x72\xdd\x79\x87\xe5\x3a\xe7\x54\x33\xcd\x08\x3f\xa3"
+      "\x34\xbe\xd7\xac\x7d\x78\xd6\xe9\xe4\x92\x00\xa2\xd4\xf5\x00\x10"
+      "\xc2\xd6\xe3\x42\x39\x51\x50\x1f\x41\x80\x6f\x5f\x82\xb8\x57\x8d", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_224,
+      "\x63\x44\x0a\x49\xe2\x04\xf0\xf9\xd7\x06\x22\x35\xab\xd1\x39\x99"
+      "\x4c\xe9\x7c\xf0\xa9\x45\x33\x3a", 24,
+      "\xe4\x34\x6a\xdb\x0d\xec\x99\x92\xd7\x95\x68\xfb", 12,
+      "", 0,
+      "\xce\xaf\x42\xfc\x84\xba\xac\x70\xa7\x42\xaa\x90\x78\xd8\x28\xa2"
+      "\xe3\x51\x97\x41\xe3\xf4\x20\x31", 24,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xeb\xb0\x49\xa5\x24\x03\xfc\x52\xd1\xfd\xfd\x20\xf0\x34\x6f\x4e"
+      "\xb0\x38\x47\xa2\x44\x44\xfe\xbf\xdd\x0f\x1f\xc0\x47\x03\xef\xc1"
+      "\x67\x0c\xfc\x2a\x91\xcd\x56\xbb\xc1\x16\xf7\xf1\xce\x75\x92\x67"
+      "\xb7\xea\x82\x40\x8a\x2d\x8d\x9c\xe5\x12\xa1\x83\x30\xd1\xe1\xf8"
+      "\x57\x16\x62\x23\x60\x61\x75\x38\xfa\x24\x22\x71\x55\x6f\x70\xb4"
+      "\x3f\xa5\x08\xe7\x86\x00\x8a\x3c\xdb\x37\xcd\x08\xd4\xde\x03\xe8"
+      "\xcf\x8a\x1a\x8a\xdb\xad\xd4\xd3\xfa\x85\xfa\x29\x88\x97\xaf\xfe", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_224,
+      "\xde\x58\x2e\x68\x0e\x2c\xab\xf2\xdc\x47\x2b\xc1\x1b\x98\x3a\x52"
+      "\x1a\xf0\x8e\x3d\xdc\x4f\x96\xdf", 24,
+      "\x2c\x50\xd3\x53\x8c\x1b\x56\x49\xbb\x74\x58\x47", 12,
+      "", 0,
+      "\x53\x05\x27\x21\x6b\x5f\xef\xf0\xf5\x9f\xf9\x0d\x3c\xa9\x45\x25"
+      "\x23\xd1\x00\xdd\x8a\x95\x6e\xf4", 24,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x70\x15\x3c\x46\x96\x5a\x59\x41\xda\x5e\xd3\xa0\x3e\x21\xa5\x1a"
+      "\xfa\x00\x8d\x81\xb8\x0e\xee\x4c\x45\xf7\xe0\xd9\x61\x92\x94\x4a"
+      "\x9d\xca\x8c\x6d\xe6\x5a\xa1\x8b\xcc\x89\xc1\xd6\xe8\x11\xa3\x5e"
+      "\xaa\xfc\x2a\xfd\xbd\x36\xa4\xce\xcd\xca\x37\x46\xbc\x81\x66\x4b"
+      "\xb0\x5c\xd0\xa0\xb7\x81\x92\x3f\x9f\xb9\x43\x8a\xae\x49\xc3\xc2"
+      "\x7f\xb8\x15\xe8\xa5\x4d\x73\x17\x37\x33\x80\xc6\xdd\x50\xa0\x8e"
+      "\x47\x09\x50\xca\x3e\x70\xdd\x56\xde\x8e\x40\x88\x5e\xd3\x24\xd6", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_224,
+      "\x5a\xd0\x7b\xa6\x6d\xcb\xee\x78\xc1\xc4\xc0\x97\x86\x8f\xae\x2e"
+      "\x1e\x2e\x51\xb6\x6e\xe2\x5d\xad", 24,
+      "\x14\x9d\x84\x3e\xe4\xde\xb3\xdd\x79\x4b\xad\xd6", 12,
+      "", 0,
+      "\x54\x9e\xde\xc3\x57\x77\xe3\x2f\x17\xe9\x6a\x71\x99\x89\x36\xbe"
+      "\xbe\xb1\x3b\xd1\xc7\x43\x89\x9b", 24,
+      "\x09\x98\x30\x9a\x3f\x14\xf2\xcb\xa6\x62\xf1\x0f\x54\x76\x1d\x0b"
+      "\xe3\x02\xac\xce\x01\xe3\xfa\xea", 24,
+      "\xbe\x76\xb9\xf9\xb9\x3c\xfd\xb7\xad\x9b\xba\x40\x7d\x58\xf4\x68"
+      "\xc1\x42\xa6\xc0\xc7\xfa\xa5\xda", 24,
+      "\x16\x7b\xf0\xf1\xd5\x54\xaf\xdf\x67\x3a\xee\xe7\x0f\x4e\x59\x02"
+      "\xb5\x7d\x91\xd8\x5f\x3b\xcd\xfb", 24,
+      "\xea\x00\xf2\xe1\xab\x44\xfd\x82\xda\x5a\xc0\xf3\x95\x05\x9a\x8d"
+      "\x20\x0f\xec\xf3\x02\x9d\xfb\xf2\xf9\xf4\x1f\xe1\x09\xb0\xae\x12"
+      "\x19\xbb\x03\x8f\x49\xbb\xf4\xd6\x84\x32\xee\x9a\x47\xfe\xe7\xa8"
+      "\xea\x8c\x8e\x78\x6d\xcd\xd3\x72\x7c\x55\x05\x4a\x1c\x81\xa0\x7c"
+      "\x8d\x7e\x4b\x08\x93\xec\x9c\x32\x46\xf3\x40\xa1\x36\x5b\xf7\xb3"
+      "\x94\xbc\x37\x8f\xd0\xdc\x0a\x1c\xc4\x3e\xa6\x89\x5c\x85\x59\x1a"
+      "\xb0\x93\x76\x72\x8a\x77\xca\x4b\x57\x7e\x60\x85\x4f\x97\x4f\xc2", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_224,
+      "\xbf\xd3\xe7\xf4\x90\x79\xce\x7b\xe6\x7b\x9a\x01\x85\x1e\x16\x04"
+      "\x4e\x8b\xf1\x66\x41\x3e\xbd\xdf", 24,
+      "\xd1\xc7\xb8\xd3\xc2\xc5\x80\x31\xd7\x83\xd3\xf6", 12,
+      "", 0,
+      "\x82\xbc\x0f\xf1\x91\xfd\xf7\x13\x9e\x93\x0a\x72\x5b\x22\x3f\xb2"
+      "\x97\x97\xe2\xb4\xe6\xc7\x48\xeb", 24,
+      "\x0c\x78\xf2\x52\x2a\x6f\xf7\x32\x63\x64\xcf\xe5\x1f\x4e\x0b\xe7"
+      "\x67\x8f\x33\x5a\xea\xbe\x25\xc5", 24,
+      "\x39\x37\x78\x17\x78\x84\xb2\xdc\xa7\x69\x06\xae\xc3\x0b\x0a\xd2"
+      "\x64\xee\x8a\x1b\xdd\x86\x98\x87", 24,
+      "\x22\xd7\xb5\xc6\x94\xec\x56\xcc\x48\x23\x07\x5f\x50\x09\x9b\x57"
+      "\xf1\x89\x37\xe8\x03\x4f\x80\xa5", 24,
+      "\x46\xb9\x8d\xc3\xee\xc9\x94\xc8\x0d\xa2\x31\xa9\x67\x03\x72\xba"
+      "\xa5\x09\x65\x46\x9c\x70\x6d\x42\x44\xd5\x75\xb6\x10\xcf\x6a\x54"
+      "\x47\x39\x23\xc9\x22\xd0\x6d\x87\x3e\xc8\xbf\x1b\x7b\xbd\x96\xc1"
+      "\xf8\xbc\xcf\xd1\xf7\x4b\x25\x6b\xcf\x4d\xc2\x9d\x8e\x79\x21\x08"
+      "\x5d\x82\xdd\x89\xc1\xbd\xb5\x59\x72\x2a\xf2\x44\x71\xe2\x65\x9b"
+      "\xef\x9c\x46\x5f\xc8\xad\xc3\x6f\x48\x4b\xba\x74\x0a\x71\xa8\xf0"
+      "\xc9\x58\x38\xac\xc0\x17\x08\x98\xcc\x8d\x7c\x23\x6c\xd9\xaf\x90", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_224,
+      "\x3f\x74\xc9\x36\xb7\x64\x17\xc2\x9b\x77\xa1\x81\x0c\xce\xe8\x14"
+      "\x21\x5b\xd6\x7f\x42\x93\x39\x61", 24,
+      "\x38\x8c\x25\x78\x38\x7f\x53\x3e\x42\x57\x9d\x0b", 12,
+      "", 0,
+      "\x96\x57\xf4\x14\xc3\x51\x88\x56\x45\xbd\xcf\x90\x85\xb0\xa0\x0c"
+      "\xa9\x18\x12\x95\xe7\xb4\xa7\xcd", 24,
+      "\xc4\x51\xa0\x12\x58\x94\xe2\x96\xad\x9d\xb3\x87\x73\xfd\x53\x61"
+      "\xcc\x16\x7e\xc9\xc9\xbc\x51\x1d", 24,
+      "\x17\x37\x19\xa2\x42\x74\x1e\x81\x23\x82\x6d\xab\x3b\x94\x16\x3e"
+      "\xa9\xbb\x64\x9c\xf6\x38\x76\x89", 24,
+      "\xac\xd3\x54\x77\xb8\xe5\xc6\xa8\x16\x9e\xe0\xf4\xe1\x72\xb0\x0b"
+      "\x6a\xfe\x5c\xbe\x18\xe9\x20\x5b", 24,
+      "\xa3\x8f\xff\x0f\x5f\x03\xa2\x16\xe3\x9d\xaf\xe5\xc3\x8a\xf9\x19"
+      "\xb9\x0e\xf4\x85\x9d\x72\xf4\x74\xbc\x60\x91\x1f\x73\xde\x5a\xae"
+      "\xdd\xe7\xb6\x7a\x65\x15\xbb\x33\x21\xb0\xe9\xcb\x99\xcf\x56\xbc"
+      "\x13\x54\xe9\xff\xe9\xf7\x7f\xca\x9e\x32\x26\xb2\x38\x25\xd6\x42"
+      "\x10\x04\x73\x97\x99\xc2\x90\x70\xd0\x7f\xb5\xe8\xeb\xb0\x10\xd5"
+      "\x17\x30\xdc\xd7\x2a\xa4\x94\x5d\xaa\x68\xc4\x43\xd8\xb5\x99\x8c"
+      "\xe2\x75\x03\x52\xc5\x7f\xaa\xa8\x26\xae\x7e\xeb\xd3\x03\x2e\x96", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_224,
+      "\xbd\x86\x07\x48\x6a\xc3\x95\xa4\xda\x52\x8a\x26\x29\x7d\x8a\x4f"
+      "\x7e\x39\xbe\x1b\xd6\x69\xda\x3e", 24,
+      "\x46\x6e\xb3\x61\xa2\xde\x40\xbf\xf4\x5b\x8f\x25", 12,
+      "", 0,
+      "\xe2\x19\x3d\x6f\xfb\x0c\xf2\x11\x19\x44\x55\xd3\x70\x8f\xac\x44"
+      "\xa5\xa9\xb2\xd3\x63\x14\x81\x6c", 24,
+      "\x25\x67\xa6\xf8\xc2\x23\x52\x1f\x53\x98\xdf\x6f\xba\x4e\x64\x13"
+      "\x2e\x28\x59\xf4\x0b\x5d\x17\xde", 24,
+      "\xf7\x91\xab\xac\x98\x66\x05\x84\x8f\x46\xec\xda\x15\xc6\xd9\xc3"
+      "\x28\x5c\x72\x58\x24\x8c\x90\x97", 24,
+      "\xef\xea\x1a\x0d\x4a\x03\x19\xfb\x7a\xf7\x68\xdb\x4a\xd7\x37\xf9"
+      "\x37\x40\xaa\xe8\x96\x90\x98\xe7", 24,
+      "\x83\xf6\x83\xbf\x7e\xd4\xd0\x4c\x86\xf0\xde\x2b\x9d\xc7\x5f\x6e"
+      "\x96\x1b\x48\xa2\x1c\x1a\x8c\x3c\x17\x22\x44\xd6\xb5\x3b\x43\xe1"
+      "\x70\xef\x09\x99\xa0\x2e\xd4\x62\x01\xa8\xe8\x90\x2d\x0c\xe5\xd9"
+      "\x29\x47\x5f\xa3\xf0\x7f\xa4\xa0\x26\x74\x4e\x97\xc9\x0e\x1f\x35"
+      "\x69\x1a\x5b\x59\xd1\xa2\xd4\xb5\xc4\xc9\x09\xb8\xa2\x36\xad\xde"
+      "\xed\x7c\xed\x45\x71\x86\x1c\xba\xca\x57\x86\x0f\xb6\x20\x9a\x3b"
+      "\x67\x8e\x0e\x6e\x8f\x7a\x02\x83\x9e\x2b\xbc\xd8\x7c\xe7\xa7\xce", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_224,
+      "\xf1\x91\x0f\xee\xd4\xdb\x6d\xd9\x2f\x21\xf4\x9d\x75\x7c\xdf\xaf"
+      "\x98\x76\x90\x13\xc5\xf4\x61\x19", 24,
+      "\xfe\x92\x3c\x4b\xeb\x59\xe1\x41\x36\x6d\xa3\x10", 12,
+      "\x97\x67\x1c\x24\x02\x0a\xbb\x2e\xc8\xcf\x69\x97\xd0\x77\x71\x20"
+      "\xdd\xd0\x97\xdf\x54\xa3\x0f\xb8", 24,
+      "\x68\x23\x01\x18\x8c\x68\x79\x9a\xec\x5b\x3b\x49\xd4\x4e\x10\x1f"
+      "\x82\x60\x29\x4f\x8c\x0b\x45\xc2", 24,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x85\xf3\x9f\x40\xb6\xc9\xbc\xc7\x70\x15\xf0\x89\x2d\xe0\xab\x96"
+      "\x11\x75\x6b\xb0\xde\xf8\x8e\x5c\x1a\x05\x56\x87\x8f\x67\xed\xa4"
+      "\xd9\x2e\x47\x9d\x9c\x40\xcc\x4a\x15\xdb\x50\xbb\xda\x72\xb8\x6d"
+      "\x55\x65\x7f\xa1\x52\x74\xe9\xca\xde\x36\x7a\xfa\x74\xcf\x99\x3c"
+      "\x92\x64\x40\xb5\xff\x40\xf4\x35\x05\xbe\x07\xd0\x0a\x23\xbc\x28"
+      "\x43\x1e\xa2\x01\x99\xc3\x66\xb4\x5e\xce\xe4\x4f\x1c\x79\x94\xd9"
+      "\x92\x90\xd4\x65\x68\xe8\x3a\x19\x30\x3d\xeb\xd1\x85\xfd\x93\xd2", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_224,
+      "\xce\xfb\x0f\x2b\xc3\x0f\x05\x5e\x63\x0a\x2f\x32\xd9\xc8\xe4\x79"
+      "\x1e\x9f\xcf\xd9\x4b\x44\xbf\x16", 24,
+      "\x68\xe5\xdf\x0f\x9b\x97\x1e\xbf\xdf\x59\xe0\xee", 12,
+      "\x7e\x54\xf4\x78\x71\xec\xa8\xe5\x1d\xab\x40\xda\x52\x45\x57\x77"
+      "\x3b\x04\x7a\x28\x19\xef\x7b\x2e", 24,
+      "\xdc\x94\xde\x60\x74\xf0\x54\xa4\x7d\xb3\x2b\x1f\x8d\x3d\xa9\x6b"
+      "\xfc\x9f\xdc\x6c\x06\x89\x91\x50", 24,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xa0\x40\xa6\xae\x96\xd4\xb7\x9f\xe1\x4d\x70\x6b\x07\x7e\x77\x20"
+      "\x7f\x61\xd7\xcf\x67\xfd\x3c\x02\x99\x04\xf7\x46\x2c\xb8\xc2\xac"
+      "\x01\x87\x14\xc3\xba\xcc\x84\x8f\x92\xd5\x4a\x64\xf1\xc5\xa2\xf3"
+      "\x8a\x61\x4d\x13\x65\x93\x90\x11\xca\xcc\xac\xe0\x7d\xef\xbe\x35"
+      "\x59\x42\xb8\x69\x0f\x64\x82\x36\x79\x34\x8d\x20\x9c\x88\x5b\xc0"
+      "\xc1\x89\x4d\xdb\x2c\xaa\x0f\x8a\xdd\xf2\x5e\x4a\x62\x8b\xed\x99"
+      "\x46\x33\xbc\xba\x28\x03\x9e\x1e\x15\x49\x5a\xf4\xca\x1e\xb5\x93", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_224,
+      "\xec\x3f\x1f\xd3\x8c\x77\x70\x18\x72\xff\x3f\x53\xec\xa8\xb2\xb2"
+      "\xfc\x9b\x4a\x65\x7f\xbf\xf9\xa4", 24,
+      "\x6c\x3e\xdd\xe8\x7b\x9a\xac\xd7\x72\xba\x5d\xc1", 12,
+      "\x8d\x05\x6b\x4d\x27\xb1\x9b\xdf\x46\xa6\xea\x2f\x99\x93\xfa\xf3"
+      "\x9c\x54\xe6\xf0\xcc\x08\xfd\xdf", 24,
+      "\x6a\xc0\xea\x88\xcd\x6d\x67\x5f\xe8\x24\xe2\x6c\x07\x51\x0a\x17"
+      "\x44\x38\x2f\x7a\xb2\xcd\xe2\x2a", 24,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xfd\x4d\xa4\x43\x55\x6f\x2d\xd4\x8f\x34\xd3\xdd\xf6\xd6\x66\x21"
+      "\x0e\x65\x00\x95\x70\x69\xda\xaf\x36\xd5\x3d\x2f\xe4\x02\x05\xd8"
+      "\xeb\x5c\xf6\x1d\x96\x7d\x95\x6e\x4c\x86\xbc\x41\x5a\x30\xb7\x25"
+      "\x11\x84\x15\x2e\x94\xb9\x17\xd7\xc4\x14\x5c\x1b\xb0\x1f\x34\x9c"
+      "\xc0\x39\xaf\xba\xcd\x84\x4c\x90\xe5\xa8\x79\xe7\xaf\x4f\x70\x32"
+      "\xb0\xce\x37\x52\x32\x70\x36\xc9\xe8\xe0\x00\x16\xf5\x5b\xfb\xa0"
+      "\x5c\x7a\xd3\x97\x8a\xd5\x87\xca\x0f\xbb\x7b\xc5\x9e\xcf\x75\x5f", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_224,
+      "\xc5\x35\x70\x5e\xd4\xb5\xc7\xef\xc7\x40\x07\x94\x67\x80\xb5\x49"
+      "\xc1\x4c\x30\x4c\x42\x4d\xe4\x50", 24,
+      "\xa7\x33\x4f\x57\x99\x3d\x5a\x75\x62\xa4\xfa\x14", 12,
+      "\x7b\x57\x24\x96\xd8\x08\xce\xd5\xbd\x9c\x50\x9c\x42\xf0\xdd\x45"
+      "\x1f\x86\x63\x63\x62\x7c\x92\x24", 24,
+      "\x45\x88\x8e\x99\x3b\x9a\x1b\xae\x5d\x93\x7c\x14\xaf\x50\xe3\xd6"
+      "\xbb\xf8\xe8\x20\x9c\xfd\x5e\x98", 24,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x30\xd4\x1d\x02\x14\x12\x3b\x46\x36\x47\x7d\xc3\x5f\xc9\xd8\x3c"
+      "\xff\x09\x91\x93\xb6\x10\xa9\x29\x1b\x21\x76\x82\x8f\x7b\x75\x0c"
+      "\xfc\x29\xff\x66\x11\x3f\xcf\xbc\x4c\x47\xd2\xd7\x27\x1b\x76\x9c"
+      "\x34\x23\xe7\x15\x76\xb4\x5b\x31\x48\x22\xe6\x3f\x55\xf2\x4b\x3f"
+      "\xfb\xe1\xce\xce\xc2\xfd\x1d\x95\xe5\x26\xdd\x76\x45\x6e\x56\x7c"
+      "\x76\x8e\xc7\x3e\x57\x61\x02\xca\x72\x4a\x5f\xb3\xc9\x9b\x33\x6a"
+      "\x02\xf7\xf2\xe2\x1d\x84\x12\x39\xcb\xe9\xc5\x86\x5c\xc1\x61\x00", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_224,
+      "\x6f\x24\x44\xe8\xce\x1a\x3c\x55\xc6\x7e\xc7\x7b\xde\x32\xc8\xa7"
+      "\xf7\x46\x2d\xe0\x03\x88\xb5\xee", 24,
+      "\xf0\xcc\xc0\xca\xbe\x8f\xe3\x11\x34\xd0\xb4\xd2", 12,
+      "\x50\xa0\x6b\xda\x4f\x6c\xb3\xac\x64\xe9\x18\x57\x11\x55\x3d\x59"
+      "\x26\xe8\x1f\xf6\xb7\x5c\xe0\x75", 24,
+      "\x7f\x63\x16\xfa\xd6\xe0\xbc\x05\x93\x6b\x99\xe0\xa0\xac\x68\xba"
+      "\x01\xe8\x17\x8c\xb0\xf1\x23\xdb", 24,
+      "\x8f\xda\x36\x9b\x13\xd2\xda\x79\x2b\x37\x52\xbe\x8f\x85\x25\x14"
+      "\x1b\xbc\xac\x0f\x90\x45\xcc\x38", 24,
+      "\x9e\x6c\x66\xf6\xe5\x85\x29\x31\xfe\x7f\x78\xb6\x7b\x2a\xda\x52"
+      "\x63\x32\xe1\x0f\x7d\x9b\x14\xab", 24,
+      "\x06\x01\x5d\xe7\xe4\x46\xe7\x5e\x11\x3c\x8d\xf4\x7e\x82\x84\xc5"
+      "\xcf\x33\xa2\x19\xa7\xcb\x78\x6f", 24,
+      "\xe5\x99\x64\xf0\xbe\x8e\x5f\x80\x64\xf2\xeb\xb3\xc8\xc2\xc7\x45"
+      "\xc8\xb5\xe3\x0e\x00\x76\x1c\x6b\x6b\xf4\x78\xe4\xaa\x56\xca\xcd"
+      "\x5a\x17\x1c\x69\x92\x57\x1e\x84\x0e\xc1\x22\xff\xa5\x22\x4c\x20"
+      "\xf1\xf6\x03\x0b\x5c\x7f\x44\x0b\xe3\xb0\xd7\xb3\xd1\xb4\xc5\x33"
+      "\xda\x76\x47\x69\x37\xac\x29\x60\xb5\x3f\x9d\xf6\x5f\xb6\x35\xb0"
+      "\x36\xa0\xbf\x3b\x54\x89\xf2\xdf\x4a\xf4\xf5\x8f\x90\xed\x0d\x4a"
+      "\x5e\x3e\x46\x83\x8c\xd5\x8a\xbd\xac\x97\xda\x3f\xb7\x35\x4b\xdc", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_224,
+      "\x84\xb2\x74\xd2\xe3\xd6\x25\xc4\xfd\x79\xb9\xa4\xad\x45\x6b\xd3"
+      "\xca\xe4\x0f\xe7\x40\x2a\xd1\xd1", 24,
+      "\x4c\x80\xf8\xf6\xef\x97\xda\xec\x6f\x1e\x76\xe5", 12,
+      "\xe3\x0f\x7f\xd7\x8b\xfd\xae\xdb\xfb\x3c\x3a\xb8\x5b\xcf\x65\x75"
+      "\x8d\x80\x06\x35\xdc\x83\xa8\x9b", 24,
+      "\x09\x54\x07\x37\x48\xd0\xfb\xa5\xbd\xbe\x06\x43\x35\x37\x62\x92"
+      "\x74\x91\x1b\xce\x63\xf3\xbc\x40", 24,
+      "\x28\x3d\x3e\xc9\x03\x14\x7f\xd3\x39\x56\x2f\x40\x84\x45\xe6\xa8"
+      "\xa9\x21\x77\x4c\x5a\x34\xd8\x50", 24,
+      "\x3c\x7b\x23\x5a\x65\xa5\xa7\xde\x26\x0a\x27\x20\xce\x0b\x81\x8b"
+      "\xf7\xe1\x85\x20\x0e\x00\xf6\x49", 24,
+      "\x9e\x77\xdf\x06\xa5\x8e\xe7\x9a\xcf\xc9\xad\x4d\x6e\x58\x90\x19"
+      "\x6b\x06\x0c\x95\x28\x71\xa0\x50", 24,
+      "\xcd\x7a\x97\x6d\xad\x39\xb7\xcd\xb4\x1c\x29\x10\x6a\xdc\x7c\x80"
+      "\x01\x62\xe9\x52\x8f\x51\xe9\x30\xe1\x72\xe0\xdb\xd6\x39\x25\xfe"
+      "\x6d\x01\x63\xe4\xdb\xfb\xdc\x15\xd2\x55\x3f\x4b\x7f\xd2\x15\x51"
+      "\x9c\x57\x3a\xf4\xbb\x98\xd8\x0f\x54\x21\x8a\x23\x64\x43\xff\xbc"
+      "\x6a\xd7\x00\xba\xcc\x63\x43\x53\x8d\xc5\x42\x67\x4b\x51\x4d\xa7"
+      "\x5e\x75\x16\xdc\x8b\xda\xb1\xb0\xff\x14\x94\x5b\x74\x25\x5c\xf7"
+      "\x7c\xdd\x30\xa1\x77\x9a\x35\x1d\xbb\xe1\x01\x9f\x17\x43\x5a\x8d", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_224,
+      "\xc5\x99\x48\x47\x88\x35\xf3\x45\x89\x72\xa0\x68\x1d\x20\x5b\x52"
+      "\x86\xcc\xd2\x74\xdc\x86\xe2\xb0", 24,
+      "\x36\x13\xdd\xf0\xee\xe5\x2f\x87\xa4\x0c\x1a\xff", 12,
+      "\xe4\xc5\xff\x7f\xa4\xd5\xcb\x8d\x93\x5a\x7e\x04\x7c\xcc\x9f\x1d"
+      "\x9b\xb6\xde\xb2\xab\xb2\x58\xd2", 24,
+      "\xeb\x8d\x1f\xa6\x67\x90\x85\x05\x48\xf8\x67\xab\x50\x8a\x9c\x87"
+      "\x08\xd3\x82\xc4\x69\x45\x3b\xad", 24,
+      "\x9f\xb5\x74\x96\xc8\x0e\xf7\xb3\x9e\x11\x68\xd3\x24\xe1\x21\xcb"
+      "\x05\x3f\x28\x21\x2b\x98\x78\xdb", 24,
+      "\x12\x5b\xc2\xc8\x02\x23\x3e\x70\xe3\x43\xc8\xf7\xe3\x14\x3c\x0a"
+      "\x27\xb3\x69\x1a\x96\xb8\xe3\x4b", 24,
+      "\xcf\x96\x05\x17\x3c\xd2\x06\xaf\x06\x2c\x9e\x9b\x00\x04\x13\xd9"
+      "\x3b\x40\x2c\x04\xea\x51\x97\x90", 24,
+      "\xde\x93\x2e\x36\x59\x6f\xe1\xc3\x21\x37\x29\xa5\xda\x56\xd4\x88"
+      "\x69\x4b\xff\x08\x95\x73\xfc\xd8\xfb\x26\xf7\xd1\xcb\x35\xd3\x5c"
+      "\xbc\x46\xe3\x00\x52\x35\x86\xb8\xde\x11\xcf\x41\x71\xa1\x9a\x4e"
+      "\x80\xf4\xaf\x2a\x64\xd5\x5d\x4d\xbb\xe7\x08\x79\xce\xb5\x34\xd4"
+      "\xa4\x16\x9e\x76\x9c\x77\x8f\x5a\x88\x92\x3f\x37\x53\x60\x74\x48"
+      "\xf6\x7e\xce\xc8\xca\x21\xca\x1b\x31\x0e\x8d\x7e\x69\x4a\x31\xf0"
+      "\xa2\xd7\x4e\x30\x9b\x08\x42\x52\x32\xe7\x48\x1f\x6f\x2d\x49\x43", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_224,
+      "\x91\xcb\x44\xa6\xb8\xe5\x02\xcb\x48\x82\x8b\x01\x6d\x94\x04\x11"
+      "\x43\x49\x1b\x32\xc5\xab\x70\xc5", 24,
+      "\x5e\x7e\x36\xd4\xb9\x3e\xf5\xcc\x5b\x69\x52\xd1", 12,
+      "\x20\x0e\xbe\x17\x80\xac\x7a\xc9\xe1\xd7\x79\xc3\x5f\x59\xa1\x67"
+      "\xc9\x39\x4f\x3d\xe0\x7e\x1d\x43", 24,
+      "\xcb\x8b\xfc\xa5\x40\x1c\x33\x0f\x5a\xcf\x65\x8b\x1c\x53\x51\xfa"
+      "\xb3\xea\x75\xf0\xed\x31\x28\x70", 24,
+      "\x28\x40\x45\x60\x7b\x00\xcf\x4e\xa7\x84\x1d\x94\x5f\xbb\x5e\xa5"
+      "\x24\x7e\xfc\x51\x03\x8f\x1b\xef", 24,
+      "\x28\xb9\x86\xd7\xf7\xd8\x6a\x8a\x16\xe0\x65\x13\x40\xd1\xc2\xce"
+      "\x2b\x4e\x39\x3f\xe0\xca\x6b\x84", 24,
+      "\xae\x1c\xb8\x33\xc4\x17\xda\x41\x48\x9e\x63\x84\x52\x30\xac\x3b"
+      "\x10\x0b\x18\x84\xde\x2e\x9a\x85", 24,
+      "\xf1\xa0\x7c\x5f\x5c\x7e\x96\xed\xb5\xf9\x7c\x94\x84\xd7\x68\x10"
+      "\xb2\x5c\xf2\xae\xe9\xf4\x45\xc7\x22\x90\x8f\x6b\xd1\x1a\x6c\x52"
+      "\x0f\xed\xce\x81\x35\x0e\xb4\xb9\x37\xdc\x0a\x79\xc0\x26\x95\xa4"
+      "\xd6\xc4\x11\x79\x9e\x21\x14\x53\x99\xfd\xd6\xf6\xb7\x28\xd4\xc0"
+      "\x6a\xe9\x8c\x7e\x29\xd0\xb7\xcf\xc7\xb8\x11\xbd\xa6\x54\x02\x63"
+      "\xf3\xe9\xb2\x4e\xc2\xd1\x3e\xe0\x1c\x0b\xbe\xe1\x80\x13\xc7\xd7"
+      "\xf9\x7e\x06\xbb\xb4\x1a\xf7\x69\x76\xb3\x75\xd1\x5a\xfb\xd2\xfe", 112,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_256,
+      "\xc6\xb4\x7c\x17\xbf\xd7\xbd\x81\x15\xc5\x83\x80\x55\xbd\xb9\x62"
+      "\x03\xbb\x4f\xae\xfd\x02\xc5\x7f\x9d\x37\x15\xd3\xd6\x55\x63\x44", 32,
+      "\x09\x75\xd0\x02\x4e\x50\xdc\x53\xc2\x90\x68\x22\x0f\xd1\x7c\xfe", 16,
+      "", 0,
+      "\x85\x51\xb2\xa0\xa3\x93\xc8\x42\x9e\xc0\x68\xca\xd5\xfd\xe9\xe7"
+      "\x5d\xdc\x8f\x8f\xf2\x6f\xea\xe2\x48\x36\xa0\x1f\xfd\x91\xd9\xa4", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x8b\x69\xe6\x09\xc3\x93\x3e\x9f\x17\xc2\x0b\x25\xab\x62\x17\x91"
+      "\x17\xc2\xc9\x59\xa0\xad\xf9\xbb\x8e\x9b\xe6\xee\xda\x06\x9d\xca"
+      "\xf8\x1c\x8f\x5a\xdf\x0e\x9a\x27\x9b\x0e\x22\xb3\x4f\xc2\x57\x87"
+      "\x26\xc4\x41\xea\xd2\xbe\x47\xc3\x07\xbe\x4b\xa4\xe2\x1d\x47\xa1"
+      "\x71\xcc\xef\x5c\x4a\x1f\x54\x57\xe6\xea\xb1\x14\xec\x67\xca\x06"
+      "\xef\x25\xc9\x6a\x9c\x2b\x6b\xf9\x49\x05\x36\x66\xc9\xcd\xcb\xeb"
+      "\x74\x5e\xf0\x0f\x32\x9f\xb0\x11\x8a\x6e\x51\xb0\xb6\x83\x7b\xa3"
+      "\x80\x74\x67\x4d\x0e\xd1\xca\xde\xdb\x08\x9b\x13\x5c\x80\xc1\x87", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_256,
+      "\x8a\xf8\x00\x23\x5f\xec\x71\x52\xf7\x48\x70\xd6\xd6\xd4\x9c\xe8"
+      "\x27\xaa\x89\xc1\xc0\x4a\x1d\x66\x08\xf6\x4f\xca\xe8\xd2\x89\xc7", 32,
+      "\x95\xe7\xa2\x1c\x75\x28\xa2\xd3\xbf\x63\x97\x21\x44\xc7\x9c\xf0", 16,
+      "", 0,
+      "\xb5\x1d\xc7\x19\x5a\x6d\x19\x0d\x81\xac\xe6\x44\x51\x9e\xe2\x54"
+      "\x1d\x1b\x89\xd3\xca\x0d\x2d\xc6\xbb\xd1\x29\x67\x8c\x85\xb5\x1a", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xeb\xbd\xd1\x6c\xf5\xe5\x11\x5f\xf1\x4b\xa5\x6f\xc0\x41\x56\xa8"
+      "\x21\x5e\xff\x7a\x9c\x3a\x90\xcc\x6d\x43\xf6\x39\x1e\x17\x42\x05"
+      "\x86\x53\xe2\x6b\xdc\xe4\x9c\x3e\x84\xd8\xe6\xb8\xfa\x5b\x19\xeb"
+      "\x62\x96\x4e\x37\x65\xdd\xc7\xaa\x4f\x0e\xe1\x45\xfc\x75\x28\x4e"
+      "\xc4\x22\xa9\x68\xc6\xfd\xe5\x44\x17\x84\xd6\x80\x89\xff\x88\xad"
+      "\x3a\xa4\xc4\x85\x07\xb9\x2b\x77\xe3\xb1\x67\xa3\xc6\x32\x96\x85"
+      "\x3f\xd8\xed\x16\x5b\x6b\x5e\x95\xdd\x97\x5e\x6c\x25\x01\x2f\x6c"
+      "\x07\x33\xc2\x54\xab\xdd\x98\x77\x2b\x65\x07\x97\x14\x40\xce\x06", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_256,
+      "\xd6\xf2\x52\xad\x24\x38\x93\x16\x48\xfa\xb6\x6b\xfe\x6e\x90\xf0"
+      "\x9b\xfb\x01\x8f\xf2\x92\xdf\x38\xaf\x9f\x08\x2f\x57\x5a\xa9\x3c", 32,
+      "\xa9\xa0\xd5\xe8\x51\x00\x52\x25\x66\x77\x5a\x6a\x7b\x8e\xe4\x9a", 16,
+      "", 0,
+      "\x0d\xab\xbe\x51\x37\x39\xab\x34\x7e\x40\x7c\x67\xff\x9f\x92\x79"
+      "\xe4\x39\x18\xb9\xe8\x6b\x2b\xf9\xd1\xa3\x76\x17\x3a\xa3\xcd\xea", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x2b\x47\x77\xcf\xbf\x1d\xe2\x21\x49\xed\x63\x6f\x4c\x3f\xf3\x3d"
+      "\x78\xba\x6a\x6f\xfe\x81\xa8\x5f\xa4\x8a\x3e\x10\xe6\x6f\xe3\x41"
+      "\x95\xb4\x13\x79\xe6\x9a\xed\xa7\xbb\x1e\x6d\x32\xa5\x1e\xb6\x66"
+      "\x3e\x77\xa0\xec\x55\x21\x50\x08\x8d\x5a\x2e\x06\xc9\xe8\x26\x82"
+      "\x8d\x1e\x3d\xf9\x2a\xd6\x73\xb9\xa7\x4d\x4a\xb3\xb6\x16\x80\xcd"
+      "\x06\xb3\xc5\x63\x22\x17\xe9\x06\xc6\x01\x53\x1c\xc1\x53\x2c\xb8"
+      "\x9f\xb4\xf4\x60\xf6\x56\x4d\x30\x58\x2e\xab\xa0\xaf\x99\xb4\xa8"
+      "\x17\x60\xe7\x38\xc6\xcb\xed\x8b\x74\xb2\x31\xae\xff\x8b\x4d\x2a", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_256,
+      "\x55\x69\x78\x45\x50\xef\xcb\xfd\xc9\x4f\x12\x72\xfa\x68\x48\xcb"
+      "\xd1\x76\x7c\x0b\xbb\xd0\x81\xec\xa3\x6d\x2e\xf4\x92\x7e\x75\xdc", 32,
+      "\x30\x64\xa0\xfa\x87\x76\xbf\x66\x8f\x5b\xde\x0d\x0a\x3a\x6d\xbe", 16,
+      "", 0,
+      "\xe3\xe0\xcd\x05\xe5\x36\xac\x60\x8c\x90\x7e\xde\xe2\xc3\xb7\xba"
+      "\x8e\xf0\x75\xde\xa5\xb6\xe1\x41\x14\x5d\x3e\x26\x33\x76\x18\xea", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xc4\x19\xfb\x72\xc9\xea\x37\xe7\x47\xc2\x02\xf5\x33\x1f\x23\xc6"
+      "\x7a\x16\xea\xea\xd1\x62\x18\x0d\x8d\x3e\x1f\x8c\xed\xc4\xbc\x56"
+      "\x77\x61\xc6\x31\x5a\x90\xe9\x31\xbe\xc0\xb5\x4c\xd4\xd9\x53\x47"
+      "\xf3\x90\xa8\xbf\x25\xf9\x67\x2b\x3d\x05\x56\xb0\x29\x50\x4d\x35"
+      "\xbd\x91\x21\x3a\x01\x62\xa0\xd7\xf1\xcd\x0c\x41\x5a\x3d\x66\x79"
+      "\x22\xa5\x4b\xff\x77\xc7\x4e\x83\xd7\x83\xd7\xa1\xc6\xcd\xc5\xed"
+      "\xd5\x95\x27\xe2\x04\x22\x1e\x98\xfb\xbc\xcb\x07\x9d\x18\x97\x0b"
+      "\xbc\xe5\xb6\x05\x28\xe9\x2d\x2f\x8f\x6f\xd7\x9a\x79\x44\x23\x46", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_256,
+      "\x92\x3e\x33\xcd\x74\x64\x37\xc0\x20\x68\xc8\x86\x7a\xd8\xfa\xb1"
+      "\x76\x95\xb3\x3b\xac\x8b\xdd\xcf\x31\x1d\x6b\xca\x8a\x55\xea\x28", 32,
+      "\xa6\x4a\xb5\x2f\x82\x58\xeb\xd5\x00\xd8\xf4\x81\x51\x1e\xd1\x97", 16,
+      "", 0,
+      "\xb7\x6f\xd1\x3c\x38\x7a\xb6\xd7\xf9\xe7\xfc\xe7\xa0\x98\x67\x5f"
+      "\x2d\xcd\x05\xae\x86\x2d\xf5\x91\x78\x26\x80\xd2\x5f\x1e\xcc\x6e", 32,
+      "\x48\x3d\xfd\x9f\xb6\xa9\xe1\x38\x73\xf6\xeb\x8b\x36\x16\xf5\x8d"
+      "\x06\x5c\x8f\x0e\xd0\x9b\xd4\x24\xf4\x43\x51\x51\xaa\xb1\x36\x47", 32,
+      "\xff\xb6\xb9\x2e\x01\x8e\x1b\x46\x5b\xb4\x72\x78\x5d\xea\x76\x4e"
+      "\x75\xc5\x2a\xb9\x40\xe1\x4d\x87\xf7\x5a\x76\xdc\xe4\x58\xa5\xa5", 32,
+      "\xa4\x22\xdc\xe3\x89\x8d\x7d\x6c\x41\x5d\x39\x0b\xea\x21\x0d\x3b"
+      "\xac\x6e\x4d\xda\xdd\x3b\x6c\xb2\x39\x8c\x5a\x59\xcd\xb7\x17\x79", 32,
+      "\xf8\xb4\xc6\x29\x42\x81\xe8\x92\x93\xed\x86\xe1\x9f\x16\x34\xcf"
+      "\xf2\xe9\x45\x16\x7c\x3d\x62\x1b\x77\x66\xad\x6c\xd0\x4e\x48\xfa"
+      "\x13\xc1\x19\xe0\x60\xbd\x49\x2f\x92\x37\xed\x28\x69\xf4\x7f\x65"
+      "\x69\x19\xc9\x93\x7e\xcb\x0d\xfd\xcc\x72\xf8\xf5\x37\xdf\x73\x33"
+      "\x9d\x2a\xcc\x81\x22\xe6\x95\x7f\x19\xfa\x84\x91\xeb\x66\x74\xe8"
+      "\xb7\x7d\x36\xa3\x65\xf7\xee\x3e\x33\x0a\x0e\x70\x4e\x92\x6b\x9f"
+      "\x17\xb3\xdb\x14\x1d\x04\x20\xab\xdc\xca\x7d\xda\x0c\xb9\x63\xad"
+      "\xa0\x90\xaa\xd7\xcb\x99\x22\x34\x85\xe7\xe5\x5c\xe8\xd3\x1e\xf6", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_256,
+      "\xd3\x83\xd6\x9c\xfc\xc6\x61\x17\xe5\x0f\xff\x93\x24\xcd\x67\x70"
+      "\x7f\x00\x92\xac\x9c\xca\xb6\x0a\x5f\xb6\xf1\xdd\x34\x6e\x2a\xed", 32,
+      "\x23\x02\xce\x08\x17\x3f\x54\xef\x3c\x71\xf0\x9a\xe8\xb0\x88\x38", 16,
+      "", 0,
+      "\xb9\x96\x94\x9e\x74\x70\x97\x46\xa8\x62\x5e\xfe\xca\x59\x9e\xf4"
+      "\xf4\x77\x1f\xa0\xcd\x3f\xb8\xf3\xc2\xc7\x5f\x76\x19\xb0\x84\xd2", 32,
+      "\xb2\x2a\xcb\xb9\xca\x24\xec\x76\xf7\xd5\x1e\xa7\x39\x0e\x76\x68"
+      "\xeb\x54\x83\xef\xf8\x95\x4f\x45\x62\x05\xa3\x45\x55\x04\x5c\x19", 32,
+      "\xbf\xc2\xb5\x2d\xd5\x55\x98\x96\xc5\x70\x10\x26\x70\x1e\x2b\x42"
+      "\x2f\x70\x99\x0a\xfd\xab\x31\xc2\x3c\x6d\x6e\x8c\x11\x3a\xf8\x83", 32,
+      "\xba\x77\xe4\xd9\xd8\xf0\x9e\xf2\xcd\x83\xab\x44\x15\xfb\x30\xc1"
+      "\xed\xf0\x8f\xd9\xc1\xa9\x62\xa6\x0d\x00\xad\x5c\xdf\x2a\x15\x3a", 32,
+      "\x59\xd9\xde\xd8\xce\x41\xfa\xbc\xbf\x92\x8b\x99\x13\x99\xdf\xe9"
+      "\xe4\xc1\x44\x1b\x51\x12\x45\x1c\x72\xd1\x6d\x88\xb6\x87\x3d\x4c"
+      "\xab\xf9\x02\x74\xf7\x2d\xdd\x53\xba\xda\x83\x82\x8e\x2a\xfd\x9d"
+      "\xe9\xd6\xd9\x29\xef\x88\x80\x56\x17\xb5\xd8\xf3\x32\xd6\xf7\xd5"
+      "\x28\x06\xe9\xe1\x57\xd5\x2d\xb8\x7a\x33\x7d\xac\x49\x67\x4f\x07"
+      "\xe2\x5e\xab\x7c\xee\x19\xe1\xad\xa6\x05\xa2\x08\x31\x1e\x6f\xc5"
+      "\xca\xdd\xf4\x0b\xad\xe3\x0d\x98\x4c\xb8\xfe\x16\xf9\x2e\x40\x61"
+      "\xc2\x7f\xbc\x4c\xf8\x9f\x5f\x37\x4e\xdc\x23\x65\x65\x10\xc5\xef", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_256,
+      "\x6e\x4b\xfb\x5e\x26\xa8\xa6\xf6\x66\x6e\xb3\xa9\x99\x2d\x39\x3a"
+      "\x59\x57\xf6\x43\xe3\xb9\x84\x02\x0a\xaa\x14\x90\x1e\xef\x7f\x61", 32,
+      "\xde\x8a\xd6\xed\x06\x01\x71\x57\x24\x35\x59\x27\x8b\xc7\x42\x57", 16,
+      "", 0,
+      "\xdd\x66\xd0\x48\xe6\x7f\x87\xa6\x8c\xd9\xaf\x0b\xc3\x37\x05\x14"
+      "\x86\xf0\x84\x5f\x73\x5a\xf6\xc6\x75\xec\xc3\x8a\xef\x88\xa1\x0b", 32,
+      "\x8f\xfa\x05\x1c\xfc\x21\x94\x0c\x7e\xfc\x1d\x5a\x95\x01\xdd\xd8"
+      "\xbe\xb2\x46\xb0\x47\x37\x99\x56\xa6\xc4\x9c\x61\x47\x8c\x4d\x91", 32,
+      "\x06\x43\x74\xe8\xc0\x38\xd7\x5d\xb0\x78\xee\x58\x7c\xe7\xac\x63"
+      "\x3b\xa2\x2a\x4c\xc5\x06\xf9\xeb\x37\x54\x0c\xfc\xbe\xd6\x22\x4f", 32,
+      "\x4f\xac\xc8\x59\xb5\x08\x89\xf4\x27\xfd\x65\x77\x0a\xf3\xe5\x23"
+      "\x17\x42\xf2\x79\x37\xee\x71\x26\x9d\x5c\x0f\x4e\x2b\xae\x55\x90", 32,
+      "\xc6\x7e\xd0\x55\x7e\x94\xe5\x85\x2d\x63\x90\x31\x2e\x34\xe3\x2b"
+      "\x83\x5b\xe1\x9b\xd1\xd4\x1a\xb6\xcf\x9d\xdc\x5a\x27\xa2\xf2\xb8"
+      "\xf3\x03\x86\xb2\x21\xb1\xdf\x48\x27\x14\x5b\x00\x9e\xc0\x7f\x08"
+      "\x50\xf4\xeb\x5b\xb2\x38\x51\x49\xdb\x59\x50\xbc\xbf\xf4\x94\x4d"
+      "\xd4\x31\xd1\x1b\xd4\xf6\x29\x25\x66\x38\x86\x89\xc4\xdc\xff\xcf"
+      "\x46\x35\xf3\x81\x66\xf6\x2f\xcd\xef\xf6\x33\x25\x8f\x2e\x13\x9c"
+      "\xa8\xd5\x5b\x86\x43\x8b\x00\x07\x2d\x7c\x6e\x4e\xa2\x5a\xf3\x97"
+      "\x5b\xd7\xe6\x18\xbd\xc2\x43\x80\x2a\x9e\xa4\xff\xe8\x43\xd3\x43", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_256,
+      "\x92\x44\x07\xd4\xd5\x0c\x4a\x02\x23\x6e\x48\x25\xba\x24\x02\xf2"
+      "\x2a\x24\x6b\x72\x9c\x9b\x78\x5e\x92\x5e\xdf\x07\xc1\x8a\x54\x6f", 32,
+      "\x76\x87\x39\xb6\x8b\x31\x71\xb3\xe0\x57\xbf\xdc\x06\x41\x5a\xb5", 16,
+      "", 0,
+      "\x55\x8e\xf8\x52\x60\x8c\xd4\xb9\x96\x37\xe5\x32\x3d\xc3\x83\xa9"
+      "\x41\xb9\xb6\x0d\x66\xac\xd7\x39\xce\xc6\x69\xdd\x79\x67\x27\x31", 32,
+      "\xd1\x68\xad\x00\xc7\x1f\x88\x28\x3c\x3f\xe5\x99\x66\x8e\x43\x22"
+      "\x14\x4e\xe0\x18\x84\x00\xe6\x2a\x69\xdf\xad\xb0\x2f\xb7\x8b\x03", 32,
+      "\xc4\xef\x31\xae\xa7\x92\x39\xf0\x95\x25\x3e\xf9\xb5\x1f\x1c\xe1"
+      "\xb6\x0f\xd9\x2f\xf7\x2c\x61\xb4\xa4\x2d\x21\x8d\x12\x10\xdb\x03", 32,
+      "\x4a\x31\xc9\x93\x17\x7f\xab\x33\x53\x9a\xc4\x87\x22\xa1\x6c\x08"
+      "\x3e\xf5\x3b\x53\x62\x97\xfb\x36\x97\x9b\xe9\xea\x0d\x6b\xcf\x87", 32,
+      "\xe5\xe1\xe3\xd3\xc7\xd7\xcb\x13\xae\x10\x58\xfd\xb2\x7a\x31\x1e"
+      "\x36\x42\x6e\x55\x63\x14\x9a\xde\x77\xac\xf5\x9f\xa2\x1a\x15\x57"
+      "\x30\xb5\x27\xa8\xb7\x62\xb9\xf8\x34\xbb\xf3\x39\x62\x1e\x65\x86"
+      "\x01\x8a\x61\x75\x7d\xd7\xf1\xd8\xe9\x39\x3b\x46\x59\x48\x60\x2e"
+      "\x5c\x2f\xe4\x9c\xc6\x6e\x64\x72\x86\xd1\x19\xbf\x4c\x8a\x76\xce"
+      "\xfc\x9f\xc9\xc8\x31\xa0\x9b\xd1\x76\x60\x95\xfb\xf2\xfe\x1d\x5f"
+      "\x47\x92\xbd\x67\x4d\x53\xb4\xdf\x01\x16\x60\x77\xb7\x76\x88\xc4"
+      "\x55\xad\xcf\x21\x36\xf1\x36\xa2\x98\x75\xc3\xeb\x00\x80\xe2\xdc", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_256,
+      "\x21\x1b\x7d\xd4\x7b\x60\xd7\xcc\xe5\x38\x72\x74\x1f\x6e\xf6\x2c"
+      "\x4e\x0f\x6d\x01\x27\x33\xce\x35\x6c\xd4\x0e\x79\xa7\xa7\x69\x5e", 32,
+      "\x64\x7b\x76\xa7\x3e\x84\xc0\x90\x10\xe0\x26\x98\x73\x15\x1c\x2f", 16,
+      "\xb2\x94\x3d\x46\x8e\x42\x05\x5b\x13\xd0\xcd\xb2\x9e\xef\x3c\x59"
+      "\xaa\xe5\x27\x74\xb0\xe5\x98\xe3\xb4\x84\x6a\xa6\x90\xe3\x81\x5e", 32,
+      "\x5e\x63\xcc\x8b\x38\x18\xf5\x86\x5e\x8b\xd8\x7b\xca\xa3\x18\xb2"
+      "\x47\x36\xf6\xba\xf7\x03\x42\xe4\x49\x93\x82\xb0\xb3\x7f\x54\xde", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x22\xcd\x0e\x5a\x41\xec\x85\x09\xac\xcd\x87\x72\x74\xd4\xdb\xe1"
+      "\x42\x9a\x44\xdb\xc8\xfa\x1e\xb8\x2e\x64\x09\xc4\x73\x0d\x55\x44"
+      "\x25\x2e\x3d\x34\xe2\xea\x77\xe9\x32\x6b\xa5\xb2\xe9\xd3\xa4\x2f"
+      "\xef\x95\xb1\xe4\x8d\x55\xed\x51\x61\xc6\x22\x7e\x71\x92\xa4\x26"
+      "\x28\x77\xa6\x78\xcf\x67\x08\xc9\x43\xde\x6b\x8d\x52\xad\x57\x6e"
+      "\x99\x4e\x0e\x41\x6b\xe3\x3a\x3c\xe2\xf1\x70\x12\x63\xc2\x5f\xa6"
+      "\x6c\xdc\x54\x63\x8a\x09\x85\x3f\xd1\xaf\x81\xfa\xc8\x5c\x90\x72"
+      "\x62\xb4\x3b\x6d\xee\x6f\x1e\x2c\x81\x96\x83\x30\x75\x61\x07\xd1", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_256,
+      "\xe0\x24\x1c\xff\x9f\x01\xb5\xcc\xae\xe9\x2a\x80\x9d\xa9\xc6\x6e"
+      "\x31\xa3\x6f\x21\xaf\xd8\x07\xb5\x85\xb5\x95\x67\x20\x9f\x6c\xc9", 32,
+      "\xa3\x1b\x5a\x79\xba\x70\x3f\x3d\xef\xb3\x83\x8a\xdf\x4d\xa4\x03", 16,
+      "\x2d\x1c\x1a\x43\x98\xa3\x98\xef\x89\x06\xb1\xab\x57\x5d\xa5\xfd"
+      "\x3f\x5b\x69\xaa\xb0\x8e\xaf\x6a\x5a\xd9\xc0\x2f\x79\xa8\xf7\x3c", 32,
+      "\xf1\x46\x95\x1d\xe8\xf8\x59\x08\x8c\xd1\xe3\xaf\xae\x3d\xfa\x69"
+      "\x7a\x31\x74\xfd\x54\x88\x58\x3c\xed\xa1\x8a\x10\x02\x92\xce\x79", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\xa3\xc2\x78\x83\x52\x86\x56\x51\x67\xe8\xaa\x44\xb7\x3c\x3e\x9b"
+      "\xc5\x44\xd7\x29\xed\xad\xde\xd3\xb4\x9e\xac\x3e\x4c\xd4\xc8\x50"
+      "\x2f\x4a\xda\x36\xf7\xa1\x52\xa9\xcc\x2c\x3f\x73\x96\xf2\x6d\x3b"
+      "\xc3\x63\xaf\x34\x3d\xdd\x63\xb6\x23\x22\x10\xd3\xf6\x35\x91\x4a"
+      "\xc5\xea\x4e\x5c\x88\x31\x0c\x77\x63\x2c\xd7\x1f\xa7\xcb\x1a\x00"
+      "\x3a\x19\x62\x8f\xe6\x10\x87\xc8\x6f\x53\xe1\xc9\x2a\x1f\x6b\xab"
+      "\xc6\xcb\x95\x50\xec\x17\x94\xd7\xa0\xf7\x70\x02\x5d\xbe\x22\x2f"
+      "\xda\xad\x86\xec\x24\x34\x1f\x60\x50\x8e\x65\x07\x45\x74\x9d\xd2", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_256,
+      "\xc8\x12\x68\x23\x97\x5d\x65\x55\x2d\x7c\x23\x7d\xcf\x05\x28\x4e"
+      "\x02\x8a\x28\x89\x25\x6e\x98\x1c\xfd\xbb\xb5\x18\xf6\x8d\x4c\x70", 32,
+      "\xa1\xb0\x1e\xfe\xe3\xf6\x10\x39\x25\xa8\x52\x6e\xc7\x94\x7b\xa5", 16,
+      "\xfb\x61\xa7\x99\x22\xf7\x10\x21\xfc\x11\x5c\xfc\xe5\xcb\xf6\x72"
+      "\x4d\x65\x55\x5b\x19\x55\x2e\xe0\xeb\x1d\x8b\xca\x23\xf7\xa0\xeb", 32,
+      "\xc9\xc6\x48\x01\xcd\xca\xcb\x8f\xb9\x29\x8b\xc1\x8b\x04\x91\x42"
+      "\xaf\x28\x8c\xf3\x31\x4c\xbc\x35\x7e\xf2\x8d\x69\x6f\xe9\x30\xc8", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x55\xaf\x56\xc5\xae\x81\xa9\x1c\x7b\xb3\x53\x15\x55\xcd\xed\xab"
+      "\x15\x3d\x1c\xa1\x3f\x6a\x56\x03\xed\x3e\x1f\xfb\xc1\xd1\xef\x4f"
+      "\x9f\xaf\x82\x41\x8c\x0a\xc4\x48\xdd\xff\x1f\x32\x57\xf9\xfb\xfb"
+      "\xaf\x0f\x5d\xe9\xfa\x76\x59\x13\xdb\xcd\xf9\xeb\xd0\xf0\xc4\x2b"
+      "\x23\x07\x9b\xc5\x8d\x5e\xc8\x12\x71\x05\xff\x90\xd7\x99\xba\x59"
+      "\x17\x95\xb7\xca\xbf\x1c\xae\xb6\xc8\xbd\x3c\xbe\x9d\xab\x80\x77"
+      "\x5f\x3d\x59\x87\x7d\x11\x88\x43\xca\x8d\x7e\x3e\xd6\x39\x65\xd7"
+      "\xcd\xeb\xe2\xc6\x50\x4d\xc6\x80\x1f\xee\xf8\x06\x33\x73\x9b\x22", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_256,
+      "\xde\x8a\x16\x88\xb1\x9c\x5c\xd6\x2f\xb6\xed\x50\x9a\xff\x98\xca"
+      "\x74\x24\x5b\x83\x13\x3b\xdb\x36\xa4\xa2\x19\xd0\x1e\x9a\xb2\x38", 32,
+      "\xcb\xea\x5f\x5a\x28\x56\x93\x07\x85\x89\xe2\x6c\x6e\xb9\x96\xa8", 16,
+      "\x0a\x08\x74\xe5\xe1\xee\x63\x69\x55\xdc\xb6\x7b\x85\x66\x7c\xf0"
+      "\x3c\x15\x8b\x32\x36\x60\x28\xc3\x0c\xcd\xe7\x52\x21\x28\x84\x59", 32,
+      "\x2c\xdf\x2a\x0a\x4e\xa5\x77\x78\xb3\x30\x12\xc2\x84\x54\x3d\x28"
+      "\x64\x89\x5b\x32\x37\x7c\x9d\xd4\x62\xdb\x18\xa3\xdf\x55\xa2\x41", 32,
+      "", 0,
+      "", 0,
+      "", 0,
+      "\x51\xdd\xba\x39\xe7\x1c\x48\x7e\x8b\x53\x15\x47\xc6\x56\x3c\x84"
+      "\x49\x8a\xa8\xdd\xe1\xcc\x0b\x0a\x57\x43\x95\x95\x39\x71\x96\xd4"
+      "\xea\xb7\xbc\x19\x39\x43\xc8\x94\x3d\x2b\xb3\xd1\x23\xb9\xed\xe1"
+      "\xaa\xe6\xd4\x34\x11\xf4\xe7\x0a\x2b\xd9\x6f\x2d\x19\xa6\x5e\x42"
+      "\x19\xdf\x68\x42\xf1\x0d\x30\xcf\xfd\x41\x3f\xc8\x70\xcb\xdf\x9a"
+      "\x06\x0f\x8f\x03\x75\xe2\x04\xca\x18\xbf\x22\x32\x23\x29\xa3\x11"
+      "\xfa\x96\xc4\xe4\x2e\x73\xa5\x22\xb8\x0b\x04\xd8\x7b\xfd\xc7\xb0"
+      "\x02\x43\x70\xd6\x47\x1b\x4e\xc8\x45\xb1\x70\xc9\x62\x3b\x64\xc4", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_256,
+      "\x28\x13\x60\xb5\xdf\x8e\x88\x90\x84\xb7\x10\xe6\x95\x0c\x8f\x21"
+      "\x71\x22\x0e\x70\x5f\x00\xaf\xc7\x27\x98\x3d\x65\x92\x72\x33\x56", 32,
+      "\x68\xc4\x5a\x4e\x30\x0e\xda\xd1\xd4\xa3\x57\xe1\xb8\x52\x38\xc0", 16,
+      "\x5f\x71\x0f\x28\x28\xbd\x19\x7a\x16\xec\xed\x20\x7e\xbb\x96\xa7"
+      "\x30\x36\xda\xab\xdb\x4e\x4f\xda\x8e\xe5\xc3\x5c\xcc\x6f\x4b\xd2", 32,
+      "\x8a\xe1\x03\xa2\xc3\x81\x9d\xae\xda\xbf\x46\xbe\xcc\x29\x82\x17"
+      "\xa0\xef\x4f\xd5\xff\xde\x21\x59\xf8\xf5\xc5\x25\xde\xb9\x78\xb4", 32,
+      "\x34\x2f\xa9\x2d\x2e\xf9\x89\xbc\x31\x1f\x59\x81\xbb\x21\x8e\xd1"
+      "\x0e\xa3\xe9\x3f\x1a\xe0\xb2\xc6\x9e\x1f\x8f\xa6\xf8\x44\x95\x42", 32,
+      "\xcc\xb7\xb0\x12\xa3\x44\x33\x66\xad\xc5\x7b\x14\x8e\x6e\xfa\xc1"
+      "\x2f\x30\x0d\x4b\xef\x1b\xb1\x3f\x67\xc1\x77\xf6\xed\x1d\x63\x82", 32,
+      "\xdd\xa9\x0b\x7e\x96\x65\xab\xc3\x7a\x92\x62\x29\x71\x61\x8a\xe1"
+      "\xed\xfe\xd0\x29\x0b\x64\x51\x55\x3d\xce\x77\x88\x93\xee\xb5\x5e", 32,
+      "\xa1\x3f\x32\xee\xe6\xec\xd5\xc7\x5c\xec\x62\xae\x85\xf0\x9a\xfb"
+      "\xb0\x3a\x17\x27\x30\x9a\xc0\x70\xe5\xd7\xa9\x61\x2d\xc3\x2c\x18"
+      "\xd4\xed\x3c\xbf\x3d\x3e\x8a\x4c\x85\x11\x19\xa3\xf5\xde\x96\x07"
+      "\x2c\x90\x7b\x25\x09\xda\xb4\x0e\x7f\xa2\xf1\xeb\x96\xc4\xe0\x58"
+      "\x49\xf3\x90\xbc\xd7\xd4\x3c\x7d\x15\xa0\xe0\xdc\xcd\x56\x61\x24"
+      "\x28\x28\xe8\x4e\xbb\xd8\x34\x28\xd7\x1c\xc1\x4a\xbe\x53\x2b\x82"
+      "\x40\x84\x92\x52\x0f\xf1\x95\x60\xc9\x1c\x52\x88\xf8\x2b\x62\x1f"
+      "\x58\xea\x7f\x2d\xae\xee\xbc\x84\x20\x0c\x16\xa6\xa6\x06\x9f\x50", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_256,
+      "\xa6\xe8\xa9\x2d\xc1\xda\x53\x7d\x78\xfa\x04\xd1\x28\x5c\xd0\xe4"
+      "\x5a\x69\x59\xc3\x78\x1b\xc1\x46\x17\x50\x31\xf9\xa4\xcc\xad\x14", 32,
+      "\x0a\x02\xf0\x39\x9b\xaa\x1b\xa3\x6c\xc5\xc4\x2b\xb1\x29\xfe\x15", 16,
+      "\x91\x72\xa3\x83\x73\x78\xc0\xd6\x01\x20\x8c\xa0\x19\xaa\x53\xb8"
+      "\x08\x0a\x71\xbe\x07\x98\xcb\xae\xf7\x47\x74\xf5\xd6\x4a\xf7\xf5", 32,
+      "\x06\xe6\xfc\x43\x33\xca\xbb\xbf\xac\x5d\xac\x4a\xa0\x51\x1e\x57"
+      "\x01\x4b\x27\xc7\xa6\x84\xad\xd5\xd1\x4d\xd0\x0b\x0a\xd8\x30\x41", 32,
+      "\x81\xae\x14\xb4\xee\x53\x47\xe8\x06\x34\xa9\xa8\x14\xbb\x4b\x19"
+      "\x42\x49\x32\xa6\x52\x19\x39\x37\xcf\x83\x00\x6a\x7b\xc8\x34\xe7", 32,
+      "\x4d\x06\xfe\x8c\x46\xd2\x57\x89\x56\xa2\x2e\x30\x00\x2b\x7b\xe7"
+      "\x18\x83\x1c\xd8\x2a\x58\x67\xa8\xb4\x9f\xeb\x41\xf5\x92\xa1\x63", 32,
+      "\x44\x2a\xd4\x32\x02\x5c\x0d\xaa\x65\x29\x09\xf9\x5d\x4b\xba\x55"
+      "\xc7\x8d\x3f\x6f\x9a\x3b\x24\x5f\xf8\x45\xd4\x26\x87\x7d\xb7\x4d", 32,
+      "\x22\x6b\x3c\xc6\x27\xed\x03\x75\xb1\xda\x98\x9f\xd4\x23\x14\xab"
+      "\x26\x9b\xb3\xd6\xcd\xc4\x6f\xfc\x3c\xbd\x66\xc5\xe4\xf5\xe9\xc6"
+      "\xa1\xf5\x59\x60\x13\x28\x68\x0b\xcc\xd1\xca\xb7\xe8\xd5\x28\x0a"
+      "\xc7\x72\xfc\x9e\x69\x72\xf9\x0b\xf7\x5f\x29\xa5\xf4\x8b\x6b\xcf"
+      "\x8e\xf1\x9b\x71\xaf\x1c\x39\xb4\x1b\x24\x6f\xac\x2b\xbd\x67\xa0"
+      "\xba\xf7\x81\xe7\x6f\x99\x79\x8f\x91\x7b\x28\xa8\x41\xae\xe0\xa6"
+      "\xcf\xed\x49\x93\x02\x30\xa1\x84\x66\x81\xec\x8c\xc1\x04\x7d\x43"
+      "\xed\xb1\x5a\xac\x94\x92\x88\x64\xd8\x2e\xf4\x3d\x7c\x90\x97\x86", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_256,
+      "\xc1\x89\x0e\x2b\x93\x03\x88\x7c\x44\x6a\xcd\x6b\x6c\xdc\x3c\x16"
+      "\xd7\x61\x2a\x23\x03\xad\x86\x71\x58\x38\x10\x55\x9f\x43\x02\x8f", 32,
+      "\xb7\x02\xca\xaf\x11\xbd\x9e\x32\xe2\xa3\xcb\xf0\x22\x07\xb1\xde", 16,
+      "\x65\xc0\xfd\x2a\x43\x6b\x17\x8a\x11\x6c\x55\x29\xa9\xc4\xad\x8d"
+      "\xe0\xa4\xe4\x84\xbd\x24\x78\x21\x8b\xa5\x0f\xc5\x3a\x37\xf5\xbf", 32,
+      "\xa0\xd4\xfa\xc0\x89\x81\xce\x7a\x1a\x8f\x1c\x7e\x00\xb3\x88\xf8"
+      "\xb1\x47\x43\x3f\x55\x03\xc9\x68\x85\xc8\xf9\xab\x70\x04\xe4\x7d", 32,
+      "\x99\xf9\xab\x03\x51\xe7\xc8\x3e\x2a\xbb\xc3\x9c\xb1\xc7\xe8\x37"
+      "\xe6\x9f\xc0\x10\xf1\x2d\x2b\xb7\xcc\x9b\x86\x72\xc0\x5a\x56\xf0", 32,
+      "\x44\xaa\x7c\x63\x45\x40\xb3\x72\x15\xa7\xc6\xfa\x5a\x74\xac\x13"
+      "\xd2\xa4\xc0\x57\x22\x70\x2c\x4b\x4b\x38\xdf\xfc\x6f\xf8\x5a\xe4", 32,
+      "\xfe\x95\x7d\x1e\x1a\x58\xcc\x36\x98\x64\x5b\x28\xa5\x8c\x85\xe9"
+      "\xda\xe1\x44\x96\xcf\xd2\x56\xd1\x1b\x17\x3a\x2d\xf8\xbd\xc2\x0c", 32,
+      "\xe8\x7c\xa3\x9e\xe5\xa8\x2b\xba\x8c\xc2\x3c\x68\xde\x48\x42\x54"
+      "\x73\x19\xb5\x55\xec\x6e\x0a\x69\x79\x56\xdb\x0b\x46\x8b\xd9\xb0"
+      "\xce\x3c\x8c\x91\xb2\x78\xc2\x78\x8e\xdf\x93\x5e\x87\x6a\x0d\x37"
+      "\x40\x26\xd6\xd5\xc7\x05\x6f\x62\xf7\xd6\xad\xf1\x7b\xb0\xb9\xe3"
+      "\x4d\x4b\x97\x38\x5d\xf3\xd6\x62\xb7\x93\x9d\xe8\x8e\xb7\x07\xba"
+      "\xb7\x0f\x9d\xa1\x35\x76\x9b\xdd\x0e\xbf\x1f\x0b\xdb\x96\x8d\x31"
+      "\x02\xb8\x63\xfe\xd7\x26\x17\x7b\x0b\x2a\xf9\x48\xb3\x67\x80\x1b"
+      "\x72\x44\xc3\xca\x3f\x61\xb5\x35\xc9\x8b\x13\x2a\x56\x7c\x21\x39", 128,
+    },
+    { RANDOM_ID_HASH_DRBG_SHA512_256,
+      "\x38\x50\xff\xb2\x63\x11\x35\xcf\x8e\xb1\x85\x5a\x20\x33\x50\x98"
+      "\xf2\x10\xb2\x3b\xa9\x3a\x77\xba\x62\xb1\xdb\x97\x43\x04\x0b\x21", 32,
+      "\x64\x16\xfe\x2e\x40\x27\xed\xbb\x00\x1b\x70\xd1\x69\xe3\x69\x7d", 16,
+      "\x95\x9f\x6c\x1d\x14\x4f\xe4\x4a\x3e\xfd\xe8\x95\x44\xae\x13\xb7"
+      "\x15\xbc\x34\x53\x36\xeb\xd7\x9e\xfe\x3b\xd3\xc3\x95\xdf\xba\xba", 32,
+      "\x32\xa8\x4f\xb5\x46\x99\x18\x27\x5a\x51\x01\xf2\xc4\x50\x50\xe5"
+      "\xb9\xdc\x97\xc4\x0a\xcf\x67\xe5\xc8\xc7\x85\xe8\xeb\x80\xdd\xee", 32,
+      "\x70\x68\x66\x20\x8f\x20\xef\x93\xca\x9d\xc6\xa0\xff\x83\x2d\x72"
+      "\xa9\x92\x24\xe6\x00\xf2\x5f\xee\xdd\xc5\x7d\xfb\x88\x4d\xde\x15", 32,
+      "\xb8\x99\xef\x6c\x2d\x2a\x5e\xb7\x2a\xe9\xc1\xa8\xa7\xc5\x58\x30"
+      "\xe6\xec\x3f\xe3\xe1\x03\x60\x79\xa6\x08\x58\x9e\x8a\xe7\x6e\x7e", 32,
+      "\xbf\xa2\xf2\x03\xb7\x2b\x63\xa8\x42\x09\x4f\x9f\xa7\x37\x46\xdb"
+      "\xec\xff\x2f\x25\x16\x9f\xbf\xc1\x3d\x41\xa2\xcc\x77\xb7\xf7\x3e", 32,
+      "\x74\x0a\xe9\x4d\xfc\xd9\x16\x15\x5e\x21\x39\xa4\xb9\x32\x1f\xe8"
+      "\x39\x59\x9b\xe9\xb9\xe5\x1f\xa1\x94\xe1\xaf\x67\x9f\x2c\x04\x5e"
+      "\xe9\x39\xce\xc4\xbb\xbd\x64\x8d\x32\x38\xf0\xc4\x9d\x82\xbe\x19"
+      "\x67\x4d\x08\xaf\x51\x9e\x1e\xfb\xb3\x1f\x8a\xcf\xab\x66\x80\xf8"
+      "\xf9\x6b\x32\x80\x9d\x13\xf5\x7f\x19\xf3\x18\x95\x9d\xe8\x66\xcf"
+      "\xcd\xc6\x84\xea\x57\x4b\xef\xc9\x60\xb8\xc6\x53\x8b\x44\x2c\x7d"
+      "\x29\xea\x88\xfe\xbc\x04\x39\xbb\x0c\xd4\xa6\xc1\x1f\x37\xb5\x9f"
+      "\xfc\xd3\xf1\x51\xab\x5f\x02\x60\x25\x5e\x1d\xdb\x75\x96\x1f\x57", 128,
+    },
+};
+
+#define HASH_DRBG_KAT_NUM \
+    ((int)(sizeof(hash_drbg_kat)/sizeof(*hash_drbg_kat)))
@@ -24,20 +24,42 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
+#include <limits.h>
 #include <unistd.h>
 #include <math.h>
+#include <pthread.h>
+#include <sys/wait.h>
+#include <bzlib.h>
 
 #include "entropy.h"
+#include "random.h"
+#include "t_perf.h"
 
 #ifdef CC_CLANG
 #define PRIu64 "llu"
+#define SCNu64 "llu"
 #else
 #define PRIu64 "lu"
+#define SCNu64 "lu"
 #endif
 
 /* Number of cycles/sec. */
 uint64_t cps = 0;
 
+/* The number of threads running estimators. 0 means one per online CPU. */
+static int est_threads = 0;
+/* The maximum number of samples to collect with one call to a source. */
+#define COLLECT_BULK_SAMPLES	4096
+/* The number of samples each estimator analyzes in the speed test. */
+#define EST_SPEED_SAMPLES	(1 << 22)
+/* The maximum number of sets of samples analyzed together. */
+#define EST_MAX_SETS		2
+
+/* Hardware performance counters - opened with -perf. */
+static PERF perf;
+/* Whether to report hardware performance counters. */
+static int use_perf = 0;
+
 /*
  * Get the current cycle count from the CPU.
  *
@@ -70,6 +92,7 @@ typedef struct entropy_src_st
 {
     char *name;
     ENTROPY_FUNC *func;
+    ENTROPY_BULK_FUNC *bulk;
     COALESCE_FUNC *coalesce;
     uint16_t bits;
     uint32_t samples;
@@ -112,38 +135,65 @@ void coalesce_time(void *data)
 ENTROPY_SRC entropy_src[] =
 {
 #if 1
-    { "/dev/random", ENTROPY_METH_dev_random, coalesce_dev_random, 2, 1<<4, 2 },
+    { "/dev/random", ENTROPY_METH_dev_random, ENTROPY_METH_dev_random_bulk,
+      coalesce_dev_random, 2, 1<<4, 2 },
 #endif
-    { "RDRAND Hi 8", ENTROPY_METH_rdrand, coalesce_rdrand_hi, 8, 1<<24, 2 },
-    { "RDRAND Lo 8", ENTROPY_METH_rdrand, coalesce_rdrand_lo, 8, 1<<24, 2 },
-    { "RDTSC Hi 4", ENTROPY_METH_rdtsc, coalesce_rdtsc_hi, 4, 1<<16, 2 },
-    { "RDTSC Lo 4", ENTROPY_METH_rdtsc, coalesce_rdtsc_lo, 4, 1<<16, 2 },
-    { "usec Time", ENTROPY_METH_time, coalesce_time, 8, 1<<16, 2 },
+    { "RDRAND Hi 8", ENTROPY_METH_rdrand, ENTROPY_METH_rdrand_bulk,
+      coalesce_rdrand_hi, 8, 1<<24, 2 },
+    { "RDRAND Lo 8", ENTROPY_METH_rdrand, ENTROPY_METH_rdrand_bulk,
+      coalesce_rdrand_lo, 8, 1<<24, 2 },
+    { "RDTSC Hi 4", ENTROPY_METH_rdtsc, NULL,
+      coalesce_rdtsc_hi, 4, 1<<16, 2 },
+    { "RDTSC Lo 4", ENTROPY_METH_rdtsc, NULL,
+      coalesce_rdtsc_lo, 4, 1<<16, 2 },
+    { "usec Time", ENTROPY_METH_time, NULL, coalesce_time, 8, 1<<16, 2 },
 };
 
 /* The number of entropy sources to test. */
 #define ENTROPY_SRC_NUM ((uint8_t)(sizeof(entropy_src)/sizeof(*entropy_src)))
 
+/*
+ * Calculate the Most Common Value entropy from the largest count.
+ */
+static double mcv_calc(uint64_t max, uint64_t n)
+{
+    double p, pu;
+
+    p = max; p /= n;
+    pu = p + 2.576 * sqrt((p*(1-p))/n);
+    if (pu > 1) pu = 1;
+
+    return -log2(pu);
+}
+
 int most_common_value(void *buffer, ENTROPY_SRC *src, double *entropy)
 {
     uint16_t *b = buffer;
     uint32_t i;
     uint32_t *cnt, max = 0;
     uint32_t s = 1 << src->bits;
-    double p, pu;
 
-    cnt = malloc(s * sizeof(*cnt));
-    memset(cnt, 0, s * sizeof(*cnt));
-    for (i=0; i<src->samples; i++)
+    /* Count into four histograms so consecutive equal samples don't wait on
+     * the same counter.
+     */
+    cnt = malloc(4 * s * sizeof(*cnt));
+    memset(cnt, 0, 4 * s * sizeof(*cnt));
+    for (i=0; i+4<=src->samples; i+=4)
+    {
+        cnt[b[i]]++;
+        cnt[s+b[i+1]]++;
+        cnt[2*s+b[i+2]]++;
+        cnt[3*s+b[i+3]]++;
+    }
+    for (; i<src->samples; i++)
         cnt[b[i]]++;
     for (i=0; i<s; i++)
+    {
+        cnt[i] += cnt[s+i] + cnt[2*s+i] + cnt[3*s+i];
         max = (max > cnt[i]) ? max : cnt[i];
+    }
 
-    p = max; p /= src->samples;
-    pu = p + 2.576 * sqrt((p*(1-p))/src->samples);
-    if (pu > 1) pu = 1;
-
-    *entropy = -log2(pu);
+    *entropy = mcv_calc(max, src->samples);
     free(cnt);
     return 0;
 }
@@ -166,56 +216,32 @@ double collision_func(double p, double q, double k)
     return (t1/q)*(1+t2)*f(q,k+1) - t1*t2;
 }
 
-int collision_estimate(void *buffer, ENTROPY_SRC *src, double *entropy)
+/*
+ * Calculate the Collision entropy from the collision distances.
+ *
+ * @param [in]  v        The number of collisions.
+ * @param [in]  sum      The sum of the distances.
+ * @param [in]  sq       The sum of the squares of the distances.
+ * @param [in]  bits     The number of bits in a sample.
+ * @param [out] entropy  The min-entropy per sample.
+ * @return  0 on success and 1 when too few collisions.
+ */
+static int collision_calc(uint64_t v, uint64_t sum, uint64_t sq,
+    uint16_t bits, double *entropy)
 {
-    int ret = 0;
-    uint16_t *b = buffer;
-    uint32_t v, index, i, c;
-    uint32_t *pos;
-    uint16_t *t;
-    uint32_t s = 1 << src->bits;
-    double x, o, n, x1;
-    double p, q, k = s;
-
-    pos = malloc(s * sizeof(*pos));
-    t = malloc(src->samples * sizeof(*t));
-    memset(t, 0, src->samples * sizeof(*t));
-    v = 0;
-    index = 0;
+    uint32_t i;
+    double x, o, x1;
+    double p, q, k = 1 << bits;
 
-    for (index=0,v=0; index<src->samples; )
-    {
-        memset(pos, -1, s * sizeof(*pos));
-        for (i=index; i<src->samples; i++)
-        {
-            if (pos[b[i]] != (uint32_t)-1)
-            {
-                t[v++] = i - index;
-                break;
-            }
-            pos[b[i]] = i;
-        }
-        index = i+1;
-    }
     if (v < 1000)
-    {
-        ret = 1;
-        goto end;
-    }
+        return 1;
 
-    for (i=0,c=0; i<v; i++)
-        c += t[i];
-    x = c; x /= v;
-    for (i=0,c=0,o=0; i<v; i++)
-    {
-        n = t[i] - x;
-        o += n*n;
-    }
-    o /= v;
-    o = sqrt(o);
+    x = sum; x /= v;
+    o = sq; o /= v;
+    o = sqrt(o - x*x);
 
 #ifdef DEBUG_COLLISION
-    fprintf(stderr, "mean:%lf std:%lf v=%d\n", x, o, v);
+    fprintf(stderr, "mean:%lf std:%lf v=%"PRIu64"\n", x, o, v);
 #endif
 
     x1 = x - 2.576*o/sqrt(v);
@@ -236,28 +262,67 @@ fprintf(stderr, "%d: %14.12lf %14.12lf %14.12lf\n", i, p, x, x1);
     if (x1 - 0.001 < x)
         *entropy = -log2(p);
     else
-        *entropy = src->bits;
+        *entropy = bits;
 
-end:
-    free(t);
+    return 0;
+}
+
+int collision_estimate(void *buffer, ENTROPY_SRC *src, double *entropy)
+{
+    int ret;
+    uint16_t *b = buffer;
+    uint32_t index, i, t;
+    uint32_t *pos;
+    uint32_t s = 1 << src->bits;
+    uint64_t v, sum, sq;
+
+    pos = malloc(s * sizeof(*pos));
+
+    /* pos holds the start of the run a value was last seen in. Seen in this
+     * run when it matches the run's start - no clearing between runs.
+     */
+    memset(pos, -1, s * sizeof(*pos));
+    for (index=0,v=0,sum=0,sq=0; index<src->samples; )
+    {
+        for (i=index; i<src->samples; i++)
+        {
+            if (pos[b[i]] == index)
+            {
+                t = i - index;
+                v++;
+                sum += t;
+                sq += (uint64_t)t * t;
+                break;
+            }
+            pos[b[i]] = index;
+        }
+        index = i+1;
+    }
+
+    ret = collision_calc(v, sum, sq, src->bits, entropy);
     free(pos);
     return ret;
 }
 
-int markov_estimate(void *buffer, ENTROPY_SRC *src, double *entropy)
+/*
+ * Calculate the Markov entropy from the counts of values and transitions.
+ *
+ * @param [in] cnt    The count of each value.
+ * @param [in] trans  The count of each transition - from * k + to.
+ * @param [in] n      The number of samples counted.
+ * @param [in] bits   The number of bits in a sample.
+ * @return  The min-entropy per sample.
+ */
+static double markov_calc(uint64_t *cnt, uint64_t *trans, uint64_t n,
+    uint16_t bits)
 {
-    uint16_t *b = buffer;
     uint32_t i, j, c, d = 128;
     double alpha = 0.99;
     double epsilon;
-    uint32_t k = 1<<src->bits;
-    uint16_t *cnt;
-    uint16_t *trans;
+    uint32_t k = 1<<bits;
     double *prob, *h, *p, pmax;
-    double *t;
+    double *t, *tc;
 
-    cnt = malloc(k * sizeof(*cnt));
-    trans = malloc(k * k * sizeof(*trans));
     prob = malloc(k * sizeof(*prob));
     t = malloc(k * k * sizeof(*t));
     p = malloc(k * sizeof(*p));
@@ -266,35 +331,34 @@ int markov_estimate(void *buffer, ENTROPY_SRC *src, double *entropy)
     for (i=1; (i<k*k) && (i<d); i++)
         alpha *= 0.99;
 
-    epsilon = sqrt(log2(1/(1-alpha))/(2*k*k));
-
-    memset(cnt, 0, k * sizeof(*cnt));
-    for (i=0; i<k*k; i++)
-        cnt[b[i]]++;
-    for (i=0; i<k; i++)
-        prob[i] = cnt[i]/(k*k) + epsilon;
-    pmax = 0;
+    epsilon = sqrt(log2(1/(1-alpha))/(2*n));
     for (i=0; i<k; i++)
-        pmax = (pmax > prob[i]) ? pmax : prob[i];
-
-    memset(trans, 0, k * k * sizeof(*trans));
-    for (i=0; i<k*k-1; i++)
-        trans[b[i]*k+b[i+1]]++;
+    {
+        prob[i] = (double)cnt[i]/n + epsilon;
+        if (prob[i] > 1) prob[i] = 1;
+    }
 
+    /* Transition probabilities stored transposed: t[c*k+i] is from i to c.
+     * The column a step reads is then contiguous.
+     */
     for (i=0; i<k; i++)
     {
         epsilon = sqrt(log2(1/(1-alpha))/(2*cnt[i]));
         for (j=0; j<k; j++)
-            t[i*k+j] = (cnt[i] == 0) ? 1 : (trans[i*k+j] / cnt[i]) + epsilon;
+        {
+            t[j*k+i] = (cnt[i] == 0) ? 1 :
+                ((double)trans[i*k+j] / cnt[i]) + epsilon;
+            if (t[j*k+i] > 1) t[j*k+i] = 1;
+        }
     }
 
     for (j=1; j<d; j++)
     {
-        fprintf(stderr, "%3d/128\r", j);
         for (c=0; c<k; c++)
         {
+            tc = t + c*k;
             for (i=0; i<k; i++)
-                p[i] = prob[i] * t[i*k+c];
+                p[i] = prob[i] * tc[i];
 
             h[c] = 0;
             for (i=0; i<k; i++)
@@ -303,267 +367,2841 @@ int markov_estimate(void *buffer, ENTROPY_SRC *src, double *entropy)
         for (i=0; i<k; i++)
             prob[i] = h[i];
     }
-    fprintf(stderr, "       \r");
     pmax = 0;
     for (i=0; i<k; i++)
-        pmax = (pmax > p[i]) ? pmax : p[i];
+        pmax = (pmax > prob[i]) ? pmax : prob[i];
 
-    *entropy = -log2(pmax) / d;
     free(h);
     free(p);
     free(t);
     free(prob);
-    free(trans);
-    free(cnt);
-    return 0;
+    return -log2(pmax) / d;
 }
 
-double compression_func_f(double z, uint32_t t, uint32_t u)
+/*
+ * Markov estimate of the min-entropy of the samples.
+ * All samples are counted - the same counts as streaming the samples.
+ *
+ * @param [in]  buffer   The samples.
+ * @param [in]  src      The entropy source.
+ * @param [out] entropy  The min-entropy per sample.
+ * @return  0 to indicate success.
+ */
+int markov_estimate(void *buffer, ENTROPY_SRC *src, double *entropy)
 {
+    uint16_t *b = buffer;
     uint32_t i;
-    double r;
+    uint32_t k = 1<<src->bits;
+    uint32_t n = src->samples;
+    uint64_t *cnt;
+    uint64_t *trans;
 
-    r = z;
-    for (i=0; i<u-1; i++)
-        r *= (1-z);
-    if (u < t)
-        r = z;
+    cnt = malloc(k * sizeof(*cnt));
+    trans = malloc(k * k * sizeof(*trans));
 
-    return r;
+    memset(cnt, 0, k * sizeof(*cnt));
+    for (i=0; i<n; i++)
+        cnt[b[i]]++;
+    memset(trans, 0, k * k * sizeof(*trans));
+    for (i=0; i+1<n; i++)
+        trans[b[i]*k+b[i+1]]++;
+
+    *entropy = markov_calc(cnt, trans, n, src->bits);
+    free(trans);
+    free(cnt);
+    return 0;
 }
-double compression_func_g(double z, uint32_t l, uint32_t v, uint32_t d)
-{
-    uint32_t t, u;
-    double r;
 
-    r = 0;
-    for (t=d; t<l; t++)
+/* The number of samples that make the dictionary of the compression estimate.
+ */
+#define COMPRESSION_D	1000
+
+/*
+ * Calculate G(z) of the compression estimate - the expected mean of log2 of
+ * the distance back to the previous occurrence of each test sample when the
+ * most likely value has probability z. SP 800-90B defines:
+ *   G(z) = 1/v sum_{t=d+1}^{L} sum_{u=1}^{t} log2(u) F(z, t, u)
+ *   F(z, t, u) = z^2 (1-z)^(u-1) when u < t, z (1-z)^(t-1) when u = t
+ * The u < t terms are summed once per u, weighted by the number of t after u:
+ * L - max(u, d).
+ *
+ * @param [in] z   The probability of the most likely value.
+ * @param [in] lg  The table of log2(u) for u from 0 to L.
+ * @param [in] l   The number of samples - L.
+ * @param [in] d   The number of samples in the dictionary.
+ * @return  G(z).
+ */
+static double compression_g(double z, const double *lg, uint32_t l,
+    uint32_t d)
+{
+    uint32_t u;
+    double pw = 1;
+    double r = 0;
+
+    /* pw is (1-z)^(u-1). The terms once it is below 1e-30 are negligible -
+     * and it would never reach 0: the smallest subnormal times 1-z rounds
+     * back to itself. */
+    for (u=1; (u<=l) && (pw > 1e-30); u++)
     {
-        fprintf(stderr, "%d/%d\r", t, l);
-        for (u=0; u<t; u++)
-            r += log2(u) * compression_func_f(z, t, u);
+        if (u < l)
+            r += lg[u] * z * z * pw * (l - ((u > d) ? u : d));
+        if (u > d)
+            r += lg[u] * z * pw;
+        pw *= 1 - z;
     }
 
-    return r / v;
+    return r / (l - d);
 }
-double compression_func(double p, double q, uint32_t n, uint32_t l, uint32_t v,
-    uint32_t d)
+
+/*
+ * Calculate the expected mean of the compression estimate when the most
+ * likely value has probability p and the other k-1 values share the rest.
+ *
+ * @param [in] p   The probability of the most likely value.
+ * @param [in] k   The number of values a sample can have.
+ * @param [in] lg  The table of log2(u) for u from 0 to L.
+ * @param [in] l   The number of samples - L.
+ * @param [in] d   The number of samples in the dictionary.
+ * @return  The expected mean.
+ */
+static double compression_func(double p, uint32_t k, const double *lg,
+    uint32_t l, uint32_t d)
 {
-    return compression_func_g(p, l, v, d) +
-        (n-1) * compression_func_g(q, l, v, d);
+    double q = (1 - p) / (k - 1);
+
+    return compression_g(p, lg, l, d) + (k - 1) * compression_g(q, lg, l, d);
 }
 
+/*
+ * Compression estimate of the min-entropy of the samples (SP 800-90B 6.3.4).
+ * The first 1000 samples make a dictionary of the last position of each
+ * value. For each later sample, log2 of the distance back to its previous
+ * occurrence is taken. The lower bound of the mean is then matched, by
+ * binary search, to the expected mean of a distribution where one value has
+ * probability p.
+ *
+ * @param [in]  buffer   The samples.
+ * @param [in]  src      The entropy source.
+ * @param [out] entropy  The min-entropy per sample.
+ * @return  0 on success and 1 when there are too few samples or on allocation
+ *          failure.
+ */
 int compression_estimate(void *buffer, ENTROPY_SRC *src, double *entropy)
 {
+    int ret = 1;
     uint16_t *s = buffer;
     uint32_t i;
-    uint32_t v, d, l;
+    uint32_t l = src->samples;
+    uint32_t d = COMPRESSION_D;
+    uint32_t v = l - d;
     uint32_t b = src->bits;
     uint32_t k = 1 << src->bits;
-    double p, q, x, t, x1;
-    double c, rho;
-    uint32_t *dict;
-    uint32_t *di;
-
-    l = 1002;
-    d = 1000;
-    v = l - d;
-
-    if (src->samples < d)
-        return 1;
+    uint32_t *dict = NULL;
+    double *lg = NULL;
+    double x, x2, c, sigma, lo, hi, p;
 
-    dict = malloc(k * sizeof(*dict));
-    memset(dict, 0, k * sizeof(*dict));
-    di = malloc(v * sizeof(*di));
-
-    for (i=0; i<d; i++)
-        dict[s[i]] = i;
-
-    for (; i<l; i++)
+    if (l <= d + 1)
+        goto end;
+    dict = calloc(k, sizeof(*dict));
+    lg = malloc(((size_t)l + 1) * sizeof(*lg));
+    if ((dict == NULL) || (lg == NULL))
+        goto end;
+    lg[0] = 0;
+    for (i=1; i<=l; i++)
+        lg[i] = log2(i);
+
+    /* Positions are 1-based - 0 is never seen. A value not seen before has a
+     * distance of its position. */
+    for (i=1; i<=d; i++)
+        dict[s[i-1]] = i;
+    for (x=0, x2=0; i<=l; i++)
     {
-        di[i-d] = i - dict[s[i]];
-        dict[s[i]] = i;
+        x += lg[i - dict[s[i-1]]];
+        x2 += lg[i - dict[s[i-1]]] * lg[i - dict[s[i-1]]];
+        dict[s[i-1]] = i;
     }
-
-    for (x=0,x1=0,i=0; i<v; i++)
+    x /= v;
+    c = 0.7 - (0.8 / b) + ((4 + 32.0 / b) * pow(v, -3.0 / b)) / 15;
+    sigma = c * sqrt(x2 / (v - 1) - x * x);
+    /* The lower bound of the mean at 99% confidence. */
+    x -= 2.576 * sigma / sqrt(v);
+
+    /* The expected mean is largest when all values are equally likely. */
+    if (compression_func(1.0 / k, k, lg, l, d) < x)
+        *entropy = b;
+    else
     {
-        t = log2(di[i]);
-        x += t;
-        x1 += t*t;
+        /* The expected mean falls as p rises - find p where it is x. */
+        lo = 1.0 / k;
+        hi = 1;
+        for (i=0; i<48; i++)
+        {
+            p = (lo + hi) / 2;
+            if (compression_func(p, k, lg, l, d) < x)
+                hi = p;
+            else
+                lo = p;
+        }
+        *entropy = -log2(lo);
     }
-    x /= v;
-    x1 /= v;
 
-    c = 0.7 - (0.8 / b) + ((4 + 32 / b) * pow(v, -3.0/b)) / 15;
+    ret = 0;
+end:
+    free(lg);
+    free(dict);
+    return ret;
+}
 
-    rho = c * sqrt(x1 - x*x);
+/* The minimum count of the most common tuple for t-Tuple to use its length. */
+#define TUPLE_MIN_CNT	35
 
-    x1 = x - (2.576 * rho / sqrt(v));
+/* Counts of the repeated tuples in the samples - shared by t-Tuple and LRS. */
+typedef struct tuple_cnt_st
+{
+    /* Lock protecting the counts while they are calculated. */
+    pthread_mutex_t lock;
+    /* The samples the counts are for - NULL when not in use. */
+    void *buffer;
+    /* Whether the counts have been calculated for the samples. */
+    int done;
+    /* The length of the longest repeated tuple. */
+    uint32_t v;
+    /* The count of the most common tuple of each length - index 1..v+1. */
+    uint32_t *max;
+    /* The number of pairs of equal tuples of each length - index 1..v+1. */
+    uint64_t *pairs;
+} TUPLE_CNT;
+
+/* Lock protecting which samples the tuple counts are for. */
+static pthread_mutex_t tuple_cnt_lock = PTHREAD_MUTEX_INITIALIZER;
+/* The tuple counts of each set of samples being analyzed. */
+static TUPLE_CNT tuple_cnt[EST_MAX_SETS] =
+{
+    { PTHREAD_MUTEX_INITIALIZER, NULL, 0, 0, NULL, NULL },
+    { PTHREAD_MUTEX_INITIALIZER, NULL, 0, 0, NULL, NULL },
+};
 
-    p = 0;
-    for (i=1; i<48; i++)
-    {
-        fprintf(stderr, "%3d/48\r", i);
-        p += (double)1.0 / (1L << i);
-        q = (1 - p) / (k - 1);
+/*
+ * Forget the tuple counts - call before analyzing new samples.
+ */
+static void tuple_cnt_reset()
+{
+    int i;
 
-        x = compression_func(p, q, k, l, v, d);
-#define DEBUG_COMPRESSION
-#ifdef DEBUG_COMPRESSION
-fprintf(stderr, "%d: %14.12lf %14.12lf %14.12lf\n", i, p, x, x1);
-#endif
-        if (x < x1)
-            p -= (double)1.0 / (1L << i);
+    for (i=0; i<EST_MAX_SETS; i++)
+    {
+        free(tuple_cnt[i].max);
+        free(tuple_cnt[i].pairs);
+        tuple_cnt[i].max = NULL;
+        tuple_cnt[i].pairs = NULL;
+        tuple_cnt[i].v = 0;
+        tuple_cnt[i].done = 0;
+        tuple_cnt[i].buffer = NULL;
     }
-    fprintf(stderr, "       \r");
-
-    if (x1 - 0.001 < x)
-        *entropy = -log2(p);
-    else
-        *entropy = src->bits;
-
-    free(di);
-    free(dict);
-    return 0;
 }
 
-typedef int (ESTIMATOR_FUNC)(void *buffer, ENTROPY_SRC *src, double *entropy);
-typedef struct estimator_st
-{
-    char *name;
-    ESTIMATOR_FUNC *func;
-} ESTIMATOR;
-
-ESTIMATOR estimator[] =
+/* Compare the sort keys of suffixes. */
+static int sa_key_cmp(const void *a, const void *b)
 {
-    { "Most Common Value", &most_common_value },
-    { "Collision", &collision_estimate },
-    { "Markov", &markov_estimate },
-    { "Compression", &compression_estimate },
-};
+    uint64_t ka = *(const uint64_t *)a;
+    uint64_t kb = *(const uint64_t *)b;
+    return (ka > kb) - (ka < kb);
+}
 
-#define ESTIMATOR_NUM  ((uint8_t)(sizeof(estimator)/sizeof(*estimator)))
+/* Close the group of suffixes from s to e - kept when still to be sorted. */
+#define SA_GROUP(list, num, u, s, e)	\
+    do                                  \
+    {                                   \
+        if ((e) - (s) > 1)              \
+        {                               \
+            (list)[(num)++] = (s);      \
+            (list)[(num)++] = (e) - (s);\
+            (u) += (e) - (s);           \
+        }                               \
+    }                                   \
+    while (0)
 
 /*
- * Analyze the samples of an entropy source.
+ * Build the suffix array of the samples by prefix doubling.
+ * The first round radix sorts on as many samples as fit in 32 bits. Each
+ * round after orders on the rank of the second half and then stably counting
+ * sorts on the rank of the first half - O(n log n) overall. Once few suffixes
+ * are left unsorted only their groups are sorted (Larsson-Sadakane).
  *
- * @param [in] src     The entropy source.
- * @param [in] len     The length of each sample.
- * @return  0 to indicate success.
+ * @param [in]  s     The samples.
+ * @param [in]  n     The number of samples.
+ * @param [in]  bits  The number of bits in a sample.
+ * @param [out] sa    The suffix array.
+ * @param [out] rank  The inverse of the suffix array.
+ * @param [in]  tmp   Temporary array of n entries.
+ * @param [in]  cnt   Temporary array of max(n, 65536) entries.
  */
-int analyze(ENTROPY_SRC *src, void *buffer)
+static void suffix_array(uint16_t *s, uint32_t n, uint16_t bits, uint32_t *sa,
+    uint32_t *rank, uint32_t *tmp, uint32_t *cnt)
 {
-    int r;
-    uint8_t i;
-    double entropy, least;
-
-    printf("%s:\n", src->name);
+    uint32_t i, j, h, r, m, a = 0, b, g, u, num, key, mask;
+    uint32_t *p;
+    uint64_t *keys;
+
+    /* Key is the first h samples - zero past the end. */
+    h = 32 / bits;
+    if (h > n)
+        h = n;
+    mask = (h * bits == 32) ? 0xffffffff : (1U << (h * bits)) - 1;
+    for (i=0,key=0; i<h-1; i++)
+        key = (key << bits) | s[i];
+    for (i=0; i<n; i++)
+    {
+        key = (key << bits) | ((i + h - 1 < n) ? s[i+h-1] : 0);
+        rank[i] = key & mask;
+    }
 
-    least = src->bits;
-    for (i=0; i<ESTIMATOR_NUM; i++)
+    /* Radix sort, 16 bits at a time, starting with the suffixes shorter than
+     * h - shortest first - so they come before longer ones with the same key.
+     */
+    for (j=0; j<32; j+=16)
     {
-        r = (estimator[i].func)(buffer, src, &entropy);
-        if (r == 1)
+        p = (j == 0) ? NULL : tmp;
+        memset(cnt, 0, 65536 * sizeof(*cnt));
+        for (i=0; i<n; i++)
+            cnt[(rank[i] >> j) & 0xffff]++;
+        for (i=1,r=cnt[0],cnt[0]=0; i<65536; i++)
         {
-            printf("%-17s: Too few samples\n", estimator[i].name);
+            a = cnt[i];
+            cnt[i] = r;
+            r += a;
         }
-        else
+        for (i=0; i<n; i++)
+        {
+            a = (p != NULL) ? p[i] : ((i < h - 1) ? n - 1 - i : i - h + 1);
+            ((j == 0) ? tmp : sa)[cnt[(rank[a] >> j) & 0xffff]++] = a;
+        }
+    }
+    /* A rank is the start of the group of suffixes with equal prefixes.
+     * Suffixes shorter than h are unique.
+     */
+    for (g=0,num=0,u=0,i=0; i<n; i++)
+    {
+        if ((i > 0) && ((rank[sa[i]] != rank[sa[i-1]]) || (sa[i] > n - h) ||
+                        (sa[i-1] > n - h)))
         {
-            if (least > entropy) least = entropy;
-            printf("%-17s: %9.6lf %9.6lf\n", estimator[i].name, entropy, least);
+            SA_GROUP(cnt, num, u, g, i);
+            g = i;
         }
+        tmp[sa[i]] = g;
     }
+    SA_GROUP(cnt, num, u, g, n);
+    memcpy(rank, tmp, n * sizeof(*rank));
 
-    return 0;
+    for (; num>0; h<<=1)
+    {
+        /* Few left to sort - refine each group on its own. */
+        keys = (u <= n / 16) ? malloc(u * sizeof(*keys)) : NULL;
+        if (keys != NULL)
+        {
+            for (j=0,m=0,u=0; j<num; j+=2)
+            {
+                g = cnt[j];
+                for (i=0; i<cnt[j+1]; i++)
+                {
+                    a = sa[g+i];
+                    keys[i] = ((uint64_t)((a + h < n) ? rank[a+h] + 1 : 0)
+                        << 32) | a;
+                }
+                qsort(keys, cnt[j+1], sizeof(*keys), sa_key_cmp);
+                for (r=0,i=0; i<=cnt[j+1]; i++)
+                {
+                    if ((i == cnt[j+1]) ||
+                        ((i > 0) && ((keys[i] >> 32) != (keys[i-1] >> 32))))
+                    {
+                        SA_GROUP(tmp, m, u, g + r, g + i);
+                        r = i;
+                    }
+                    if (i < cnt[j+1])
+                    {
+                        sa[g+i] = (uint32_t)keys[i];
+                        rank[sa[g+i]] = g + r;
+                    }
+                }
+            }
+            free(keys);
+            memcpy(cnt, tmp, m * sizeof(*cnt));
+            num = m;
+            continue;
+        }
+
+        /* Order on the second half - suffixes without one come first. */
+        for (r=0,i=n-h; i<n; i++)
+            tmp[r++] = i;
+        for (i=0; i<n; i++)
+        {
+            if (sa[i] >= h)
+                tmp[r++] = sa[i] - h;
+        }
+        /* Stable sort on the first half. */
+        memset(cnt, 0, n * sizeof(*cnt));
+        for (i=0; i<n; i++)
+            cnt[rank[i]]++;
+        for (i=1; i<n; i++)
+            cnt[i] += cnt[i-1];
+        for (i=n; i>0; i--)
+            sa[--cnt[rank[tmp[i-1]]]] = tmp[i-1];
+
+        for (g=0,num=0,u=0,i=0; i<n; i++)
+        {
+            b = sa[i];
+            if ((i > 0) && ((rank[a] != rank[b]) || (a + h >= n) ||
+                            (b + h >= n) || (rank[a+h] != rank[b+h])))
+            {
+                SA_GROUP(cnt, num, u, g, i);
+                g = i;
+            }
+            tmp[b] = g;
+            a = b;
+        }
+        SA_GROUP(cnt, num, u, g, n);
+        memcpy(rank, tmp, n * sizeof(*rank));
+    }
 }
 
 /*
- * Collect samples from an entropy source to analyze.
+ * Calculate the tuple counts of the samples.
+ * The suffix array and LCP array (Kasai) give the lcp-intervals: an interval
+ * of c suffixes with lcp l inside a parent with lcp pl is a tuple that occurs
+ * c times for each length pl+1..l.
  *
- * @param [in] src     The entropy source.
- * @param [in] buffer  The buffer to hold the samples.
- * @return  0 to indicate success.
+ * @param [in] tc    The tuple counts.
+ * @param [in] s     The samples.
+ * @param [in] n     The number of samples.
+ * @param [in] bits  The number of bits in a sample.
+ * @return  0 on success and 1 when out of memory.
  */
-int collect(ENTROPY_SRC *src, void *buffer)
+static int tuple_cnt_calc(TUPLE_CNT *tc, uint16_t *s, uint32_t n,
+    uint16_t bits)
 {
-    uint32_t i;
-    uint32_t len;
-    uint16_t bits;
-    uint8_t *b8 = buffer;
-    uint16_t *b16 = buffer;
-    uint32_t *b32 = buffer;
+    int ret = 1;
+    uint32_t i, j, h, l, lb, top, v, c, pl;
+    uint32_t *sa, *rank, *lcp, *cnt;
+    uint32_t *st_lcp, *st_lb;
+    uint64_t *diff = NULL;
+    uint32_t *max = NULL;
+
+    sa = malloc(n * sizeof(*sa));
+    rank = malloc(n * sizeof(*rank));
+    lcp = malloc(n * sizeof(*lcp));
+    cnt = malloc(((n > 65536) ? n : 65536) * sizeof(*cnt));
+    if ((sa == NULL) || (rank == NULL) || (lcp == NULL) || (cnt == NULL))
+        goto end;
 
-    for (i=0; i<src->samples; )
+    suffix_array(s, n, bits, sa, rank, lcp, cnt);
+
+    /* lcp[i] is the length shared by suffixes sa[i-1] and sa[i]. */
+    lcp[0] = 0;
+    for (i=0,h=0,v=0; i<n; i++)
     {
-        if ((*src->func)(b8, &len, &bits))
+        if (rank[i] == 0)
         {
-#ifdef DEBUG_OUTPUT
-            fprintf(stderr, "%02x%02x ", b8[0], b8[1]);
-#endif
-            b8 += len;
-            i++;
+            h = 0;
+            continue;
         }
+        j = sa[rank[i]-1];
+        while ((i+h < n) && (j+h < n) && (s[i+h] == s[j+h]))
+            h++;
+        lcp[rank[i]] = h;
+        if (v < h) v = h;
+        if (h > 0) h--;
     }
-#ifdef DEBUG_OUTPUT
-fprintf(stderr, "\n");
-#endif
 
-    if (src->len == 2)
+    max = malloc((v + 2) * sizeof(*max));
+    diff = malloc((v + 2) * sizeof(*diff));
+    if ((max == NULL) || (diff == NULL))
+        goto end;
+    memset(max, 0, (v + 2) * sizeof(*max));
+    memset(diff, 0, (v + 2) * sizeof(*diff));
+
+    /* Walk the lcp-intervals bottom-up - the stack reuses the sort arrays. */
+    st_lcp = cnt;
+    st_lb = rank;
+    st_lcp[0] = 0;
+    st_lb[0] = 0;
+    top = 0;
+    for (i=1; i<=n; i++)
     {
-        for (i=0; i<src->samples; i++,b16++)
+        l = (i < n) ? lcp[i] : 0;
+        lb = i - 1;
+        while (l < st_lcp[top])
         {
-            src->coalesce(b16);
-#ifdef DEBUG
-            fprintf(stderr, "%04x ", b16[0]);
-#endif
+            c = i - st_lb[top];
+            pl = (l > st_lcp[top-1]) ? l : st_lcp[top-1];
+            if (max[st_lcp[top]] < c)
+                max[st_lcp[top]] = c;
+            diff[pl+1] += (uint64_t)c * (c - 1) / 2;
+            diff[st_lcp[top]+1] -= (uint64_t)c * (c - 1) / 2;
+            lb = st_lb[top--];
+        }
+        if (l > st_lcp[top])
+        {
+            top++;
+            st_lcp[top] = l;
+            st_lb[top] = lb;
         }
     }
-    else if (src->len == 4)
+
+    /* Most common count is the largest of any interval at least as long. */
+    max[v+1] = 1;
+    for (i=v; i>0; i--)
     {
-        for (i=0; i<src->samples; i++,b32++)
-            src->coalesce(b32);
+        if (max[i] < max[i+1])
+            max[i] = max[i+1];
     }
+    for (i=1; i<=v+1; i++)
+        diff[i] += diff[i-1];
+
+    tc->v = v;
+    tc->max = max;
+    tc->pairs = diff;
+    max = NULL;
+    diff = NULL;
+    ret = 0;
+end:
+    free(diff);
+    free(max);
+    free(cnt);
+    free(lcp);
+    free(rank);
+    free(sa);
+    return ret;
+}
 
-    fprintf(stderr, "\n");
-
+/*
+ * Get the tuple counts of the samples - calculated by the first caller.
+ *
+ * @param [in] buffer  The samples.
+ * @param [in] src     The entropy source.
+ * @return  The tuple counts or NULL when out of memory or more than
+ *          EST_MAX_SETS sets of samples are being analyzed.
+ */
+static TUPLE_CNT *tuple_cnt_get(void *buffer, ENTROPY_SRC *src)
+{
+    int i;
+    TUPLE_CNT *tc;
+
+    /* Use the counts of these samples or else unused counts. */
+    pthread_mutex_lock(&tuple_cnt_lock);
+    for (i=0; (i<EST_MAX_SETS) && (tuple_cnt[i].buffer!=buffer); i++)
+        ;
+    if (i == EST_MAX_SETS)
+    {
+        for (i=0; (i<EST_MAX_SETS) && (tuple_cnt[i].buffer!=NULL); i++)
+            ;
+        if (i < EST_MAX_SETS)
+            tuple_cnt[i].buffer = buffer;
+    }
+    pthread_mutex_unlock(&tuple_cnt_lock);
+    if (i == EST_MAX_SETS)
+        return NULL;
+
+    tc = &tuple_cnt[i];
+    pthread_mutex_lock(&tc->lock);
+    if (!tc->done)
+    {
+        tuple_cnt_calc(tc, buffer, src->samples, src->bits);
+        tc->done = 1;
+    }
+    pthread_mutex_unlock(&tc->lock);
+
+    return (tc->max != NULL) ? tc : NULL;
+}
+
+/*
+ * Upper bound of the probability - 99% confidence.
+ */
+static double upper_bound(double p, uint32_t n)
+{
+    p += 2.576 * sqrt(p * (1 - p) / (n - 1));
+    return (p > 1) ? 1 : p;
+}
+
+int t_tuple_estimate(void *buffer, ENTROPY_SRC *src, double *entropy)
+{
+    TUPLE_CNT *tc;
+    uint32_t i;
+    uint32_t n = src->samples;
+    double p, pmax = 0;
+
+    tc = tuple_cnt_get(buffer, src);
+    if ((tc == NULL) || (tc->max[1] < TUPLE_MIN_CNT))
+        return 1;
+
+    for (i=1; (i<=tc->v) && (tc->max[i]>=TUPLE_MIN_CNT); i++)
+    {
+        p = pow((double)tc->max[i] / (n - i + 1), 1.0 / i);
+        if (pmax < p) pmax = p;
+    }
+
+    *entropy = -log2(upper_bound(pmax, n));
+    return 0;
+}
+
+int lrs_estimate(void *buffer, ENTROPY_SRC *src, double *entropy)
+{
+    TUPLE_CNT *tc;
+    uint32_t u, w;
+    uint32_t n = src->samples;
+    double p, t, pmax = 0;
+
+    tc = tuple_cnt_get(buffer, src);
+    if (tc == NULL)
+        return 1;
+
+    /* Shortest tuple length too rare for t-Tuple. */
+    for (u=1; (u<=tc->v) && (tc->max[u]>=TUPLE_MIN_CNT); u++)
+        ;
+    if (u > tc->v)
+        return 1;
+
+    for (w=u; w<=tc->v; w++)
+    {
+        t = n - w + 1;
+        p = pow(tc->pairs[w] / (t * (t - 1) / 2), 1.0 / w);
+        if (pmax < p) pmax = p;
+    }
+
+    *entropy = -log2(upper_bound(pmax, n));
+    return 0;
+}
+
+/*
+ * Probability of no run of r correct predictions in n with success
+ * probability p - SP 800-90B 6.3.7.
+ */
+static double predictor_run_prob(double p, uint32_t r, uint32_t n)
+{
+    int i;
+    double q = 1 - p;
+    double x = 1;
+
+    for (i=0; i<10; i++)
+        x = 1 + q * pow(p, r) * pow(x, r + 1);
+
+    return (1 - p * x) / ((r + 1 - r * x) * q) / pow(x, n + 1);
+}
+
+/*
+ * Calculate the entropy from the results of a predictor.
+ *
+ * @param [in] c     The number of correct predictions.
+ * @param [in] n     The number of predictions.
+ * @param [in] run   The longest run of correct predictions.
+ * @param [in] bits  The number of bits in a sample.
+ * @return  The min-entropy per sample.
+ */
+static double predictor_entropy(uint32_t c, uint32_t n, uint32_t run,
+    uint16_t bits)
+{
+    int i;
+    double pg, pl, lo, hi;
+    double pmax = 1.0 / (1 << bits);
+
+    if (c == 0)
+        pg = 1 - pow(0.01, 1.0 / n);
+    else
+        pg = upper_bound((double)c / n, n);
+
+    /* Local probability is where the longest run becomes 99% likely. */
+    for (lo=0,hi=1,i=0; i<64; i++)
+    {
+        pl = (lo + hi) / 2;
+        if (predictor_run_prob(pl, run + 1, n) > 0.99)
+            lo = pl;
+        else
+            hi = pl;
+    }
+    pl = lo;
+
+    if (pmax < pg) pmax = pg;
+    if (pmax < pl) pmax = pl;
+    return -log2(pmax);
+}
+
+/* Record whether a prediction was correct. */
+#define PREDICTED(correct, c, run, max_run)	\
+    do                                          \
+    {                                           \
+        if (correct)                            \
+        {                                       \
+            c++;                                \
+            if (++run > max_run)                \
+                max_run = run;                  \
+        }                                       \
+        else                                    \
+            run = 0;                            \
+    }                                           \
+    while (0)
+
+/* The number of windows of MultiMCW. */
+#define MCW_NUM		4
+
+/*
+ * Find the most common value in the window - the most recent on a tie.
+ */
+static uint16_t mcw_mode(uint32_t *cnt, uint32_t *last, uint32_t k)
+{
+    uint32_t v, m = 0;
+
+    for (v=1; v<k; v++)
+    {
+        if ((cnt[v] > cnt[m]) || ((cnt[v] == cnt[m]) && (last[v] > last[m])))
+            m = v;
+    }
+    return m;
+}
+
+int multi_mcw_estimate(void *buffer, ENTROPY_SRC *src, double *entropy)
+{
+    static const uint32_t win[MCW_NUM] = { 63, 255, 1023, 4095 };
+    uint16_t *s = buffer;
+    uint32_t n = src->samples;
+    uint32_t k = 1 << src->bits;
+    uint32_t i, j, u, w = 0;
+    uint32_t c = 0, run = 0, max_run = 0;
+    uint32_t *cnt, *last, *wc;
+    uint16_t v, mode[MCW_NUM];
+    uint32_t score[MCW_NUM];
+
+    if (n <= win[0] + 1)
+        return 1;
+
+    cnt = malloc(MCW_NUM * k * sizeof(*cnt));
+    last = malloc(k * sizeof(*last));
+    if ((cnt == NULL) || (last == NULL))
+    {
+        free(last);
+        free(cnt);
+        return 1;
+    }
+    memset(cnt, 0, MCW_NUM * k * sizeof(*cnt));
+    memset(last, 0, k * sizeof(*last));
+    memset(mode, 0, sizeof(mode));
+    memset(score, 0, sizeof(score));
+
+    for (i=0; i<n; i++)
+    {
+        v = s[i];
+        if (i >= win[0])
+        {
+            PREDICTED(mode[w] == v, c, run, max_run);
+            for (j=0; (j<MCW_NUM) && (i>=win[j]); j++)
+            {
+                if ((mode[j] == v) && (++score[j] >= score[w]))
+                    w = j;
+            }
+        }
+
+        /* Slide the windows on - counts kept so the mode is O(1) to update
+         * unless the mode is the value leaving.
+         */
+        last[v] = i;
+        for (j=0; j<MCW_NUM; j++)
+        {
+            wc = cnt + j * k;
+            if (++wc[v] >= wc[mode[j]])
+                mode[j] = v;
+            if (i >= win[j])
+            {
+                u = s[i - win[j]];
+                wc[u]--;
+                if (u == mode[j])
+                    mode[j] = mcw_mode(wc, last, k);
+            }
+        }
+    }
+
+    *entropy = predictor_entropy(c, n - win[0], max_run, src->bits);
+    free(last);
+    free(cnt);
+    return 0;
+}
+
+/* The number of lags of the Lag predictor. */
+#define LAG_D		128
+
+int lag_estimate(void *buffer, ENTROPY_SRC *src, double *entropy)
+{
+    uint16_t *s = buffer;
+    uint32_t n = src->samples;
+    uint32_t k = 1 << src->bits;
+    uint32_t i, j, d, w = 1;
+    uint32_t c = 0, run = 0, max_run = 0;
+    uint32_t *last;
+    uint8_t *prev;
+    uint32_t score[LAG_D+1];
+
+    if (n < 3)
+        return 1;
+
+    last = malloc(k * sizeof(*last));
+    prev = malloc(n * sizeof(*prev));
+    if ((last == NULL) || (prev == NULL))
+    {
+        free(prev);
+        free(last);
+        return 1;
+    }
+    memset(last, 0xff, k * sizeof(*last));
+    memset(score, 0, sizeof(score));
+
+    for (i=0; i<n; i++)
+    {
+        /* Distance back to the same value when within the lags - 0 if not. */
+        j = last[s[i]];
+        prev[i] = ((j != 0xffffffff) && (i - j <= LAG_D)) ? i - j : 0;
+        last[s[i]] = i;
+        if (i == 0)
+            continue;
+
+        PREDICTED(s[i-w] == s[i], c, run, max_run);
+        /* Only the lags that predicted correctly score - follow the chain of
+         * equal values back in order of increasing lag.
+         */
+        for (j=i; prev[j]!=0; )
+        {
+            j -= prev[j];
+            d = i - j;
+            if (d > LAG_D)
+                break;
+            if (++score[d] >= score[w])
+                w = d;
+        }
+    }
+
+    *entropy = predictor_entropy(c, n - 1, max_run, src->bits);
+    free(prev);
+    free(last);
+    return 0;
+}
+
+/* An entry in a model table. */
+typedef struct model_ent_st
+{
+    /* The key of the tuple - 0 when the slot is empty. */
+    uint64_t key;
+    /* Tuple: count of the most common value to follow - 0 when the tuple is
+     *        only the end of longer tuples.
+     * Count: the number of times the value followed the tuple.
+     */
+    uint32_t cnt;
+    /* Tuple: the most common value to follow - the largest on a tie.
+     * Count: the value following the tuple.
+     */
+    uint16_t y;
+} MODEL_ENT;
+
+/* Open addressed table of tuples or of counts of values following tuples. */
+typedef struct model_tbl_st
+{
+    /* The entries. */
+    MODEL_ENT *ent;
+    /* The number of slots less one. */
+    uint32_t mask;
+    /* The number of entries. */
+    uint32_t num;
+    /* Whether the value is part of the key - counts. */
+    int cnt;
+    /* Incremented when the table grows and the entries move. */
+    uint32_t gen;
+} MODEL_TBL;
+
+/* Model of the values that follow tuples of samples.
+ * Every ending of a tuple in the model is in the tuple table so a lookup of
+ * ever longer tuples stops at the first that is missing.
+ */
+typedef struct model_st
+{
+    /* The tuples. */
+    MODEL_TBL ctx;
+    /* The counts of values following tuples. */
+    MODEL_TBL cnt;
+} MODEL;
+
+/* Hash a key and value to a slot. */
+#define MODEL_HASH(t, key, y)                                             \
+    ((uint32_t)((((key) + ((t)->cnt ? (y) + 1 : 0) * 0xc2b2ae3d27d4eb4fULL) \
+        * 0x9e3779b97f4a7c15ULL) >> 32) & (t)->mask)
+
+static int model_tbl_init(MODEL_TBL *t, int cnt)
+{
+    t->mask = (1 << 16) - 1;
+    t->num = 0;
+    t->cnt = cnt;
+    t->gen = 0;
+    t->ent = calloc(t->mask + 1, sizeof(*t->ent));
+    return t->ent != NULL;
+}
+
+static int model_init(MODEL *m)
+{
+    int ok = model_tbl_init(&m->ctx, 0);
+    return model_tbl_init(&m->cnt, 1) && ok;
+}
+
+static void model_free(MODEL *m)
+{
+    free(m->cnt.ent);
+    free(m->ctx.ent);
+}
+
+/*
+ * Find the slot of the entry or the empty slot it goes in.
+ */
+static uint32_t model_find(MODEL_TBL *t, uint64_t key, uint16_t y)
+{
+    uint32_t i = MODEL_HASH(t, key, y);
+
+    while ((t->ent[i].key != 0) &&
+           ((t->ent[i].key != key) || (t->cnt && (t->ent[i].y != y))))
+    {
+        i = (i + 1) & t->mask;
+    }
+    return i;
+}
+
+/*
+ * Add an entry with a zero count to the table - grows when half full.
+ *
+ * @param [in] t    The table.
+ * @param [in] i    The empty slot the entry goes in.
+ * @param [in] key  The key of the tuple.
+ * @param [in] y    The value following the tuple.
+ * @return  The slot of the entry or -1 when out of memory.
+ */
+static int64_t model_add(MODEL_TBL *t, uint32_t i, uint64_t key, uint16_t y)
+{
+    uint32_t j;
+    MODEL_ENT *e = t->ent;
+    uint32_t mask = t->mask;
+
+    if (2 * (t->num + 1) > t->mask + 1)
+    {
+        t->ent = calloc(2 * (mask + 1), sizeof(*t->ent));
+        if (t->ent == NULL)
+        {
+            t->ent = e;
+            return -1;
+        }
+        t->mask = 2 * mask + 1;
+        for (j=0; j<=mask; j++)
+        {
+            if (e[j].key != 0)
+                t->ent[model_find(t, e[j].key, e[j].y)] = e[j];
+        }
+        free(e);
+        t->gen++;
+        i = model_find(t, key, y);
+    }
+    t->ent[i].key = key;
+    t->ent[i].cnt = 0;
+    t->ent[i].y = t->cnt ? y : 0;
+    t->num++;
+    return i;
+}
+
+/*
+ * Count a value following a tuple in the model.
+ *
+ * @param [in] m    The model.
+ * @param [in] ctx  The slot of the tuple.
+ * @param [in] y    The value following.
+ * @param [in] add  Whether to add the count when not in the model.
+ * @return  1 when counted and 0 otherwise.
+ */
+static int model_inc(MODEL *m, uint32_t ctx, uint16_t y, int add)
+{
+    MODEL_ENT *c = &m->ctx.ent[ctx];
+    MODEL_ENT *e;
+    uint32_t i;
+    int64_t r;
+
+    i = model_find(&m->cnt, c->key, y);
+    if (m->cnt.ent[i].key == 0)
+    {
+        if (!add)
+            return 0;
+        r = model_add(&m->cnt, i, c->key, y);
+        if (r < 0)
+            return 0;
+        i = r;
+    }
+    e = &m->cnt.ent[i];
+    e->cnt++;
+    if ((e->cnt > c->cnt) || ((e->cnt == c->cnt) && (y > c->y)))
+    {
+        c->cnt = e->cnt;
+        c->y = y;
+    }
+    return 1;
+}
+
+/*
+ * Add the tuples that end the same but are longer than those in the model.
+ *
+ * @param [in]      m      The model.
+ * @param [in]      key    The keys of the tuples by length.
+ * @param [in, out] slot   The slots of the tuples by length.
+ * @param [in, out] depth  The longest tuple in the table.
+ * @param [in]      len    The length of tuple to add up to.
+ * @return  1 on success and 0 when out of memory.
+ */
+static int model_extend(MODEL *m, uint64_t *key, uint32_t *slot,
+    uint32_t *depth, uint32_t len)
+{
+    uint32_t l;
+    uint32_t gen = m->ctx.gen;
+    int64_t r;
+
+    for (; *depth<len; (*depth)++)
+    {
+        r = model_add(&m->ctx, model_find(&m->ctx, key[*depth+1], 0),
+            key[*depth+1], 0);
+        if (r < 0)
+            return 0;
+        slot[*depth+1] = r;
+    }
+    if (gen != m->ctx.gen)
+    {
+        for (l=1; l<=len; l++)
+            slot[l] = model_find(&m->ctx, key[l], 0);
+    }
+    return 1;
+}
+
+/*
+ * Look up the tuples of samples that end before e - shortest first.
+ *
+ * @param [in]  m      The model.
+ * @param [in]  s      The samples.
+ * @param [in]  e      The index after the end of the tuples.
+ * @param [in]  num    The maximum length of tuple.
+ * @param [in]  bits   The number of bits in a sample.
+ * @param [out] key    The keys of the tuples by length.
+ * @param [out] slot   The slots of the tuples by length.
+ * @param [out] depth  The longest tuple in the table.
+ */
+static void model_lookup(MODEL *m, uint16_t *s, uint32_t e, uint32_t num,
+    uint16_t bits, uint64_t *key, uint32_t *slot, uint32_t *depth)
+{
+    uint32_t l;
+    uint64_t p = 0, h = 0;
+
+    /* Tuples that fit are packed into the key and longer ones are hashed. */
+    for (l=1; l<=num; l++)
+    {
+        p = (p << bits) | s[e-l];
+        h = (h ^ s[e-l]) * 0x9e3779b97f4a7c15ULL;
+        h ^= h >> 29;
+        if (l * bits <= 56)
+            key[l] = ((uint64_t)l << 56) | p;
+        else
+            key[l] = (h ^ l) | (1ULL << 63);
+    }
+
+    for (l=1; l<=num; l++)
+    {
+        slot[l] = model_find(&m->ctx, key[l], 0);
+        if (m->ctx.ent[slot[l]].key == 0)
+            break;
+        /* Counted for the next sample. */
+        if (m->ctx.ent[slot[l]].cnt > 0)
+        {
+            __builtin_prefetch(&m->cnt.ent[MODEL_HASH(&m->cnt, key[l],
+                s[e])]);
+        }
+    }
+    *depth = l - 1;
+}
+
+/* The number of Markov models of MultiMMC. */
+#define MMC_D			16
+/* The maximum number of transitions in a Markov model of MultiMMC. */
+#define MMC_MAX_ENTRIES		100000
+
+int multi_mmc_estimate(void *buffer, ENTROPY_SRC *src, double *entropy)
+{
+    uint16_t *s = buffer;
+    uint32_t n = src->samples;
+    uint32_t t, d, num, depth = 0, w = 1;
+    uint32_t c = 0, run = 0, max_run = 0;
+    uint64_t key[MMC_D+1];
+    uint32_t slot[MMC_D+1];
+    int pred[MMC_D+1];
+    uint32_t entries[MMC_D+1];
+    uint32_t score[MMC_D+1];
+    MODEL m;
+
+    if (n < 3)
+        return 1;
+    if (!model_init(&m))
+    {
+        model_free(&m);
+        return 1;
+    }
+    memset(entries, 0, sizeof(entries));
+    memset(score, 0, sizeof(score));
+
+    for (t=1; t<n; t++)
+    {
+        /* Update the models with the value after the tuples ending at t-2 -
+         * looked up for the last prediction.
+         */
+        for (d=1; (t>=2) && (d<=MMC_D) && (d<=t-1); d++)
+        {
+            if ((d <= depth) && model_inc(&m, slot[d], s[t-1], 0))
+                continue;
+            if (entries[d] >= MMC_MAX_ENTRIES)
+                continue;
+            if (!model_extend(&m, key, slot, &depth, d))
+                continue;
+            if (model_inc(&m, slot[d], s[t-1], 1))
+                entries[d]++;
+        }
+
+        /* Look up the tuples ending at t-1 and predict with each model. */
+        num = (t < MMC_D) ? t : MMC_D;
+        model_lookup(&m, s, t, num, src->bits, key, slot, &depth);
+        if (t < 2)
+            continue;
+
+        for (d=1; d<=num; d++)
+        {
+            pred[d] = -1;
+            if ((d <= depth) && (m.ctx.ent[slot[d]].cnt > 0))
+                pred[d] = m.ctx.ent[slot[d]].y;
+        }
+        PREDICTED(pred[w] == s[t], c, run, max_run);
+        for (d=1; d<=num; d++)
+        {
+            if ((pred[d] == s[t]) && (++score[d] >= score[w]))
+                w = d;
+        }
+    }
+
+    *entropy = predictor_entropy(c, n - 2, max_run, src->bits);
+    model_free(&m);
+    return 0;
+}
+
+/* The maximum length of tuple in the LZ78Y dictionary. */
+#define LZ78Y_B			16
+/* The maximum number of tuples in the LZ78Y dictionary. */
+#define LZ78Y_MAX_DICT		65536
+
+int lz78y_estimate(void *buffer, ENTROPY_SRC *src, double *entropy)
+{
+    uint16_t *s = buffer;
+    uint32_t n = src->samples;
+    uint32_t t, j, num, depth = 0, size = 0, max;
+    uint32_t c = 0, run = 0, max_run = 0;
+    uint64_t key[LZ78Y_B+1];
+    uint32_t slot[LZ78Y_B+1];
+    int pred;
+    MODEL m;
+
+    if (n <= LZ78Y_B + 2)
+        return 1;
+    if (!model_init(&m))
+    {
+        model_free(&m);
+        return 1;
+    }
+
+    for (t=1; t<n; t++)
+    {
+        /* Add the value after the tuples ending at t-2 - longest first. */
+        for (j=LZ78Y_B; (t>LZ78Y_B) && (j>0); j--)
+        {
+            if ((j > depth) || (m.ctx.ent[slot[j]].cnt == 0))
+            {
+                if (size >= LZ78Y_MAX_DICT)
+                    continue;
+                if (!model_extend(&m, key, slot, &depth, j))
+                    continue;
+                size++;
+            }
+            model_inc(&m, slot[j], s[t-1], 1);
+        }
+
+        /* Look up the tuples ending at t-1. */
+        num = (t < LZ78Y_B) ? t : LZ78Y_B;
+        model_lookup(&m, s, t, num, src->bits, key, slot, &depth);
+        if (t <= LZ78Y_B)
+            continue;
+
+        /* Predict the most common value after any tuple - longest on a tie. */
+        pred = -1;
+        for (j=depth,max=0; j>0; j--)
+        {
+            if (m.ctx.ent[slot[j]].cnt > max)
+            {
+                pred = m.ctx.ent[slot[j]].y;
+                max = m.ctx.ent[slot[j]].cnt;
+            }
+        }
+        PREDICTED(pred == s[t], c, run, max_run);
+    }
+
+    *entropy = predictor_entropy(c, n - LZ78Y_B - 1, max_run, src->bits);
+    model_free(&m);
+    return 0;
+}
+
+typedef int (ESTIMATOR_FUNC)(void *buffer, ENTROPY_SRC *src, double *entropy);
+typedef struct estimator_st
+{
+    char *name;
+    ESTIMATOR_FUNC *func;
+} ESTIMATOR;
+
+ESTIMATOR estimator[] =
+{
+    { "Most Common Value", &most_common_value },
+    { "Collision", &collision_estimate },
+    { "Markov", &markov_estimate },
+    { "Compression", &compression_estimate },
+    { "t-Tuple", &t_tuple_estimate },
+    { "LRS", &lrs_estimate },
+    { "MultiMCW", &multi_mcw_estimate },
+    { "Lag", &lag_estimate },
+    { "MultiMMC", &multi_mmc_estimate },
+    { "LZ78Y", &lz78y_estimate },
+};
+
+#define ESTIMATOR_NUM  ((uint8_t)(sizeof(estimator)/sizeof(*estimator)))
+
+/* The estimators to run on sets of samples - shared by the threads. */
+typedef struct est_jobs_st
+{
+    /* The number of sets of samples. */
+    int num;
+    /* The entropy source of each set. */
+    ENTROPY_SRC *src[EST_MAX_SETS];
+    /* The samples of each set. */
+    void *buffer[EST_MAX_SETS];
+    /* Lock protecting next. */
+    pthread_mutex_t lock;
+    /* The index of the next estimator to run - over all sets. */
+    int next;
+    /* The result of each estimator. */
+    int r[EST_MAX_SETS][ESTIMATOR_NUM];
+    /* The entropy estimated by each estimator. */
+    double entropy[EST_MAX_SETS][ESTIMATOR_NUM];
+} EST_JOBS;
+
+/*
+ * Run estimators until there are none left.
+ *
+ * @param [in] arg  The estimator jobs.
+ * @return  NULL.
+ */
+static void *est_worker(void *arg)
+{
+    EST_JOBS *jobs = arg;
+    int i, set;
+
+    while (1)
+    {
+        pthread_mutex_lock(&jobs->lock);
+        i = jobs->next++;
+        pthread_mutex_unlock(&jobs->lock);
+        if (i >= jobs->num * ESTIMATOR_NUM)
+            break;
+
+        set = i / ESTIMATOR_NUM;
+        i %= ESTIMATOR_NUM;
+        jobs->r[set][i] = (estimator[i].func)(jobs->buffer[set],
+            jobs->src[set], &jobs->entropy[set][i]);
+    }
+
+    return NULL;
+}
+
+/*
+ * Get the number of threads to run estimators on.
+ *
+ * @param [in] jobs  The number of estimators to run.
+ * @return  The number of threads - at least 1, at most jobs.
+ */
+static int est_num_threads(int jobs)
+{
+    long n = est_threads;
+
+    if (n <= 0)
+        n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n < 1)
+        n = 1;
+    if (n > jobs)
+        n = jobs;
+    return n;
+}
+
+/*
+ * Run the estimators on each set of samples.
+ * The estimators run concurrently on a pool of threads.
+ *
+ * @param [in] jobs  The estimator jobs - sets of samples filled in.
+ */
+static void est_run(EST_JOBS *jobs)
+{
+    int i, n, started;
+    pthread_t thread[EST_MAX_SETS * ESTIMATOR_NUM];
+
+    tuple_cnt_reset();
+    jobs->next = 0;
+    pthread_mutex_init(&jobs->lock, NULL);
+
+    /* This thread is one of the workers. */
+    n = est_num_threads(jobs->num * ESTIMATOR_NUM);
+    for (started=0; started<n-1; started++)
+    {
+        if (pthread_create(&thread[started], NULL, est_worker, jobs) != 0)
+            break;
+    }
+    est_worker(jobs);
+    for (i=0; i<started; i++)
+        pthread_join(thread[i], NULL);
+    pthread_mutex_destroy(&jobs->lock);
+}
+
+/*
+ * Print the results of the estimators on a set of samples in order.
+ *
+ * @param [in] jobs  The estimator jobs - run.
+ * @param [in] set   The index of the set of samples.
+ * @return  The least entropy estimated.
+ */
+static double est_print(EST_JOBS *jobs, int set)
+{
+    uint8_t i;
+    double least = jobs->src[set]->bits;
+
+    for (i=0; i<ESTIMATOR_NUM; i++)
+    {
+        if (jobs->r[set][i] == 1)
+        {
+            printf("%-17s: Too few samples\n", estimator[i].name);
+        }
+        else
+        {
+            if (least > jobs->entropy[set][i])
+                least = jobs->entropy[set][i];
+            printf("%-17s: %9.6lf %9.6lf\n", estimator[i].name,
+                jobs->entropy[set][i], least);
+        }
+    }
+
+    return least;
+}
+
+/*
+ * Analyze the samples of an entropy source.
+ * The estimators run concurrently on a pool of threads and the results are
+ * printed in order.
+ *
+ * @param [in]  src      The entropy source.
+ * @param [in]  buffer   The samples.
+ * @param [out] entropy  The least entropy estimated. May be NULL.
+ * @return  0 to indicate success.
+ */
+int analyze(ENTROPY_SRC *src, void *buffer, double *entropy)
+{
+    EST_JOBS jobs;
+    double least;
+
+    printf("%s:\n", src->name);
+
+    jobs.num = 1;
+    jobs.src[0] = src;
+    jobs.buffer[0] = buffer;
+    est_run(&jobs);
+    least = est_print(&jobs, 0);
+    if (entropy != NULL)
+        *entropy = least;
+
+    return 0;
+}
+
+/*
+ * Collect samples from an entropy source to analyze.
+ *
+ * @param [in] src     The entropy source.
+ * @param [in] buffer  The buffer to hold the samples.
+ * @return  0 to indicate success.
+ */
+int collect(ENTROPY_SRC *src, void *buffer)
+{
+    uint32_t i, n;
+    uint32_t len;
+    uint16_t bits;
+    uint8_t *b8 = buffer;
+    uint16_t *b16 = buffer;
+    uint32_t *b32 = buffer;
+
+    for (i=0; i<src->samples; )
+    {
+        if (src->bulk != NULL)
+        {
+            n = src->samples - i;
+            if (n > COLLECT_BULK_SAMPLES)
+                n = COLLECT_BULK_SAMPLES;
+            n = (*src->bulk)(b8, n, &len, &bits);
+            b8 += len;
+            i += n;
+        }
+        else if ((*src->func)(b8, &len, &bits))
+        {
+#ifdef DEBUG_OUTPUT
+            fprintf(stderr, "%02x%02x ", b8[0], b8[1]);
+#endif
+            b8 += len;
+            i++;
+        }
+    }
+#ifdef DEBUG_OUTPUT
+fprintf(stderr, "\n");
+#endif
+
+    if (src->len == 2)
+    {
+        for (i=0; i<src->samples; i++,b16++)
+        {
+            src->coalesce(b16);
+#ifdef DEBUG
+            fprintf(stderr, "%04x ", b16[0]);
+#endif
+        }
+    }
+    else if (src->len == 4)
+    {
+        for (i=0; i<src->samples; i++,b32++)
+            src->coalesce(b32);
+    }
+
+#ifdef DEBUG
+    fprintf(stderr, "\n");
+#endif
+
+    return 0;
+}
+
+/* The number of restarts of each entropy source in the restart test. */
+#define RESTART_NUM		1000
+/* The number of samples collected after each restart. */
+#define RESTART_SAMPLES		1000
+/* The significance of the restart sanity check - 0.01 over all rows and
+ * columns. */
+#define RESTART_ALPHA		(0.01 / (2 * RESTART_NUM))
+
+/*
+ * Collect the samples of an entropy source after restarting it.
+ * The source is re-instantiated in a new process so that no state is carried
+ * over from earlier samples.
+ *
+ * @param [in] src     The entropy source - samples is the number to collect.
+ * @param [in] buffer  The buffer to hold the samples.
+ * @return  0 on success and 1 on error.
+ */
+static int restart_collect(ENTROPY_SRC *src, void *buffer)
+{
+    int ret = 1;
+    int fd[2];
+    pid_t pid;
+    int status;
+    size_t len = (size_t)src->samples * src->len;
+    size_t l;
+    ssize_t rl;
+
+    if (pipe(fd) != 0)
+        goto end;
+
+    pid = fork();
+    if (pid == -1)
+    {
+        close(fd[0]);
+        close(fd[1]);
+        goto end;
+    }
+    if (pid == 0)
+    {
+        close(fd[0]);
+        collect(src, buffer);
+        for (l=0; l<len; l+=rl)
+        {
+            rl = write(fd[1], (uint8_t *)buffer + l, len - l);
+            if (rl <= 0)
+                _exit(1);
+        }
+        _exit(0);
+    }
+
+    close(fd[1]);
+    for (l=0; l<len; l+=rl)
+    {
+        rl = read(fd[0], (uint8_t *)buffer + l, len - l);
+        if (rl <= 0)
+            break;
+    }
+    close(fd[0]);
+    if (waitpid(pid, &status, 0) != pid)
+        goto end;
+    if (l != len || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        goto end;
+
+    ret = 0;
+end:
+    return ret;
+}
+
+/*
+ * Calculate the cutoff of the restart sanity check.
+ * The smallest count that a value occurs in n samples by chance with
+ * probability no more than RESTART_ALPHA, when the most likely value has
+ * probability p.
+ *
+ * @param [in] p  The probability of the most likely value.
+ * @param [in] n  The number of samples in a row or column.
+ * @return  The cutoff - counts above this fail.
+ */
+static uint32_t restart_cutoff(double p, uint32_t n)
+{
+    uint32_t u;
+    double tail = 0;
+
+    if (p >= 1)
+        return n;
+
+    /* Sum the binomial tail, P(X >= u), from the top down. */
+    for (u=n; u>0; u--)
+    {
+        tail += exp(lgamma(n + 1.0) - lgamma(u + 1.0) - lgamma(n - u + 1.0) +
+            u * log(p) + (n - u) * log1p(-p));
+        if (tail > RESTART_ALPHA)
+            break;
+    }
+
+    return u;
+}
+
+/*
+ * Find the largest count of any one value in any row and any column of the
+ * restart matrix.
+ *
+ * @param [in] rows  The restart matrix - one restart per row.
+ * @param [in] cols  The transposed restart matrix.
+ * @param [in] bits  The number of bits in a sample.
+ * @return  The largest count or 0 on allocation failure.
+ */
+static uint32_t restart_max_cnt(uint16_t *rows, uint16_t *cols, uint16_t bits)
+{
+    uint32_t i, j;
+    uint32_t max = 0;
+    uint32_t *cnt;
+    uint16_t *m;
+
+    cnt = calloc(1 << bits, sizeof(*cnt));
+    if (cnt == NULL)
+        return 0;
+
+    for (m=rows; m!=NULL; m=(m==rows)?cols:NULL)
+    {
+        for (i=0; i<RESTART_NUM; i++)
+        {
+            for (j=0; j<RESTART_SAMPLES; j++)
+            {
+                if (max < ++cnt[m[i * RESTART_SAMPLES + j]])
+                    max = cnt[m[i * RESTART_SAMPLES + j]];
+            }
+            for (j=0; j<RESTART_SAMPLES; j++)
+                cnt[m[i * RESTART_SAMPLES + j]] = 0;
+        }
+    }
+
+    free(cnt);
+    return max;
+}
+
+/*
+ * Perform the SP 800-90B restart test on an entropy source.
+ * The source is restarted RESTART_NUM times and RESTART_SAMPLES samples are
+ * collected after each restart. The counts in each row and column are
+ * sanity checked and the estimators are run on the rows and on the columns
+ * concurrently.
+ *
+ * @param [in] src      The entropy source.
+ * @param [in] initial  The initial entropy estimate of the source.
+ * @param [out] entropy  The entropy estimate after the restart test.
+ * @return  0 on success and 1 on error.
+ */
+static int restart_test(ENTROPY_SRC *src, double initial, double *entropy)
+{
+    int ret = 1;
+    uint32_t i, j;
+    uint32_t cutoff, max;
+    ENTROPY_SRC restart;
+    ENTROPY_SRC set[EST_MAX_SETS];
+    uint16_t *rows = NULL;
+    uint16_t *cols = NULL;
+    EST_JOBS jobs;
+    double h_r, h_c;
+
+    /* Samples are coalesced to 16 bits or less. */
+    if (src->len != 2)
+        goto end;
+
+    rows = malloc(RESTART_NUM * RESTART_SAMPLES * sizeof(*rows));
+    cols = malloc(RESTART_NUM * RESTART_SAMPLES * sizeof(*cols));
+    if ((rows == NULL) || (cols == NULL))
+        goto end;
+
+    restart = *src;
+    restart.samples = RESTART_SAMPLES;
+    for (i=0; i<RESTART_NUM; i++)
+    {
+        if (restart_collect(&restart, rows + i * RESTART_SAMPLES))
+        {
+            fprintf(stderr, "Failed to restart: %s\n", src->name);
+            goto end;
+        }
+    }
+    for (i=0; i<RESTART_NUM; i++)
+    {
+        for (j=0; j<RESTART_SAMPLES; j++)
+            cols[j * RESTART_NUM + i] = rows[i * RESTART_SAMPLES + j];
+    }
+
+    printf("%s restart test: initial %9.6lf\n", src->name, initial);
+
+    cutoff = restart_cutoff(pow(2, -initial), RESTART_SAMPLES);
+    max = restart_max_cnt(rows, cols, src->bits);
+    if (max == 0)
+        goto end;
+    printf("%-17s: %9u %9u %s\n", "Sanity check", max, cutoff,
+        (max > cutoff) ? "FAIL" : "PASS");
+
+    set[0] = *src;
+    set[0].name = "Rows";
+    set[0].samples = RESTART_NUM * RESTART_SAMPLES;
+    set[1] = set[0];
+    set[1].name = "Columns";
+    jobs.num = EST_MAX_SETS;
+    jobs.src[0] = &set[0];
+    jobs.src[1] = &set[1];
+    jobs.buffer[0] = rows;
+    jobs.buffer[1] = cols;
+    est_run(&jobs);
+
+    printf("Rows:\n");
+    h_r = est_print(&jobs, 0);
+    printf("Columns:\n");
+    h_c = est_print(&jobs, 1);
+
+    *entropy = (h_r < h_c) ? h_r : h_c;
+    if (*entropy > initial)
+        *entropy = initial;
+    printf("%-17s: %9.6lf %9.6lf %s\n", "Restart", h_r, h_c,
+        ((max <= cutoff) && (h_r >= initial / 2) && (h_c >= initial / 2)) ?
+        "PASS" : "FAIL");
+    printf("%-17s: %9.6lf\n", "Entropy", *entropy);
+
+    ret = 0;
+end:
+    free(cols);
+    free(rows);
+    return ret;
+}
+
+/* The number of samples tested for IID by default. */
+#define IID_SAMPLES		1000000
+/* The number of shuffles in the IID permutation tests. */
+#define IID_SHUFFLES		10000
+/* The number of statistics in the IID permutation tests. */
+#define IID_STAT_NUM		19
+/* The index of the compression statistic - the last. */
+#define IID_STAT_COMPRESSION	(IID_STAT_NUM - 1)
+/* The number of lags of the periodicity and covariance statistics. */
+#define IID_LAG_NUM		5
+/* The largest lag of the periodicity and covariance statistics. */
+#define IID_LAG_MAX		32
+/* The least number of samples tested for IID - well past the largest lag. */
+#define IID_MIN_SAMPLES		(IID_LAG_MAX + 1000)
+/* The most samples tested for IID - the compressed text buffer, at most
+ * 7 bytes per sample plus 600, must fit bzip2's unsigned int length. */
+#define IID_MAX_SAMPLES		((UINT_MAX - 600) / 7)
+/* The maximum number of threads shuffling. */
+#define IID_MAX_THREADS		64
+/* The number of shuffles ranking on either side of the original that show
+ * the original is not an outlier. */
+#define IID_RANK_BOUND		6
+
+/* The lags of the periodicity and covariance statistics. */
+static const uint32_t iid_lag[IID_LAG_NUM] = { 1, 2, 8, 16, IID_LAG_MAX };
+
+/* The names of the statistics of the IID permutation tests. */
+static const char *iid_stat_name[IID_STAT_NUM] =
+{
+    "Excursion", "Directional runs", "Longest dir run", "Incr/decreases",
+    "Median runs", "Longest med run", "Avg collision", "Max collision",
+    "Periodicity 1", "Periodicity 2", "Periodicity 8", "Periodicity 16",
+    "Periodicity 32", "Covariance 1", "Covariance 2", "Covariance 8",
+    "Covariance 16", "Covariance 32", "Compression"
+};
+
+/* The samples and results of the IID permutation tests - shared by the
+ * threads. */
+typedef struct iid_ctx_st
+{
+    /* The samples in the original order. */
+    uint16_t *s;
+    /* The number of samples. */
+    uint32_t n;
+    /* The number of bits in a sample. */
+    uint16_t bits;
+    /* The sum of the samples. */
+    int64_t total;
+    /* Twice the median of the samples. */
+    uint32_t median2;
+    /* The statistics of the samples in the original order. */
+    double t[IID_STAT_NUM];
+    /* The counts of shuffles with a statistic greater than, equal to and less
+     * than the original. */
+    uint32_t c[IID_STAT_NUM][3];
+    /* Whether the rank of the statistic is known to be within bounds. */
+    uint8_t done[IID_STAT_NUM];
+    /* The number of statistics with a rank known to be within bounds. */
+    int num_done;
+    /* The number of shuffles ranked. */
+    uint32_t shuffles;
+} IID_CTX;
+
+/* A thread shuffling the samples and calculating the statistics. */
+typedef struct iid_thread_st
+{
+    /* The shared samples and results. */
+    IID_CTX *ctx;
+    /* Deterministic random number generator - initialized per shuffle. */
+    RANDOM *random;
+    /* The shuffled samples. */
+    uint16_t *s;
+    /* The collision in which each value was last seen. */
+    uint32_t *seen;
+    /* The samples as text to compress. */
+    char *text;
+    /* The compressed text. */
+    char *comp;
+    /* The size of the compressed text buffer. */
+    size_t comp_len;
+    /* The index of the shuffle to perform. */
+    uint32_t shuffle;
+    /* The result of the shuffle. */
+    int ret;
+    /* The statistics of the shuffled samples. */
+    double t[IID_STAT_NUM];
+} IID_THREAD;
+
+/*
+ * Calculate the periodicity and covariance statistics at a lag.
+ * Separate simple loop so that the compiler can vectorize it.
+ *
+ * @param [in]  s       The samples.
+ * @param [in]  n       The number of samples.
+ * @param [in]  p       The lag.
+ * @param [out] period  The number of samples equal to the sample p later.
+ * @param [out] cov     The sum of the products of samples p apart.
+ */
+static void iid_lag_stats(const uint16_t *s, uint32_t n, uint32_t p,
+    double *period, double *cov)
+{
+    uint32_t i;
+    uint32_t c = 0;
+    uint64_t v = 0;
+
+    for (i=0; i<n-p; i++)
+    {
+        c += (s[i] == s[i + p]);
+        v += (uint32_t)s[i] * s[i + p];
+    }
+
+    *period = c;
+    *cov = v;
+}
+
+/*
+ * Calculate the compression statistic: the length of the samples, as decimal
+ * text separated by spaces, compressed with bzip2.
+ *
+ * @param [in]  th  The thread with buffers for the text and compressed text.
+ * @param [in]  s   The samples.
+ * @param [in]  n   The number of samples.
+ * @param [out] t   The length of the compressed text.
+ * @return  0 on success and 1 on compression failure.
+ */
+static int iid_compression(IID_THREAD *th, const uint16_t *s, uint32_t n,
+    double *t)
+{
+    uint32_t i;
+    uint32_t v;
+    char *p = th->text;
+    char d[5];
+    int j;
+    unsigned int len = (unsigned int)th->comp_len;
+
+    for (i=0; i<n; i++)
+    {
+        v = s[i];
+        j = 0;
+        do
+        {
+            d[j++] = '0' + v % 10;
+            v /= 10;
+        }
+        while (v > 0);
+        while (j > 0)
+            *(p++) = d[--j];
+        *(p++) = ' ';
+    }
+
+    if (BZ2_bzBuffToBuffCompress(th->comp, &len, th->text, p - th->text, 5, 0,
+        0) != BZ_OK)
+    {
+        return 1;
+    }
+
+    *t = len;
+    return 0;
+}
+
+/*
+ * Calculate the statistics of the IID permutation tests on samples.
+ * The excursion, run and collision statistics are found in a single pass.
+ * Statistics with a rank known to be within bounds are not recalculated when
+ * expensive.
+ *
+ * @param [in]  th  The thread with working buffers.
+ * @param [in]  s   The samples.
+ * @param [out] t   The statistics.
+ * @return  0 on success and 1 on compression failure.
+ */
+static int iid_stats(IID_THREAD *th, const uint16_t *s, double *t)
+{
+    IID_CTX *ctx = th->ctx;
+    uint32_t n = ctx->n;
+    uint32_t i;
+    int64_t sum = 0;
+    double mean = (double)ctx->total / n, ex, max_ex = 0;
+    int dir, prev_dir = -1, med, prev_med = -1;
+    uint32_t dir_runs = 0, dir_run = 0, dir_max = 0, inc = 0;
+    uint32_t med_runs = 0, med_run = 0, med_max = 0;
+    uint32_t stamp = 1, start = 0, len;
+    uint64_t coll_sum = 0;
+    uint32_t coll_max = 0;
+
+    memset(th->seen, 0, sizeof(*th->seen) << ctx->bits);
+
+    for (i=0; i<n; i++)
+    {
+        /* Excursion - in double as n times the sum can overflow 64 bits. */
+        sum += s[i];
+        ex = fabs((double)sum - (i + 1) * mean);
+        if (max_ex < ex)
+            max_ex = ex;
+
+        /* Runs of samples on the same side of the median. */
+        med = 2 * (uint32_t)s[i] >= ctx->median2;
+        if (med != prev_med)
+        {
+            med_runs++;
+            med_run = 0;
+        }
+        if (++med_run > med_max)
+            med_max = med_run;
+        prev_med = med;
+
+        /* Samples until a value is repeated. */
+        if (th->seen[s[i]] == stamp)
+        {
+            len = i - start + 1;
+            coll_sum += len;
+            if (coll_max < len)
+                coll_max = len;
+            stamp++;
+            start = i + 1;
+        }
+        else
+            th->seen[s[i]] = stamp;
+
+        if (i == 0)
+            continue;
+
+        /* Runs of increases and decreases. */
+        dir = s[i - 1] <= s[i];
+        inc += dir;
+        if (dir != prev_dir)
+        {
+            dir_runs++;
+            dir_run = 0;
+        }
+        if (++dir_run > dir_max)
+            dir_max = dir_run;
+        prev_dir = dir;
+    }
+
+    t[0] = max_ex;
+    t[1] = dir_runs;
+    t[2] = dir_max;
+    t[3] = (inc > n - 1 - inc) ? inc : n - 1 - inc;
+    t[4] = med_runs;
+    t[5] = med_max;
+    t[6] = (stamp > 1) ? (double)coll_sum / (stamp - 1) : 0;
+    t[7] = coll_max;
+    for (i=0; i<IID_LAG_NUM; i++)
+        iid_lag_stats(s, n, iid_lag[i], &t[8 + i], &t[8 + IID_LAG_NUM + i]);
+
+    t[IID_STAT_COMPRESSION] = 0;
+    if (!ctx->done[IID_STAT_COMPRESSION])
+        return iid_compression(th, s, n, &t[IID_STAT_COMPRESSION]);
+    return 0;
+}
+
+/*
+ * Shuffle the samples and calculate the statistics.
+ * The random number generator is initialized from the index of the shuffle so
+ * the results do not depend on the number of threads.
+ *
+ * @param [in] arg  The thread.
+ * @return  NULL.
+ */
+static void *iid_worker(void *arg)
+{
+    IID_THREAD *th = arg;
+    IID_CTX *ctx = th->ctx;
+    uint8_t ent[48] = "SP 800-90B IID permutation test shuffle";
+
+    memcpy(ent + 40, &th->shuffle, sizeof(th->shuffle));
+    th->ret = RANDOM_init_with_entropy(th->random, ent, sizeof(ent), NULL, 0);
+    if (th->ret != 0)
+        goto end;
+    memcpy(th->s, ctx->s, ctx->n * sizeof(*th->s));
+    th->ret = RANDOM_shuffle(th->random, th->s, ctx->n, sizeof(*th->s));
+    if (th->ret != 0)
+        goto end;
+    th->ret = iid_stats(th, th->s, th->t);
+end:
+    return NULL;
+}
+
+/*
+ * Rank the statistics of a shuffle against the original.
+ * A statistic's rank is within bounds once enough shuffles are on either side
+ * of the original.
+ *
+ * @param [in] ctx  The shared samples and results.
+ * @param [in] t    The statistics of the shuffle.
+ */
+static void iid_rank(IID_CTX *ctx, double *t)
+{
+    int i;
+    uint32_t *c;
+
+    for (i=0; i<IID_STAT_NUM; i++)
+    {
+        if (ctx->done[i])
+            continue;
+
+        c = ctx->c[i];
+        if (t[i] > ctx->t[i])
+            c[0]++;
+        else if (t[i] == ctx->t[i])
+            c[1]++;
+        else
+            c[2]++;
+        if ((c[0] + c[1] >= IID_RANK_BOUND) &&
+            (c[1] + c[2] >= IID_RANK_BOUND))
+        {
+            ctx->done[i] = 1;
+            ctx->num_done++;
+        }
+    }
+    ctx->shuffles++;
+}
+
+/*
+ * Get the value at an index of the samples when sorted.
+ *
+ * @param [in] cnt  The count of each value in the samples.
+ * @param [in] k    The index into the sorted samples.
+ * @return  The value.
+ */
+static uint32_t iid_sorted_value(uint32_t *cnt, uint32_t k)
+{
+    uint32_t j;
+    uint32_t c = 0;
+
+    for (j=0; ; j++)
+    {
+        c += cnt[j];
+        if (c > k)
+            break;
+    }
+
+    return j;
+}
+
+/*
+ * Free the working buffers of the threads.
+ *
+ * @param [in] th   The threads.
+ * @param [in] num  The number of threads.
+ */
+static void iid_threads_free(IID_THREAD *th, int num)
+{
+    int i;
+
+    for (i=0; i<num; i++)
+    {
+        RANDOM_free(th[i].random);
+        free(th[i].s);
+        free(th[i].seen);
+        free(th[i].text);
+        free(th[i].comp);
+    }
+}
+
+/*
+ * Perform the SP 800-90B IID permutation tests on the samples of an entropy
+ * source. The samples are shuffled up to IID_SHUFFLES times on a pool of
+ * threads. Shuffling stops when the rank of every statistic is known to be
+ * within bounds.
+ *
+ * @param [in] src     The entropy source.
+ * @param [in] buffer  The samples.
+ * @return  0 on success and 1 on error.
+ */
+static int iid_test(ENTROPY_SRC *src, uint16_t *buffer)
+{
+    int ret = 1;
+    int i, num, started, pass = 1;
+    uint32_t j, shuffle;
+    uint32_t *cnt = NULL;
+    IID_CTX ctx;
+    IID_THREAD th[IID_MAX_THREADS];
+    pthread_t thread[IID_MAX_THREADS];
+    uint32_t *c;
+
+    memset(&ctx, 0, sizeof(ctx));
+    memset(th, 0, sizeof(th));
+    ctx.s = buffer;
+    ctx.n = src->samples;
+    ctx.bits = src->bits;
+
+    /* Median from the counts of each value. */
+    cnt = calloc(1 << ctx.bits, sizeof(*cnt));
+    if (cnt == NULL)
+        goto end;
+    for (j=0; j<ctx.n; j++)
+    {
+        cnt[buffer[j]]++;
+        ctx.total += buffer[j];
+    }
+    ctx.median2 = iid_sorted_value(cnt, (ctx.n - 1) / 2) +
+        iid_sorted_value(cnt, ctx.n / 2);
+
+    num = est_num_threads(IID_MAX_THREADS);
+    for (i=0; i<num; i++)
+    {
+        th[i].ctx = &ctx;
+        th[i].comp_len = (size_t)ctx.n * 6 + ctx.n / 50 + 600;
+        if (RANDOM_new_by_id(ENTROPY_METH_defaults,
+            RANDOM_ID_HASH_DRBG_SHA256, 0, &th[i].random) != 0)
+        {
+            goto end;
+        }
+        th[i].s = malloc(ctx.n * sizeof(*th[i].s));
+        th[i].seen = malloc(sizeof(*th[i].seen) << ctx.bits);
+        th[i].text = malloc((size_t)ctx.n * 6);
+        th[i].comp = malloc(th[i].comp_len);
+        if ((th[i].s == NULL) || (th[i].seen == NULL) ||
+            (th[i].text == NULL) || (th[i].comp == NULL))
+        {
+            goto end;
+        }
+    }
+
+    if (iid_stats(&th[0], buffer, ctx.t) != 0)
+        goto end;
+
+    /* Shuffle in rounds of one per thread. Rank in shuffle order so the
+     * results do not depend on the number of threads.
+     */
+    for (shuffle=0; shuffle<IID_SHUFFLES && ctx.num_done<IID_STAT_NUM; )
+    {
+        if (num > IID_SHUFFLES - (int)shuffle)
+            num = IID_SHUFFLES - shuffle;
+        for (i=0; i<num; i++)
+            th[i].shuffle = shuffle + i;
+        for (started=1; started<num; started++)
+        {
+            if (pthread_create(&thread[started], NULL, iid_worker,
+                &th[started]) != 0)
+            {
+                break;
+            }
+        }
+        iid_worker(&th[0]);
+        for (i=1; i<started; i++)
+            pthread_join(thread[i], NULL);
+        /* Threads that could not be started are run on this thread. */
+        for (; i<num; i++)
+            iid_worker(&th[i]);
+
+        for (i=0; i<num && ctx.num_done<IID_STAT_NUM; i++)
+        {
+            if (th[i].ret != 0)
+                goto end;
+            iid_rank(&ctx, th[i].t);
+        }
+        shuffle += num;
+    }
+
+    printf("%s IID permutation tests: %u shuffles\n", src->name, ctx.shuffles);
+    for (i=0; i<IID_STAT_NUM; i++)
+    {
+        /* Rejected when the original is among the highest or lowest. */
+        pass &= ctx.done[i];
+        c = ctx.c[i];
+        printf("%-17s: %14.3lf %5u %5u %s\n", iid_stat_name[i], ctx.t[i],
+            c[0], c[1], ctx.done[i] ? "PASS" : "FAIL");
+    }
+    printf("%-17s: %s\n", "IID", pass ? "PASS" : "FAIL");
+
+    ret = 0;
+end:
+    iid_threads_free(th, IID_MAX_THREADS);
+    free(cnt);
+    return ret;
+}
+
+/*
+ * Collect samples from each entropy source and perform the IID permutation
+ * tests on them.
+ *
+ * @param [in] samples  The number of samples per source - 0 for default.
+ * @return  0 on success and 1 on error.
+ */
+int iid(uint64_t samples)
+{
+    int ret = 1;
+    uint8_t i;
+    uint16_t *buffer;
+    ENTROPY_SRC src;
+
+    if (samples == 0)
+        samples = IID_SAMPLES;
+    if ((samples < IID_MIN_SAMPLES) || (samples > IID_MAX_SAMPLES))
+    {
+        fprintf(stderr, "Samples must be %d to %u\n", IID_MIN_SAMPLES,
+            IID_MAX_SAMPLES);
+        return 1;
+    }
+    buffer = malloc(samples * sizeof(*buffer));
+    if (buffer == NULL)
+        goto end;
+
+    for (i=0; i<ENTROPY_SRC_NUM; i++)
+    {
+        /* Samples are coalesced to 16 bits or less. */
+        if (entropy_src[i].len != 2)
+            continue;
+        src = entropy_src[i];
+        src.samples = samples;
+        collect(&src, buffer);
+        if (iid_test(&src, buffer))
+            goto end;
+    }
+
+    ret = 0;
+end:
+    free(buffer);
+    return ret;
+}
+
+/*
+ * Determine the number of entropy gathering operations that can be performed
+ * per second.
+ */
+void entropy_cycles(uint16_t bits)
+{
+    int i;
+    uint64_t start, end, diff;
+    int num_ops;
+    uint8_t data[256];
+    uint16_t olen;
+
+    /* Prime the caches, etc */
+    for (i=0; i<1000; i++)
+        ENTROPY_generate(ENTROPY_METH_defaults, bits, data, &olen);
+
+    /* Approximate number of ops in a second. */
+    start = get_cycles();
+    for (i=0; i<200; i++)
+        ENTROPY_generate(ENTROPY_METH_defaults, bits, data, &olen);
+    end = get_cycles();
+    num_ops = cps/((end-start)/200);
+
+    /* Perform about 1 seconds worth of operations. */
+    if (use_perf)
+        perf_start(&perf);
+    start = get_cycles();
+    for (i=0; i<num_ops; i++)
+        ENTROPY_generate(ENTROPY_METH_defaults, bits, data, &olen);
+    end = get_cycles();
+    if (use_perf)
+        perf_stop(&perf);
+
+    diff = end - start;
+
+    printf("%4d: %7d %2.3f  %7"PRIu64" %7"PRIu64"\n", bits, num_ops,
+        diff/(cps*1.0), diff/num_ops, cps/(diff/num_ops));
+    if (use_perf)
+        perf_print(&perf, (double)num_ops*bits/8);
+}
+
+/* The maximum number of calls to an entropy source in the benchmark. */
+#define SRC_SPEED_CALLS		(1 << 20)
+
+/*
+ * Compare two latencies for sorting.
+ *
+ * @param [in] a  The first latency.
+ * @param [in] b  The second latency.
+ * @return  Negative, zero or positive when a is less, equal or greater.
+ */
+static int latency_cmp(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/*
+ * Benchmark one entropy source on its own.
+ * The source is called for about a second, or SRC_SPEED_CALLS times, and the
+ * cycles of every call are kept. Reports calls/s, raw bytes/s, credited bits/s
+ * and cycles per credited bit, and the latency percentiles of a call in
+ * cycles - the tail shows sources that block or are slow.
+ *
+ * @param [in] name  The name of the source.
+ * @param [in] func  The function gathering one sample. NULL when bulk.
+ * @param [in] bulk  The function gathering many samples. NULL when single.
+ * @param [in] lat   The buffer to hold the cycles of each call.
+ */
+static void source_cycles(char *name, ENTROPY_FUNC *func,
+    ENTROPY_BULK_FUNC *bulk, uint64_t *lat)
+{
+    uint32_t i, num, fail = 0;
+    uint64_t start, end, diff = 0;
+    uint64_t bytes = 0, credit = 0;
+    uint32_t len;
+    uint16_t bits;
+    uint8_t data[COLLECT_BULK_SAMPLES * sizeof(uint32_t)];
+
+    /* Prime the caches, etc */
+    for (i=0; i<10; i++)
+    {
+        if (bulk != NULL)
+            (*bulk)(data, COLLECT_BULK_SAMPLES, &len, &bits);
+        else
+            (*func)(data, &len, &bits);
+    }
+
+    if (use_perf)
+        perf_start(&perf);
+    for (num=0; (num<SRC_SPEED_CALLS) && (diff<cps); num++)
+    {
+        len = 0;
+        bits = 0;
+        start = get_cycles();
+        if (bulk != NULL)
+        {
+            if ((*bulk)(data, COLLECT_BULK_SAMPLES, &len, &bits) == 0)
+                fail++;
+        }
+        else if (!(*func)(data, &len, &bits))
+            fail++;
+        end = get_cycles();
+        lat[num] = end - start;
+        diff += lat[num];
+        bytes += len;
+        credit += bits;
+    }
+    if (use_perf)
+        perf_stop(&perf);
+
+    qsort(lat, num, sizeof(*lat), latency_cmp);
+
+    printf("%-17s %9.0f %11.0f %11.0f %7.1f %5u %8"PRIu64" %8"PRIu64" %8"
+        PRIu64" %9"PRIu64"\n", name, num/(diff/(cps*1.0)),
+        bytes/(diff/(cps*1.0)), credit/(diff/(cps*1.0)),
+        (credit > 0) ? (double)diff / credit : 0.0, fail, lat[num / 2],
+        lat[num - 1 - num / 100], lat[num - 1 - num / 1000], lat[num - 1]);
+    if (use_perf)
+        perf_print(&perf, bytes);
+}
+
+/*
+ * Benchmark each default entropy source on its own - single sample and bulk.
+ * Shows which source dominates the cost of ENTROPY_generate().
+ */
+void source_speed()
+{
+    int i;
+    uint64_t *lat;
+    char name[64];
+
+    lat = malloc(SRC_SPEED_CALLS * sizeof(*lat));
+    if (lat == NULL)
+        return;
+
+    printf("%-17s %9s %11s %11s %7s %5s %8s %8s %8s %9s\n", "Source",
+        "calls/s", "B/s", "bits/s", "c/bit", "fail", "p50", "p99", "p99.9",
+        "max");
+    if (use_perf)
+        perf_print_header("B");
+    for (i=0; ENTROPY_METH_defaults[i].func != NULL; i++)
+    {
+        source_cycles(ENTROPY_METH_defaults[i].name,
+            ENTROPY_METH_defaults[i].func, NULL, lat);
+        if (ENTROPY_METH_defaults[i].bulk != NULL)
+        {
+            snprintf(name, sizeof(name), "%s bulk",
+                ENTROPY_METH_defaults[i].name);
+            source_cycles(name, NULL, ENTROPY_METH_defaults[i].bulk, lat);
+        }
+    }
+
+    free(lat);
+}
+
+/* The number of samples collected at a time when streaming. */
+#define STREAM_CHUNK_SAMPLES	(1 << 16)
+/* The magic at the start of a serialized estimator state. */
+#define EST_STATE_MAGIC		"ENTROPY_STATE"
+/* The maximum number of different sources to merge. */
+#define MERGE_MAX_SRC		32
+
+/* Sufficient statistics of the samples for the counting estimators:
+ * Most Common Value, Collision and Markov.
+ * States of independent sets of samples merge by adding.
+ */
+typedef struct est_state_st
+{
+    /* The number of bits in a sample. */
+    uint16_t bits;
+    /* The number of samples. */
+    uint64_t samples;
+    /* The count of each value. */
+    uint64_t *cnt;
+    /* The count of each transition - from * k + to. */
+    uint64_t *trans;
+    /* The number of collisions. */
+    uint64_t coll_num;
+    /* The sum of the collision distances. */
+    uint64_t coll_sum;
+    /* The sum of the squares of the collision distances. */
+    uint64_t coll_sq;
+    /* The last sample - transition into the next chunk. Not serialized. */
+    int32_t last;
+    /* The run each value was last seen in - collisions over chunks.
+     * Not serialized.
+     */
+    uint64_t *pos;
+    /* The number of the current run. */
+    uint64_t run;
+    /* The number of samples in the current run. */
+    uint32_t run_len;
+} EST_STATE;
+
+/*
+ * Initialize the estimator state for samples of a number of bits.
+ *
+ * @param [in] state  The estimator state.
+ * @param [in] bits   The number of bits in a sample.
+ * @return  0 on success and 1 when out of memory.
+ */
+static int est_state_init(EST_STATE *state, uint16_t bits)
+{
+    uint32_t k = 1 << bits;
+
+    memset(state, 0, sizeof(*state));
+    state->bits = bits;
+    state->last = -1;
+    state->run = 1;
+    state->cnt = calloc(k, sizeof(*state->cnt));
+    state->trans = calloc((size_t)k * k, sizeof(*state->trans));
+    state->pos = calloc(k, sizeof(*state->pos));
+    return (state->cnt == NULL) || (state->trans == NULL) ||
+        (state->pos == NULL);
+}
+
+static void est_state_free(EST_STATE *state)
+{
+    free(state->pos);
+    free(state->trans);
+    free(state->cnt);
+}
+
+/*
+ * Add a chunk of samples to the estimator state.
+ * Transitions and collision runs carry over from the previous chunk.
+ *
+ * @param [in] state  The estimator state.
+ * @param [in] s      The samples.
+ * @param [in] n      The number of samples.
+ */
+static void est_state_update(EST_STATE *state, uint16_t *s, uint32_t n)
+{
+    uint32_t i;
+    uint32_t k = 1 << state->bits;
+    uint32_t t;
+
+    for (i=0; i<n; i++)
+    {
+        state->cnt[s[i]]++;
+        if (state->last >= 0)
+            state->trans[state->last*k+s[i]]++;
+        state->last = s[i];
+
+        if (state->pos[s[i]] == state->run)
+        {
+            t = state->run_len;
+            state->coll_num++;
+            state->coll_sum += t;
+            state->coll_sq += (uint64_t)t * t;
+            state->run++;
+            state->run_len = 0;
+        }
+        else
+        {
+            state->pos[s[i]] = state->run;
+            state->run_len++;
+        }
+    }
+    state->samples += n;
+}
+
+/*
+ * Merge an estimator state of independent samples into another.
+ * No transition or collision spans the two.
+ *
+ * @param [in] state  The estimator state to merge into.
+ * @param [in] other  The estimator state to merge.
+ * @return  0 on success and 1 when the sample sizes differ.
+ */
+static int est_state_merge(EST_STATE *state, EST_STATE *other)
+{
+    uint32_t i;
+    uint32_t k = 1 << state->bits;
+
+    if (state->bits != other->bits)
+        return 1;
+
+    for (i=0; i<k; i++)
+        state->cnt[i] += other->cnt[i];
+    for (i=0; i<k*k; i++)
+        state->trans[i] += other->trans[i];
+    state->coll_num += other->coll_num;
+    state->coll_sum += other->coll_sum;
+    state->coll_sq += other->coll_sq;
+    state->samples += other->samples;
     return 0;
 }
 
 /*
- * Determine the number of entropy gathering operations that can be performed
- * per second.
+ * Write the estimator state of a source as text.
+ *
+ * @param [in] fp     The file to write to.
+ * @param [in] name   The name of the entropy source.
+ * @param [in] state  The estimator state.
  */
-void entropy_cycles(uint16_t bits)
+static void est_state_write(FILE *fp, char *name, EST_STATE *state)
+{
+    uint32_t i;
+    uint32_t k = 1 << state->bits;
+
+    fprintf(fp, "%s %d %"PRIu64" %"PRIu64" %"PRIu64" %"PRIu64" %s\n",
+        EST_STATE_MAGIC, state->bits, state->samples, state->coll_num,
+        state->coll_sum, state->coll_sq, name);
+    for (i=0; i<k; i++)
+        fprintf(fp, "%"PRIu64"%c", state->cnt[i], (i == k-1) ? '\n' : ' ');
+    for (i=0; i<k*k; i++)
+    {
+        fprintf(fp, "%"PRIu64"%c", state->trans[i],
+            ((i % k) == k-1) ? '\n' : ' ');
+    }
+}
+
+/*
+ * Read the estimator state of a source written by est_state_write().
+ *
+ * @param [in]  fp     The file to read from.
+ * @param [out] name   The name of the entropy source.
+ * @param [in]  len    The size of the name buffer.
+ * @param [out] state  The estimator state - initialized.
+ * @return  0 on success, 1 on error and -1 at the end of the file.
+ */
+static int est_state_read(FILE *fp, char *name, int len, EST_STATE *state)
+{
+    int bits;
+    uint32_t i, k;
+    char magic[sizeof(EST_STATE_MAGIC)];
+    uint64_t samples, coll_num, coll_sum, coll_sq;
+    char *p;
+
+    if (fscanf(fp, "%13s", magic) != 1)
+        return -1;
+    if ((strcmp(magic, EST_STATE_MAGIC) != 0) ||
+        (fscanf(fp, "%d %"SCNu64" %"SCNu64" %"SCNu64" %"SCNu64" ", &bits,
+            &samples, &coll_num, &coll_sum, &coll_sq) != 5) ||
+        (bits < 1) || (bits > 16) || (fgets(name, len, fp) == NULL))
+    {
+        return 1;
+    }
+    if ((p = strchr(name, '\n')) != NULL)
+        *p = '\0';
+
+    if (est_state_init(state, bits))
+        goto err;
+    state->samples = samples;
+    state->coll_num = coll_num;
+    state->coll_sum = coll_sum;
+    state->coll_sq = coll_sq;
+    k = 1 << bits;
+    for (i=0; i<k; i++)
+    {
+        if (fscanf(fp, "%"SCNu64, &state->cnt[i]) != 1)
+            goto err;
+    }
+    for (i=0; i<k*k; i++)
+    {
+        if (fscanf(fp, "%"SCNu64, &state->trans[i]) != 1)
+            goto err;
+    }
+    return 0;
+err:
+    est_state_free(state);
+    return 1;
+}
+
+/* The number of counting estimators - Most Common Value, Collision and
+ * Markov, in the order of the estimator table. */
+#define EST_STATE_NUM		3
+
+/*
+ * Calculate the estimates of the counting estimators from the state.
+ * There must be at least two samples.
+ *
+ * @param [in]  state    The estimator state.
+ * @param [out] entropy  The min-entropy per sample of each estimator.
+ * @param [out] few      Whether each estimator had too few samples.
+ */
+static void est_state_calc(EST_STATE *state, double *entropy, int *few)
+{
+    uint32_t i;
+    uint32_t k = 1 << state->bits;
+    uint64_t max = 0;
+
+    for (i=0; i<k; i++)
+        max = (max > state->cnt[i]) ? max : state->cnt[i];
+    entropy[0] = mcv_calc(max, state->samples);
+    few[0] = 0;
+
+    few[1] = collision_calc(state->coll_num, state->coll_sum, state->coll_sq,
+        state->bits, &entropy[1]);
+
+    entropy[2] = markov_calc(state->cnt, state->trans, state->samples,
+        state->bits);
+    few[2] = 0;
+}
+
+/*
+ * Print the estimates of the counting estimators from the state.
+ *
+ * @param [in] name   The name of the entropy source.
+ * @param [in] state  The estimator state.
+ */
+static void est_state_print(char *name, EST_STATE *state)
 {
     int i;
-    uint64_t start, end, diff;
-    int num_ops;
-    uint8_t data[256];
-    uint16_t olen;
+    double entropy[EST_STATE_NUM];
+    int few[EST_STATE_NUM];
+    double least = state->bits;
 
-    /* Prime the caches, etc */
-    for (i=0; i<1000; i++)
-        ENTROPY_generate(ENTROPY_METH_defaults, bits, data, &olen);
+    printf("%s: %"PRIu64" samples\n", name, state->samples);
+    if (state->samples < 2)
+    {
+        printf("%-17s: Too few samples\n", "All");
+        return;
+    }
 
-    /* Approximate number of ops in a second. */
-    start = get_cycles();
-    for (i=0; i<200; i++)
-        ENTROPY_generate(ENTROPY_METH_defaults, bits, data, &olen);
-    end = get_cycles();
-    num_ops = cps/((end-start)/200);
+    est_state_calc(state, entropy, few);
+    for (i=0; i<EST_STATE_NUM; i++)
+    {
+        if (few[i])
+        {
+            printf("%-17s: Too few samples\n", estimator[i].name);
+            continue;
+        }
+        if (least > entropy[i]) least = entropy[i];
+        printf("%-17s: %9.6lf %9.6lf\n", estimator[i].name, entropy[i],
+            least);
+    }
+}
 
-    /* Perform about 1 seconds worth of operations. */
-    start = get_cycles();
-    for (i=0; i<num_ops; i++)
-        ENTROPY_generate(ENTROPY_METH_defaults, bits, data, &olen);
-    end = get_cycles();
+/*
+ * Stream samples from each entropy source through the counting estimators.
+ * Only the sufficient statistics are kept so the number of samples is not
+ * limited by memory.
+ *
+ * @param [in] samples  The number of samples per source - 0 for default.
+ * @param [in] file     The file to save the states to - NULL to not save.
+ * @return  0 on success and 1 on error.
+ */
+int stream(uint64_t samples, char *file)
+{
+    int ret = 1;
+    uint8_t i;
+    uint64_t done, total;
+    uint16_t *buffer;
+    ENTROPY_SRC chunk;
+    EST_STATE state;
+    FILE *fp = NULL;
+
+    buffer = malloc(STREAM_CHUNK_SAMPLES * sizeof(*buffer));
+    if (buffer == NULL)
+        goto end;
+    if ((file != NULL) && ((fp = fopen(file, "w")) == NULL))
+    {
+        fprintf(stderr, "Failed to open: %s\n", file);
+        goto end;
+    }
 
-    diff = end - start;
+    for (i=0; i<ENTROPY_SRC_NUM; i++)
+    {
+        if (est_state_init(&state, entropy_src[i].bits))
+        {
+            est_state_free(&state);
+            goto end;
+        }
+        chunk = entropy_src[i];
+        total = (samples > 0) ? samples : entropy_src[i].samples;
+        for (done=0; done<total; done+=chunk.samples)
+        {
+            chunk.samples = STREAM_CHUNK_SAMPLES;
+            if (chunk.samples > total - done)
+                chunk.samples = total - done;
+            collect(&chunk, buffer);
+            est_state_update(&state, buffer, chunk.samples);
+        }
+        est_state_print(entropy_src[i].name, &state);
+        if (fp != NULL)
+            est_state_write(fp, entropy_src[i].name, &state);
+        est_state_free(&state);
+    }
 
-    printf("%4d: %7d %2.3f  %7"PRIu64" %7"PRIu64"\n", bits, num_ops,
-        diff/(cps*1.0), diff/num_ops, cps/(diff/num_ops));
+    ret = 0;
+end:
+    if (fp != NULL)
+        fclose(fp);
+    free(buffer);
+    return ret;
+}
+
+/*
+ * Merge the saved estimator states of the entropy sources and print the
+ * estimates. States of sources with the same name are merged.
+ *
+ * @param [in] files  The files holding the states.
+ * @param [in] num    The number of files.
+ * @return  0 on success and 1 on error.
+ */
+int merge(char *files[], int num)
+{
+    int ret = 1;
+    int i, j, r;
+    int cnt = 0;
+    char name[64];
+    char *names[MERGE_MAX_SRC];
+    EST_STATE state[MERGE_MAX_SRC];
+    EST_STATE other;
+    FILE *fp;
+
+    for (i=0; i<num; i++)
+    {
+        if ((fp = fopen(files[i], "r")) == NULL)
+        {
+            fprintf(stderr, "Failed to open: %s\n", files[i]);
+            goto end;
+        }
+        while ((r = est_state_read(fp, name, sizeof(name), &other)) == 0)
+        {
+            for (j=0; (j<cnt) && (strcmp(names[j], name) != 0); j++)
+                ;
+            if ((j == cnt) && (cnt < MERGE_MAX_SRC))
+            {
+                names[cnt] = strdup(name);
+                state[cnt++] = other;
+                continue;
+            }
+            r = (j == cnt) ? 1 : est_state_merge(&state[j], &other);
+            est_state_free(&other);
+            if (r != 0)
+                break;
+        }
+        fclose(fp);
+        if (r > 0)
+        {
+            fprintf(stderr, "Bad state in: %s\n", files[i]);
+            goto end;
+        }
+    }
+
+    for (j=0; j<cnt; j++)
+        est_state_print(names[j], &state[j]);
+
+    ret = 0;
+end:
+    for (j=0; j<cnt; j++)
+    {
+        est_state_free(&state[j]);
+        free(names[j]);
+    }
+    return ret;
+}
+
+/*
+ * Determine the number of samples per second each estimator analyzes.
+ * Uses 8-bit samples from a fixed pseudo-random sequence.
+ */
+void estimator_speed()
+{
+    ENTROPY_SRC src = { "speed", NULL, NULL, NULL, 8, EST_SPEED_SAMPLES, 2 };
+    uint16_t *buffer;
+    uint32_t i;
+    uint32_t x = 0x12345678;
+    uint64_t start, end, diff;
+    double entropy;
+    int r;
+
+    buffer = malloc(EST_SPEED_SAMPLES * sizeof(*buffer));
+    if (buffer == NULL)
+        return;
+    for (i=0; i<EST_SPEED_SAMPLES; i++)
+    {
+        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+        buffer[i] = x & 0xff;
+    }
+
+    printf("%-17s  %9s %7s %12s\n", "Estimator", "samples", "secs",
+        "samples/s");
+    for (i=0; i<ESTIMATOR_NUM; i++)
+    {
+        /* Each estimator pays for the tuple counts it uses. */
+        tuple_cnt_reset();
+        start = get_cycles();
+        r = (estimator[i].func)(buffer, &src, &entropy);
+        end = get_cycles();
+        diff = end - start;
+
+        printf("%-17s: %9d %7.3f %12.0f%s\n", estimator[i].name,
+            EST_SPEED_SAMPLES, diff/(cps*1.0),
+            EST_SPEED_SAMPLES/(diff/(cps*1.0)), (r == 1) ? " (too few)" : "");
+    }
+
+    tuple_cnt_reset();
+    free(buffer);
 }
 
+/* The number of samples in each check that streaming matches buffering. */
+#define CHECK_SAMPLES		(1 << 18)
+
+/*
+ * Check that the streaming counting estimators give exactly the estimates of
+ * the buffered estimators on the same samples. The samples are from a fixed
+ * pseudo-random sequence, skewed so the estimates are below the sample size,
+ * and span many chunks.
+ *
+ * @return  0 when the estimates match and 1 otherwise.
+ */
+int stream_check()
+{
+    int ret = 1;
+    static const uint16_t bits[] = { 1, 4, 8 };
+    ENTROPY_SRC src = { "check", NULL, NULL, NULL, 0, CHECK_SAMPLES, 2 };
+    EST_STATE state;
+    uint16_t *buffer;
+    uint32_t i, j, n;
+    uint32_t x = 0x12345678;
+    double entropy[EST_STATE_NUM];
+    double buffered;
+    int few[EST_STATE_NUM];
+    int r;
+
+    buffer = malloc(CHECK_SAMPLES * sizeof(*buffer));
+    if (buffer == NULL)
+        return 1;
+
+    for (i=0; i<sizeof(bits)/sizeof(*bits); i++)
+    {
+        src.bits = bits[i];
+        for (j=0; j<CHECK_SAMPLES; j++)
+        {
+            x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+            /* Half the samples repeat the previous one. */
+            buffer[j] = ((j > 0) && (x & 0x80000000)) ? buffer[j-1] :
+                (x & ((1 << bits[i]) - 1));
+        }
+
+        if (est_state_init(&state, bits[i]))
+        {
+            est_state_free(&state);
+            goto end;
+        }
+        for (j=0; j<CHECK_SAMPLES; j+=n)
+        {
+            n = STREAM_CHUNK_SAMPLES / 3;
+            if (n > CHECK_SAMPLES - j)
+                n = CHECK_SAMPLES - j;
+            est_state_update(&state, buffer + j, n);
+        }
+        est_state_calc(&state, entropy, few);
+        est_state_free(&state);
+
+        for (j=0; j<EST_STATE_NUM; j++)
+        {
+            r = (estimator[j].func)(buffer, &src, &buffered);
+            printf("%2d bits %-17s: buffered %9.6lf streamed %9.6lf  %s\n",
+                bits[i], estimator[j].name, r ? -1 : buffered,
+                few[j] ? -1 : entropy[j],
+                ((r == few[j]) && (r || (buffered == entropy[j]))) ?
+                "pass" : "FAIL");
+            if ((r != few[j]) || (!r && (buffered != entropy[j])))
+                goto end;
+        }
+    }
+
+    ret = 0;
+end:
+    free(buffer);
+    return ret;
+}
 
 int main(int argc, char *argv[])
 {
@@ -571,6 +3209,13 @@ int main(int argc, char *argv[])
     uint8_t i;
     uint8_t *buffer = NULL;
     int speed = 0;
+    int streaming = 0;
+    int restart = 0;
+    int iid_mode = 0;
+    int sources = 0;
+    double entropy;
+    uint64_t samples = 0;
+    char *save = NULL;
     uint32_t len;
 
     while (--argc)
@@ -578,6 +3223,41 @@ int main(int argc, char *argv[])
         argv++;
         if (strcmp(*argv, "-speed") == 0)
             speed = 1;
+        else if (strcmp(*argv, "-stream") == 0)
+            streaming = 1;
+        else if (strcmp(*argv, "-restart") == 0)
+            restart = 1;
+        else if (strcmp(*argv, "-iid") == 0)
+            iid_mode = 1;
+        else if (strcmp(*argv, "-sources") == 0)
+            sources = 1;
+        else if (strcmp(*argv, "-check") == 0)
+        {
+            r = stream_check();
+            goto end;
+        }
+        else if ((strcmp(*argv, "-samples") == 0) && (argc > 1))
+        {
+            argc--; argv++;
+            samples = strtoull(*argv, NULL, 0);
+        }
+        else if ((strcmp(*argv, "-save") == 0) && (argc > 1))
+        {
+            argc--; argv++;
+            save = *argv;
+        }
+        else if ((strcmp(*argv, "-merge") == 0) && (argc > 1))
+        {
+            r = merge(argv + 1, argc - 1);
+            goto end;
+        }
+        else if (strcmp(*argv, "-perf") == 0)
+            use_perf = 1;
+        else if ((strcmp(*argv, "-threads") == 0) && (argc > 1))
+        {
+            argc--; argv++;
+            est_threads = atoi(*argv);
+        }
         else
         {
             fprintf(stderr, "Option not supported: %s\n", *argv);
@@ -592,22 +3272,72 @@ int main(int argc, char *argv[])
         printf("\n");
         printf("%4s  %7s %5s  %7s %7s\n", "bits", "ops", "secs", "c/op",
             "ops/s");
+        if (use_perf && (perf_open(&perf) == 0))
+            use_perf = 0;
+        if (use_perf)
+            perf_print_header("B");
         entropy_cycles(128);
         entropy_cycles(256);
 
+        printf("\n");
+        source_speed();
+        if (use_perf)
+            perf_close(&perf);
+
+        printf("\n");
+        estimator_speed();
+
+        r = 0;
+        goto end;
+    }
+
+    if (sources)
+    {
+        calc_cps();
+        if (use_perf && (perf_open(&perf) == 0))
+            use_perf = 0;
+        source_speed();
+        if (use_perf)
+            perf_close(&perf);
+
         r = 0;
         goto end;
     }
 
+    if (iid_mode)
+    {
+        r = iid(samples);
+        goto end;
+    }
+
+    if (streaming)
+    {
+        r = stream(samples, save);
+        goto end;
+    }
+
+    if (samples > 0xffffffff)
+    {
+        fprintf(stderr, "Too many samples: %"PRIu64"\n", samples);
+        goto end;
+    }
     for (i=0,len=0; i<ENTROPY_SRC_NUM; i++)
+    {
+        if (samples > 0)
+            entropy_src[i].samples = samples;
         len = (len > entropy_src[i].samples) ? len : entropy_src[i].samples;
+    }
 
     buffer = malloc(sizeof(uint16_t) * len);
+    if (buffer == NULL)
+        goto end;
 
     for (i=0; i<ENTROPY_SRC_NUM; i++)
     {
         collect(&entropy_src[i], buffer);
-        analyze(&entropy_src[i], buffer);
+        analyze(&entropy_src[i], buffer, &entropy);
+        if (restart && restart_test(&entropy_src[i], entropy, &entropy))
+            goto end;
     }
 
     r = 0;
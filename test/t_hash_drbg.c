@@ -0,0 +1,637 @@
+/*
+ * Copyright (c) 2016 Sean Parkinson (sparkinson@iprimus.com.au)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "random.h"
+#include "hash.h"
+
+/* A Hash_DRBG known answer test: no prediction resistance, with reseed. */
+typedef struct hash_drbg_kat_st
+{
+    /* The random number generator identifier. */
+    int id;
+    /* The entropy input to instantiate with. */
+    char *entropy;
+    uint32_t entropy_len;
+    /* The nonce to instantiate with. */
+    char *nonce;
+    uint32_t nonce_len;
+    /* The personalization string to instantiate with. */
+    char *pers;
+    uint32_t pers_len;
+    /* The entropy input to reseed with. */
+    char *entropy_reseed;
+    uint32_t entropy_reseed_len;
+    /* The additional input to reseed with. */
+    char *add_reseed;
+    uint32_t add_reseed_len;
+    /* The additional input of the first generate. */
+    char *add1;
+    uint32_t add1_len;
+    /* The additional input of the second generate. */
+    char *add2;
+    uint32_t add2_len;
+    /* The expected output of the second generate. */
+    char *ret;
+    uint32_t ret_len;
+} HASH_DRBG_KAT;
+
+#include "hash_drbg_kat.h"
+
+/* The maximum length of data in a single differential test operation. */
+#define DIFF_MAX_LEN	200000
+/* The number of operations performed per algorithm in differential test. */
+#define DIFF_OPS	200
+/* The maximum number of segments in a differential test scatter generate. */
+#define DIFF_IOV_MAX	8
+/* The maximum length of a segment in a differential test scatter generate. */
+#define DIFF_IOV_LEN	(DIFF_MAX_LEN / DIFF_IOV_MAX)
+/* The length of the buffer of generated data used for small draws. */
+#define DIFF_BUF_SIZE	4096
+/* The maximum number of bytes generated by one call to the implementation. */
+#define DIFF_CHUNK	(1 << 16)
+/* The maximum length of a differential test file fill - several I/O buffers. */
+#define DIFF_FILL_LEN	(3 << 20)
+/* The maximum offset into the file of a differential test file fill. */
+#define DIFF_FILL_OFF	8192
+/* The maximum length of a digest of the hash algorithms. */
+#define REF_MAX_DIGEST_LEN	64
+
+/* Random number generator algorithm identifiers. */
+static uint8_t id[] =
+{
+    RANDOM_ID_HASH_DRBG_SHA1,
+    RANDOM_ID_HASH_DRBG_SHA224, RANDOM_ID_HASH_DRBG_SHA256,
+    RANDOM_ID_HASH_DRBG_SHA384, RANDOM_ID_HASH_DRBG_SHA512,
+    RANDOM_ID_HASH_DRBG_SHA512_224, RANDOM_ID_HASH_DRBG_SHA512_256,
+};
+/* The hash algorithm identifier of each random number generator. */
+static uint8_t hash_id[] =
+{
+    HASH_ID_SHA1,
+    HASH_ID_SHA224, HASH_ID_SHA256,
+    HASH_ID_SHA384, HASH_ID_SHA512,
+    HASH_ID_SHA512_224, HASH_ID_SHA512_256,
+};
+
+/* The number of algorithm identifiers. */
+#define NUM_ID  ((uint8_t)(sizeof(id)/(sizeof(*id))))
+
+/* Output of the random number generator object under test. */
+static uint8_t out[DIFF_MAX_LEN];
+/* Output of the reference implementation. */
+static uint8_t ref_out[DIFF_MAX_LEN];
+/* Data read back from the file filled in differential test. */
+static uint8_t fill_out[DIFF_FILL_LEN];
+/* Output of reference implementation for a file fill. */
+static uint8_t fill_ref[DIFF_FILL_LEN];
+
+/*
+ * Straightforward Hash_DRBG implementation from SP 800-90A used as the
+ * reference. Shares nothing with the library but the hash functions.
+ */
+typedef struct ref_drbg_st
+{
+    /* The hash object. */
+    HASH *hash;
+    /* The length of the hash output. */
+    int hlen;
+    /* The length of V and C in bytes. */
+    int seed_len;
+    /* The working state V. */
+    uint8_t v[111];
+    /* The constant C. */
+    uint8_t c[111];
+    /* The number of generate requests since instantiation or reseed. */
+    uint64_t reseed_cnt;
+    /* Generated data kept for small draws. */
+    uint8_t buf[DIFF_BUF_SIZE];
+    /* The number of unused bytes at the end of the buffer. */
+    uint32_t buf_len;
+} REF_DRBG;
+
+/*
+ * Hash derivation function: Hash_df(in, seed_len).
+ *
+ * @param [in]  ref  The reference DRBG.
+ * @param [in]  in   The input data.
+ * @param [in]  len  The length of the input data.
+ * @param [out] res  The derived data of seed_len bytes.
+ */
+static void ref_hash_df(REF_DRBG *ref, uint8_t *in, uint32_t len, uint8_t *res)
+{
+    uint8_t pre[5];
+    uint8_t t[REF_MAX_DIGEST_LEN];
+    uint32_t bits = ref->seed_len * 8;
+    int i, n;
+
+    pre[0] = 1;
+    pre[1] = bits >> 24; pre[2] = bits >> 16; pre[3] = bits >> 8;
+    pre[4] = bits;
+    for (i=0; i<ref->seed_len; i+=n, pre[0]++)
+    {
+        HASH_init(ref->hash);
+        HASH_update(ref->hash, pre, sizeof(pre));
+        HASH_update(ref->hash, in, len);
+        HASH_final(ref->hash, t);
+        n = ref->seed_len - i;
+        if (n > ref->hlen) n = ref->hlen;
+        memcpy(res + i, t, n);
+    }
+}
+
+/*
+ * Adds a big-endian number into V modulo 2^seed_len.
+ *
+ * @param [in] ref  The reference DRBG.
+ * @param [in] a    The big-endian number.
+ * @param [in] len  The length of the number in bytes.
+ */
+static void ref_add(REF_DRBG *ref, uint8_t *a, int len)
+{
+    int i, j;
+    unsigned int c = 0;
+
+    for (i=ref->seed_len-1, j=len-1; i>=0; i--, j--)
+    {
+        c += ref->v[i];
+        if (j >= 0) c += a[j];
+        ref->v[i] = c;
+        c >>= 8;
+    }
+}
+
+/*
+ * Instantiate the reference DRBG.
+ *
+ * @param [in] ref    The reference DRBG.
+ * @param [in] ent    The entropy input and nonce.
+ * @param [in] elen   The length of the entropy input and nonce.
+ * @param [in] pers   The personalization string.
+ * @param [in] plen   The length of the personalization string.
+ */
+static void ref_init(REF_DRBG *ref, uint8_t *ent, uint32_t elen, uint8_t *pers,
+    uint32_t plen)
+{
+    uint8_t in[1024];
+
+    memcpy(in, ent, elen);
+    memcpy(in + elen, pers, plen);
+    ref_hash_df(ref, in, elen + plen, ref->v);
+    in[0] = 0;
+    memcpy(in + 1, ref->v, ref->seed_len);
+    ref_hash_df(ref, in, 1 + ref->seed_len, ref->c);
+    ref->reseed_cnt = 1;
+    ref->buf_len = 0;
+}
+
+/*
+ * Reseed the reference DRBG.
+ *
+ * @param [in] ref   The reference DRBG.
+ * @param [in] ent   The entropy input.
+ * @param [in] elen  The length of the entropy input.
+ * @param [in] add   The additional input.
+ * @param [in] alen  The length of the additional input.
+ */
+static void ref_reseed(REF_DRBG *ref, uint8_t *ent, uint32_t elen, uint8_t *add,
+    uint32_t alen)
+{
+    uint8_t in[1024];
+
+    in[0] = 1;
+    memcpy(in + 1, ref->v, ref->seed_len);
+    memcpy(in + 1 + ref->seed_len, ent, elen);
+    memcpy(in + 1 + ref->seed_len + elen, add, alen);
+    ref_hash_df(ref, in, 1 + ref->seed_len + elen + alen, ref->v);
+    in[0] = 0;
+    memcpy(in + 1, ref->v, ref->seed_len);
+    ref_hash_df(ref, in, 1 + ref->seed_len, ref->c);
+    ref->reseed_cnt = 1;
+    ref->buf_len = 0;
+}
+
+/*
+ * Generate data with the reference DRBG in one request.
+ *
+ * @param [in] ref   The reference DRBG.
+ * @param [in] add   The additional input.
+ * @param [in] alen  The length of the additional input.
+ * @param [in] res   The buffer to hold the generated data.
+ * @param [in] len   The length of data to generate.
+ */
+static void ref_gen(REF_DRBG *ref, uint8_t *add, uint32_t alen, uint8_t *res,
+    uint32_t len)
+{
+    uint8_t pre = 2;
+    uint8_t t[REF_MAX_DIGEST_LEN];
+    uint8_t data[111];
+    uint8_t cnt[8];
+    uint32_t i, n;
+    int j;
+
+    if (alen > 0)
+    {
+        HASH_init(ref->hash);
+        HASH_update(ref->hash, &pre, 1);
+        HASH_update(ref->hash, ref->v, ref->seed_len);
+        HASH_update(ref->hash, add, alen);
+        HASH_final(ref->hash, t);
+        ref_add(ref, t, ref->hlen);
+    }
+
+    memcpy(data, ref->v, ref->seed_len);
+    for (i=0; i<len; i+=n)
+    {
+        HASH_init(ref->hash);
+        HASH_update(ref->hash, data, ref->seed_len);
+        HASH_final(ref->hash, t);
+        n = len - i;
+        if (n > (uint32_t)ref->hlen) n = ref->hlen;
+        memcpy(res + i, t, n);
+        for (j=ref->seed_len-1; j>=0 && (++data[j] == 0); j--) ;
+    }
+
+    pre = 3;
+    HASH_init(ref->hash);
+    HASH_update(ref->hash, &pre, 1);
+    HASH_update(ref->hash, ref->v, ref->seed_len);
+    HASH_final(ref->hash, t);
+    ref_add(ref, t, ref->hlen);
+    ref_add(ref, ref->c, ref->seed_len);
+    for (j=0; j<8; j++)
+        cnt[j] = ref->reseed_cnt >> (56 - j*8);
+    ref_add(ref, cnt, 8);
+    ref->reseed_cnt++;
+}
+
+/*
+ * Generate data with the reference DRBG in requests of at most 64KB. The
+ * additional input is used in each request.
+ *
+ * @param [in] ref   The reference DRBG.
+ * @param [in] add   The additional input.
+ * @param [in] alen  The length of the additional input.
+ * @param [in] res   The buffer to hold the generated data.
+ * @param [in] len   The length of data to generate.
+ */
+static void ref_generate(REF_DRBG *ref, uint8_t *add, uint32_t alen,
+    uint8_t *res, uint32_t len)
+{
+    uint32_t n;
+
+    for (; len > 0; res += n, len -= n)
+    {
+        n = (len > DIFF_CHUNK) ? DIFF_CHUNK : len;
+        ref_gen(ref, add, alen, res, n);
+    }
+}
+
+/*
+ * Draw a number in [0, 2^31) from the buffered data of the reference DRBG.
+ * With a power of two bound, the multiply-shift reduction never rejects and
+ * is the top 31 bits of the word.
+ *
+ * @param [in] ref  The reference DRBG.
+ * @return  The bounded number.
+ */
+static uint32_t ref_u31(REF_DRBG *ref)
+{
+    uint32_t w;
+
+    if (ref->buf_len < sizeof(w))
+    {
+        ref_generate(ref, NULL, 0, ref->buf, DIFF_BUF_SIZE);
+        ref->buf_len = DIFF_BUF_SIZE;
+    }
+    memcpy(&w, ref->buf + DIFF_BUF_SIZE - ref->buf_len, sizeof(w));
+    ref->buf_len -= sizeof(w);
+
+    return w >> 1;
+}
+
+/* State of the generator of test operations. */
+static uint64_t diff_state = 0x9e3779b97f4a7c15ULL;
+
+/*
+ * Generate the next 64-bit value for choosing test operations (splitmix64).
+ *
+ * @return  Pseudo-random 64-bit value.
+ */
+static uint64_t diff_next()
+{
+    uint64_t z = (diff_state += 0x9e3779b97f4a7c15ULL);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+/*
+ * Fill a buffer with pseudo-random test data.
+ *
+ * @param [in] data  The buffer to fill.
+ * @param [in] len   The number of bytes to fill.
+ */
+static void diff_fill(uint8_t *data, uint32_t len)
+{
+    uint32_t i;
+
+    for (i=0; i<len; i++)
+        data[i] = diff_next();
+}
+
+/*
+ * Compare generated data against the expected and report a difference.
+ *
+ * @param [in] op    The operation number.
+ * @param [in] what  The name of the operation.
+ * @param [in] a     The generated data.
+ * @param [in] e     The expected data.
+ * @param [in] len   The length of the data.
+ * @return  1 when the data differs.<br>
+ *          0 otherwise.
+ */
+static int diff_cmp(int op, char *what, uint8_t *a, uint8_t *e, uint32_t len)
+{
+    uint32_t i;
+
+    if (memcmp(a, e, len) == 0)
+        return 0;
+
+    for (i=0; a[i] == e[i]; i++) ;
+    fprintf(stderr, "  op %d: %s of %u bytes differs at byte %u\n", op, what,
+        len, i);
+    return 1;
+}
+
+/*
+ * Run a random sequence of operations against the random number generator
+ * object and the reference implementation and compare the output.
+ *
+ * @param [in] idx  The index of the algorithm identifier.
+ * @return  Non-zero when the output differs or an operation fails.
+ */
+static int test_diff(int idx)
+{
+    int ret;
+    RANDOM *random = NULL;
+    REF_DRBG ref;
+    char *name;
+    uint8_t ent[256];
+    uint8_t add[256];
+    uint32_t elen, alen, len, i;
+    uint32_t r;
+    int op, fail = 0;
+    uint32_t cnt;
+    struct iovec iov[DIFF_IOV_MAX];
+    FILE *file = NULL;
+    off_t off;
+
+    memset(&ref, 0, sizeof(ref));
+    ret = HASH_new(hash_id[idx], 0, &ref.hash);
+    if (ret == 0) ret = HASH_get_len(ref.hash, &ref.hlen);
+    if (ret)
+    {
+        fprintf(stderr, "Failed to create hash object: %d\n", ret);
+        goto end;
+    }
+    ref.seed_len = (ref.hlen > 32) ? 111 : 55;
+
+    file = tmpfile();
+    if (file == NULL)
+    {
+        fprintf(stderr, "Failed to create temporary file\n");
+        ret = -1;
+        goto end;
+    }
+
+    ret = RANDOM_new_by_id(ENTROPY_METH_defaults, id[idx], 0, &random);
+    if (ret == 0) ret = RANDOM_get_impl_name(random, &name);
+    if (ret)
+    {
+        fprintf(stderr, "Failed to create random object: %d\n", ret);
+        goto end;
+    }
+
+    elen = ref.hlen + ref.hlen / 2;
+    alen = diff_next() % 64;
+    diff_fill(ent, elen);
+    diff_fill(add, alen);
+    ret = RANDOM_init_with_entropy(random, ent, elen, add, alen);
+    if (ret) goto end;
+    ref_init(&ref, ent, elen, add, alen);
+
+    for (op=0; op<DIFF_OPS; op++)
+    {
+        alen = (diff_next() & 1) ? diff_next() % sizeof(add) : 0;
+        diff_fill(add, alen);
+
+        switch (diff_next() % 7)
+        {
+            case 0:
+                elen = ref.hlen + diff_next() % 64;
+                diff_fill(ent, elen);
+                ret = RANDOM_seed_with_entropy(random, ent, elen,
+                    (alen > 0) ? add : NULL, alen);
+                if (ret) goto end;
+                ref_reseed(&ref, ent, elen, add, alen);
+                break;
+            case 1:
+                /* Large requests are split by the implementation. */
+                len = diff_next() % DIFF_MAX_LEN;
+                ret = RANDOM_generate_with_input(random, add, alen, out, len);
+                if (ret) goto end;
+                ref_generate(&ref, add, alen, ref_out, len);
+                fail |= diff_cmp(op, "generate", out, ref_out, len);
+                break;
+            case 2:
+                len = diff_next() % 1024;
+                ret = RANDOM_generate(random, out, len);
+                if (ret) goto end;
+                ref_generate(&ref, NULL, 0, ref_out, len);
+                fail |= diff_cmp(op, "generate", out, ref_out, len);
+                break;
+            case 3:
+                /* Segments are one stream - the same as one generate. */
+                cnt = diff_next() % DIFF_IOV_MAX;
+                for (i=0,len=0; i<cnt; i++)
+                {
+                    iov[i].iov_base = out + len;
+                    iov[i].iov_len = diff_next() % DIFF_IOV_LEN;
+                    if (diff_next() % 4 == 0)
+                        iov[i].iov_len %= 64;
+                    len += iov[i].iov_len;
+                }
+                ret = RANDOM_generatev(random, iov, cnt);
+                if (ret) goto end;
+                ref_generate(&ref, NULL, 0, ref_out, len);
+                fail |= diff_cmp(op, "generatev", out, ref_out, len);
+                break;
+            case 4:
+                /* A file fill is one stream - the same as one generate. */
+                len = diff_next() % ((diff_next() % 8 == 0) ? DIFF_FILL_LEN :
+                    DIFF_MAX_LEN);
+                off = diff_next() % DIFF_FILL_OFF;
+                ret = RANDOM_fill_fd(random, fileno(file), off, len);
+                if (ret) goto end;
+                if (pread(fileno(file), fill_out, len, off) != (ssize_t)len)
+                {
+                    fprintf(stderr, "  op %d: read back of fill failed\n",
+                        op);
+                    ret = -1;
+                    goto end;
+                }
+                ref_generate(&ref, NULL, 0, fill_ref, len);
+                fail |= diff_cmp(op, "fill fd", fill_out, fill_ref, len);
+                break;
+            default:
+                /* Small draws come from the buffer of generated data. */
+                len = diff_next() % 3000;
+                for (i=0; i<len; i++)
+                {
+                    ret = RANDOM_uniform_u32(random, 1U << 31, &r);
+                    if (ret) goto end;
+                    if (r != ref_u31(&ref))
+                    {
+                        fprintf(stderr, "  op %d: uniform u32 %u differs\n",
+                            op, i);
+                        fail = 1;
+                        break;
+                    }
+                }
+                break;
+        }
+        if (fail)
+            break;
+    }
+
+    printf("%-24s %s\n", name, fail ? "FAIL" : "pass");
+    ret = fail;
+end:
+    if (ret < 0)
+        fprintf(stderr, "Operation failed: %d\n", ret);
+    if (file != NULL)
+        fclose(file);
+    RANDOM_free(random);
+    HASH_free(ref.hash);
+    return ret;
+}
+
+/*
+ * Run the known answer tests for a random number generator algorithm.
+ *
+ * @param [in] idx  The index of the algorithm identifier.
+ * @return  Non-zero when a test fails.
+ */
+static int test_kat(int idx)
+{
+    int ret = 0;
+    RANDOM *random = NULL;
+    HASH_DRBG_KAT *t;
+    uint8_t ent[256];
+    uint8_t res[256];
+    char *name = NULL;
+    int i, cnt = 0, pass = 0;
+
+    ret = RANDOM_new_by_id(ENTROPY_METH_defaults, id[idx], 0, &random);
+    if (ret == 0) ret = RANDOM_get_impl_name(random, &name);
+    if (ret)
+    {
+        fprintf(stderr, "Failed to create random object: %d\n", ret);
+        goto end;
+    }
+
+    for (i=0; i<HASH_DRBG_KAT_NUM; i++)
+    {
+        t = &hash_drbg_kat[i];
+        if (t->id != id[idx])
+            continue;
+        cnt++;
+
+        memcpy(ent, t->entropy, t->entropy_len);
+        memcpy(ent + t->entropy_len, t->nonce, t->nonce_len);
+        ret = RANDOM_init_with_entropy(random, ent,
+            t->entropy_len + t->nonce_len, t->pers, t->pers_len);
+        if (ret == 0)
+            ret = RANDOM_seed_with_entropy(random, t->entropy_reseed,
+                t->entropy_reseed_len, t->add_reseed, t->add_reseed_len);
+        if (ret == 0)
+            ret = RANDOM_generate_with_input(random, t->add1, t->add1_len,
+                res, t->ret_len);
+        if (ret == 0)
+            ret = RANDOM_generate_with_input(random, t->add2, t->add2_len,
+                res, t->ret_len);
+        if (ret)
+        {
+            fprintf(stderr, "  test %d: operation failed: %d\n", i, ret);
+            goto end;
+        }
+
+        if (memcmp(res, t->ret, t->ret_len) == 0)
+            pass++;
+        else
+            fprintf(stderr, "  test %d: returned bits differ\n", i);
+    }
+
+    printf("%-24s %3d/%3d\n", name, pass, cnt);
+    ret = (cnt == 0) || (pass != cnt);
+end:
+    RANDOM_free(random);
+    return ret;
+}
+
+int main(int argc, char *argv[])
+{
+    int ret = 0;
+    int diff = 0;
+    uint8_t i;
+
+    while (--argc)
+    {
+        argv++;
+
+        if (strcmp(*argv, "-diff") == 0)
+            diff = 1;
+        else if ((strcmp(*argv, "-seed") == 0) && (argc > 1))
+        {
+            argc--; argv++;
+            diff_state = strtoull(*argv, NULL, 0);
+        }
+    }
+
+    if (diff)
+        printf("Differential (seed 0x%016llx, %d ops)\n",
+            (unsigned long long)diff_state, DIFF_OPS);
+    else
+        printf("Known answer tests: %s\n", "Hash_DRBG.txt");
+
+    for (i=0; i<NUM_ID; i++)
+        ret |= diff ? test_diff(i) : test_kat(i);
+
+    return ret != 0;
+}
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2016 Sean Parkinson (sparkinson@iprimus.com.au)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Hardware performance counters for the speed tests.
+ * Uses perf_event_open on Linux. Counters that can't be opened - no PMU,
+ * restricted by perf_event_paranoid, other operating systems - are reported
+ * as unavailable and the speed tests run as normal.
+ */
+
+#ifndef T_PERF_H
+#define T_PERF_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifdef OS_LINUX
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+/* Counter of cycles. */
+#define PERF_CYCLES		0
+/* Counter of instructions retired. */
+#define PERF_INSTRUCTIONS	1
+/* Counter of mispredicted branches. */
+#define PERF_BRANCH_MISSES	2
+/* Counter of L1 data cache read misses. */
+#define PERF_L1D_MISSES		3
+/* Counter of last level cache misses. */
+#define PERF_LLC_MISSES		4
+/* The number of counters. */
+#define PERF_NUM		5
+
+/* A set of hardware performance counters. */
+typedef struct perf_st
+{
+    /* The file descriptor of each counter. -1 when unavailable. */
+    int fd[PERF_NUM];
+    /* The value of each counter when last stopped. */
+    uint64_t val[PERF_NUM];
+} PERF;
+
+/*
+ * Open the hardware performance counters. Counters are opened separately so
+ * that one being unavailable doesn't lose the others.
+ *
+ * @param [in] perf  The performance counters.
+ * @return  The number of counters opened.
+ */
+static int perf_open(PERF *perf)
+{
+    int i, cnt = 0;
+#ifdef OS_LINUX
+    struct perf_event_attr attr;
+    static const uint32_t type[PERF_NUM] =
+    {
+        PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+        PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE
+    };
+    static const uint64_t config[PERF_NUM] =
+    {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_BRANCH_MISSES,
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+            (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+        PERF_COUNT_HW_CACHE_MISSES
+    };
+
+    for (i=0; i<PERF_NUM; i++)
+    {
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type[i];
+        attr.config = config[i];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        perf->fd[i] = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+        if (perf->fd[i] >= 0)
+            cnt++;
+        perf->val[i] = 0;
+    }
+#else
+    for (i=0; i<PERF_NUM; i++)
+    {
+        perf->fd[i] = -1;
+        perf->val[i] = 0;
+    }
+#endif
+    if (cnt == 0)
+        fprintf(stderr, "Performance counters unavailable\n");
+    return cnt;
+}
+
+/*
+ * Close the hardware performance counters.
+ *
+ * @param [in] perf  The performance counters.
+ */
+static void perf_close(PERF *perf)
+{
+    int i;
+
+    for (i=0; i<PERF_NUM; i++)
+    {
+        if (perf->fd[i] >= 0)
+            close(perf->fd[i]);
+        perf->fd[i] = -1;
+    }
+}
+
+/*
+ * Reset and start the hardware performance counters.
+ *
+ * @param [in] perf  The performance counters.
+ */
+static void perf_start(PERF *perf)
+{
+#ifdef OS_LINUX
+    int i;
+
+    for (i=0; i<PERF_NUM; i++)
+    {
+        if (perf->fd[i] >= 0)
+        {
+            ioctl(perf->fd[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(perf->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#else
+    (void)perf;
+#endif
+}
+
+/*
+ * Stop the hardware performance counters and read their values.
+ *
+ * @param [in] perf  The performance counters.
+ */
+static void perf_stop(PERF *perf)
+{
+#ifdef OS_LINUX
+    int i;
+
+    for (i=0; i<PERF_NUM; i++)
+    {
+        if (perf->fd[i] >= 0)
+            ioctl(perf->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+    }
+    for (i=0; i<PERF_NUM; i++)
+    {
+        if ((perf->fd[i] < 0) ||
+            (read(perf->fd[i], &perf->val[i], sizeof(perf->val[i])) !=
+             sizeof(perf->val[i])))
+        {
+            perf->val[i] = 0;
+        }
+    }
+#else
+    (void)perf;
+#endif
+}
+
+/*
+ * Print the header of the performance counter report.
+ *
+ * @param [in] unit  The name of the unit the counts are divided by.
+ */
+static void perf_print_header(char *unit)
+{
+    printf("%6s  %5s %10s %10s %10s\n", "", "IPC", "brmiss/", "L1miss/",
+        "LLCmiss/");
+    printf("%6s  %5s %10s %10s %10s\n", "", "", unit, unit, unit);
+}
+
+/*
+ * Print the performance counter report of the last run.
+ *
+ * @param [in] perf  The performance counters.
+ * @param [in] num   The number of units processed - bytes, samples, etc.
+ */
+static void perf_print(PERF *perf, double num)
+{
+    int i;
+
+    printf("%6s  ", "");
+    if ((perf->fd[PERF_CYCLES] >= 0) && (perf->fd[PERF_INSTRUCTIONS] >= 0) &&
+        (perf->val[PERF_CYCLES] > 0))
+    {
+        printf("%5.2f", (double)perf->val[PERF_INSTRUCTIONS] /
+            perf->val[PERF_CYCLES]);
+    }
+    else
+        printf("%5s", "-");
+    for (i=PERF_BRANCH_MISSES; i<PERF_NUM; i++)
+    {
+        if (perf->fd[i] >= 0)
+            printf(" %10.4f", perf->val[i] / num);
+        else
+            printf(" %10s", "-");
+    }
+    printf("\n");
+}
+
+#endif /* T_PERF_H */
@@ -20,13 +20,28 @@
  * SOFTWARE.
  */
 
+#ifdef OS_LINUX
+#define _GNU_SOURCE
+#endif
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
+#include <math.h>
 #include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#ifdef OS_LINUX
+#include <sched.h>
+#endif
 
 #include "random.h"
+#include "random_svc.h"
+#include "t_perf.h"
 
 #define T_RANDOM_LEN	64
 
@@ -41,6 +56,42 @@ static unsigned char out[16384];
 /* The output lengths to test in speed test. */
 static int olen[] = { 1, 32, 64, 1024, 8192, 16384 };
 
+/* The exclusive upper bound of numbers in the uniform speed test. */
+#define UNIFORM_BOUND	1000003
+/* The number of numbers generated per array in the uniform speed test. */
+#define UNIFORM_NUM	(1 << 20)
+/* Array of bounded random numbers to generate into. */
+static uint64_t uniform[UNIFORM_NUM];
+
+/* The number of bits of sub-bucket in the latency histogram - 2^-5 = ~3%. */
+#define LAT_SUB_BITS	5
+/* The number of sub-buckets per power of two in the latency histogram. */
+#define LAT_SUB		(1 << LAT_SUB_BITS)
+/* The number of buckets in the latency histogram: all 64-bit values. */
+#define LAT_BUCKETS	((64 - LAT_SUB_BITS + 1) * LAT_SUB)
+/* Log-linear histogram of call latencies in cycles. */
+static uint64_t lat_hist[LAT_BUCKETS];
+
+/* The output lengths to test in the thread scaling test. */
+static int thread_olen[] = { 32, 1024, 16384 };
+/* The number of seconds each thread scaling test runs for. */
+#define THREAD_SECS	1
+/* The maximum number of threads in the thread scaling test. */
+#define THREAD_MAX	256
+
+/* Thread scaling test: one random object shared by all threads, locked. */
+#define THREAD_MODE_LOCKED	0
+/* Thread scaling test: one random object for each thread. */
+#define THREAD_MODE_PER_THREAD	1
+/* Thread scaling test: one random object shared by all threads through the
+ * combining front-end. */
+#define THREAD_MODE_COMBINED	2
+/* The names of the thread scaling test modes. */
+static char *thread_mode_name[] = { "locked", "per-thread", "combined" };
+/* The number of thread scaling test modes. */
+#define THREAD_MODE_NUM \
+    ((int)(sizeof(thread_mode_name)/sizeof(*thread_mode_name)))
+
 /* Random number generator algorithm identifiers. */
 static uint8_t id[] =
 {
@@ -53,6 +104,13 @@ static uint8_t id[] =
 /* The number of algorithm identifiers. */
 #define NUM_ID  ((uint8_t)(sizeof(id)/(sizeof(*id))))
 
+/* Hardware performance counters - opened with -perf. */
+static PERF perf;
+/* Whether to report hardware performance counters. */
+static int use_perf = 0;
+/* Whether to print the statistics of the random object after testing. */
+static int use_stats = 0;
+
 /* Number of cycles/sec. */
 uint64_t cps = 0;
 
@@ -109,10 +167,14 @@ void random_cycles(RANDOM *random, unsigned char *out, int olen)
     num_ops = cps/((end-start)/200);
 
     /* Perform about 1 seconds worth of operations. */
+    if (use_perf)
+        perf_start(&perf);
     start = get_cycles();
     for (i=0; i<num_ops; i++)
         RANDOM_generate(random, out, olen);
     end = get_cycles();
+    if (use_perf)
+        perf_stop(&perf);
 
     diff = end - start;
 
@@ -120,13 +182,1326 @@ void random_cycles(RANDOM *random, unsigned char *out, int olen)
         olen, num_ops, diff/(cps*1.0), diff/num_ops, cps/(diff/num_ops),
         (double)diff/num_ops/olen, cps/((double)diff/num_ops)*olen,
         (cps/((double)diff/num_ops)*olen)/1000000);
+    if (use_perf)
+        perf_print(&perf, (double)num_ops*olen);
+}
+
+/*
+ * Generate bounded random numbers of the kind selected.
+ *
+ * @param [in] random  The random object to use.
+ * @param [in] kind    The kind of generation: 0 - u32, 1 - u64,
+ *                     2 - u32 array, 3 - u64 array, 4 - double array,
+ *                     5 - float array, 6 - dense double array,
+ *                     7 - shuffle array, 8 - sample indices,
+ *                     9 - normal array, 10 - exponential array.
+ * @return  Number of random numbers generated.
+ */
+static int uniform_gen(RANDOM *random, int kind)
+{
+    uint32_t r32;
+    uint64_t r64;
+
+    switch (kind)
+    {
+        case 0:
+            RANDOM_uniform_u32(random, UNIFORM_BOUND, &r32);
+            return 1;
+        case 1:
+            RANDOM_uniform_u64(random, UNIFORM_BOUND, &r64);
+            return 1;
+        case 2:
+            RANDOM_uniform_u32_array(random, UNIFORM_BOUND,
+                (uint32_t *)uniform, UNIFORM_NUM);
+            return UNIFORM_NUM;
+        case 3:
+            RANDOM_uniform_u64_array(random, UNIFORM_BOUND, uniform,
+                UNIFORM_NUM);
+            return UNIFORM_NUM;
+        case 4:
+            RANDOM_fill_double(random, (double *)uniform, UNIFORM_NUM, 0);
+            return UNIFORM_NUM;
+        case 5:
+            RANDOM_fill_float(random, (float *)uniform, UNIFORM_NUM, 0);
+            return UNIFORM_NUM;
+        case 6:
+            RANDOM_fill_double(random, (double *)uniform, UNIFORM_NUM,
+                RANDOM_FLOAT_DENSE);
+            return UNIFORM_NUM;
+        case 7:
+            RANDOM_shuffle(random, uniform, UNIFORM_NUM, sizeof(*uniform));
+            return UNIFORM_NUM;
+        case 8:
+            RANDOM_sample_indices(random, 1 << 30, UNIFORM_NUM,
+                (uint32_t *)uniform);
+            return UNIFORM_NUM;
+        case 9:
+            RANDOM_fill_normal(random, (double *)uniform, UNIFORM_NUM);
+            return UNIFORM_NUM;
+        default:
+            RANDOM_fill_exponential(random, (double *)uniform, UNIFORM_NUM);
+            return UNIFORM_NUM;
+    }
+}
+
+/*
+ * Determine the number of bounded random numbers that can be generated per
+ * second.
+ *
+ * @param [in] random  The random object to use.
+ * @param [in] kind    The kind of generation - see uniform_gen().
+ */
+void uniform_cycles(RANDOM *random, int kind)
+{
+    static char *name[] = { "u32", "u64", "u32[]", "u64[]", "f64[]", "f32[]",
+                            "f64d[]", "shuf[]", "smpl[]", "norm[]",
+                            "exp[]" };
+    int i;
+    uint64_t start, end, diff;
+    int num_ops;
+    uint64_t num = 0;
+    /* Single draws are cheap - approximate over many buffer refills. */
+    int approx = (kind < 2) ? 100000 : 2;
+
+    RANDOM_init(random, NULL, 0);
+
+    /* Prime the caches, etc */
+    for (i=0; i<approx; i++)
+        uniform_gen(random, kind);
+
+    /* Approximate number of ops in a second. */
+    start = get_cycles();
+    for (i=0; i<approx; i++)
+        uniform_gen(random, kind);
+    end = get_cycles();
+    num_ops = cps/((end-start)/approx);
+
+    /* Perform about 1 seconds worth of operations. */
+    start = get_cycles();
+    for (i=0; i<num_ops; i++)
+        num += uniform_gen(random, kind);
+    end = get_cycles();
+
+    diff = end - start;
+
+    printf("%6s: %10"PRIu64" %2.3f  %7.2f %11.0f\n", name[kind], num,
+        diff/(cps*1.0), (double)diff/num, cps/((double)diff/num));
+}
+
+/*
+ * Get the index of the latency histogram bucket for a value.
+ * Values below LAT_SUB have their own bucket. Above, each power of two is
+ * split into LAT_SUB linear buckets.
+ *
+ * @param [in] v  The latency in cycles.
+ * @return  The index of the bucket.
+ */
+static int lat_index(uint64_t v)
+{
+    int shift;
+
+    if (v < LAT_SUB)
+        return (int)v;
+    shift = 63 - __builtin_clzll(v) - LAT_SUB_BITS;
+    return (shift + 1) * LAT_SUB + (int)((v >> shift) - LAT_SUB);
+}
+
+/*
+ * Get the highest value that is counted in a latency histogram bucket.
+ *
+ * @param [in] idx  The index of the bucket.
+ * @return  The highest value of the bucket.
+ */
+static uint64_t lat_value(int idx)
+{
+    int shift;
+
+    if (idx < 2 * LAT_SUB)
+        return idx;
+    shift = idx / LAT_SUB - 1;
+    return ((((uint64_t)LAT_SUB + idx % LAT_SUB) + 1) << shift) - 1;
+}
+
+/*
+ * Get the latency at a percentile of the calls in the histogram.
+ *
+ * @param [in] num  The number of calls in the histogram.
+ * @param [in] pc   The percentile.
+ * @return  The latency of the call at the percentile.
+ */
+static uint64_t lat_percentile(uint64_t num, double pc)
+{
+    uint64_t cnt = 0;
+    uint64_t want = (uint64_t)(num * pc / 100.0 + 0.5);
+    int i;
+
+    if (want == 0)
+        want = 1;
+    for (i=0; i<LAT_BUCKETS; i++)
+    {
+        cnt += lat_hist[i];
+        if (cnt >= want)
+            break;
+    }
+    return lat_value(i);
+}
+
+/*
+ * Measure the latency of each call to generate and print the percentiles.
+ * Optionally reseeds every reseed calls - the reseed counts towards the
+ * latency of the call it precedes.
+ *
+ * @param [in] random  The random object to use.
+ * @param [in] out     The buffer to generate into.
+ * @param [in] olen    The length of data to generate in each call.
+ * @param [in] reseed  The number of calls between reseeds. 0 to never reseed.
+ */
+void latency_cycles(RANDOM *random, unsigned char *out, int olen, int reseed)
+{
+    int i;
+    uint64_t start, end, diff, max = 0, total = 0;
+    int num_ops;
+
+    RANDOM_init(random, NULL, 0);
+    memset(lat_hist, 0, sizeof(lat_hist));
+
+    /* Prime the caches, etc */
+    for (i=0; i<100000/olen; i++)
+        RANDOM_generate(random, out, olen);
+
+    /* Approximate number of ops in a second. */
+    start = get_cycles();
+    for (i=0; i<200; i++)
+        RANDOM_generate(random, out, olen);
+    end = get_cycles();
+    num_ops = cps/((end-start)/200);
+
+    /* Time each of about 1 seconds worth of operations. */
+    for (i=0; i<num_ops; i++)
+    {
+        start = get_cycles();
+        if ((reseed > 0) && (i % reseed == reseed - 1))
+            RANDOM_seed(random, NULL, 0);
+        RANDOM_generate(random, out, olen);
+        end = get_cycles();
+
+        diff = end - start;
+        lat_hist[lat_index(diff)]++;
+        total += diff;
+        if (diff > max)
+            max = diff;
+    }
+
+    printf("%6d: %8d %9.1f %8"PRIu64" %8"PRIu64" %8"PRIu64" %8"PRIu64
+        " %9"PRIu64"\n", olen, num_ops, (double)total/num_ops,
+        lat_percentile(num_ops, 50), lat_percentile(num_ops, 90),
+        lat_percentile(num_ops, 99), lat_percentile(num_ops, 99.9), max);
+}
+
+/* The data of a thread in the thread scaling test. */
+typedef struct thread_data_st
+{
+    /* The pthread handle. */
+    pthread_t thread;
+    /* The index of the thread - used to pick the CPU to run on. */
+    int idx;
+    /* The random number generator algorithm identifier. */
+    int id;
+    /* The thread scaling test mode. */
+    int mode;
+    /* The length of data to generate in each call. */
+    int olen;
+    /* The shared random object or NULL when one is to be created. */
+    RANDOM *random;
+    /* The combining front-end of the shared random object. */
+    RANDOM_SHARED *shared;
+    /* The number of bytes generated. */
+    uint64_t bytes;
+    /* The number of seconds the thread generated data for. */
+    double secs;
+    /* The result of the thread's operations. */
+    int ret;
+    /* The buffer to generate into. */
+    unsigned char out[16384];
+} THREAD_DATA;
+
+/* Lock protecting the shared random object. */
+static pthread_mutex_t thread_lock = PTHREAD_MUTEX_INITIALIZER;
+/* Lock and condition used to start all threads and the timer together. */
+static pthread_mutex_t thread_start_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t thread_start_cond = PTHREAD_COND_INITIALIZER;
+/* The number of threads ready to generate. */
+static int thread_ready;
+/* Set when the threads are to start generating. */
+static int thread_go;
+/* Set when the threads are to stop generating. */
+static volatile int thread_stop;
+
+/*
+ * Get the current time in seconds from a monotonic clock.
+ *
+ * @return  Time in seconds.
+ */
+static double get_secs()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+}
+
+/*
+ * Pin the calling thread to a CPU. Threads are spread over the online CPUs
+ * in order.
+ *
+ * @param [in] idx  The index of the thread.
+ */
+static void thread_pin(int idx)
+{
+#ifdef OS_LINUX
+    cpu_set_t set;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (cpus <= 0)
+        cpus = 1;
+    CPU_ZERO(&set);
+    CPU_SET(idx % cpus, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)idx;
+#endif
+}
+
+/*
+ * Generate data until told to stop.
+ *
+ * @param [in] arg  The thread's data.
+ * @return  NULL.
+ */
+static void *thread_gen(void *arg)
+{
+    THREAD_DATA *t = arg;
+    RANDOM *random = t->random;
+    double start;
+
+    thread_pin(t->idx);
+
+    if (random == NULL)
+    {
+        t->ret = RANDOM_new_by_id(ENTROPY_METH_defaults, t->id, 0, &random);
+        if (t->ret == 0)
+            t->ret = RANDOM_init(random, NULL, 0);
+    }
+
+    pthread_mutex_lock(&thread_start_lock);
+    thread_ready++;
+    pthread_cond_broadcast(&thread_start_cond);
+    while (!thread_go)
+        pthread_cond_wait(&thread_start_cond, &thread_start_lock);
+    pthread_mutex_unlock(&thread_start_lock);
+    start = get_secs();
+
+    while ((t->ret == 0) && !thread_stop)
+    {
+        if (t->mode == THREAD_MODE_LOCKED)
+        {
+            pthread_mutex_lock(&thread_lock);
+            t->ret = RANDOM_generate(random, t->out, t->olen);
+            pthread_mutex_unlock(&thread_lock);
+        }
+        else if (t->mode == THREAD_MODE_COMBINED)
+            t->ret = RANDOM_SHARED_generate(t->shared, t->out, t->olen);
+        else
+            t->ret = RANDOM_generate(random, t->out, t->olen);
+        t->bytes += t->olen;
+    }
+
+    t->secs = get_secs() - start;
+    if (t->random == NULL)
+        RANDOM_free(random);
+    return NULL;
+}
+
+/*
+ * Determine the rate of generation with multiple threads for a mode and
+ * output length. Prints the aggregate and per-thread rates.
+ *
+ * @param [in] id       The random number generator algorithm identifier.
+ * @param [in] mode     The thread scaling test mode.
+ * @param [in] olen     The length of data to generate in each call.
+ * @param [in] threads  The number of threads.
+ * @return  Non-zero when creating a thread or generating fails.
+ */
+static int thread_cycles(int id, int mode, int olen, int threads)
+{
+    int ret = 0;
+    RANDOM *random = NULL;
+    RANDOM_SHARED *shared = NULL;
+    THREAD_DATA *t = NULL;
+    int i, started = 0;
+    uint64_t bytes = 0;
+    double secs = 0, rate, min = 0, max = 0;
+
+    t = calloc(threads, sizeof(*t));
+    if (t == NULL)
+    {
+        ret = 1;
+        goto end;
+    }
+
+    if (mode != THREAD_MODE_PER_THREAD)
+    {
+        ret = RANDOM_new_by_id(ENTROPY_METH_defaults, id, 0, &random);
+        if (ret == 0)
+            ret = RANDOM_init(random, NULL, 0);
+        if ((ret == 0) && (mode == THREAD_MODE_COMBINED))
+            ret = RANDOM_SHARED_new(random, &shared);
+        if (ret != 0) goto end;
+    }
+
+    thread_ready = 0;
+    thread_go = 0;
+    thread_stop = 0;
+    for (i=0; i<threads; i++)
+    {
+        t[i].idx = i;
+        t[i].id = id;
+        t[i].mode = mode;
+        t[i].olen = olen;
+        t[i].random = random;
+        t[i].shared = shared;
+        if (pthread_create(&t[i].thread, NULL, thread_gen, &t[i]) != 0)
+            break;
+        started++;
+    }
+    if (started < threads)
+    {
+        fprintf(stderr, "Failed to create thread %d\n", started);
+        for (i=started; i<threads; i++)
+            t[i].ret = 1;
+        thread_stop = 1;
+    }
+
+    /* Start timing when all threads are ready. */
+    pthread_mutex_lock(&thread_start_lock);
+    while (thread_ready < started)
+        pthread_cond_wait(&thread_start_cond, &thread_start_lock);
+    thread_go = 1;
+    pthread_cond_broadcast(&thread_start_cond);
+    pthread_mutex_unlock(&thread_start_lock);
+    if (started == threads)
+        sleep(THREAD_SECS);
+    thread_stop = 1;
+
+    for (i=0; i<started; i++)
+        pthread_join(t[i].thread, NULL);
+
+    for (i=0; i<threads; i++)
+    {
+        ret |= t[i].ret;
+        bytes += t[i].bytes;
+        if (t[i].secs > secs)
+            secs = t[i].secs;
+        rate = t[i].secs > 0 ? t[i].bytes / t[i].secs / 1000000 : 0;
+        if ((i == 0) || (rate < min))
+            min = rate;
+        if ((i == 0) || (rate > max))
+            max = rate;
+    }
+    if (ret != 0)
+    {
+        fprintf(stderr, "Failed to generate in thread: %d\n", ret);
+        goto end;
+    }
+
+    printf("%-10s %6d: %3d %5.3f %9.2f %9.2f %9.2f %9.2f\n",
+        thread_mode_name[mode], olen, threads, secs, bytes / secs / 1000000,
+        bytes / secs / 1000000 / threads, min, max);
+end:
+    RANDOM_SHARED_free(shared);
+    RANDOM_free(random);
+    free(t);
+    return ret;
+}
+
+/* The number of bytes compared between two clients of the service. */
+#define SVC_CMP_LEN	64
+
+/* Set to stop the random byte service's server. */
+static volatile int svc_stop;
+
+/*
+ * Run the server of the random byte service until stopped.
+ *
+ * @param [in] arg  The server.
+ * @return  NULL.
+ */
+static void *svc_server(void *arg)
+{
+    RANDOM_SVC_server_run(arg, &svc_stop);
+    return NULL;
+}
+
+/*
+ * Determine the rate of generation by a client of the random byte service, or
+ * of a random object when the client is NULL, for about a second.
+ *
+ * @param [in] svc     The client or NULL.
+ * @param [in] random  The random object used when the client is NULL.
+ * @param [in] olen    The length of data to generate in each call.
+ * @return  Non-zero when generating fails.
+ */
+static int svc_cycles(RANDOM_SVC *svc, RANDOM *random, int olen)
+{
+    int ret = 0;
+    uint64_t bytes = 0, shared0 = 0, local0 = 0, shared, local;
+    double start, secs;
+
+    if (svc != NULL)
+        RANDOM_SVC_get_bytes(svc, &shared0, &local0);
+    start = get_secs();
+    do
+    {
+        if (svc != NULL)
+            ret = RANDOM_SVC_generate(svc, out, olen);
+        else
+            ret = RANDOM_generate(random, out, olen);
+        bytes += olen;
+        secs = get_secs() - start;
+    }
+    while ((ret == 0) && (secs < THREAD_SECS));
+    if (ret != 0)
+    {
+        fprintf(stderr, "Failed to generate: %d\n", ret);
+        goto end;
+    }
+
+    if (svc != NULL)
+    {
+        RANDOM_SVC_get_bytes(svc, &shared, &local);
+        printf("%-10s %6d: %5.3f %9.2f %7.1f%%\n", "service", olen, secs,
+            bytes / secs / 1000000,
+            (shared - shared0) * 100.0 / bytes);
+    }
+    else
+    {
+        printf("%-10s %6d: %5.3f %9.2f\n", "local", olen, secs,
+            bytes / secs / 1000000);
+    }
+end:
+    return ret;
+}
+
+/*
+ * Determine whether this process owns a slot of the random byte service.
+ *
+ * @param [in] name  The name of the shared memory.
+ * @return  1 when a slot is owned and 0 otherwise.
+ */
+static int svc_owns_slot(const char *name)
+{
+    int fd;
+    int owned = 0;
+    uint32_t i;
+    RANDOM_SVC_HDR *hdr = MAP_FAILED;
+    RANDOM_SVC_SLOT *slot;
+    size_t len = sizeof(*hdr) + RANDOM_SVC_SLOTS * sizeof(*slot);
+
+    fd = shm_open(name, O_RDONLY, 0);
+    if (fd != -1)
+    {
+        hdr = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+    }
+    if (hdr == MAP_FAILED)
+        return 0;
+    slot = (RANDOM_SVC_SLOT *)(hdr + 1);
+    for (i=0; i<RANDOM_SVC_SLOTS; i++)
+        owned |= (slot[i].owner == (int32_t)getpid());
+    munmap(hdr, len);
+    return owned;
+}
+
+/*
+ * Check that the child of a fork gets different data from the parent through
+ * the same client. The parent generates after the child has exited.
+ *
+ * @param [in] svc   The client.
+ * @param [in] name  The name of the shared memory when connected, else NULL.
+ * @return  Non-zero when a check or generating fails.
+ */
+static int svc_fork_check(RANDOM_SVC *svc, const char *name)
+{
+    int ret = 1;
+    int i;
+    int fds[2];
+    int status;
+    ssize_t len;
+    pid_t pid;
+    uint8_t data[2][SVC_CMP_LEN];
+    uint64_t shared0, shared, local;
+
+    /* Wait for the server to fill the ring so the parent takes its bytes
+     * from the slot after the fork. */
+    RANDOM_SVC_get_bytes(svc, &shared0, &local);
+    for (i=0; RANDOM_SVC_is_shared(svc) && (i<1000); i++)
+    {
+        if (RANDOM_SVC_generate(svc, data[0], 1) != 0)
+            goto end;
+        RANDOM_SVC_get_bytes(svc, &shared, &local);
+        if (shared > shared0)
+            break;
+        usleep(1000);
+    }
+
+    if (pipe(fds) != 0)
+        goto end;
+    RANDOM_SVC_get_bytes(svc, &shared0, &local);
+    pid = fork();
+    if (pid == 0)
+    {
+        close(fds[0]);
+        status = (RANDOM_SVC_generate(svc, data[0], SVC_CMP_LEN) != 0) ||
+            (write(fds[1], data[0], SVC_CMP_LEN) != SVC_CMP_LEN);
+        RANDOM_SVC_free(svc);
+        _exit(status);
+    }
+    close(fds[1]);
+    if (pid == -1)
+    {
+        close(fds[0]);
+        goto end;
+    }
+    len = read(fds[0], data[0], SVC_CMP_LEN);
+    close(fds[0]);
+    if ((waitpid(pid, &status, 0) != pid) || !WIFEXITED(status) ||
+        (WEXITSTATUS(status) != 0) || (len != SVC_CMP_LEN))
+    {
+        fprintf(stderr, "Child of fork failed to generate\n");
+        goto end;
+    }
+
+    if (RANDOM_SVC_generate(svc, data[1], SVC_CMP_LEN) != 0)
+        goto end;
+    if (memcmp(data[0], data[1], SVC_CMP_LEN) == 0)
+    {
+        fprintf(stderr, "Child of fork got the parent's data\n");
+        goto end;
+    }
+    /* The child didn't give back the parent's slot. */
+    RANDOM_SVC_get_bytes(svc, &shared, &local);
+    if ((name != NULL) && ((shared != shared0 + SVC_CMP_LEN) ||
+        !svc_owns_slot(name)))
+    {
+        fprintf(stderr, "Parent lost its slot after fork\n");
+        goto end;
+    }
+    ret = 0;
+end:
+    return ret;
+}
+
+/*
+ * Check that the server skips a slot whose tail, written by the client, is
+ * ahead of the head rather than writing past the ring.
+ *
+ * @param [in] random  The random object to fill the rings with.
+ * @return  Non-zero when a check fails.
+ */
+static int svc_corrupt_check(RANDOM *random)
+{
+    int ret = 1;
+    int fd;
+    char name[64];
+    RANDOM_SVC_SERVER *srv = NULL;
+    RANDOM_SVC *svc = NULL;
+    RANDOM_SVC_HDR *hdr = MAP_FAILED;
+    RANDOM_SVC_SLOT *slot;
+    size_t len = sizeof(*hdr) + 2 * sizeof(*slot);
+    uint64_t filled, head;
+
+    snprintf(name, sizeof(name), "/t_random_svc_bad_%d", (int)getpid());
+    if ((RANDOM_SVC_server_new(random, name, 2, 4096, &srv) != 0) ||
+        (RANDOM_SVC_new(name, &svc) != 0) || !RANDOM_SVC_is_shared(svc) ||
+        (RANDOM_SVC_server_fill(srv, &filled) != 0))
+    {
+        fprintf(stderr, "Failed to set up service\n");
+        goto end;
+    }
+
+    fd = shm_open(name, O_RDWR, 0);
+    if (fd != -1)
+    {
+        hdr = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+    }
+    if (hdr == MAP_FAILED)
+        goto end;
+    slot = (RANDOM_SVC_SLOT *)(hdr + 1);
+    head = slot->head;
+    slot->tail = head + 6000;
+
+    if ((RANDOM_SVC_server_fill(srv, &filled) != 0) || (filled != 0) ||
+        (slot->head != head))
+    {
+        fprintf(stderr, "Server filled a corrupt slot\n");
+        goto end;
+    }
+    ret = 0;
+end:
+    if (hdr != MAP_FAILED)
+        munmap(hdr, len);
+    RANDOM_SVC_free(svc);
+    RANDOM_SVC_server_free(srv);
+    return ret;
+}
+
+/*
+ * Check whether a client connects to shared memory with a mode and, when not
+ * -1, an owner.
+ *
+ * @param [in] name  The name of the shared memory.
+ * @param [in] mode  The mode to give the shared memory.
+ * @param [in] uid   The user to give the shared memory or -1 to keep it.
+ * @return  1 when the client connected, 0 when not and -1 on error.
+ */
+static int svc_perm_connects(const char *name, mode_t mode, uid_t uid)
+{
+    int ret = -1;
+    int fd;
+    RANDOM_SVC *svc = NULL;
+
+    fd = shm_open(name, O_RDWR, 0);
+    if (fd == -1)
+        goto end;
+    if ((fchmod(fd, mode) != 0) ||
+        ((uid != (uid_t)-1) && (fchown(fd, uid, (gid_t)-1) != 0)))
+    {
+        close(fd);
+        goto end;
+    }
+    close(fd);
+
+    if (RANDOM_SVC_new(name, &svc) == 0)
+        ret = RANDOM_SVC_is_shared(svc);
+end:
+    RANDOM_SVC_free(svc);
+    return ret;
+}
+
+/*
+ * Check that a client only connects to shared memory that other users can't
+ * write: not when group or other accessible and, when running as root, not
+ * when owned by another user.
+ *
+ * @param [in] random  The random object to fill the rings with.
+ * @return  Non-zero when a check fails.
+ */
+static int svc_perm_check(RANDOM *random)
+{
+    int ret = 1;
+    char name[64];
+    RANDOM_SVC_SERVER *srv = NULL;
+
+    snprintf(name, sizeof(name), "/t_random_svc_perm_%d", (int)getpid());
+    if (RANDOM_SVC_server_new(random, name, 2, 4096, &srv) != 0)
+    {
+        fprintf(stderr, "Failed to set up service\n");
+        goto end;
+    }
+
+    if ((svc_perm_connects(name, 0620, (uid_t)-1) != 0) ||
+        (svc_perm_connects(name, 0606, (uid_t)-1) != 0) ||
+        ((geteuid() == 0) && (svc_perm_connects(name, 0600, 1) != 0)))
+    {
+        fprintf(stderr, "Client connected to another user's memory\n");
+        goto end;
+    }
+    if (svc_perm_connects(name, 0600, geteuid()) != 1)
+    {
+        fprintf(stderr, "Client not connected to server\n");
+        goto end;
+    }
+    ret = 0;
+end:
+    RANDOM_SVC_server_free(srv);
+    return ret;
 }
 
-int test_random(int id, int flags, int speed)
+/*
+ * Test the random byte service: a server thread fills the rings of the
+ * clients of this process through shared memory.
+ * Checks that two clients get different data, that a client falls back to
+ * local generation without a server, that the child of a fork gets different
+ * data from its parent, that the server skips a corrupt slot and that a
+ * client won't use shared memory other users can write, then compares the
+ * rate of generation of a client with a local random object.
+ *
+ * @param [in] id  The random number generator algorithm identifier.
+ * @return  Non-zero when a check or generating fails.
+ */
+static int svc_test(int id)
 {
     int ret;
     RANDOM *random = NULL;
+    RANDOM_SVC_SERVER *srv = NULL;
+    RANDOM_SVC *svc[2] = { NULL, NULL };
+    pthread_t thread;
+    int started = 0;
+    char name[64];
+    uint8_t data[2][SVC_CMP_LEN];
+    uint64_t shared, local;
     int i;
+
+    ret = RANDOM_new_by_id(ENTROPY_METH_defaults, id, 0, &random);
+    if (ret == 0)
+        ret = RANDOM_init(random, NULL, 0);
+    if (ret != 0) goto end;
+
+    /* No server - all data is generated locally. */
+    snprintf(name, sizeof(name), "/t_random_svc_none_%d", (int)getpid());
+    ret = RANDOM_SVC_new(name, &svc[0]);
+    if (ret == 0)
+        ret = RANDOM_SVC_generate(svc[0], data[0], SVC_CMP_LEN);
+    if (ret == 0)
+        ret = RANDOM_SVC_get_bytes(svc[0], &shared, &local);
+    if (ret != 0) goto end;
+    if (RANDOM_SVC_is_shared(svc[0]) || (shared != 0) ||
+        (local != SVC_CMP_LEN))
+    {
+        fprintf(stderr, "Client without server not local\n");
+        ret = 1;
+        goto end;
+    }
+    ret = svc_fork_check(svc[0], NULL);
+    if (ret != 0) goto end;
+    RANDOM_SVC_free(svc[0]);
+    svc[0] = NULL;
+
+    snprintf(name, sizeof(name), "/t_random_svc_%d", (int)getpid());
+    ret = RANDOM_SVC_server_new(random, name, 0, 0, &srv);
+    if (ret != 0)
+    {
+        fprintf(stderr, "Failed to create server: %d\n", ret);
+        goto end;
+    }
+    svc_stop = 0;
+    if (pthread_create(&thread, NULL, svc_server, srv) != 0)
+    {
+        fprintf(stderr, "Failed to create server thread\n");
+        ret = 1;
+        goto end;
+    }
+    started = 1;
+
+    /* Two clients get different data. */
+    for (i=0; i<2; i++)
+    {
+        ret = RANDOM_SVC_new(name, &svc[i]);
+        if (ret != 0) goto end;
+        if (!RANDOM_SVC_is_shared(svc[i]))
+        {
+            fprintf(stderr, "Client not connected to server\n");
+            ret = 1;
+            goto end;
+        }
+    }
+    for (i=0; i<2; i++)
+    {
+        ret = RANDOM_SVC_generate(svc[i], data[i], SVC_CMP_LEN);
+        if (ret != 0) goto end;
+    }
+    if (memcmp(data[0], data[1], SVC_CMP_LEN) == 0)
+    {
+        fprintf(stderr, "Clients got the same data\n");
+        ret = 1;
+        goto end;
+    }
+    RANDOM_SVC_free(svc[1]);
+    svc[1] = NULL;
+
+    ret = svc_fork_check(svc[0], name);
+    if (ret == 0)
+        ret = svc_corrupt_check(random);
+    if (ret == 0)
+        ret = svc_perm_check(random);
+    if (ret != 0) goto end;
+
+    printf("%-10s %6s  %5s %9s %8s\n", "Client", "Op", "secs", "mB/s",
+        "shared");
+    for (i=0; i<(int)(sizeof(thread_olen)/sizeof(*thread_olen)); i++)
+    {
+        ret = svc_cycles(svc[0], NULL, thread_olen[i]);
+        if (ret != 0) goto end;
+    }
+    for (i=0; i<(int)(sizeof(thread_olen)/sizeof(*thread_olen)); i++)
+    {
+        ret = svc_cycles(NULL, random, thread_olen[i]);
+        if (ret != 0) goto end;
+    }
+end:
+    RANDOM_SVC_free(svc[0]);
+    RANDOM_SVC_free(svc[1]);
+    if (started)
+    {
+        svc_stop = 1;
+        pthread_join(thread, NULL);
+    }
+    RANDOM_SVC_server_free(srv);
+    RANDOM_free(random);
+    return ret;
+}
+
+/* The average count of each outcome in a uniformity check. */
+#define DIST_PER_CELL	200
+/* The standard normal quantile of the significance of a uniformity check -
+ * fails by chance with probability 1e-5. */
+#define DIST_Z		4.265
+
+/*
+ * Check that counts of outcomes are uniform with a chi-square test.
+ * The critical value is the Wilson-Hilferty approximation.
+ *
+ * @param [in] name   The name of the check.
+ * @param [in] count  The counts of each outcome.
+ * @param [in] cells  The number of outcomes.
+ * @param [in] num    The number of trials.
+ * @return  0 when uniform.
+ */
+static int dist_check(char *name, uint32_t *count, uint32_t cells,
+    uint32_t num)
+{
+    uint32_t i;
+    double e = (double)num / cells, d = cells - 1;
+    double chi = 0, crit;
+
+    for (i=0; i<cells; i++)
+        chi += (count[i] - e) * (count[i] - e) / e;
+    crit = 1 - 2 / (9 * d) + DIST_Z * sqrt(2 / (9 * d));
+    crit = d * crit * crit * crit;
+
+    printf("%-24s %7u cells  chi-square %10.1f  critical %10.1f  %s\n", name,
+        cells, chi, crit, (chi <= crit) ? "pass" : "FAIL");
+    return chi > crit;
+}
+
+/*
+ * Get the rank of a sequence of distinct values from [0, n) among all
+ * sequences of its length in lexicographic order.
+ *
+ * @param [in] v    The values.
+ * @param [in] len  The number of values.
+ * @param [in] n    The number of possible values.
+ * @return  The rank.
+ */
+static uint32_t dist_rank(uint32_t *v, uint32_t len, uint32_t n)
+{
+    uint32_t i, j, d, rank = 0;
+
+    for (i=0; i<len; i++)
+    {
+        /* Position of the value among those not used before. */
+        for (j=0, d=v[i]; j<i; j++)
+            d -= (v[j] < v[i]);
+        rank = rank * (n - i) + d;
+    }
+    return rank;
+}
+
+/* The number of random numbers in a distribution check - enough for the
+ * chi-square test to see the ziggurat's wedges accepting every point. */
+#define DIST_CONT_NUM	(1 << 24)
+/* The number of random numbers generated at a time in a distribution check. */
+#define DIST_CONT_CHUNK	65536
+/* The number of cells of equal probability in a distribution check. */
+#define DIST_CONT_CELLS	16384
+/* The number of cells of equal probability in the tail of a distribution. */
+#define DIST_TAIL_CELLS	8
+/* Where the ziggurat tails start - beyond the last layer. */
+#define DIST_NORM_TAIL	3.6541528853610088
+#define DIST_EXP_TAIL	7.69711747013104972
+
+/* A function of a random number of a distribution. */
+typedef double (DIST_FUNC)(double x);
+/* A function generating random numbers of a distribution. */
+typedef int (DIST_FILL)(RANDOM *random, double *r, uint32_t num);
+
+/* The cumulative distribution function of the standard normal. */
+static double dist_norm_cdf(double x)
+{
+    return 0.5 * erfc(-x / sqrt(2));
+}
+/* The probability of a standard normal further from 0 than x. */
+static double dist_norm_tail(double x)
+{
+    return erfc(fabs(x) / sqrt(2));
+}
+/* The cumulative distribution function of the standard exponential. */
+static double dist_exp_cdf(double x)
+{
+    return -expm1(-x);
+}
+/* The probability of a standard exponential larger than x. */
+static double dist_exp_tail(double x)
+{
+    return exp(-x);
+}
+
+/*
+ * Check that generated random numbers have a distribution.
+ * A chi-square test over cells of equal probability covers the whole range
+ * and a Kolmogorov-Smirnov test, at the cell boundaries, detects a shift of
+ * mass that is spread over many cells. The number beyond the start of the
+ * tail is checked against its expected count and a chi-square test over cells
+ * of equal probability within the tail checks its shape.
+ *
+ * @param [in]      random  The random object to generate with.
+ * @param [in]      name    The name of the distribution.
+ * @param [in]      fill    The function generating the random numbers.
+ * @param [in]      cdf     The cumulative distribution function.
+ * @param [in]      tail    The probability of being further into the tail
+ *                          than x.
+ * @param [in]      start   Where the tail starts.
+ * @param [in, out] fail    Set to 1 when a check fails.
+ * @return  Non-zero when generating fails.
+ */
+static int dist_cont_check(RANDOM *random, char *name, DIST_FILL *fill,
+    DIST_FUNC *cdf, DIST_FUNC *tail, double start, int *fail)
+{
+    int ret;
+    uint32_t i, j, c, n = 0;
+    uint32_t *count = NULL;
+    uint32_t tcount[DIST_TAIL_CELLS] = { 0 };
+    double *r = NULL;
+    double p = tail(start), e, z, t, d, crit;
+    char cname[32];
+
+    count = calloc(DIST_CONT_CELLS, sizeof(*count));
+    r = malloc(DIST_CONT_CHUNK * sizeof(*r));
+    if ((count == NULL) || (r == NULL))
+    {
+        ret = RANDOM_ERR_ALLOC;
+        goto end;
+    }
+    for (i=0; i<DIST_CONT_NUM; i+=DIST_CONT_CHUNK)
+    {
+        ret = fill(random, r, DIST_CONT_CHUNK);
+        if (ret != 0) goto end;
+        for (j=0; j<DIST_CONT_CHUNK; j++)
+        {
+            c = (uint32_t)(cdf(r[j]) * DIST_CONT_CELLS);
+            count[(c < DIST_CONT_CELLS) ? c : DIST_CONT_CELLS - 1]++;
+            t = tail(r[j]);
+            if (t < p)
+            {
+                tcount[(uint32_t)(t / p * DIST_TAIL_CELLS)]++;
+                n++;
+            }
+        }
+    }
+    *fail |= dist_check(name, count, DIST_CONT_CELLS, DIST_CONT_NUM);
+
+    e = (double)DIST_CONT_NUM * p;
+    z = (n - e) / sqrt(e * (1 - p));
+    snprintf(cname, sizeof(cname), "%s tail", name);
+    printf("%-24s %7u beyond %.3f  expected %10.1f  z %5.2f  %s\n", cname, n,
+        start, e, z, (fabs(z) <= DIST_Z) ? "pass" : "FAIL");
+    *fail |= fabs(z) > DIST_Z;
+    snprintf(cname, sizeof(cname), "%s tail shape", name);
+    *fail |= dist_check(cname, tcount, DIST_TAIL_CELLS, n);
+
+    /* Largest difference of the cumulative counts from the expected. */
+    for (i=0, n=0, d=0; i<DIST_CONT_CELLS; i++)
+    {
+        n += count[i];
+        e = (double)(i + 1) / DIST_CONT_CELLS;
+        if (fabs((double)n / DIST_CONT_NUM - e) > d)
+            d = fabs((double)n / DIST_CONT_NUM - e);
+    }
+    /* Asymptotic critical value at the significance of DIST_Z. */
+    crit = sqrt(-0.5 * log(0.5 * erfc(DIST_Z / sqrt(2))) / DIST_CONT_NUM);
+    snprintf(cname, sizeof(cname), "%s KS", name);
+    printf("%-24s %7u cells  D          %10.6f  critical %10.6f  %s\n", cname,
+        DIST_CONT_CELLS, d, crit, (d <= crit) ? "pass" : "FAIL");
+    *fail |= d > crit;
+end:
+    free(r);
+    free(count);
+    return ret;
+}
+
+/*
+ * Check that RANDOM_shuffle and RANDOM_sample_indices produce every
+ * permutation, and every ordered sample, equally often, and that
+ * RANDOM_fill_normal and RANDOM_fill_exponential have their distributions -
+ * including the mass and shape of the tails.
+ * Small arrays are used so that the bounds are batched into each word.
+ * The random object is initialized with fixed entropy so the check is
+ * repeatable.
+ *
+ * @return  0 on success.
+ */
+static int dist_test()
+{
+    int ret = 0;
+    int fail = 0;
+    RANDOM *random = NULL;
+    uint8_t ent[48] = "t_random shuffle and sample uniformity";
+    static const uint32_t shuffle_n[] = { 5, 7 };
+    static const uint32_t sample_n[] = { 8, 20 };
+    static const uint32_t sample_k[] = { 3, 3 };
+    uint32_t v[8];
+    uint32_t *count = NULL;
+    uint32_t i, j, t, cells, num;
+    char name[32];
+
+    ret = RANDOM_new_by_id(ENTROPY_METH_defaults, RANDOM_ID_HASH_DRBG_SHA256,
+        0, &random);
+    if (ret == 0)
+        ret = RANDOM_init_with_entropy(random, ent, sizeof(ent), NULL, 0);
+    if (ret != 0)
+    {
+        fprintf(stderr, "Failed to create random object: %d\n", ret);
+        goto end;
+    }
+
+    for (i=0; i<sizeof(shuffle_n)/sizeof(*shuffle_n); i++)
+    {
+        for (j=2, cells=1; j<=shuffle_n[i]; j++)
+            cells *= j;
+        num = cells * DIST_PER_CELL;
+        count = calloc(cells, sizeof(*count));
+        if (count == NULL)
+        {
+            ret = RANDOM_ERR_ALLOC;
+            goto end;
+        }
+        for (t=0; t<num; t++)
+        {
+            for (j=0; j<shuffle_n[i]; j++)
+                v[j] = j;
+            ret = RANDOM_shuffle(random, v, shuffle_n[i], sizeof(*v));
+            if (ret != 0) goto end;
+            count[dist_rank(v, shuffle_n[i], shuffle_n[i])]++;
+        }
+        snprintf(name, sizeof(name), "shuffle %u", shuffle_n[i]);
+        fail |= dist_check(name, count, cells, num);
+        free(count);
+        count = NULL;
+    }
+
+    for (i=0; i<sizeof(sample_n)/sizeof(*sample_n); i++)
+    {
+        for (j=0, cells=1; j<sample_k[i]; j++)
+            cells *= sample_n[i] - j;
+        num = cells * DIST_PER_CELL;
+        count = calloc(cells, sizeof(*count));
+        if (count == NULL)
+        {
+            ret = RANDOM_ERR_ALLOC;
+            goto end;
+        }
+        for (t=0; t<num; t++)
+        {
+            ret = RANDOM_sample_indices(random, sample_n[i], sample_k[i], v);
+            if (ret != 0) goto end;
+            count[dist_rank(v, sample_k[i], sample_n[i])]++;
+        }
+        snprintf(name, sizeof(name), "sample indices %u of %u", sample_k[i],
+            sample_n[i]);
+        fail |= dist_check(name, count, cells, num);
+        free(count);
+        count = NULL;
+    }
+
+    ret = dist_cont_check(random, "normal", RANDOM_fill_normal, dist_norm_cdf,
+        dist_norm_tail, DIST_NORM_TAIL, &fail);
+    if (ret == 0)
+    {
+        ret = dist_cont_check(random, "exponential", RANDOM_fill_exponential,
+            dist_exp_cdf, dist_exp_tail, DIST_EXP_TAIL, &fail);
+    }
+end:
+    free(count);
+    RANDOM_free(random);
+    return (ret != 0) ? ret : fail;
+}
+
+/* The security strengths to compare the fixed and tuned choices of. */
+static uint16_t tune_bits[] = { 128, 192, 256 };
+/* The lengths to compare the speed of the fixed and tuned choices with. */
+static int tune_olen[] = { 32, 16384 };
+
+/*
+ * Get the names of the fixed and tuned choices of implementation for each
+ * security strength.
+ *
+ * @param [out] names  The names - fixed then tuned for each strength.
+ * @param [out] rand   The random objects - fixed then tuned for each strength.
+ *                     May be NULL.
+ * @return  0 on success.
+ */
+static int tune_choose(char *names[], RANDOM *rand[])
+{
+    int ret = 0;
+    int i, j;
+    RANDOM *random;
+
+    for (i=0; i<(int)(sizeof(tune_bits)/sizeof(*tune_bits)); i++)
+    {
+        for (j=0; j<2; j++)
+        {
+            ret = RANDOM_new(ENTROPY_METH_defaults, tune_bits[i],
+                j ? RANDOM_METH_FLAG_TUNED : 0, &random);
+            if (ret == 0)
+                ret = RANDOM_get_impl_name(random, &names[i * 2 + j]);
+            if (ret != 0)
+            {
+                fprintf(stderr, "Failed to create random object: %d\n", ret);
+                goto end;
+            }
+            if (rand != NULL)
+                rand[i * 2 + j] = random;
+            else
+                RANDOM_free(random);
+        }
+    }
+end:
+    return ret;
+}
+
+/*
+ * Test choosing the implementation by measured throughput.
+ * Reports the time to measure and load a profile, the fixed and tuned choices
+ * for each strength and their speeds. Checks that a saved profile is loaded,
+ * gives the same choices, and that an invalid profile is measured again.
+ *
+ * @return  0 on success.
+ */
+static int tune_test()
+{
+    int ret;
+    int i, j;
+    char file[64];
+    char line[64];
+    char *names[6];
+    char *loaded[6];
+    RANDOM *rand[6] = { NULL };
+    FILE *f;
+    double start, measure, load;
+
+    snprintf(file, sizeof(file), "/tmp/t_random_tune_%d", (int)getpid());
+    remove(file);
+
+    /* No profile file - measured and saved. */
+    start = get_secs();
+    ret = RANDOM_tune(file);
+    measure = get_secs() - start;
+    if (ret != 0)
+    {
+        fprintf(stderr, "Failed to tune: %d\n", ret);
+        goto end;
+    }
+    ret = tune_choose(names, rand);
+    if (ret != 0) goto end;
+
+    /* Valid profile file - loaded with the same choices. */
+    start = get_secs();
+    ret = RANDOM_tune(file);
+    load = get_secs() - start;
+    if (ret == 0)
+        ret = tune_choose(loaded, NULL);
+    if (ret != 0) goto end;
+    printf("Tune: measure %.1f ms, load profile %.3f ms\n", measure * 1000,
+        load * 1000);
+    for (i=0; i<6; i++)
+    {
+        if (strcmp(names[i], loaded[i]) != 0)
+        {
+            fprintf(stderr, "Loaded profile chose %s not %s\n", loaded[i],
+                names[i]);
+            ret = 1;
+            goto end;
+        }
+    }
+
+    /* Invalid profile file - measured again and replaced. */
+    f = fopen(file, "w");
+    if (f != NULL)
+    {
+        fprintf(f, "not a profile\n");
+        fclose(f);
+    }
+    ret = RANDOM_tune(file);
+    if (ret != 0) goto end;
+    f = fopen(file, "r");
+    if ((f == NULL) || (fgets(line, sizeof(line), f) == NULL) ||
+        (strncmp(line, "random tune", 11) != 0))
+    {
+        fprintf(stderr, "Invalid profile not replaced\n");
+        ret = 1;
+    }
+    if (f != NULL)
+        fclose(f);
+    if (ret != 0) goto end;
+
+    for (i=0; i<(int)(sizeof(tune_bits)/sizeof(*tune_bits)); i++)
+    {
+        printf("%3d bits: fixed %s, tuned %s\n", tune_bits[i], names[i * 2],
+            names[i * 2 + 1]);
+        printf("%6s  %7s %5s  %7s %7s %8s %9s %8s\n", "Op", "ops", "secs",
+            "c/op", "ops/s", "c/B", "B/s", "mB/s");
+        for (j=0; j<2; j++)
+        {
+            printf("%s\n", j ? "tuned" : "fixed");
+            random_cycles(rand[i * 2 + j], out, tune_olen[0]);
+            random_cycles(rand[i * 2 + j], out, tune_olen[1]);
+        }
+    }
+end:
+    for (i=0; i<6; i++)
+        RANDOM_free(rand[i]);
+    remove(file);
+    return ret;
+}
+
+/*
+ * Print the statistics of a random object.
+ *
+ * @param [in] random  The random object.
+ */
+static void print_stats(RANDOM *random)
+{
+    RANDOM_STATS stats;
+    uint64_t cycles;
+
+    if (RANDOM_get_stats(random, &stats) != 0)
+        return;
+
+    printf("Stats: inits %"PRIu64", reseeds %"PRIu64" (auto %"PRIu64"), "
+        "generates %"PRIu64", bytes %"PRIu64", buffer fills %"PRIu64"\n",
+        stats.inits, stats.reseeds, stats.auto_reseeds, stats.generates,
+        stats.bytes, stats.buf_fills);
+    printf("       entropy bytes %"PRIu64", entropy failures %"PRIu64"\n",
+        stats.entropy_bytes, stats.entropy_fails);
+    cycles = stats.entropy_cycles + stats.df_cycles + stats.gen_cycles +
+        stats.update_cycles;
+    if (cycles > 0)
+    {
+        printf("       cycles: entropy %.1f%%, hash_df %.1f%%, "
+            "hashgen %.1f%%, update %.1f%%\n",
+            stats.entropy_cycles * 100.0 / cycles,
+            stats.df_cycles * 100.0 / cycles,
+            stats.gen_cycles * 100.0 / cycles,
+            stats.update_cycles * 100.0 / cycles);
+    }
+}
+
+int test_random(int id, int flags, int speed, int threads, int reseed)
+{
+    int ret;
+    RANDOM *random = NULL;
+    int i, j;
     uint8_t rand[T_RANDOM_LEN];
     char *name;
 
@@ -158,10 +1533,49 @@ int test_random(int id, int flags, int speed)
         goto end;
     }
 
-    if (speed)
+    if (speed == 5)
+    {
+        ret = svc_test(id);
+        goto end;
+    }
+    else if (speed == 4)
+    {
+        if (reseed > 0)
+            printf("Reseed every %d calls\n", reseed);
+        printf("%6s  %8s %9s %8s %8s %8s %8s %9s\n", "Op", "calls", "mean",
+            "p50", "p90", "p99", "p99.9", "max");
+        for (i=0; i<(int)(sizeof(olen)/sizeof(*olen)); i++)
+            latency_cycles(random, out, olen[i], reseed);
+        goto end;
+    }
+    else if (speed == 3)
+    {
+        printf("%-10s %6s  %3s %5s %9s %9s %9s %9s\n", "Mode", "Op", "thr",
+            "secs", "mB/s", "mB/s/thr", "min", "max");
+        for (i=0; i<THREAD_MODE_NUM; i++)
+        {
+            for (j=0; j<(int)(sizeof(thread_olen)/sizeof(*thread_olen)); j++)
+            {
+                ret = thread_cycles(id, i, thread_olen[j], threads);
+                if (ret != 0) goto end;
+            }
+        }
+        goto end;
+    }
+    else if (speed == 2)
+    {
+        printf("%6s  %10s %5s  %7s %11s\n", "Op", "nums", "secs", "c/num",
+            "nums/s");
+        for (i=0; i<11; i++)
+            uniform_cycles(random, i);
+        goto end;
+    }
+    else if (speed)
     {
         printf("%6s  %7s %5s  %7s %7s %8s %9s %8s\n", "Op", "ops", "secs",
             "c/op", "ops/s", "c/B", "B/s", "mB/s");
+        if (use_perf)
+            perf_print_header("B");
         for (i=0; i<(int)(sizeof(olen)/sizeof(*olen)); i++)
             random_cycles(random, out, olen[i]);
         goto end;
@@ -173,6 +1587,8 @@ int test_random(int id, int flags, int speed)
         fprintf(stderr, "\n");
     }
 end:
+    if (use_stats && (random != NULL))
+        print_stats(random);
     RANDOM_free(random);
     return ret;
 }
@@ -181,6 +1597,8 @@ int main(int argc, char *argv[])
 {
     int ret = 0;
     int speed = 1;
+    int threads = 1;
+    int reseed = 0;
     uint32_t which = 0;
     int8_t alg_id;
     uint8_t i;
@@ -192,6 +1610,36 @@ int main(int argc, char *argv[])
 
         if (strcmp(*argv, "-speed") == 0)
             speed = 1;
+        else if (strcmp(*argv, "-uniform") == 0)
+            speed = 2;
+        else if (strcmp(*argv, "-perf") == 0)
+            use_perf = 1;
+        else if (strcmp(*argv, "-stats") == 0)
+            use_stats = 1;
+        else if (strcmp(*argv, "-latency") == 0)
+            speed = 4;
+        else if (strcmp(*argv, "-svc") == 0)
+            speed = 5;
+        else if (strcmp(*argv, "-tune") == 0)
+            speed = 6;
+        else if (strcmp(*argv, "-dist") == 0)
+            speed = 7;
+        else if ((strcmp(*argv, "-reseed") == 0) && (argc > 1))
+        {
+            argc--; argv++;
+            reseed = atoi(*argv);
+        }
+        else if ((strcmp(*argv, "-threads") == 0) && (argc > 1))
+        {
+            argc--; argv++;
+            speed = 3;
+            threads = atoi(*argv);
+            if ((threads < 1) || (threads > THREAD_MAX))
+            {
+                fprintf(stderr, "Threads must be 1 to %d\n", THREAD_MAX);
+                return 1;
+            }
+        }
         else if (strcmp(*argv, "-sha1") == 0)
             alg_id = RANDOM_ID_HASH_DRBG_SHA1;
         else if (strcmp(*argv, "-sha224") == 0)
@@ -217,15 +1665,26 @@ int main(int argc, char *argv[])
         }
     }
 
-    if (speed)
+    if (speed && (speed != 7))
         calc_cps();
+    if (use_perf && (perf_open(&perf) == 0))
+        use_perf = 0;
 
-    for (i=0; i<NUM_ID; i++)
+    if (speed == 7)
+        ret = dist_test();
+    else if (speed == 6)
+        ret = tune_test();
+    else
     {
-        if ((which == 0) || (which & (1 << i)) != 0)
-            ret |= test_random(id[i], 0, speed);
+        for (i=0; i<NUM_ID; i++)
+        {
+            if ((which == 0) || (which & (1 << i)) != 0)
+                ret |= test_random(id[i], 0, speed, threads, reseed);
+        }
     }
 
+    if (use_perf)
+        perf_close(&perf);
     return ret != 0;
 }
 
@@ -0,0 +1,98 @@
+# Copyright (c) 2016 Sean Parkinson
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+
+# Generates the C table of Hash_DRBG known answer tests from a CAVP response
+# file (prediction resistance not enabled, with reseed).
+# The output is committed as test/hash_drbg_kat.h - regenerate with: make kat
+#
+#   ruby gen_test.rb Hash_DRBG.txt > hash_drbg_kat.h
+
+# Map of CAVP hash names to random number generator identifiers.
+IDS = {
+  "SHA-1" => "RANDOM_ID_HASH_DRBG_SHA1",
+  "SHA-224" => "RANDOM_ID_HASH_DRBG_SHA224",
+  "SHA-256" => "RANDOM_ID_HASH_DRBG_SHA256",
+  "SHA-384" => "RANDOM_ID_HASH_DRBG_SHA384",
+  "SHA-512" => "RANDOM_ID_HASH_DRBG_SHA512",
+  "SHA-512/224" => "RANDOM_ID_HASH_DRBG_SHA512_224",
+  "SHA-512/256" => "RANDOM_ID_HASH_DRBG_SHA512_256",
+}
+
+# The fields of a test case in the order of the C structure.
+FIELDS = [ "EntropyInput", "Nonce", "PersonalizationString",
+  "EntropyInputReseed", "AdditionalInputReseed", "AdditionalInput1",
+  "AdditionalInput2", "ReturnedBits" ]
+
+# Converts a hex string into a C string and length.
+def c_data(hex)
+  bytes = [hex].pack("H*").bytes
+  str = bytes.map { |b| "\\x%02x" % b }.join
+  lines = str.scan(/.{1,64}/).map { |l| "\"#{l}\"" }
+  lines = [ "\"\"" ] if lines.empty?
+  "#{lines.join("\n      ")}, #{bytes.length}"
+end
+
+if ARGV.length != 1
+  STDERR.puts "Usage: ruby gen_test.rb <Hash_DRBG.txt>"
+  exit 1
+end
+
+tests = []
+id = nil
+test = nil
+
+File.readlines(ARGV[0]).each do |line|
+  line = line.strip
+  if line =~ /^\[(SHA-[0-9\/]+)\]$/
+    id = IDS[$1]
+  elsif line =~ /^COUNT = /
+    test = { "id" => id }
+  elsif (test != nil) && (line =~ /^(\w+) =\s*([0-9a-fA-F]*)$/)
+    name, value = $1, $2
+    if name == "AdditionalInput"
+      name = test.has_key?("AdditionalInput1") ? "AdditionalInput2" :
+        "AdditionalInput1"
+    end
+    test[name] = value
+    if name == "ReturnedBits"
+      tests << test if test["id"] != nil
+      test = nil
+    end
+  end
+end
+
+puts "/* Generated by test/vectors/gen_test.rb from #{File.basename(ARGV[0])}"
+puts " * - do not edit."
+puts " */"
+puts
+puts "static HASH_DRBG_KAT hash_drbg_kat[] ="
+puts "{"
+tests.each do |t|
+  puts "    { #{t["id"]},"
+  FIELDS.each do |f|
+    puts "      #{c_data(t[f] || "")},"
+  end
+  puts "    },"
+end
+puts "};"
+puts
+puts "#define HASH_DRBG_KAT_NUM \\"
+puts "    ((int)(sizeof(hash_drbg_kat)/sizeof(*hash_drbg_kat)))"
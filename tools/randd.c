@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2016 Sean Parkinson (sparkinson@iprimus.com.au)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* The daemon of the random byte service - fills the shared memory rings of
+ * the clients on this host until interrupted or terminated.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+
+#include "random.h"
+#include "random_svc.h"
+
+/* Set by the signal handler to stop the server. */
+static volatile int stop;
+
+/*
+ * Stop the server on a signal.
+ *
+ * @param [in] sig  The signal number.
+ */
+static void stop_handler(int sig)
+{
+    (void)sig;
+    stop = 1;
+}
+
+int main(int argc, char *argv[])
+{
+    int ret;
+    int id = RANDOM_ID_HASH_DRBG_SHA512;
+    char *name = NULL;
+    uint32_t slots = 0;
+    uint32_t ring_size = 0;
+    RANDOM *random = NULL;
+    RANDOM_SVC_SERVER *srv = NULL;
+    struct sigaction sa;
+
+    while (--argc)
+    {
+        argv++;
+
+        if ((strcmp(*argv, "-name") == 0) && (argc > 1))
+        {
+            argc--; argv++;
+            name = *argv;
+        }
+        else if ((strcmp(*argv, "-slots") == 0) && (argc > 1))
+        {
+            argc--; argv++;
+            slots = atoi(*argv);
+        }
+        else if ((strcmp(*argv, "-ring") == 0) && (argc > 1))
+        {
+            argc--; argv++;
+            ring_size = atoi(*argv);
+        }
+        else if (strcmp(*argv, "-sha1") == 0)
+            id = RANDOM_ID_HASH_DRBG_SHA1;
+        else if (strcmp(*argv, "-sha224") == 0)
+            id = RANDOM_ID_HASH_DRBG_SHA224;
+        else if (strcmp(*argv, "-sha256") == 0)
+            id = RANDOM_ID_HASH_DRBG_SHA256;
+        else if (strcmp(*argv, "-sha384") == 0)
+            id = RANDOM_ID_HASH_DRBG_SHA384;
+        else if (strcmp(*argv, "-sha512") == 0)
+            id = RANDOM_ID_HASH_DRBG_SHA512;
+        else if (strcmp(*argv, "-sha512_224") == 0)
+            id = RANDOM_ID_HASH_DRBG_SHA512_224;
+        else if (strcmp(*argv, "-sha512_256") == 0)
+            id = RANDOM_ID_HASH_DRBG_SHA512_256;
+        else
+        {
+            fprintf(stderr, "Usage: randd [-name /shm] [-slots N] "
+                "[-ring bytes] [-sha1|-sha224|-sha256|-sha384|-sha512|"
+                "-sha512_224|-sha512_256]\n");
+            return 1;
+        }
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = stop_handler;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    ret = RANDOM_new_by_id(ENTROPY_METH_defaults, id, 0, &random);
+    if (ret == 0)
+        ret = RANDOM_init(random, "randd", 5);
+    if (ret != 0)
+    {
+        fprintf(stderr, "Failed to create random object: %d\n", ret);
+        goto end;
+    }
+
+    ret = RANDOM_SVC_server_new(random, name, slots, ring_size, &srv);
+    if (ret != 0)
+    {
+        fprintf(stderr, "Failed to create shared memory %s: %d\n",
+            (name != NULL) ? name : RANDOM_SVC_NAME, ret);
+        goto end;
+    }
+
+    ret = RANDOM_SVC_server_run(srv, &stop);
+    if (ret != 0)
+        fprintf(stderr, "Failed to fill rings: %d\n", ret);
+end:
+    RANDOM_SVC_server_free(srv);
+    RANDOM_free(random);
+    return ret != 0;
+}
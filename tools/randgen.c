@@ -0,0 +1,535 @@
+/*
+ * Copyright (c) 2016 Sean Parkinson (sparkinson@iprimus.com.au)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Writes random data to stdout or a file as fast as possible.
+ * Worker threads, each with its own random object, generate blocks into a
+ * ring of aligned buffers. The main thread writes the blocks in order:
+ * regular files are written with pwrite and anything else with write. With
+ * -vmsplice, pipes are given the buffer pages with vmsplice instead. This is
+ * only safe when the reader copies the data out with read(): a reader that
+ * splices the pages on, such as pv, still refers to them when the buffer is
+ * reused for a later block, corrupting the stream.
+ */
+
+#ifdef OS_LINUX
+#define _GNU_SOURCE
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#include "random.h"
+
+#ifdef CC_CLANG
+#define PRIu64 "llu"
+#else
+#define PRIu64 "lu"
+#endif
+
+/* The default size of a block generated by a thread in one go. */
+#define BLOCK_SIZE	(1 << 20)
+/* The smallest block size - the default size of a pipe. */
+#define BLOCK_MIN	(1 << 16)
+/* The largest block size - the most one generate call produces. */
+#define BLOCK_MAX	(1U << 30)
+/* The alignment of the block buffers - pages for vmsplice and O_DIRECT. */
+#define BLOCK_ALIGN	4096
+/* The maximum number of generating threads. */
+#define THREAD_MAX	256
+
+/* How the output is written. */
+#define OUT_WRITE	0
+#define OUT_PWRITE	1
+#define OUT_VMSPLICE	2
+
+/* A buffer in the ring of blocks. */
+typedef struct slot_st
+{
+    /* The number of the block the buffer is for next. */
+    uint64_t block;
+    /* Set when the block has been generated. */
+    int full;
+    /* The result of generating the block. */
+    int ret;
+    /* The buffer of the block. */
+    uint8_t *data;
+} SLOT;
+
+/* The ring of blocks shared by the generating threads and the writer. */
+static SLOT *slot;
+/* The number of buffers in the ring. */
+static uint32_t slots;
+/* The size of a block. */
+static uint32_t block_size;
+/* The number of blocks to generate - 0 for no limit. */
+static uint64_t blocks;
+/* The number of the next block to be generated. */
+static uint64_t next_block;
+/* Set when generating is to stop. */
+static int stop;
+/* Protects the ring of blocks. */
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+/* Signaled when a buffer is filled or emptied. */
+static pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+
+/* The data of a generating thread. */
+typedef struct thread_data_st
+{
+    /* The thread. */
+    pthread_t thread;
+    /* The random number generator algorithm identifier. */
+    int id;
+    /* The result of creating the random object. */
+    int ret;
+} THREAD_DATA;
+
+/*
+ * Get the current time in seconds.
+ *
+ * @return  The number of seconds.
+ */
+static double get_secs()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * Generate blocks into the ring in order until told to stop or all blocks
+ * are generated.
+ *
+ * @param [in] arg  The thread data.
+ * @return  NULL.
+ */
+static void *gen_thread(void *arg)
+{
+    THREAD_DATA *t = arg;
+    RANDOM *random = NULL;
+    SLOT *s;
+    uint64_t b;
+    int ret;
+
+    t->ret = RANDOM_new_by_id(ENTROPY_METH_defaults, t->id, 0, &random);
+    if (t->ret == 0)
+        t->ret = RANDOM_init(random, "randgen", 7);
+
+    pthread_mutex_lock(&lock);
+    if (t->ret != 0)
+    {
+        stop = 1;
+        pthread_cond_broadcast(&cond);
+    }
+    while (!stop && ((blocks == 0) || (next_block < blocks)))
+    {
+        b = next_block++;
+        s = &slot[b % slots];
+        while (!stop && (s->block != b))
+            pthread_cond_wait(&cond, &lock);
+        if (stop)
+            break;
+        pthread_mutex_unlock(&lock);
+
+        ret = RANDOM_generate(random, s->data, block_size);
+
+        pthread_mutex_lock(&lock);
+        s->ret = ret;
+        s->full = 1;
+        pthread_cond_broadcast(&cond);
+    }
+    pthread_mutex_unlock(&lock);
+
+    RANDOM_free(random);
+    return NULL;
+}
+
+/*
+ * Write all of a buffer to a pipe by giving it the pages with vmsplice.
+ * The pages must not be changed until the reader has consumed them.
+ *
+ * @param [in] fd    The file descriptor of the pipe.
+ * @param [in] data  The buffer.
+ * @param [in] len   The length of the buffer.
+ * @return  0 on success and -1 on error.
+ */
+static int out_vmsplice(int fd, uint8_t *data, size_t len)
+{
+    struct iovec iov;
+    ssize_t n;
+
+    while (len > 0)
+    {
+        iov.iov_base = data;
+        iov.iov_len = len;
+        n = vmsplice(fd, &iov, 1, 0);
+        if ((n == -1) && (errno == EINTR))
+            continue;
+        if (n <= 0)
+            return -1;
+        data += n;
+        len -= n;
+    }
+    return 0;
+}
+
+/*
+ * Write all of a buffer to a regular file at an offset.
+ *
+ * @param [in] fd    The file descriptor.
+ * @param [in] data  The buffer.
+ * @param [in] len   The length of the buffer.
+ * @param [in] off   The offset into the file.
+ * @return  0 on success and -1 on error.
+ */
+static int out_pwrite(int fd, uint8_t *data, size_t len, off_t off)
+{
+    ssize_t n;
+
+    while (len > 0)
+    {
+        n = pwrite(fd, data, len, off);
+        if ((n == -1) && (errno == EINTR))
+            continue;
+        if (n <= 0)
+            return -1;
+        data += n;
+        len -= n;
+        off += n;
+    }
+    return 0;
+}
+
+/*
+ * Write all of a buffer.
+ *
+ * @param [in] fd    The file descriptor.
+ * @param [in] data  The buffer.
+ * @param [in] len   The length of the buffer.
+ * @return  0 on success and -1 on error.
+ */
+static int out_write(int fd, uint8_t *data, size_t len)
+{
+    ssize_t n;
+
+    while (len > 0)
+    {
+        n = write(fd, data, len);
+        if ((n == -1) && (errno == EINTR))
+            continue;
+        if (n <= 0)
+            return -1;
+        data += n;
+        len -= n;
+    }
+    return 0;
+}
+
+/*
+ * Choose how to write to the output.
+ * A pipe is only given pages with vmsplice when asked for and it holds no more
+ * than a block: once a block is all in the pipe the previous block has been
+ * read and its buffer can be reused - as long as the reader copied it out.
+ *
+ * @param [in]  fd   The file descriptor of the output.
+ * @param [out] off  The offset to write a regular file from.
+ * @param [in]  vms  Whether to give a pipe the pages with vmsplice.
+ * @return  The output method: OUT_WRITE, OUT_PWRITE or OUT_VMSPLICE.
+ */
+static int out_method(int fd, off_t *off, int vms)
+{
+    struct stat st;
+#ifdef F_SETPIPE_SZ
+    int size;
+#endif
+
+    if (fstat(fd, &st) != 0)
+        return OUT_WRITE;
+    if (S_ISREG(st.st_mode))
+    {
+        *off = lseek(fd, 0, SEEK_CUR);
+        return (*off == -1) ? OUT_WRITE : OUT_PWRITE;
+    }
+#ifdef F_SETPIPE_SZ
+    if (vms && S_ISFIFO(st.st_mode))
+    {
+        fcntl(fd, F_SETPIPE_SZ, block_size);
+        size = fcntl(fd, F_GETPIPE_SZ);
+        if ((size > 0) && ((uint32_t)size <= block_size))
+            return OUT_VMSPLICE;
+    }
+#else
+    (void)vms;
+#endif
+    return OUT_WRITE;
+}
+
+/*
+ * Parse a size with an optional K, M or G suffix - powers of 1024.
+ *
+ * @param [in] str  The string to parse.
+ * @return  The size.
+ */
+static uint64_t parse_size(char *str)
+{
+    char *end;
+    uint64_t size = strtoull(str, &end, 10);
+
+    switch (*end)
+    {
+    case 'G': case 'g':
+        size <<= 10;
+        /* Fall through */
+    case 'M': case 'm':
+        size <<= 10;
+        /* Fall through */
+    case 'K': case 'k':
+        size <<= 10;
+        break;
+    }
+    return size;
+}
+
+int main(int argc, char *argv[])
+{
+    int ret = 0;
+    int id = RANDOM_ID_HASH_DRBG_SHA512;
+    int threads = 1;
+    int started = 0;
+    int vms = 0;
+    char *file = NULL;
+    uint64_t bytes = 0;
+    uint64_t done = 0, b;
+    int fd = STDOUT_FILENO;
+    int method;
+    off_t off = 0;
+    size_t len;
+    SLOT *s, *prev = NULL;
+    THREAD_DATA *t = NULL;
+    double start, secs;
+    uint32_t i;
+
+    block_size = BLOCK_SIZE;
+    while (--argc)
+    {
+        argv++;
+
+        if ((strcmp(*argv, "-bytes") == 0) && (argc > 1))
+        {
+            argc--; argv++;
+            bytes = parse_size(*argv);
+        }
+        else if ((strcmp(*argv, "-block") == 0) && (argc > 1))
+        {
+            argc--; argv++;
+            block_size = parse_size(*argv);
+        }
+        else if ((strcmp(*argv, "-threads") == 0) && (argc > 1))
+        {
+            argc--; argv++;
+            threads = atoi(*argv);
+        }
+        else if ((strcmp(*argv, "-o") == 0) && (argc > 1))
+        {
+            argc--; argv++;
+            file = *argv;
+        }
+        else if (strcmp(*argv, "-vmsplice") == 0)
+            vms = 1;
+        else if (strcmp(*argv, "-sha1") == 0)
+            id = RANDOM_ID_HASH_DRBG_SHA1;
+        else if (strcmp(*argv, "-sha224") == 0)
+            id = RANDOM_ID_HASH_DRBG_SHA224;
+        else if (strcmp(*argv, "-sha256") == 0)
+            id = RANDOM_ID_HASH_DRBG_SHA256;
+        else if (strcmp(*argv, "-sha384") == 0)
+            id = RANDOM_ID_HASH_DRBG_SHA384;
+        else if (strcmp(*argv, "-sha512") == 0)
+            id = RANDOM_ID_HASH_DRBG_SHA512;
+        else if (strcmp(*argv, "-sha512_224") == 0)
+            id = RANDOM_ID_HASH_DRBG_SHA512_224;
+        else if (strcmp(*argv, "-sha512_256") == 0)
+            id = RANDOM_ID_HASH_DRBG_SHA512_256;
+        else
+        {
+            fprintf(stderr, "Usage: randgen [-bytes N[K|M|G]] "
+                "[-block N[K|M|G]] [-threads N] [-o file] [-vmsplice] "
+                "[-sha1|-sha224|-sha256|-sha384|-sha512|-sha512_224|"
+                "-sha512_256]\n");
+            return 1;
+        }
+    }
+    if ((threads < 1) || (threads > THREAD_MAX))
+    {
+        fprintf(stderr, "Threads must be 1 to %d\n", THREAD_MAX);
+        return 1;
+    }
+    if ((block_size < BLOCK_MIN) || (block_size > BLOCK_MAX) ||
+        ((block_size & (block_size - 1)) != 0))
+    {
+        fprintf(stderr, "Block size must be a power of 2 from %d to %u\n",
+            BLOCK_MIN, BLOCK_MAX);
+        return 1;
+    }
+    blocks = (bytes + block_size - 1) / block_size;
+
+    if (file != NULL)
+    {
+        fd = open(file, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd == -1)
+        {
+            fprintf(stderr, "Failed to open %s: %s\n", file, strerror(errno));
+            return 1;
+        }
+    }
+    method = out_method(fd, &off, vms);
+    /* A closed pipe is an error on write rather than a signal. */
+    signal(SIGPIPE, SIG_IGN);
+
+    /* Each thread can be generating while the writer holds two blocks. */
+    slots = 2 * threads + 2;
+    slot = calloc(slots, sizeof(*slot));
+    t = calloc(threads, sizeof(*t));
+    if ((slot == NULL) || (t == NULL))
+    {
+        fprintf(stderr, "Failed to allocate memory\n");
+        ret = 1;
+        goto end;
+    }
+    for (i=0; i<slots; i++)
+    {
+        slot[i].block = i;
+        slot[i].data = aligned_alloc(BLOCK_ALIGN, block_size);
+        if (slot[i].data == NULL)
+        {
+            fprintf(stderr, "Failed to allocate memory\n");
+            ret = 1;
+            goto end;
+        }
+    }
+
+    start = get_secs();
+    for (; started<threads; started++)
+    {
+        t[started].id = id;
+        if (pthread_create(&t[started].thread, NULL, gen_thread,
+            &t[started]) != 0)
+        {
+            fprintf(stderr, "Failed to create thread %d\n", started);
+            ret = 1;
+            goto end;
+        }
+    }
+
+    for (b=0; (blocks == 0) || (b < blocks); b++)
+    {
+        s = &slot[b % slots];
+        pthread_mutex_lock(&lock);
+        while (!stop && ((s->block != b) || !s->full))
+            pthread_cond_wait(&cond, &lock);
+        pthread_mutex_unlock(&lock);
+        if (stop || (s->ret != 0))
+        {
+            if (s->ret != 0)
+                fprintf(stderr, "Failed to generate: %d\n", s->ret);
+            ret = 1;
+            break;
+        }
+
+        len = block_size;
+        if ((bytes > 0) && (bytes - done < len))
+            len = bytes - done;
+        if (method == OUT_VMSPLICE)
+            ret = out_vmsplice(fd, s->data, len);
+        else if (method == OUT_PWRITE)
+            ret = out_pwrite(fd, s->data, len, off + done);
+        else
+            ret = out_write(fd, s->data, len);
+        if (ret != 0)
+        {
+            /* The reader going away ends an unlimited stream. */
+            if ((errno != EPIPE) || (bytes > 0))
+                fprintf(stderr, "Failed to write: %s\n", strerror(errno));
+            else
+                ret = 0;
+            break;
+        }
+        done += len;
+
+        /* The pipe holds at most a block so the pages of the previous block
+         * have been read. */
+        pthread_mutex_lock(&lock);
+        if (method == OUT_VMSPLICE)
+        {
+            if (prev != NULL)
+            {
+                prev->full = 0;
+                prev->block += slots;
+            }
+            prev = s;
+        }
+        else
+        {
+            s->full = 0;
+            s->block += slots;
+        }
+        pthread_cond_broadcast(&cond);
+        pthread_mutex_unlock(&lock);
+    }
+    secs = get_secs() - start;
+
+    fprintf(stderr, "randgen: %"PRIu64" bytes in %.3f secs: %.3f GB/s\n",
+        done, secs, secs > 0 ? done / secs / 1e9 : 0);
+end:
+    pthread_mutex_lock(&lock);
+    stop = 1;
+    pthread_cond_broadcast(&cond);
+    pthread_mutex_unlock(&lock);
+    for (i=0; i<(uint32_t)started; i++)
+    {
+        pthread_join(t[i].thread, NULL);
+        if (t[i].ret != 0)
+        {
+            fprintf(stderr, "Failed to create random object: %d\n", t[i].ret);
+            ret = 1;
+        }
+    }
+    if (slot != NULL)
+    {
+        for (i=0; i<slots; i++)
+            free(slot[i].data);
+    }
+    free(slot);
+    free(t);
+    if (fd != STDOUT_FILENO)
+        close(fd);
+    return ret != 0;
+}